@@ -2,6 +2,7 @@
 #ifndef CONSTANTS_H
 #define CONSTANTS_H
 
+#include <cstdint>
 #include <string>
 #include <SDL3/SDL.h>
 
@@ -22,6 +23,7 @@ namespace Constants {
     constexpr float VEHICLE_LENGTH = 12.0f;
     constexpr float VEHICLE_WIDTH = 6.0f;
     constexpr float VEHICLE_GAP = 15.0f;
+    constexpr float QUEUE_SPACING = 50.0f; // Stop-line spacing per queue slot
     constexpr float TURN_DURATION = 1500.0f;
     constexpr float BEZIER_CONTROL_OFFSET = 80.0f;
     constexpr float TURN_SPEED = 0.0008f;
@@ -33,11 +35,81 @@ namespace Constants {
 
     // Queue settings
     constexpr int MAX_QUEUE_SIZE = 100;
+    constexpr int MAX_VEHICLES_PER_LANE = 12; // Admission cap per lane queue
 
     // Priority settings
     constexpr int PRIORITY_THRESHOLD_HIGH = 10; // Enter priority mode when > 10 vehicles
     constexpr int PRIORITY_THRESHOLD_LOW = 5;   // Exit priority mode when < 5 vehicles
 
+    // Lane topology. The junction is fixed at 4 roads x 3 lanes, so
+    // lane identity is compile-time data: a (road, laneNumber) pair maps
+    // to a slot index with pure arithmetic, names are pre-spelled, and
+    // turn legality is a table lookup instead of re-derived branching.
+    constexpr int ROAD_COUNT = 4;
+    constexpr int LANES_PER_ROAD = 3;
+    constexpr int LANE_SLOT_COUNT = ROAD_COUNT * LANES_PER_ROAD;
+
+    constexpr bool laneSlotValid(char laneId, int laneNumber) {
+        return laneId >= 'A' && laneId <= 'D' &&
+               laneNumber >= 1 && laneNumber <= LANES_PER_ROAD;
+    }
+
+    // Slot index in spawn order (A1=0 .. D3=11); callers validate first
+    constexpr int laneSlot(char laneId, int laneNumber) {
+        return (laneId - 'A') * LANES_PER_ROAD + (laneNumber - 1);
+    }
+
+    // Pre-spelled lane names, indexed by laneSlot()
+    inline const std::string LANE_NAMES[LANE_SLOT_COUNT] = {
+        "A1", "A2", "A3", "B1", "B2", "B3",
+        "C1", "C2", "C3", "D1", "D2", "D3"
+    };
+
+    // Legal destinations per slot, as a bitmask over the Destination
+    // enum. Lane 1 is the incoming lane (nothing spawns there), lane 2
+    // goes straight or left, lane 3 is the free lane and always turns
+    // left - the rules processVehicles() and the generator both assume.
+    constexpr uint8_t TURN_STRAIGHT = 1 << 0;
+    constexpr uint8_t TURN_LEFT = 1 << 1;
+    constexpr uint8_t TURN_RIGHT = 1 << 2;
+
+    constexpr uint8_t LANE_LEGAL_TURNS[LANE_SLOT_COUNT] = {
+        0, TURN_STRAIGHT | TURN_LEFT, TURN_LEFT,  // A1 A2 A3
+        0, TURN_STRAIGHT | TURN_LEFT, TURN_LEFT,  // B1 B2 B3
+        0, TURN_STRAIGHT | TURN_LEFT, TURN_LEFT,  // C1 C2 C3
+        0, TURN_STRAIGHT | TURN_LEFT, TURN_LEFT   // D1 D2 D3
+    };
+
+    // True for lanes vehicles may spawn into (lane 1 is incoming only)
+    constexpr bool laneSpawnable(int laneNumber) {
+        return laneNumber == 2 || laneNumber == LANES_PER_ROAD;
+    }
+
+    // Movement-conflict geometry. Roads sit at fixed compass points
+    // (A north, B east, C south, D west in index order), so the
+    // opposing approach is always index ^ 2. Opposing flows run on
+    // separate halves of the carriageway and their governed movements
+    // (straight/left per LANE_LEGAL_TURNS) never cross; every other
+    // pairing shares the intersection box. Compile-time so the light's
+    // composite phases are validated against the geometry statically.
+    constexpr bool movementsConflict(int roadA, int roadB) {
+        return roadA != roadB && (roadA ^ 2) != roadB;
+    }
+
+    // True when every pair of roads in mask (bit r = road r green) is
+    // mutually conflict-free - the admission test for a composite phase
+    constexpr bool isCompatibleGreenMask(unsigned roadMask) {
+        for (int a = 0; a < ROAD_COUNT; a++) {
+            for (int b = a + 1; b < ROAD_COUNT; b++) {
+                if (((roadMask >> a) & 1) && ((roadMask >> b) & 1) &&
+                    movementsConflict(a, b)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
     // File paths
     const std::string DATA_PATH = "data/lanes";
     const std::string LOG_FILE = "traffic_simulator.log";
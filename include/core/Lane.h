@@ -4,8 +4,15 @@
 
 #include <vector>
 #include <string>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
 #include "core/Vehicle.h"
 #include "utils/Queue.h"
+#include "utils/WaitHistogram.h"
+
+class TrafficLight;
 
 class Lane {
 public:
@@ -14,11 +21,38 @@ public:
 
     // Queue operations
     void enqueue(Vehicle* vehicle);
+
+    // Admission-capped enqueue: refuses (returning false, queue
+    // untouched) once the lane holds maxCount vehicles. The cap check
+    // and insert are atomic, replacing the old trim-after-the-fact
+    // sweep in TrafficManager::limitVehiclesPerLane().
+    bool tryEnqueue(Vehicle* vehicle, int maxCount);
+
+    // Batch admission: admit the batch front in order under one queue
+    // lock acquisition (stopping at maxCount), with bookkeeping folded
+    // over the batch the way removeExited() folds exits - one hash
+    // index pass, one count push to the light, one priority check.
+    // Returns the number admitted; the caller owns the rejected tail.
+    size_t tryEnqueueBulk(const std::vector<Vehicle*>& batch, int maxCount);
+
     Vehicle* dequeue();
     Vehicle* peek() const;
     bool isEmpty() const;
     int getVehicleCount() const;
 
+    // Id-keyed operations backed by the hash index: membership is O(1),
+    // and removal only walks the queue when the id is actually present
+    bool contains(uint32_t vehicleId) const;
+    Vehicle* removeVehicle(uint32_t vehicleId);
+
+    // Batch-compact every exited vehicle out of the queue in one stable
+    // sweep, appending them to `exited` in queue order. Bookkeeping
+    // (hash index, count observer, emergency index, wait histogram,
+    // priority) updates once per batch instead of once per vehicle, so
+    // a green-light exit burst costs one pass. Returns the number
+    // removed; the caller owns returning the vehicles to the pool.
+    size_t removeExited(std::vector<Vehicle*>& exited);
+
     // Priority related operations
     int getPriority() const;
     void updatePriority();
@@ -27,10 +61,70 @@ public:
     // Lane identification
     char getLaneId() const;
     int getLaneNumber() const;
-    std::string getName() const;
+    const std::string& getName() const;
+
+    // Visit every queued vehicle in order under the queue lock - the
+    // callable inlines and nothing is copied out. This replaces the old
+    // getVehicles() reference-into-the-live-queue accessor, which could
+    // dangle when another thread mutated the lane mid-iteration.
+    template<typename Visitor>
+    void forEachVehicle(Visitor&& visit) const {
+        vehicleQueue.forEach(std::forward<Visitor>(visit));
+    }
+
+    // Ranged variant: visit queue positions [start, count) only. The
+    // update LOD sweeps from the end of the dormant segment.
+    template<typename Visitor>
+    void forEachVehicleFrom(size_t start, Visitor&& visit) const {
+        vehicleQueue.forEachFrom(start, std::forward<Visitor>(visit));
+    }
+
+    // Update LOD (see TrafficManager::processLane): number of vehicles
+    // in the settled front segment under a red light. Parked vehicles
+    // have nothing to compute, so the sweep starts past them; any
+    // operation that shifts queue positions (dequeue, pull-forward,
+    // exit compaction) wakes the whole segment by resetting the count.
+    // Simulation thread only.
+    size_t getDormantCount() const { return dormantCount; }
+    void setDormantCount(size_t count) { dormantCount = count; }
+
+    // Bulk snapshot into a caller-owned (reusable) buffer, for passes
+    // that need random access after the lock is released
+    void copyVehicles(std::vector<Vehicle*>& out) const;
+
+    // RCU-style snapshot for the render thread. The simulation thread
+    // publishes an immutable copy once per tick (and only when the queue
+    // actually changed); the renderer grabs it wait-free and keeps it
+    // alive through the shared_ptr while drawing, so render never holds
+    // the queue mutex and never races processVehicles().
+    void publishRenderSnapshot();
+    std::shared_ptr<const std::vector<Vehicle*>> getRenderSnapshot() const;
+
+    // Traffic light that receives this lane's count deltas (each
+    // junction wires its own light to its own lanes)
+    void setCountObserver(TrafficLight* light);
 
-    // For iteration through vehicles 
-    const std::vector<Vehicle*>& getVehicles() const;
+    // Wait-time distribution for this lane, fed O(1) on every dequeue
+    // (simulation thread only; see WaitHistogram)
+    const WaitHistogram& getWaitHistogram() const;
+
+    // Emergency vehicles currently queued here, maintained O(1) at
+    // enqueue/dequeue/removeVehicle - never derived by scanning
+    int getEmergencyCount() const;
+
+    // Bytes backing this lane's ring (memory telemetry)
+    size_t getQueueStorageBytes() const;
+
+    // Rebuild the spacing ladder if the count changed; call once before
+    // a sweep that reads queueOffset() (simulation thread only). Split
+    // from queueOffset() so the per-slot read never takes the queue
+    // lock and stays safe inside forEachVehicle().
+    void warmQueueLadder();
+
+    // Stop-line offset for the given queue slot, read from a ladder
+    // precomputed per count change instead of re-deriving the spacing
+    // arithmetic inside every vehicle's update (simulation thread only)
+    float queueOffset(int queuePos) const;
 
 private:
     char laneId;               // A, B, C, or D
@@ -38,6 +132,40 @@ private:
     bool isPriority;           // Is this a priority lane (AL2)
     int priority;              // Current priority (higher means served first) FIFO
     Queue<Vehicle*> vehicleQueue; // Queue for vehicles in the lane
+
+    // Bookkeeping shared by enqueue()/tryEnqueue() after a successful
+    // queue insert: index, ladder, observer deltas, priority check
+    void afterEnqueue(Vehicle* vehicle);
+
+    // id -> vehicle hash index, kept in lockstep with the queue by
+    // enqueue()/dequeue()/removeVehicle()
+    std::unordered_map<uint32_t, Vehicle*> vehicleIndex;
+    mutable std::mutex indexMutex;
+
+    // Receives count deltas on enqueue/dequeue (may be null before the
+    // junction finishes wiring up)
+    TrafficLight* countObserver;
+
+    // Last published immutable snapshot (swapped atomically) and the
+    // queue version it was built from
+    std::shared_ptr<const std::vector<Vehicle*>> renderSnapshot;
+    uint64_t publishedVersion;
+
+    // Distribution of time spent queued in this lane (HDR buckets)
+    WaitHistogram waitHistogram;
+
+    // Emergency vehicles in the queue right now; every change is pushed
+    // to the count observer so the light's preemption index stays O(1)
+    int emergencyCount;
+
+    // Queue spacing ladder (queueOffset); rebuilt lazily after any
+    // count change, read once per queued vehicle per tick
+    std::vector<float> queueOffsetLadder;
+    bool queueLadderDirty;
+
+    // Settled front-segment length for the update LOD (see
+    // getDormantCount); reset wherever queue positions shift
+    size_t dormantCount;
 };
 
 #endif // LANE_H
@@ -0,0 +1,168 @@
+// FILE: include/core/LightControlPolicy.h
+#ifndef LIGHT_CONTROL_POLICY_H
+#define LIGHT_CONTROL_POLICY_H
+
+#include <algorithm>
+#include "core/TrafficLight.h"
+#include "utils/TuningConfig.h"
+
+// Phase policies for the traffic light's normal-mode cycling, as CRTP
+// templates. A policy answers two questions: which green phase follows
+// the one just served, and how long a green phase runs. Everything
+// above that - the ALL_RED interlock between greens, emergency
+// preemption, A2 priority mode, the event-driven wakeup - is shared
+// machinery in TrafficLight::update() and identical under every policy,
+// so controller comparisons measure the decision rule and nothing else.
+//
+// The policy is selected once at startup (TRAFFIC_LIGHT_POLICY, see the
+// TrafficLight constructor) and dispatched through one switch per
+// transition to a concrete advanceNormalPhase<Policy> instantiation.
+// Each instantiation inlines its policy's statics, so the tick path has
+// no virtual calls and the decision itself compiles down to a handful
+// of loads and compares.
+
+// The observables a policy decides on: pushed lane-2 queue depths, one
+// per road (A = index 0). Snapshotted from the atomics once per
+// evaluation so a policy sees one coherent set of counts.
+struct LightPolicyContext {
+    int lane2Counts[4];
+};
+
+template <typename Derived>
+struct LightControlPolicy {
+    // Service window shared by every adaptive duration formula: short
+    // enough that no road waits out a pathological green, long enough
+    // that a phase clears more than a car or two
+    static constexpr int MIN_GREEN_MS = 3000;
+    static constexpr int MAX_GREEN_MS = 15000;
+
+    static int clampGreen(int ms) {
+        return std::max(MIN_GREEN_MS, std::min(ms, MAX_GREEN_MS));
+    }
+
+    // Sum of the queue depths on the roads a phase greens
+    static int servedCount(TrafficLight::State phase,
+                           const LightPolicyContext& ctx) {
+        uint8_t mask = TrafficLight::greenRoadMask(phase);
+        int total = 0;
+        for (int road = 0; road < 4; road++) {
+            if (mask & (1 << road)) {
+                total += ctx.lane2Counts[road];
+            }
+        }
+        return total;
+    }
+
+    // Default rotation: alternate the opposing composites. Single-road
+    // phases (left over from priority mode, preemption or a restored
+    // snapshot) rejoin at the crossing composite.
+    static TrafficLight::State nextGreen(TrafficLight::State previousGreen,
+                                         const LightPolicyContext&) {
+        switch (previousGreen) {
+            case TrafficLight::State::AC_GREEN: return TrafficLight::State::BD_GREEN;
+            case TrafficLight::State::BD_GREEN: return TrafficLight::State::AC_GREEN;
+            case TrafficLight::State::A_GREEN:
+            case TrafficLight::State::C_GREEN:  return TrafficLight::State::BD_GREEN;
+            case TrafficLight::State::B_GREEN:
+            case TrafficLight::State::D_GREEN:  return TrafficLight::State::AC_GREEN;
+            default:                            return TrafficLight::State::AC_GREEN;
+        }
+    }
+};
+
+// The shipped controller: composite rotation with green time
+// proportional to the average lane-2 depth (Total time = |V| * t, t
+// tunable through green_ms_per_vehicle).
+struct AdaptiveRotationPolicy : LightControlPolicy<AdaptiveRotationPolicy> {
+    static int greenDurationMs(TrafficLight::State,
+                               const LightPolicyContext& ctx) {
+        int total = 0;
+        for (int road = 0; road < 4; road++) {
+            total += ctx.lane2Counts[road];
+        }
+        float average = std::max(1.0f, static_cast<float>(total) / 4.0f);
+        return clampGreen(
+            static_cast<int>(average * TuningConfig::getGreenMsPerVehicle()));
+    }
+};
+
+// Fixed-cycle baseline: the composite rotation with a constant green,
+// blind to demand. The control group for evaluating the adaptive
+// policies under an identical load profile.
+struct FixedCyclePolicy : LightControlPolicy<FixedCyclePolicy> {
+    static constexpr int GREEN_MS = 8000;
+
+    static int greenDurationMs(TrafficLight::State,
+                               const LightPolicyContext&) {
+        return GREEN_MS;
+    }
+};
+
+// Longest-queue-first: each green goes to the single road with the
+// deepest lane-2 queue, for a duration proportional to that queue. Ties
+// prefer a road other than the one just served, so equal queues
+// round-robin instead of starving three roads.
+struct LongestQueueFirstPolicy : LightControlPolicy<LongestQueueFirstPolicy> {
+    static TrafficLight::State nextGreen(TrafficLight::State previousGreen,
+                                         const LightPolicyContext& ctx) {
+        uint8_t previousMask = TrafficLight::greenRoadMask(previousGreen);
+        int best = 0;
+        for (int road = 1; road < 4; road++) {
+            bool deeper = ctx.lane2Counts[road] > ctx.lane2Counts[best];
+            bool tiebreak = ctx.lane2Counts[road] == ctx.lane2Counts[best] &&
+                            (previousMask & (1 << best)) != 0;
+            if (deeper || tiebreak) {
+                best = road;
+            }
+        }
+        return static_cast<TrafficLight::State>(best + 1);
+    }
+
+    static int greenDurationMs(TrafficLight::State phase,
+                               const LightPolicyContext& ctx) {
+        return clampGreen(servedCount(phase, ctx) *
+                          TuningConfig::getGreenMsPerVehicle());
+    }
+};
+
+// Conflict-matrix compositor: enumerate the phases, score each by the
+// total depth its road mask serves, and run the highest-scoring one.
+// Every candidate's mask is validated conflict-free against the
+// junction geometry at compile time (see the static_asserts in
+// TrafficLight.h), so at this symmetric junction the composites
+// dominate their halves and the single-road phases only matter as
+// tie-break fodder - but the scoring generalizes unchanged to a
+// geometry where some composite is illegal.
+struct ConflictCompositorPolicy : LightControlPolicy<ConflictCompositorPolicy> {
+    static TrafficLight::State nextGreen(TrafficLight::State previousGreen,
+                                         const LightPolicyContext& ctx) {
+        static constexpr TrafficLight::State CANDIDATES[] = {
+            TrafficLight::State::AC_GREEN, TrafficLight::State::BD_GREEN,
+            TrafficLight::State::A_GREEN,  TrafficLight::State::B_GREEN,
+            TrafficLight::State::C_GREEN,  TrafficLight::State::D_GREEN,
+        };
+
+        TrafficLight::State best = CANDIDATES[0];
+        int bestScore = -1;
+        for (TrafficLight::State candidate : CANDIDATES) {
+            int score = servedCount(candidate, ctx);
+            // Strictly-better wins; on a tie the phase we did not just
+            // serve wins, so an idle junction still alternates
+            if (score > bestScore ||
+                (score == bestScore && best == previousGreen &&
+                 candidate != previousGreen)) {
+                best = candidate;
+                bestScore = score;
+            }
+        }
+        return best;
+    }
+
+    static int greenDurationMs(TrafficLight::State phase,
+                               const LightPolicyContext& ctx) {
+        return clampGreen(servedCount(phase, ctx) *
+                          TuningConfig::getGreenMsPerVehicle());
+    }
+};
+
+#endif // LIGHT_CONTROL_POLICY_H
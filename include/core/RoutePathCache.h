@@ -0,0 +1,32 @@
+// FILE: include/core/RoutePathCache.h
+#ifndef ROUTE_PATH_CACHE_H
+#define ROUTE_PATH_CACHE_H
+
+#include <vector>
+#include "core/Vehicle.h"
+
+// A shared immutable cache of the waypoint routes through the junction.
+// A vehicle's path is fully determined by (lane char, laneNumber,
+// destination) - at most 36 distinct routes - yet every spawn used to
+// build its own std::vector<Point>. Vehicles now hold a pointer into
+// this table, so spawning allocates nothing for waypoints and lookups
+// stay cache-resident.
+class RoutePathCache {
+public:
+    // Get the route for a spawn configuration; builds and caches it on
+    // first use. The returned reference stays valid for the whole run.
+    static const std::vector<Point>& getRoute(char lane, int laneNumber,
+                                              Destination destination);
+
+    static constexpr int ROUTE_SLOTS = 4 * 3 * 3; // road x laneNumber x destination
+
+private:
+    // Map a spawn configuration to its table slot
+    static int slotIndex(char lane, int laneNumber, Destination destination);
+
+    // Build the waypoint list (moved from Vehicle::initializeWaypoints)
+    static std::vector<Point> buildRoute(char lane, int laneNumber,
+                                         Destination destination);
+};
+
+#endif // ROUTE_PATH_CACHE_H
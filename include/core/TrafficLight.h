@@ -2,10 +2,12 @@
 #ifndef TRAFFIC_LIGHT_H
 #define TRAFFIC_LIGHT_H
 
+#include <atomic>
 #include <cstdint>
 #include <vector>
 #include <string>
 #include <SDL3/SDL.h>
+#include "core/Constants.h"
 #include "core/Lane.h"
 
 class TrafficLight {
@@ -15,15 +17,56 @@ public:
         A_GREEN = 1,
         B_GREEN = 2,
         C_GREEN = 3,
-        D_GREEN = 4
+        D_GREEN = 4,
+        // Composite phases: opposing approaches green together. The
+        // normal rotation runs on these; the single-road states remain
+        // for priority mode and emergency preemption, where exactly one
+        // corridor must own the junction.
+        AC_GREEN = 5,
+        BD_GREEN = 6
+    };
+
+    // Which roads the given phase greens, one bit per road (A = bit 0).
+    // Consumers derive per-lane green from this mask instead of
+    // switching over states, so new phases never touch vehicle logic.
+    static constexpr uint8_t greenRoadMask(State state) {
+        switch (state) {
+            case State::A_GREEN:  return 1 << 0;
+            case State::B_GREEN:  return 1 << 1;
+            case State::C_GREEN:  return 1 << 2;
+            case State::D_GREEN:  return 1 << 3;
+            case State::AC_GREEN: return (1 << 0) | (1 << 2);
+            case State::BD_GREEN: return (1 << 1) | (1 << 3);
+            default:              return 0;
+        }
+    }
+
+    // Normal-mode phase policy, selected once at startup from the
+    // TRAFFIC_LIGHT_POLICY environment variable ("fixed", "lqf",
+    // "compositor"; unset or anything else = the adaptive rotation).
+    // The policies themselves are CRTP templates in
+    // LightControlPolicy.h; this enum only routes the per-transition
+    // dispatch to the right instantiation.
+    enum class ControlPolicy {
+        ADAPTIVE_ROTATION,
+        FIXED_CYCLE,
+        LONGEST_QUEUE_FIRST,
+        CONFLICT_COMPOSITOR
     };
 
     TrafficLight();
     ~TrafficLight();
 
+    ControlPolicy getControlPolicy() const { return controlPolicy; }
+
     // Updates the traffic light state based on lane priorities
     void update(const std::vector<Lane*>& lanes);
 
+    // Same state machine, but driven by a caller-supplied clock instead
+    // of SDL_GetTicks(). Time-compressed runs pass their logical clock
+    // here so light timing scales with the simulation, not wall time.
+    void update(const std::vector<Lane*>& lanes, uint32_t currentTime);
+
     // Renders the traffic lights
     void render(SDL_Renderer* renderer);
 
@@ -36,9 +79,25 @@ public:
     // Sets the next traffic light state
     void setNextState(State state);
 
+    // Snapshot restore: put the machine directly into the given phase
+    // and wake it immediately so it reschedules from restored lane counts
+    void restoreState(State state);
+
     // Checks if the specific lane gets green light
     bool isGreen(char lane) const;
 
+    // Incremental lane-count delta, pushed from Lane::enqueue()/dequeue()
+    // (via the lane's count observer) so update() never has to scan the
+    // lanes. Only lane 2 counts feed the timing formula; other lanes are
+    // ignored.
+    void onLaneCountChanged(char laneId, int laneNumber, int count);
+
+    // Emergency-count delta (+1/-1), pushed from the lanes the moment an
+    // emergency vehicle enters or leaves a queue. Maintains the per-road
+    // preemption index and wakes the state machine, so an ambulance is
+    // detected on the very next tick with zero scanning.
+    void onEmergencyCountChanged(char laneId, int delta);
+
 private:
     State currentState;
     State nextState;
@@ -49,14 +108,36 @@ private:
     // Last state change time in milliseconds
     uint32_t lastStateChangeTime;
 
+    // Next scheduled transition; update() returns immediately before
+    // this deadline unless a lane-count delta has arrived
+    uint32_t nextWakeTime;
+
+    // Per-road lane 2 vehicle counts, maintained by onLaneCountChanged().
+    // Per-instance so every junction's light sees only its own lanes.
+    std::atomic<int> lane2Counts[4];
+    std::atomic<bool> countsDirty;
+
+    // Per-road emergency vehicle counts (the preemption index),
+    // maintained by onEmergencyCountChanged(). Any road with a non-zero
+    // entry outranks both priority mode and the normal rotation.
+    std::atomic<int> emergencyCounts[4];
+
+    // Road currently holding an emergency green (-1 when none)
+    int preemptedRoad;
+
     // Priority mode flags
     bool isPriorityMode;
     bool shouldResumeNormalMode;
     bool forceAGreen;
     uint32_t priorityModeStartTime;
 
-    // Helper function to calculate average vehicle count
-    float calculateAverageVehicleCount(const std::vector<Lane*>& lanes);
+    ControlPolicy controlPolicy;
+
+    // Normal-mode cycling with the phase decision delegated to a
+    // policy's statics (see LightControlPolicy.h); instantiated once
+    // per policy, dispatched from update() by the enum above
+    template <typename Policy>
+    void advanceNormalPhase(uint32_t currentTime, uint32_t elapsedTime);
 
     // Modern UI drawing functions
     void drawTrafficControlCenter(SDL_Renderer* renderer);
@@ -64,7 +145,30 @@ private:
     void drawStateTimer(SDL_Renderer* renderer);
     void drawHolographicLight(SDL_Renderer* renderer, int x, int y, int size, bool isActive);
     void drawPanelText(SDL_Renderer* renderer, const char* text, int x, int y);
-    void drawPanelChar(SDL_Renderer* renderer, char c, int x, int y);
+
+    // Cached control-center panel: the panel and timer are dozens of
+    // primitive calls for content keyed only by the light state, the
+    // priority flash phase and the timer readout, so they are redrawn
+    // into a render-target texture when that key changes and blitted
+    // otherwise (see renderControlPanel)
+    void renderControlPanel(SDL_Renderer* renderer);
+
+    // The state duration the timer display assumes (shared by the draw
+    // and the cache key)
+    int displayedStateDurationMs() const;
+
+    SDL_Texture* panelTexture;
+    uint64_t panelCacheKey;
 };
 
+// Every phase the machine can enter must green only mutually
+// conflict-free roads, checked against the junction geometry at
+// compile time (see Constants::movementsConflict)
+static_assert(Constants::isCompatibleGreenMask(
+                  TrafficLight::greenRoadMask(TrafficLight::State::AC_GREEN)),
+              "AC_GREEN composites conflicting movements");
+static_assert(Constants::isCompatibleGreenMask(
+                  TrafficLight::greenRoadMask(TrafficLight::State::BD_GREEN)),
+              "BD_GREEN composites conflicting movements");
+
 #endif // TRAFFIC_LIGHT_H
@@ -0,0 +1,42 @@
+// FILE: include/core/TurnCurveCache.h
+#ifndef TURN_CURVE_CACHE_H
+#define TURN_CURVE_CACHE_H
+
+#include <vector>
+#include "core/Vehicle.h"
+
+// Precomputed eased-bezier turn curves. Vehicle::calculateTurnPath()
+// used to evaluate the quadratic bezier (plus easing) per vehicle per
+// frame - roughly 90 evaluations over a TURN_DURATION turn - even
+// though the control points are fixed by the junction geometry. The
+// curves are instead quantized into small tables once, with the
+// ease-in-out pacing baked into the sample spacing, so sampling a turn
+// position is two table loads and a lerp.
+class TurnCurveCache {
+public:
+    // Table resolution per curve; 64 eased samples keeps the worst-case
+    // lerp error well under a pixel at this junction's turn radii
+    static constexpr int SAMPLES = 64;
+
+    // Get the sampled curve for a turning spawn configuration; builds
+    // and caches it on first use (same pattern as RoutePathCache). The
+    // returned reference stays valid for the whole run. Configurations
+    // that never turn get an empty curve.
+    static const std::vector<Point>& getCurve(char lane, int laneNumber,
+                                              Destination destination);
+
+    // Sample a cached curve at progress in [0, 1]
+    static Point sample(const std::vector<Point>& curve, float progress);
+
+    static constexpr int CURVE_SLOTS = 4 * 3 * 3; // road x laneNumber x destination
+
+private:
+    // Map a spawn configuration to its table slot
+    static int slotIndex(char lane, int laneNumber, Destination destination);
+
+    // Quantize the eased bezier through the turn legs of the cached route
+    static std::vector<Point> buildCurve(char lane, int laneNumber,
+                                         Destination destination);
+};
+
+#endif // TURN_CURVE_CACHE_H
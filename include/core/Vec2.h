@@ -0,0 +1,67 @@
+// FILE: include/core/Vec2.h
+#ifndef VEC2_H
+#define VEC2_H
+
+#include <cmath>
+#include <cstddef>
+
+// The single 2-D math type and its helpers. The tree used to carry two
+// disjoint types - Point, defined inline in Vehicle.h for waypoints,
+// and an orphaned Vector2D under src/common with partial operators - so
+// every site respelled the dx/dy arithmetic longhand. Point lives here
+// now, together with the scalar helpers and batch forms the path
+// builders sample from. The batch forms are deliberately plain indexed
+// loops over contiguous floats so the compiler auto-vectorizes them;
+// the movement kernel keeps its explicit SSE path for per-tick motion,
+// these cover curve building and interpolation.
+
+// Point structure for waypoints vector (8-byte aligned so waypoint
+// arrays tile evenly into vector registers)
+struct alignas(8) Point {
+    float x;
+    float y;
+};
+
+// Linear interpolation between two points at parameter t in [0, 1]
+inline Point pointLerp(const Point& a, const Point& b, float t) {
+    return {a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t};
+}
+
+// Euclidean distance between two points
+inline float pointDistance(const Point& a, const Point& b) {
+    float dx = b.x - a.x;
+    float dy = b.y - a.y;
+    return std::sqrt(dx * dx + dy * dy);
+}
+
+// Quadratic bezier through (start, control, end) at parameter t
+inline Point bezierQuad(const Point& start, const Point& control,
+                        const Point& end, float t) {
+    float u = 1.0f - t;
+    return {u * u * start.x + 2.0f * u * t * control.x + t * t * end.x,
+            u * u * start.y + 2.0f * u * t * control.y + t * t * end.y};
+}
+
+// Batch lerp over parallel spans: out[i] = a[i] + (b[i] - a[i]) * t
+inline void lerpSpan(const Point* a, const Point* b, float t,
+                     Point* out, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        out[i].x = a[i].x + (b[i].x - a[i].x) * t;
+        out[i].y = a[i].y + (b[i].y - a[i].y) * t;
+    }
+}
+
+// Batch quadratic bezier: evaluate one curve at every parameter in ts.
+// This is how the turn-curve tables are quantized at build time.
+inline void bezierQuadSpan(const Point& start, const Point& control,
+                           const Point& end, const float* ts,
+                           Point* out, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        float t = ts[i];
+        float u = 1.0f - t;
+        out[i].x = u * u * start.x + 2.0f * u * t * control.x + t * t * end.x;
+        out[i].y = u * u * start.y + 2.0f * u * t * control.y + t * t * end.y;
+    }
+}
+
+#endif // VEC2_H
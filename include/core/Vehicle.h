@@ -1,48 +1,63 @@
-// FILE: include/c// FILE: include/core/Vehicle.h
+// FILE: include/core/Vehicle.h
 #ifndef VEHICLE_H
 #define VEHICLE_H
 
 #include <string>
+#include <cstdint>
 #include <SDL3/SDL.h>
 #include <ctime>
+#include <limits>
 #include <vector>
 #include <sstream>
+#include "core/Vec2.h"
 #include "utils/DebugLogger.h"
+#include "utils/StateSnapshot.h"
 
-// Define all enums here instead of just forward declaring them
-enum class Destination {
+class GeometryBatch;
+class VehicleSpriteAtlas;
+class MovementKernel;
+
+// Define all enums here instead of just forward declaring them.
+// Byte-wide: each lives in the packed Vehicle core below.
+enum class Destination : uint8_t {
     STRAIGHT,
     LEFT,
     RIGHT
 };
 
-enum class Direction {
+enum class Direction : uint8_t {
     UP,
     DOWN,
     LEFT,
     RIGHT
 };
 
-enum class VehicleState {
+enum class VehicleState : uint8_t {
     APPROACHING,
     IN_INTERSECTION,
     EXITING,
     EXITED
 };
 
-// Point structure for waypoints vector
-struct Point {
-    float x;
-    float y;
+// Cached movement classification derived from (turning, route
+// position). It migrates only at the transition points - route attach,
+// waypoint crossings, snapshot restore - so the per-tick lane sweep
+// dispatches each vehicle on one predictable byte instead of
+// re-deriving the state/turning/destination megaswitch per element.
+enum class MoveBucket : uint8_t {
+    CRUISE, // Straight mid-route: kernel-eligible while the lane moves
+    TURN,   // Bezier turn phase: the scalar update() owns it
+    EDGE    // Final route segment: exit checks stay scalar
 };
 
 class Vehicle {
 public:
-    Vehicle(const std::string& id, char lane, int laneNumber, bool isEmergency = false);
+    Vehicle(uint32_t id, char lane, int laneNumber, bool isEmergency = false);
     ~Vehicle();
 
     // Getters and setters
-    std::string getId() const;
+    uint32_t getId() const;
+    const std::string& getLabel() const; // Display label (see VehicleIdRegistry)
     char getLane() const;
     void setLane(char lane);
     int getLaneNumber() const;
@@ -66,36 +81,157 @@ public:
     float getTurnPosY() const;
     void setTurnPosY(float y);
 
-    // Update vehicle position
-    void update(uint32_t delta, bool isGreenLight, float targetPos);
+    // Read-only screen position (SoA-backed; the renderer's dirty-region
+    // tracker derives bounding boxes from these)
+    float getPosX() const;
+    float getPosY() const;
+
+    // Update vehicle position. maxAdvance caps this tick's displacement
+    // (the manager's gap-propagation pass derives it from the vehicle
+    // ahead in the queue); the default leaves the step unconstrained.
+    void update(uint32_t delta, bool isGreenLight, float targetPos,
+                float maxAdvance = std::numeric_limits<float>::max());
+
+    // Batched fast path for CRUISE-bucket vehicles in a movable lane
+    // (the caller dispatches on moveBucket() and the lane's movable
+    // bit): queue the straight move into the kernel and return true,
+    // or false when the positional hand-off check keeps it scalar.
+    // The step actually granted (speed clamped by maxAdvance) comes
+    // back through plannedStep so the caller can chain the follower.
+    bool queueStraightMove(MovementKernel& kernel, uint32_t delta,
+                           float maxAdvance, float& plannedStep);
+
+    // True while the vehicle is still on the straight approach segment
+    // (waypoints 0..1, not yet turning) - the only phase the manager's
+    // gap-propagation pass chains, since animPos tracks the lane axis
+    // there
+    bool onApproach() const { return !turning && currentWaypoint <= 1; }
+
+    // Sign of animPos travel on the approach: +1 when the lane axis
+    // coordinate grows toward the junction (southbound/eastbound)
+    float approachSign() const {
+        return (currentDirection == Direction::DOWN ||
+                currentDirection == Direction::RIGHT) ? 1.0f : -1.0f;
+    }
+
+    // Current movement bucket (see MoveBucket)
+    MoveBucket moveBucket() const { return bucket; }
+
+    // Intersection reservation handshake (see IntersectionReservations):
+    // an approaching vehicle must claim its box slots once before it
+    // may cross the stop line; the flag clears when the route reattaches
+    bool needsBoxReservation() const {
+        return !boxReserved && currentWaypoint <= 1;
+    }
+    void setBoxReserved(bool reserved) { boxReserved = reserved; }
+
+    // Time-compressed update: cover the same distance update() would
+    // over `delta` milliseconds, but by teleporting along the route
+    // polyline segment by segment instead of interpolating per frame.
+    // Waypoint hand-offs (turn entry, exit lane switches) still fire in
+    // order; only the smooth animation in between is skipped.
+    void fastForward(uint32_t delta, bool isGreenLight);
 
-    // Render vehicle
-    void render(SDL_Renderer* renderer, SDL_Texture* vehicleTexture, int queuePos);
+    // Push this vehicle's quads/triangles into the frame's geometry
+    // batch; the renderer submits the whole vehicle layer in one
+    // SDL_RenderGeometry call (see GeometryBatch)
+    void render(GeometryBatch& batch, int queuePos);
 
-    // Calculate turn path
-    void calculateTurnPath(float startX, float startY, float controlX, float controlY,
-                          float endX, float endY, float progress);
+    // Sprite path: one rotated atlas quad instead of ~15 primitives
+    // (see VehicleSpriteAtlas); used when the atlas baked successfully
+    void renderSprite(VehicleSpriteAtlas& atlas, int queuePos);
+
+    // Place the vehicle on its precomputed turn curve at the given
+    // progress (two table loads and a lerp; see TurnCurveCache)
+    void calculateTurnPath(float progress);
 
     // Initialize waypoints for movement path
     void initializeWaypoints();
 
+    // Closed-loop recycling (see TrafficManager::setVehicleRecycling):
+    // put an EXITED vehicle back at a spawn edge as if freshly
+    // constructed, reusing its pool slot and state-store slot
+    void resetForReentry(char newLane, int newLaneNumber);
+
     // Check if vehicle has exited the screen
     bool hasExited() const { return state == VehicleState::EXITED; }
 
+    // Culling support: true when the vehicle lies outside the window
+    // grown by margin pixels in every direction
+    bool isOffscreen(float margin) const;
+
+    // True when the vehicle sits off-screen on its road's spawn side.
+    // Queue order runs from the intersection outward, so everything
+    // after the first such vehicle is even deeper - the renderer stops
+    // walking the lane there instead of processing the whole queue.
+    bool isBeyondSpawnEdge(float margin) const;
+
+    // Queue slot used for spacing; normally stored by render(), but
+    // culled vehicles need it kept current too
+    void setQueuePos(int pos) { queuePos = static_cast<int16_t>(pos); }
+
+    // True when the vehicle has come to rest at its red-light stop
+    // offset (the same resting condition update()'s anti-jitter
+    // threshold produces): update() would not move it again until the
+    // light or its queue slot changes, which is what lets the lane
+    // sweep park it in the dormant segment (see
+    // TrafficManager::processLane)
+    bool isParkedAt(float targetPos) const;
+
+    // State snapshotting (see utils/StateSnapshot.h): capture fills the
+    // fixed-width record; restore is called on a freshly acquired
+    // vehicle and overwrites route progress and kinematics
+    void captureSnapshot(VehicleSnapshot& out) const;
+    void restoreSnapshot(const VehicleSnapshot& in);
+
+    // Spawn-latency stamps, set by the ingestion path (FileHandler) and
+    // consumed once at TrafficManager::addVehicle(). Truncated monotonic
+    // microsecond readings: interval math is done mod 2^32, which holds
+    // for any latency under ~71 minutes. 0 = unstamped (in-process
+    // spawns, or records from a generator without the stamp). Stored in
+    // the VehicleStateStore cold arrays, not the packed core below.
+    void setSpawnStamps(uint32_t createdUs, uint32_t pickedUpUs);
+    uint32_t getSpawnCreatedUs() const;
+    uint32_t getSpawnPickedUpUs() const;
+
 private:
-    std::string id;
+    // Packed hot core, 48 bytes: word-wide fields first, then the two
+    // shared route pointers, then the byte-wide flags and enums. Cold
+    // data lives externally - the label text in the VehicleIdRegistry,
+    // the kinematics in the VehicleStateStore SoA arrays, the route
+    // geometry in the RoutePathCache - so processVehicles() streams
+    // three dense cache lines per four vehicles instead of one sparse
+    // heap object each.
+
+    // Interned id; the textual label lives in the VehicleIdRegistry and
+    // is only fetched for log output
+    uint32_t id;
+
+    // Spawn time in whole seconds since the epoch; wait measurement is
+    // second-granularity, so a full time_t is wasted width
+    uint32_t arrivalTime;
+
+    // Slot handle into the VehicleStateStore SoA arrays
+    uint32_t stateSlot;
+
+    // Index into the shared route polyline (routes are a handful of
+    // points)
+    uint32_t currentWaypoint;
+
+    // Waypoints for movement: points into the shared immutable
+    // RoutePathCache table (one route per lane/laneNumber/destination),
+    // so spawning a vehicle allocates no waypoint storage
+    const std::vector<Point>* routePath;
+
+    // Precomputed eased-bezier curve for this route's turn phase
+    // (shared through TurnCurveCache; empty for non-turning routes)
+    const std::vector<Point>* turnCurve;
+
     char lane;
-    int laneNumber;
+    int8_t laneNumber;
     bool isEmergency;
-    time_t arrivalTime;
-
-    // Animation properties
-    float animPos;
     bool turning;
-    float turnProgress;
-    float turnPosX;
-    float turnPosY;
-    int queuePos; // Position in the queue for proper spacing between cars
+    bool boxReserved; // Holds an intersection-box reservation
 
     // Destination (where the vehicle is heading)
     Destination destination;
@@ -106,15 +242,39 @@ private:
     // Vehicle state
     VehicleState state;
 
-    // Waypoints for movement
-    std::vector<Point> waypoints;
-    size_t currentWaypoint;
+    // Cached (turning, route position) classification; see MoveBucket
+    MoveBucket bucket;
+
+    int16_t queuePos; // Position in the queue for proper spacing between cars
+
+    // Convenience accessor for the shared route
+    const std::vector<Point>& route() const { return *routePath; }
+
+    // Bookkeeping for crossing into the next waypoint: turn entry, exit
+    // detection and the lane reassignment rules (shared by update() and
+    // fastForward())
+    void advanceWaypoint();
+
+    // Re-derive the movement bucket after a transition (the only
+    // places turning or the route position change)
+    void reclassifyBucket();
+
+    // Spawn placement shared by the constructor and resetForReentry():
+    // heading, edge position and destination for (lane, laneNumber),
+    // ending with the route attach
+    void initializeSpawnState();
 
-    // Helper methods
-    float easeInOutQuad(float t) const;
+    // Accessors into the SoA state store (lvalues, usable on both sides)
+    float& posX() const;
+    float& posY() const;
+    float& animPosRef() const;
+    float& turnProgressRef() const;
 
-    // Helper for drawing triangles (SDL3 compatible)
-    void SDL_RenderFillTriangleF(SDL_Renderer* renderer, float x1, float y1, float x2, float y2, float x3, float y3);
+    // Presentation position: the store's snapshot-interpolated arrays
+    // when tick publishing is on, the live position otherwise. All
+    // drawing, culling and dirty-region reads go through these.
+    float renderPosX() const;
+    float renderPosY() const;
 };
 
 #endif // VEHICLE_H
@@ -0,0 +1,118 @@
+// FILE: include/core/VehicleStateStore.h
+#ifndef VEHICLE_STATE_STORE_H
+#define VEHICLE_STATE_STORE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <mutex>
+
+#include "utils/HugePageArena.h"
+
+// Structure-of-arrays storage for the per-vehicle fields touched every
+// update tick (position, animation progress). Vehicles used to carry
+// these as scattered heap members, making the per-tick sweep in
+// TrafficManager::processVehicles() a pointer-chasing cache-miss chain
+// at high vehicle counts. Each Vehicle now holds a slot index into
+// these parallel arrays; batch kernels can walk the raw arrays
+// linearly (and later with SIMD) without touching Vehicle objects.
+class VehicleStateStore {
+public:
+    // Claim a slot (fields are zeroed); called from the Vehicle constructor
+    static uint32_t acquire();
+
+    // Return a slot for reuse; called from the Vehicle destructor
+    static void release(uint32_t slot);
+
+    // A vehicle teleported back to a spawn edge in place (closed-loop
+    // recycling): bump the slot's epoch so the render blend snaps
+    // instead of interpolating across the screen
+    static void noteRespawn(uint32_t slot);
+
+    // Per-slot accessors (returned references are valid until the store
+    // grows, so don't cache them across acquire() calls)
+    static float& x(uint32_t slot)            { return xs[slot]; }
+    static float& y(uint32_t slot)            { return ys[slot]; }
+    static float& animPos(uint32_t slot)      { return animPositions[slot]; }
+    static float& turnProgress(uint32_t slot) { return turnProgresses[slot]; }
+
+    // Cold spawn-latency stamps (see Vehicle::setSpawnStamps): written
+    // once at ingestion and read once at enqueue, so they live here as
+    // parallel arrays the per-tick sweep never touches rather than
+    // growing the packed Vehicle core
+    static uint32_t& spawnCreatedUs(uint32_t slot)  { return spawnCreated[slot]; }
+    static uint32_t& spawnPickedUpUs(uint32_t slot) { return spawnPicked[slot]; }
+
+    // Raw arrays for linear batch sweeps
+    static float* xData()            { return xs.data(); }
+    static float* yData()            { return ys.data(); }
+    static float* animPosData()      { return animPositions.data(); }
+    static float* turnProgressData() { return turnProgresses.data(); }
+
+    // Slots currently in use (for diagnostics)
+    static size_t activeCount();
+
+    // --- Snapshot interpolation for the render thread ---
+    // The simulation thread publishes the position arrays after every
+    // tick (double-buffered); the render thread blends the two newest
+    // publishes by wall-clock alpha and draws from the blended arrays.
+    // Presentation stays smooth at display rate while the simulation
+    // ticks at half of it, at the cost of one tick of visual latency.
+    // Left disabled (headless runs, benchmarks) the render accessors
+    // read the live arrays and publishTick() is a no-op.
+    static void enableTickPublish(); // Call before the threads start
+    static void publishTick(uint32_t nowMs);   // Sim thread, end of tick
+    static void blendForRender(uint32_t nowMs); // Render thread, per frame
+    static float renderX(uint32_t slot) {
+        return publishEnabled ? renderXs[slot] : xs[slot];
+    }
+    static float renderY(uint32_t slot) {
+        return publishEnabled ? renderYs[slot] : ys[slot];
+    }
+
+private:
+    static constexpr size_t INITIAL_CAPACITY = 4096;
+
+    // The parallel arrays live in the huge-page arena: the per-tick
+    // sweeps walk them end to end, so 2MB pages keep the walk on a
+    // handful of TLB entries (the free list stays on the heap - it
+    // churns, and the bump arena never reclaims)
+    using FloatArray = std::vector<float, ArenaStlAllocator<float>>;
+    using IndexArray = std::vector<uint32_t, ArenaStlAllocator<uint32_t>>;
+
+    // Grow all arrays together (rare; guarded by storeMutex)
+    static void grow();
+
+    static FloatArray xs;
+    static FloatArray ys;
+    static FloatArray animPositions;
+    static FloatArray turnProgresses;
+    static IndexArray spawnCreated;
+    static IndexArray spawnPicked;
+
+    static std::vector<uint32_t> freeSlots;
+    static size_t highWater;   // First never-used slot
+    static size_t active;
+    static std::mutex storeMutex;
+
+    // One published tick: positions plus per-slot reuse epochs (so a
+    // slot recycled between ticks snaps to its new vehicle instead of
+    // sweeping across the screen) and the wall-clock stamp the blend
+    // derives its alpha from
+    struct TickBuffer {
+        std::vector<float> xs;
+        std::vector<float> ys;
+        std::vector<uint32_t> epochs;
+        uint32_t stampMs = 0;
+    };
+
+    static bool publishEnabled; // Set once at startup, before the threads
+    static TickBuffer tickBuffers[2];
+    static int newestBuffer;
+    static std::mutex publishMutex; // Buffer flip vs. the render blend
+    static std::vector<uint32_t> slotEpochs; // Bumped by acquire()
+    static std::vector<float> renderXs; // Blended output (render thread only)
+    static std::vector<float> renderYs;
+};
+
+#endif // VEHICLE_STATE_STORE_H
@@ -0,0 +1,87 @@
+// FILE: include/managers/CorridorLink.h
+#ifndef CORRIDOR_LINK_H
+#define CORRIDOR_LINK_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "utils/SpscRing.h"
+
+// A process boundary in the middle of a JunctionGraph corridor. City-
+// scale runs need more junctions than one process's cores can step, so
+// the corridor is cut into slices and each slice runs in its own
+// process (or on its own host); a CorridorLink is the TCP connection
+// between two adjacent slices. Vehicles that exit a slice's boundary
+// junction are batched for one tick and sent as a single serialized
+// frame; vehicles received from the peer are queued for admission at
+// the next tick. The link is bidirectional - eastbound and westbound
+// traffic share the one socket - and which end dials is just a startup
+// convention (listen() on the west boundary, connect() on the east).
+//
+// Like the in-process mailboxes, the link never blocks the tick: a full
+// inbound ring or a dead socket drops handoffs and counts them.
+class CorridorLink {
+public:
+    // What crosses the process boundary per vehicle. The label travels
+    // in full because vehicle ids are interned per process and mean
+    // nothing to the peer.
+    struct WireHandoff {
+        char label[16];
+        uint8_t emergency;
+    };
+
+    CorridorLink();
+    ~CorridorLink();
+
+    CorridorLink(const CorridorLink&) = delete;
+    CorridorLink& operator=(const CorridorLink&) = delete;
+
+    // Wait for the neighboring slice to dial in on the given port
+    bool listen(uint16_t port);
+
+    // Dial a neighboring slice, retrying briefly so start order between
+    // the processes doesn't matter
+    bool connect(const std::string& host, uint16_t port);
+
+    // Queue a vehicle for the next outbound frame. Only the worker
+    // stepping the boundary junction calls this (single producer).
+    void queueHandoff(const std::string& label, bool emergency);
+
+    // Send everything queued since the last flush as one frame. Called
+    // by the tick driver after the worker barrier.
+    void flush();
+
+    // Pop one vehicle received from the peer; false when drained
+    bool popInbound(WireHandoff& handoff);
+
+    void stop();
+
+    bool isConnected() const;
+
+    // Handoffs lost to a full inbound ring or a dead peer
+    uint64_t getDroppedHandoffs() const;
+
+private:
+    static constexpr size_t INBOUND_CAPACITY = 1024;
+
+    // Reads frames off the socket and feeds the inbound ring
+    void receiveLoop();
+
+    bool sendAll(const uint8_t* data, size_t length);
+    bool recvAll(uint8_t* data, size_t length);
+
+    int socketFd;
+    int listenFd;
+    std::thread receiverThread;
+    std::atomic<bool> running{false};
+    std::atomic<bool> connected{false};
+
+    std::vector<WireHandoff> outbound; // This tick's batch
+    SpscRing<WireHandoff, INBOUND_CAPACITY> inbound;
+    std::atomic<uint64_t> droppedHandoffs{0};
+};
+
+#endif // CORRIDOR_LINK_H
@@ -2,10 +2,18 @@
 #ifndef FILE_HANDLER_H
 #define FILE_HANDLER_H
 
+#include <atomic>
+#include <cstdint>
+#include <ios>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <vector>
 #include <mutex>
+#include <SDL3/SDL_asyncio.h>
 #include "core/Vehicle.h"
+#include "utils/LaneExchange.h"
+#include "utils/SharedMemoryChannel.h"
 
 class FileHandler {
 public:
@@ -15,30 +23,209 @@ public:
     // Read vehicles from lane files
     std::vector<Vehicle*> readVehiclesFromFiles();
 
-    // Write lane status to file (for debugging/monitoring)
-    void writeLaneStatus(char laneId, int laneNumber, int vehicleCount, bool isPriority);
+    // Drain vehicles from the shared memory channel (fast path).
+    // Returns an empty vector when the channel isn't available.
+    std::vector<Vehicle*> readVehiclesFromSharedMemory();
 
-    // Check if files exist/are readable
+    // True once the shared memory channel has been opened
+    bool hasSharedMemoryChannel() const;
+
+    // True when TRAFFIC_BINARY_FORMAT=1 is set at startup. In binary mode
+    // the lane files hold fixed-width VehicleMessage records instead of
+    // text lines, so ingestion is one memcpy per vehicle with no string
+    // splitting or allocations.
+    static bool binaryFormatEnabled();
+
+    // True when TRAFFIC_APPEND_LOG=1 is set at startup (both processes
+    // must agree, like the binary format). Lane files then become
+    // append-only logs the generator only ever appends to and this
+    // reader consumes through a per-lane cursor: each poll seeks to the
+    // last consumed offset and reads only the new bytes, so ingestion
+    // cost is proportional to new vehicles and there is no
+    // rename/remove per batch on either side.
+    static bool appendLogEnabled();
+
+    // Background ingestion: a dedicated thread parses the lane files
+    // off the simulation thread - event-driven via inotify on Linux,
+    // 200ms polling elsewhere (or when inotify setup fails). Either way
+    // the open/clear retry sleeps and the reads themselves never touch
+    // update(); parsed vehicles land in a lock-free staging ring.
+    bool startFileWatcher();
+    void stopFileWatcher();
+    bool hasFileWatcher() const;
+
+    // Non-blocking drain of everything the ingestion thread has staged
+    // (simulation thread only - the ring has a single consumer)
+    std::vector<Vehicle*> drainStagedVehicles();
+
+    // Buffered lane-status reporting: bufferLaneStatus() appends one
+    // lane's line to an in-memory report and flushLaneStatus() publishes
+    // the whole batch with a single write plus an atomic rename-swap.
+    // External monitors always read a consistent snapshot and a report
+    // costs one open instead of one per lane - each open is
+    // milliseconds on the network filesystems.
+    void bufferLaneStatus(char laneId, int laneNumber, int vehicleCount, bool isPriority);
+    void flushLaneStatus();
+
+    // Report cadence for the caller's periodic loop; defaults to 5000ms,
+    // overridable with TRAFFIC_STATUS_INTERVAL_MS
+    static uint32_t statusWriteIntervalMs();
+
+    // Check that the data directory exists (lane files themselves are
+    // transient under the rename-swap protocol)
     bool checkFilesExist();
 
-    // Create directories and empty files if they don't exist
+    // Create the data directory and clear leftovers from a previous run
     bool initializeFiles();
 
 private:
     std::string dataPath;
     std::mutex mutex;
 
+    // Shared memory fast path (lane files remain the fallback)
+    SharedMemoryChannel shmChannel;
+    bool shmOpenAttempted;
+
+    // Memory-mapped exchange file: the preferred disk-backed transport.
+    // Per-lane rings with atomic cursors replace the append/truncate
+    // protocol on the text files, which was inherently racy against the
+    // generator's appends (hence the retry loops on both sides) and
+    // cost a metadata-heavy truncate per poll. The text files stay as
+    // the last-resort fallback for full rings and old generators.
+    LaneExchange laneExchange;
+
+    // Drain every lane ring of the exchange file, attaching to it on
+    // first use (the generator creates it). Caller holds mutex.
+    void drainExchange(std::vector<Vehicle*>& parsed);
+
+    // Exchange file path (lives next to the lane files)
+    std::string getExchangeFilePath() const;
+
+    // Ingestion thread state: the thread owns all parsing, so even a
+    // slow disk read in readVehiclesFromFile() never blocks the simulation
+    std::thread watcherThread;
+    std::atomic<bool> watcherRunning;
+    int inotifyFd;
+
+    // Lock-free staging ring between the ingestion thread and the
+    // simulation thread (same bounded sequence-number scheme as the
+    // async logger). Single producer in practice, single consumer.
+    struct StageCell {
+        std::atomic<size_t> sequence;
+        Vehicle* vehicle;
+    };
+    static constexpr size_t STAGE_RING_SIZE = 1024; // Power of two
+    StageCell stageRing[STAGE_RING_SIZE];
+    std::atomic<size_t> stageEnqueuePos;
+    std::atomic<size_t> stageDequeuePos;
+
+    bool tryStage(Vehicle* vehicle);
+    Vehicle* tryUnstage();
+
+    // Push a parsed batch, waiting briefly whenever the ring is full -
+    // vehicles own pool slots, so dropping them is not an option
+    void stageParsed(const std::vector<Vehicle*>& parsed);
+
+    // inotify-driven ingestion loop (Linux)
+    void watcherLoop();
+
+    // Periodic polling loop used where inotify is unavailable
+    void pollingLoop();
+
+    // SDL async I/O queue shared by lane reads and the status writer.
+    // Reads for every touched lane are issued up front and completions
+    // are collected on the ingestion thread, so four dirty lanes overlap
+    // in the kernel instead of queueing behind one another; status
+    // reports ride the same queue so flushLaneStatus() returns as soon
+    // as the write is issued. Null when SDL can't provide a queue -
+    // every path then falls back to the blocking streams.
+    SDL_AsyncIOQueue* asyncIOQueue;
+
+    // One in-flight read per lane. The buffer is member storage so it
+    // outlives the async operation and is reused across polls, same as
+    // readBuffer on the blocking path.
+    struct AsyncLaneRead {
+        SDL_AsyncIO* io;
+        std::string buffer;
+        std::string claimedPath; // Claimed lane file; removed after parse
+        char laneId;
+    };
+    AsyncLaneRead laneReads[4];
+    int pendingLaneOps;
+
+    // In-flight status report: write -> flush-close -> rename, each
+    // stage driven by an outcome from the queue
+    struct AsyncStatusWrite {
+        SDL_AsyncIO* io;
+        std::string payload;
+        std::string tempPath;
+        std::string finalPath;
+        std::atomic<bool> inFlight;
+    };
+    AsyncStatusWrite statusWrite;
+
+    // Issue async reads for the touched lanes and pump the queue until
+    // the reads and their file clears retire. Caller holds mutex.
+    void readLanesAsync(const bool touched[4], std::vector<Vehicle*>& parsed);
+
+    // Dispatch one completed async operation. Caller holds mutex.
+    void handleAsyncOutcome(const SDL_AsyncIOOutcome& outcome,
+                            std::vector<Vehicle*>& parsed);
+
+    // Drain completions that finished between polls (the status chain's
+    // later stages surface here); called by both ingestion loops
+    void pumpAsyncOutcomes();
+
+    // Line-splitting and parsing shared by the blocking and async read
+    // paths; views slice into the given text
+    void parseLaneText(std::string_view text, std::vector<Vehicle*>& parsed);
+
+    // Build a Vehicle from a shared memory record
+    Vehicle* vehicleFromMessage(const VehicleMessage& message);
+
     // Lane file paths
     std::string getLaneFilePath(char laneId) const;
 
+    // Claim the published lane file by renaming it to a reader-private
+    // name. The rename is atomic, so either the whole published batch
+    // moves or nothing does - the generator and the reader never hold
+    // the same path at the same time, which is what made the old
+    // open/clear retry loops (3 attempts x 50ms each side) necessary.
+    // Returns false when nothing is published.
+    bool claimLaneFile(const std::string& filePath, std::string& claimedPath);
+
     // Read vehicles from a specific lane file
     std::vector<Vehicle*> readVehiclesFromFile(char laneId);
 
-    // Parse a vehicle line from the file
-    Vehicle* parseVehicleLine(const std::string& line);
+    // Read fixed-width binary records from a specific lane file
+    std::vector<Vehicle*> readVehiclesFromBinaryFile(char laneId);
+
+    // Append-log mode: consume new bytes past the lane's read cursor
+    std::vector<Vehicle*> readVehiclesFromAppendLog(char laneId);
+
+    // Append-only log path (one per lane, next to the lane files)
+    std::string getAppendLogPath(char laneId) const;
+
+    // Consumed offset into each lane's append-only log, indexed by
+    // laneId - 'A' (guarded by mutex, like the reads that advance it).
+    // Only whole units move the cursor - a record or line the generator
+    // is still mid-append stays behind it for the next poll.
+    std::streamoff logCursor[4];
+
+    // Parse a vehicle line. The view slices into readBuffer; nothing is
+    // copied until VehiclePool::acquire stores the label.
+    Vehicle* parseVehicleLine(std::string_view line);
+
+    // Reusable whole-file buffer for text ingestion (guarded by mutex,
+    // like the reads that fill it); grows to the largest poll and stays
+    std::string readBuffer;
+
+    // Pending lane-status report, accumulated by bufferLaneStatus()
+    // until the next flush (guarded by mutex)
+    std::string statusBuffer;
 
     // Get the lane status file path
     std::string getLaneStatusFilePath() const;
 };
 
-#endif // FILE_HANDLER_Hendif // FILE_HANDLER_H
+#endif // FILE_HANDLER_H
@@ -0,0 +1,85 @@
+// FILE: include/managers/InProcessGenerator.h
+#ifndef IN_PROCESS_GENERATOR_H
+#define IN_PROCESS_GENERATOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <random>
+#include <thread>
+#include <vector>
+#include "core/Lane.h"
+#include "core/Vehicle.h"
+
+// The traffic generator's spawn model running as a thread inside the
+// simulator process. Container deployments ran two coordinated processes
+// sharing a data directory just so vehicles could hop through lane files
+// or shared memory; in-process mode keeps the same spawn distribution
+// and cadence but hands Vehicle objects straight to the simulation
+// through a bounded lock-free ring - no filesystem, no shm segment, no
+// second binary to supervise.
+//
+// The spawn thread is the producer; TrafficManager::update() drains the
+// ring each tick (single consumer, same sequence-number scheme as the
+// FileHandler staging ring). The ring bound doubles as backpressure:
+// when the junction is saturated the thread waits instead of piling up
+// unbounded spawns.
+class InProcessGenerator {
+public:
+    InProcessGenerator();
+    ~InProcessGenerator();
+
+    // Launch the spawn thread. The lanes are read (counts only) to
+    // enforce the same global vehicle cap the external generator applied
+    // by re-counting the lane files each cycle.
+    bool start(const std::vector<Lane*>& lanes);
+    void stop();
+
+    bool isRunning() const;
+
+    // Non-blocking drain of everything spawned since the last call
+    // (simulation thread only - the ring has a single consumer)
+    std::vector<Vehicle*> drainSpawned();
+
+private:
+    // Same tuning as the external generator (traffic_generator.cpp);
+    // the spawn interval itself comes from TuningConfig so sweeps can
+    // change it on a live junction
+    static constexpr int MAX_TOTAL_VEHICLES = 60;
+    static constexpr int PRIORITY_SEED_COUNT = 12; // Initial A2 burst
+
+    // Bounded spawn ring between the generator thread and the
+    // simulation thread (same cell scheme as FileHandler's staging ring)
+    struct SpawnCell {
+        std::atomic<size_t> sequence;
+        Vehicle* vehicle;
+    };
+    static constexpr size_t SPAWN_RING_SIZE = 256; // Power of two
+    SpawnCell spawnRing[SPAWN_RING_SIZE];
+    std::atomic<size_t> spawnEnqueuePos;
+    std::atomic<size_t> spawnDequeuePos;
+
+    bool tryEnqueue(Vehicle* vehicle);
+    Vehicle* tryDequeue();
+
+    // Acquire a pooled vehicle with the same encoded label the file
+    // format carries and push it, waiting while the ring is full
+    void spawnVehicle(char lane, int laneNumber, bool straight);
+
+    // Live queue depth across all lanes plus whatever is still staged
+    // in the ring - the in-process equivalent of the external
+    // generator's count_vehicles_in_lanes() total
+    int vehiclesInSystem() const;
+
+    // Interruptible sleep in 10ms slices so stop() is prompt
+    void sleepMs(int ms);
+
+    void generatorLoop();
+
+    std::vector<Lane*> lanes; // Counts read cross-thread, like the renderer
+    std::thread spawnThread;
+    std::atomic<bool> running;
+    std::mt19937 rng;
+    int nextVehicleNumber;
+};
+
+#endif // IN_PROCESS_GENERATOR_H
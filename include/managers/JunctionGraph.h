@@ -0,0 +1,120 @@
+// FILE: include/managers/JunctionGraph.h
+#ifndef JUNCTION_GRAPH_H
+#define JUNCTION_GRAPH_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "core/Lane.h"
+#include "core/TrafficLight.h"
+#include "managers/CorridorLink.h"
+#include "utils/SpscRing.h"
+
+// A corridor of connected junctions for capacity planning, as opposed
+// to the single rendered junction TrafficManager drives. Each junction
+// owns its own twelve lanes and traffic light (the same A/B/C/D layout)
+// and junctions are laid out west-to-east: a vehicle exiting a
+// junction's east side is handed to the next junction's west road (and
+// vice versa) through a lock-free SPSC mailbox per directed edge;
+// north/south exits leave the corridor. Ticks are fanned out over a
+// worker pool that pulls junction indices from a shared atomic cursor,
+// so an idle worker naturally takes work a busy one hasn't claimed.
+// For corridors larger than one process, the open ends can instead be
+// attached to CorridorLinks, which carry the same handoffs to a
+// neighboring slice over TCP (see attachBoundaryLinks).
+class JunctionGraph {
+public:
+    explicit JunctionGraph(int junctionCount);
+    ~JunctionGraph();
+
+    JunctionGraph(const JunctionGraph&) = delete;
+    JunctionGraph& operator=(const JunctionGraph&) = delete;
+
+    // Spawn the worker pool (0 workers = step everything on the caller)
+    void start(unsigned workerCount);
+
+    // Stop and join the workers
+    void stop();
+
+    // Connect this corridor slice to its neighbors in other processes:
+    // vehicles exiting junction 0 to the west go out the west link, and
+    // vehicles exiting the last junction to the east go out the east
+    // link, instead of leaving the corridor. Either may be null for a
+    // corridor end. Call before start().
+    void attachBoundaryLinks(CorridorLink* west, CorridorLink* east);
+
+    // Advance every junction by one fixed timestep; returns when all
+    // junctions have been stepped
+    void tick(uint32_t delta);
+
+    // Fill every spawnable lane (2 and 3) of every junction with
+    // synthetic vehicles, for saturation runs and benchmarks
+    void seed(int vehiclesPerLane);
+
+    // Vehicles currently queued across all junctions
+    size_t totalVehicleCount() const;
+
+    // Handoffs dropped because a mailbox was full (overload indicator)
+    uint64_t getDroppedHandoffs() const;
+
+    int junctionCount() const { return static_cast<int>(junctions.size()); }
+
+private:
+    // What travels between junctions: enough to respawn the vehicle on
+    // the neighbor's entry road
+    struct Handoff {
+        uint32_t id;
+        bool emergency;
+    };
+
+    static constexpr size_t MAILBOX_CAPACITY = 1024;
+    using Mailbox = SpscRing<Handoff, MAILBOX_CAPACITY>;
+
+    struct Junction {
+        int id = 0;
+        std::vector<Lane*> lanes;
+        TrafficLight* light = nullptr;
+        Mailbox* fromWest = nullptr; // Filled by the western neighbor
+        Mailbox* fromEast = nullptr; // Filled by the eastern neighbor
+    };
+
+    // One full update for one junction: drain mailboxes, advance the
+    // light, move vehicles, hand off or retire the ones that exited
+    void stepJunction(Junction& junction, uint32_t delta);
+
+    // Respawn a handed-off vehicle on the given entry road
+    void admit(Junction& junction, const Handoff& handoff, char road);
+
+    // Respawn a vehicle that arrived from a neighboring process
+    void admitWire(Junction& junction, const CorridorLink::WireHandoff& wire,
+                   char road);
+
+    // Worker main loop: wait for a tick generation, then pull junctions
+    void workerLoop();
+
+    // Pull and step junctions until the tick's cursor is exhausted
+    void drainJunctions();
+
+    Lane* findLane(Junction& junction, char laneId, int laneNumber) const;
+
+    std::vector<std::unique_ptr<Junction>> junctions;
+    std::vector<std::unique_ptr<Mailbox>> mailboxes;
+
+    // Process boundaries at the corridor ends (not owned, may be null)
+    CorridorLink* westLink = nullptr;
+    CorridorLink* eastLink = nullptr;
+    uint32_t wireAdmitToggle = 0; // Alternates wire entries over lanes 2/3
+
+    std::vector<std::thread> workers;
+    std::atomic<bool> running{false};
+    std::atomic<uint64_t> tickGeneration{0};
+    std::atomic<size_t> nextJunction{0};
+    std::atomic<size_t> pendingJunctions{0};
+    std::atomic<uint64_t> droppedHandoffs{0};
+    uint32_t tickDelta = 0;
+};
+
+#endif // JUNCTION_GRAPH_H
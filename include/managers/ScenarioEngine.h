@@ -0,0 +1,138 @@
+// FILE: include/managers/ScenarioEngine.h
+#ifndef SCENARIO_ENGINE_H
+#define SCENARIO_ENGINE_H
+
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <string>
+#include <vector>
+
+class TrafficManager;
+
+// Scripted scenario layer for headless batch runs: a script is a
+// sequence of steps ("spawn an ambulance on A at t=30s, surge B for
+// 60s, assert clearance under 90s") that suspends on simulation-time
+// waits and is resumed by the TrafficManager tick. Every suspended
+// script sits in one min-heap keyed on its wake time, so a tick's
+// resumption cost is O(due events) - hundreds of concurrent scripts
+// cost nothing on the ticks where none of them are due. All times are
+// logical (simTimeMs), so scripts compress along with the simulation
+// under setTimeScale() and replay deterministically.
+//
+// Scripts are plain step lists rather than C++20 coroutines - the tree
+// builds as C++17 - but the shape is the same: each at()/after()/
+// expectWithin() is a suspension point and the engine is the scheduler
+// that resumes past it.
+class ScenarioEngine {
+public:
+    // Everything a step gets when it runs; nowMs is the logical clock
+    struct Context {
+        TrafficManager& manager;
+        uint32_t nowMs;
+    };
+
+    using Action = std::function<void(Context&)>;
+    using Predicate = std::function<bool(Context&)>;
+
+    // Builder for one script; add steps in the order they should run
+    // and hand the result to ScenarioEngine::add()
+    class Script {
+    public:
+        explicit Script(std::string name);
+
+        // Run an action at an absolute scenario time (milliseconds from
+        // the engine's first tick)
+        Script& at(uint32_t timeMs, Action action);
+
+        // Run an action a delay after the previous step completed
+        Script& after(uint32_t delayMs, Action action);
+
+        // Run an action repeatCount times at a fixed interval, starting
+        // when the previous step completed (e.g. a 60s surge is 120
+        // spawns every 500ms). Each repetition is its own scheduled
+        // wake, so the cost stays per-event.
+        Script& every(uint32_t intervalMs, uint32_t repeatCount, Action action);
+
+        // Assert that the condition becomes true within the deadline
+        // (measured from the previous step). The condition is rechecked
+        // on a coarse cadence rather than every tick; a miss fails the
+        // script and logs the description.
+        Script& expectWithin(uint32_t deadlineMs, Predicate condition,
+                             std::string description);
+
+    private:
+        friend class ScenarioEngine;
+
+        struct Step {
+            bool isExpect;
+            bool absolute;        // at() vs after()/every()
+            uint32_t timeMs;      // Absolute wake, or delay/interval
+            uint32_t repeatCount; // 1 except for every()
+            Action action;
+            Predicate condition;
+            uint32_t deadlineMs;  // expectWithin() budget
+            std::string description;
+        };
+
+        std::string name;
+        std::vector<Step> steps;
+    };
+
+    // Register a script; call before the first tick resumes the engine
+    void add(Script script);
+
+    // Resume every script whose wake time has arrived. Called once per
+    // TrafficManager tick with the logical clock.
+    void update(uint32_t nowMs, TrafficManager& manager);
+
+    // True once every script has run to completion or failed
+    bool finished() const;
+
+    size_t passedAssertions() const;
+    size_t failedAssertions() const;
+
+    // One summary line per script plus the assertion totals, for the
+    // end of a batch run
+    void logSummary() const;
+
+private:
+    // How often a pending expectWithin() rechecks its condition
+    static constexpr uint32_t EXPECT_RECHECK_MS = 250;
+
+    struct ScriptState {
+        std::string name;
+        std::vector<Script::Step> steps;
+        size_t nextStep;
+        uint32_t repeatsLeft;   // Remaining runs of the current every()
+        uint32_t expectDeadline; // Absolute fail time of the active expect
+        bool scheduled;          // First wake queued (see update())
+        bool failed;
+        bool done;
+    };
+
+    struct Wake {
+        uint32_t wakeMs;
+        size_t scriptIndex;
+        bool operator>(const Wake& other) const { return wakeMs > other.wakeMs; }
+    };
+
+    // Step through one script until it suspends again or finishes
+    void resumeScript(size_t scriptIndex, Context& context);
+
+    // Queue the wake for the script's current step (or finish it)
+    void scheduleCurrentStep(size_t scriptIndex, uint32_t nowMs);
+
+    std::vector<ScriptState> scripts;
+    std::priority_queue<Wake, std::vector<Wake>, std::greater<Wake>> wakeQueue;
+
+    // at() times are relative to the engine's first tick so scripts
+    // don't care how long the simulation ran before they were attached
+    uint32_t baselineMs = 0;
+    bool baselineSet = false;
+
+    size_t passed = 0;
+    size_t failedCount = 0;
+};
+
+#endif // SCENARIO_ENGINE_H
@@ -0,0 +1,157 @@
+// FILE: include/managers/SimulationStats.h
+#ifndef SIMULATION_STATS_H
+#define SIMULATION_STATS_H
+
+#include <cstdint>
+#include <mutex>
+
+#include "utils/WaitHistogram.h"
+
+// Incremental statistics engine. Counters are maintained at the moment
+// a vehicle enters or leaves a lane, so reading the current numbers is
+// a struct copy instead of a walk over every lane - the renderer used
+// to rebuild a formatted string from all twelve queues every frame.
+// A version counter bumps on every change, letting the overlay keep
+// its formatted text until the values actually move. Wait times go
+// into a fixed one-second histogram, so p50/p90/p99 for capacity
+// reports cost a 121-entry scan and no per-vehicle storage.
+class SimulationStats {
+public:
+    static constexpr int LANE_SLOTS = 12;    // 4 roads x 3 lanes
+    static constexpr int WAIT_BUCKETS = 121; // 1s buckets; last = 120s+
+    static constexpr int DEPTH_HISTORY = 60; // 1 sample/s; last minute
+
+    struct LaneRow {
+        char laneId;
+        int laneNumber;
+        int count;           // Vehicles queued right now
+        bool priorityActive; // Lane is in priority mode (AL2 over threshold)
+        float arrivalsPerMin;
+        float departuresPerMin;
+    };
+
+    // Memory occupancy, sampled once a second by TrafficManager. Live
+    // pool count vs. the total queued is the leak detector: vehicles
+    // that never reach EXITED stay in the pool forever, so a steadily
+    // widening gap on a 24/7 kiosk is drift worth alarming on.
+    struct MemoryRow {
+        size_t liveVehicles;     // Pool slots handed out right now
+        size_t poolCapacity;     // Total slots across all slabs
+        size_t laneQueueBytes;   // Backing storage of all twelve rings
+        size_t loggerQueueDepth; // Messages waiting for the flush thread
+        size_t rssKb;            // Process resident set size
+    };
+
+    // Plain value copy - safe to hold across frames on the render thread
+    struct Snapshot {
+        LaneRow lanes[LANE_SLOTS];
+        int totalVehicles;
+        uint64_t totalArrivals;
+        uint64_t totalDepartures;
+        uint64_t totalRejected; // Spawns refused at the admission cap
+        float waitP50; // Seconds in queue, over all departed vehicles
+        float waitP90;
+        float waitP99;
+        // Spawn pipeline latency in milliseconds: generator write to
+        // lane enqueue, split at the ingestion pickup (shm pop / file
+        // parse). Zero samples means no stamped spawns arrived yet.
+        uint64_t spawnSamples;
+        float spawnP50Ms;
+        float spawnP99Ms;
+        float spawnTransportP99Ms; // Write -> pickup (channel/poll delay)
+        float spawnStageP99Ms;     // Pickup -> enqueue (staging ring)
+        MemoryRow memory;
+        // Per-lane depth history, oldest first (see sampleDepths);
+        // depthSamples says how many leading entries are valid
+        uint8_t depth[LANE_SLOTS][DEPTH_HISTORY];
+        int depthSamples;
+        uint64_t depthGeneration;
+        uint64_t version;
+    };
+
+    SimulationStats();
+
+    // Called by TrafficManager right after a lane enqueue/dequeue; the
+    // lane's own count and priority flag are passed in so the engine
+    // never reaches back into Lane
+    void recordArrival(char laneId, int laneNumber, int laneCount,
+                       bool priorityActive, uint64_t simTimeMs);
+    void recordDeparture(char laneId, int laneNumber, int laneCount,
+                         bool priorityActive, uint64_t simTimeMs,
+                         uint32_t waitSeconds);
+
+    // One stamped vehicle made it from the generator into a lane; the
+    // three readings are microseconds end to end and per stage (see
+    // Vehicle::setSpawnStamps for where they come from)
+    void recordSpawnLatency(uint64_t totalUs, uint64_t transportUs,
+                            uint64_t stageUs);
+
+    // A spawn was refused because the target lane sat at its admission
+    // cap (see Lane::tryEnqueue); sustained rejects mean the generator
+    // outruns what the junction can serve
+    void recordRejectedSpawn(char laneId, int laneNumber);
+
+    // Store the latest memory sample (bumps the version so cached
+    // overlay text refreshes)
+    void recordMemory(const MemoryRow& row);
+
+    // Push one depth sample per lane into the history ring - twelve
+    // byte writes off the already-maintained counters, called by
+    // TrafficManager on its one-second sampling cadence. Bumps its own
+    // generation (not the text version) so the overlay's sparkline
+    // texture refreshes exactly once per sample.
+    void sampleDepths();
+
+    // Cheap change check for the cached sparkline texture
+    uint64_t getDepthGeneration() const;
+
+    // Cheap change check for callers that cache formatted output
+    uint64_t getVersion() const;
+
+    Snapshot getSnapshot();
+
+private:
+    struct LaneCounters {
+        int count;
+        bool priorityActive;
+        uint64_t arrivals;
+        uint64_t departures;
+        // Rolling one-minute window; the rate reported is the last
+        // completed window's count
+        uint32_t windowArrivals;
+        uint32_t windowDepartures;
+        float lastArrivalsPerMin;
+        float lastDeparturesPerMin;
+        uint64_t rejected; // Spawns refused at the admission cap
+    };
+
+    static int slotFor(char laneId, int laneNumber);
+
+    // Close out elapsed one-minute windows (callers hold statsMutex)
+    void rollWindow(uint64_t simTimeMs);
+
+    float percentileLocked(float fraction) const;
+
+    mutable std::mutex statsMutex;
+    LaneCounters laneCounters[LANE_SLOTS];
+    MemoryRow memory;
+    uint32_t waitHistogram[WAIT_BUCKETS];
+    // Spawn latency histograms fed with microseconds (WaitHistogram is
+    // unit-agnostic; quantiles come back in the unit recorded)
+    WaitHistogram spawnTotal;
+    WaitHistogram spawnTransport;
+    WaitHistogram spawnStage;
+    uint64_t totalArrivals;
+    uint64_t totalDepartures;
+    uint64_t totalRejected;
+    uint64_t windowStartMs;
+    uint64_t version;
+
+    // Depth history ring, one column per sample (see sampleDepths)
+    uint8_t depthHistory[LANE_SLOTS][DEPTH_HISTORY];
+    int depthHead;  // Next column to overwrite
+    int depthCount; // Valid columns, saturating at DEPTH_HISTORY
+    uint64_t depthGeneration;
+};
+
+#endif // SIMULATION_STATS_H
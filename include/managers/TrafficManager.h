@@ -9,10 +9,21 @@
 #include <string>
 #include <SDL3/SDL.h>
 
+#include "core/Constants.h"
 #include "core/Lane.h"
+#include "core/IntersectionReservations.h"
+#include "core/MovementKernel.h"
 #include "core/TrafficLight.h"
 #include "managers/FileHandler.h"
+#include "managers/InProcessGenerator.h"
+#include "managers/ScenarioEngine.h"
+#include "managers/SimulationStats.h"
+#include "utils/CompiledSchedule.h"
+#include "utils/EventJournal.h"
+#include "utils/StatsTape.h"
+#include "utils/MetricsSegment.h"
 #include "utils/PriorityQueue.h"
+#include "utils/TaskPool.h"
 
 class TrafficManager {
 public:
@@ -31,6 +42,76 @@ public:
     // Update the traffic state
     void update(uint32_t delta);
 
+    // Time compression: every tick advances logical time delta * scale.
+    // Above 1x, vehicles teleport along their routes (Vehicle::fastForward)
+    // and the traffic light runs off the logical clock, so a simulated
+    // day of arrivals replays in minutes. 1 restores real-time behavior.
+    void setTimeScale(uint32_t scale);
+    uint32_t getTimeScale() const;
+
+    // Deterministic mode: periodic work (traffic light, file polling)
+    // keys off the logical clock accumulated from update() deltas rather
+    // than SDL_GetTicks(), so two runs fed identical spawns make
+    // identical decisions regardless of wall-clock jitter.
+    void setDeterministicClock(bool enabled);
+
+    // Record every spawn/dequeue/light-change into an mmap journal at
+    // the given path (see EventJournal). Cheap enough to leave on for
+    // production-like runs; the file is the machine-readable trace the
+    // debug log never was.
+    bool startRecording(const std::string& path);
+
+    // Replay a recorded journal: spawns are fed from the journal at
+    // their recorded logical times instead of from the generator's
+    // files/shared memory. Implies the deterministic clock.
+    bool startReplay(const std::string& path);
+
+    // Jump a replay to an arbitrary simulation time: restore the
+    // nearest keyframe at or before the target (recordings capture one
+    // per simulated minute) and replay only the event delta. Without a
+    // usable keyframe, forward seeks fast-forward from the current
+    // position; backward seeks fail.
+    bool seekReplay(uint32_t targetMs);
+
+    // Stream a compiled arrival schedule (see scenario_compiler):
+    // spawns come straight out of the mmap'd record array at their
+    // precomputed times instead of from the generator's RNG and lane
+    // files. Implies the deterministic clock, so a given schedule file
+    // replays identically across the whole benchmark suite.
+    bool startScheduleStream(const std::string& path);
+
+    // Binary state snapshot: every queued vehicle with its kinematics,
+    // the light phase and the logical clock (see utils/StateSnapshot.h).
+    // loadSnapshot() on a fresh manager skips generator warm-up -
+    // scenario runs start from a saved saturated junction instead.
+    bool saveSnapshot(const std::string& path) const;
+    bool loadSnapshot(const std::string& path);
+
+    // Fused generator mode: the generator's spawn model runs as a
+    // thread inside this process and vehicles arrive through a bounded
+    // lock-free ring instead of lane files or shared memory (see
+    // InProcessGenerator). The file watcher is stopped - there is no
+    // filesystem round-trip and no second process to deploy. Call after
+    // initialize().
+    bool startInProcessGeneration();
+
+    // Opt-in task-pool mode: lanes are swept in parallel across the
+    // hardware threads (lanes are independent until the intersection
+    // box; overlap resolution and boundary checks stay sequential after
+    // the join). Worth it on deep queues; at shallow depth the dispatch
+    // overhead isn't.
+    void setParallelLaneProcessing(bool enabled);
+
+    // Closed-loop recycling: vehicles reaching EXITED are reset and
+    // re-injected at a spawn edge instead of destroyed, keeping the
+    // population constant with zero ingestion and zero allocation
+    // after warm-up - the data-structure benchmarks measure
+    // processVehicles()/queue costs without spawn/destroy churn in
+    // the profile. Pass an inflow lane to funnel every re-entry there,
+    // or lane 0 to round-robin across the eight spawnable lanes.
+    void setVehicleRecycling(bool enabled, char inflowLane = 0,
+                             int inflowLaneNumber = 0);
+
     // Get the lanes for rendering
     const std::vector<Lane*>& getLanes() const;
 
@@ -46,9 +127,35 @@ public:
     // Get statistics for display
     std::string getStatistics() const;
 
+    // Incrementally maintained counters/rates/percentiles; the overlay
+    // copies a Snapshot and re-formats only when its version moves
+    SimulationStats& getStats();
+
+    // Seqlock metrics block sampled by in-process readers (the metrics
+    // HTTP endpoint) as well as external sidecars
+    MetricsSegment& getMetricsSegment();
+
     // Find lane by ID and number
     Lane* findLane(char laneId, int laneNumber) const;
 
+    // Hand one pool-owned vehicle straight to its lane, with the same
+    // routing and accounting every generator path gets. Public for the
+    // load harness, which pumps pre-generated arrival schedules through
+    // this instead of running a generator.
+    void addVehicle(Vehicle* vehicle);
+
+    // Batch variant: groups the vehicles by target lane and admits each
+    // group through Lane::tryEnqueueBulk, so a burst of N spawns into
+    // one lane costs one queue lock acquisition and one priority/count
+    // update instead of N. Consumes (clears) the vector; rejected
+    // vehicles go back to the pool, same as addVehicle.
+    void addVehiclesBulk(std::vector<Vehicle*>& vehicles);
+
+    // Attach a scripted scenario engine (see ScenarioEngine); its due
+    // steps are resumed in one batch at the top of every tick, on the
+    // logical clock. Pass null to detach. The engine is caller-owned.
+    void attachScenarioEngine(ScenarioEngine* engine);
+
 private:
     // Lanes for each road
     std::vector<Lane*> lanes;
@@ -59,31 +166,207 @@ private:
     // Traffic light
     TrafficLight* trafficLight;
 
+    // Cached A2 pointer for updatePriorities() (the lane vector never
+    // changes after initialize())
+    Lane* priorityLaneA2;
+
+    // Batched straight-line movement kernel, regathered each tick
+    MovementKernel movementKernel;
+
+    // Space-time reservation table for the intersection box; an
+    // approaching vehicle claims its movement's slots before crossing
+    // the stop line (see IntersectionReservations)
+    IntersectionReservations intersectionBox;
+
+    // Task-pool mode (setParallelLaneProcessing): worker pool plus one
+    // movement kernel per lane so parallel sweeps never share a gather
+    // buffer. Pool and kernels are only created when the mode is on.
+    bool parallelLanes;
+    TaskPool* taskPool;
+    std::vector<MovementKernel> laneKernels;
+
+    // Scratch for the per-lane spatial bucket index in
+    // preventVehicleOverlap() (reused across ticks to avoid churn)
+    std::vector<int> bucketHeads;
+    std::vector<int> bucketNext;
+    std::vector<Vehicle*> overlapScratch; // Per-lane queue snapshot
+
+    // Scratch for checkVehicleBoundaries(): exited vehicles collected
+    // across all lanes, then released to the pool in one batch
+    std::vector<Vehicle*> exitedScratch;
+
+    // Scratch for addVehiclesBulk(): spawns grouped by target lane slot
+    // (reused across batches to avoid churn)
+    std::vector<Vehicle*> admitScratch[Constants::LANE_SLOT_COUNT];
+
+    // Per-vehicle admission accounting (stats, tape, spawn latency,
+    // journal, log), shared by addVehicle and addVehiclesBulk after the
+    // lane has accepted the vehicle
+    void recordAdmission(Vehicle* vehicle, Lane* targetLane);
+
+    // Spawn rejected at the admission cap: count it and return the
+    // vehicle to the pool
+    void rejectSpawn(Vehicle* vehicle, Lane* targetLane);
+
+    // Closed-loop recycling (setVehicleRecycling): re-inject the
+    // exitedScratch batch at spawn edges instead of releasing it
+    void recycleExited();
+    bool recycleVehicles;
+    char recycleLaneId;      // 0 = round-robin over spawnable lanes
+    int recycleLaneNumber;
+    size_t recycleCursor;    // Round-robin position
+
     // File handler for reading vehicle data
     FileHandler* fileHandler;
 
+    // Fused generator thread (startInProcessGeneration); null unless the
+    // mode is on, in which case it replaces every file/shm spawn channel
+    InProcessGenerator* inProcessGenerator;
+
+    // Scripted scenario engine (attachScenarioEngine); caller-owned,
+    // resumed once per tick on the logical clock
+    ScenarioEngine* scenarioEngine;
+
+    // Per-lane priority bitmask (bit index = Constants::laneSlot),
+    // rebuilt by updatePriorities() each tick so isLanePrioritized() is
+    // a single bit test on the render thread instead of a lane lookup
+    // and two field reads
+    std::atomic<uint16_t> priorityLaneMask;
+
+    // Sparse lane scheduling: one bit per lane slot, set while the lane
+    // may have work. Enqueues set their lane's bit, any light transition
+    // wakes every lane, and a sweep that finds a lane quiescent (empty,
+    // or fully parked at a red light) clears its bit - so the per-tick
+    // loop touches only lanes with something to do, and an overnight
+    // idle junction costs a mask test instead of twelve sweeps.
+    std::atomic<uint16_t> activeLaneMask;
+
+    // Last tick's movable mask; a change is the light-transition wake
+    uint16_t lastMovableMask;
+
     // Flag to indicate if the manager is running
     std::atomic<bool> running;
 
     // Time tracking for periodic operations
     uint32_t lastFileCheckTime;
+    uint32_t lastWaitExportTime;  // Last per-lane wait-histogram dump
+    uint32_t lastStatusWriteTime; // Last buffered lane-status report
     uint32_t lastPriorityUpdateTime;
 
+    // Time compression state (1 = real time)
+    uint32_t timeScale;
+    uint32_t simTimeMs; // Logical clock, advanced by scaled deltas
+
+    // When set, periodic work uses simTimeMs instead of SDL_GetTicks()
+    bool deterministicClock;
+
+    // Record/replay state (at most one of the two modes is active)
+    EventJournal journal;
+    bool journalRecording;
+    bool journalReplaying;
+    size_t replayCursor;
+    TrafficLight::State lastJournaledLightState;
+
+    // Feed journal spawns whose recorded time has been reached
+    void pumpReplay();
+
+    // Compiled schedule streaming (see utils/CompiledSchedule.h): the
+    // mapped record array replaces the generator channels entirely, so
+    // spawning is a cursor walk over records already sorted by time.
+    // Implies the deterministic clock, same as journal replay.
+    CompiledSchedule compiledSchedule;
+    bool scheduleStreaming;
+    size_t scheduleCursor;
+
+    // Feed compiled arrivals whose scheduled time has been reached
+    void pumpSchedule();
+
+    // Periodic full-state keyframe while recording (seekReplay's
+    // landing points); last capture time is on the logical clock
+    uint32_t lastKeyframeTime;
+    void captureKeyframe();
+
+    // Release every queued vehicle back to the pool (seekReplay rebuilds
+    // the junction from a keyframe afterwards)
+    void clearAllVehicles();
+
+    // Counters updated at enqueue/dequeue (see SimulationStats)
+    SimulationStats stats;
+
+    // Columnar per-tick metrics export, opt-in via
+    // TRAFFIC_STATS_TAPE=<path> (see utils/StatsTape.h). The sample is
+    // accumulated across the tick (arrivals/departures as they happen,
+    // depths and light state at the end) and handed to the tape's
+    // background writer in one copy.
+    StatsTape statsTape;
+    bool statsTapeEnabled;
+    StatsTape::TickSample tapeSample;
+
+    // Canonical lane slot (A1..D3 -> 0..11), same order the tape header
+    // declares
+    static int tapeSlot(char laneId, int laneNumber) {
+        return (laneId - 'A') * 3 + laneNumber - 1;
+    }
+
+    // Seqlock-published metrics block for external monitoring (see
+    // MetricsSegment); refreshed at ~10Hz from update()
+    MetricsSegment metricsSegment;
+    uint32_t lastMetricsPublishTime;
+    void publishMetrics(uint32_t delta);
+
+    // Once-a-second memory occupancy sample (see SimulationStats::MemoryRow)
+    uint32_t lastMemorySampleTime;
+
+    // Tick-budget governor (see governTick): when an update pass
+    // overruns the budget, the shed level rises and the deferrable
+    // passes - the overlap correction stride, the lane-status interval,
+    // the metrics/wait exports - stretch or pause; vehicle motion and
+    // light timing always run at full rate. Sustained headroom walks
+    // the level back down. Disabled under the deterministic clock,
+    // where wall-time feedback would make runs irreproducible.
+    static constexpr int64_t TICK_BUDGET_US = 8000;
+    static constexpr int SHED_LEVEL_MAX = 3;
+    static constexpr uint32_t OVERLAP_BASE_STRIDE = 4;
+    int shedLevel;
+    uint32_t tickCounter;          // Monotonic, drives the overlap stride
+    uint32_t ticksUnderBudget;     // Consecutive comfortable ticks
+    uint64_t shedOverlapPasses;    // Deferred-work tallies for the report
+    uint64_t shedStatusWrites;
+    uint64_t shedExports;
+    uint32_t statusDeadlines;      // Per-pass deadline phases: under shed,
+    uint32_t exportDeadlines;      // only every 2^level'th deadline runs
+    uint32_t metricsDeadlines;
+
+    // Feed one tick's measured cost into the governor
+    void governTick(int64_t tickUs);
+
+    // Current stride of the overlap pass (0 = suspended)
+    uint32_t overlapStride() const;
+
+    // Multiplier applied to the status/metrics/export intervals
+    uint32_t shedIntervalScale() const { return 1u << shedLevel; }
+
     // Read vehicles from files
     void readVehicles();
 
-  void limitVehiclesPerLane();
   void preventVehicleOverlap();
 
     // Update lane priorities
     void updatePriorities();
 
-    // Add a vehicle to the appropriate lane
-    void addVehicle(Vehicle* vehicle);
-
     // Process vehicles in lanes
     void processVehicles(uint32_t delta);
 
+    // One lane's sweep: gathers straight moves into the given kernel
+    // but does not run it (the caller decides batching granularity).
+    // movableMask has one bit per lane slot, precomputed from the light
+    // state once per tick by processVehicles(). Returns false when the
+    // lane came out quiescent - empty, or its parked segment covering
+    // every vehicle under a red light - and can be skipped until an
+    // enqueue or light change wakes it.
+    bool processLane(Lane* lane, MovementKernel& kernel, uint32_t delta,
+                     uint16_t movableMask);
+
     // Check for vehicles leaving the simulation
     void checkVehicleBoundaries();
 };
@@ -0,0 +1,80 @@
+// FILE: include/utils/CompiledSchedule.h
+#ifndef COMPILED_SCHEDULE_H
+#define COMPILED_SCHEDULE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// A precompiled arrival schedule: the scenario compiler (see
+// src/scenario_compiler.cpp) turns a human-readable scenario - per-lane
+// rate phases over time plus scripted emergency events - into a flat
+// array of fixed-width records sorted by spawn time. The simulator maps
+// the file read-only and feeds spawns from it in place of the
+// generator's runtime RNG and file writes (--schedule=<file>), so
+// startup-to-first-vehicle is an mmap plus a pointer compare, and the
+// identical traffic replays across the whole benchmark suite without
+// regeneration. Same layout discipline as the event journal: no
+// pointers, no variable-length data, nothing to parse.
+struct CompiledArrival {
+    uint64_t arrivalMs;  // Logical spawn time (milliseconds from t=0)
+    uint32_t sequence;   // Time-ordered index; spawn labels derive from it
+    char lane;           // Road letter 'A'..'D'
+    int8_t laneNumber;   // 2..3 (L1 never spawns)
+    uint8_t emergency;   // 1 for emergency vehicles
+    uint8_t destination; // 0 straight, 1 left, 2 right (VehicleMessage encoding)
+};
+
+static_assert(sizeof(CompiledArrival) == 16,
+              "CompiledArrival must stay fixed-width and padding-free");
+
+// Read side: maps a compiled schedule file and exposes the record
+// array in place. Write side is the static writeFile() the compiler
+// uses; it is a plain buffered write since compilation is offline.
+class CompiledSchedule {
+public:
+    CompiledSchedule();
+    ~CompiledSchedule();
+
+    CompiledSchedule(const CompiledSchedule&) = delete;
+    CompiledSchedule& operator=(const CompiledSchedule&) = delete;
+
+    // Map an existing compiled schedule read-only; rejects files whose
+    // magic, version or record count don't line up with their size
+    bool openForRead(const std::string& path);
+
+    // Records contained (read mode)
+    size_t count() const;
+
+    // Access into the mapped, time-sorted record array
+    const CompiledArrival& arrival(size_t index) const;
+
+    bool isOpen() const;
+
+    void close();
+
+    // Write a compiled schedule; the records must already be sorted by
+    // arrivalMs with sequence numbers assigned in that order
+    static bool writeFile(const std::string& path,
+                          const std::vector<CompiledArrival>& records);
+
+private:
+    // Layout of the file: header followed by the record array
+    struct Header {
+        uint32_t magic;   // Sanity check for version mismatches
+        uint32_t version;
+        uint64_t count;   // Records in the array
+    };
+
+    static constexpr uint32_t MAGIC = 0x44484353; // "SCHD"
+    static constexpr uint32_t VERSION = 1;
+
+    int fd;
+    void* mapping;
+    size_t mappedBytes;
+    const CompiledArrival* records;
+    uint64_t recordCount;
+};
+
+#endif // COMPILED_SCHEDULE_H
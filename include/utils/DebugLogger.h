@@ -4,6 +4,24 @@
 #include <string>
 #include <vector>
 #include <mutex>
+#include <atomic>
+#include <thread>
+
+#include "utils/FrameArena.h"
+
+// Compile-time log floor, as a severity rank: DEBUG=0, INFO=1,
+// WARNING=2, ERROR=3. Levels ranked below the floor compile to nothing
+// through logAt() - including the message construction at the call
+// site. Release builds default to dropping DEBUG (the vehicle update
+// path's per-waypoint spam); override with
+// -DTRAFFIC_MIN_LOG_SEVERITY=<rank> or the CMake cache variable.
+#ifndef TRAFFIC_MIN_LOG_SEVERITY
+#ifdef NDEBUG
+#define TRAFFIC_MIN_LOG_SEVERITY 1
+#else
+#define TRAFFIC_MIN_LOG_SEVERITY 0
+#endif
+#endif
 
 class DebugLogger {
 public:
@@ -15,31 +33,187 @@ public:
         DEBUG
     };
 
+    // Severity rank used for filtering (DEBUG is the chattiest). Kept
+    // separate from the enum order, which predates the floor and is
+    // spelled out at every call site.
+    static constexpr int severity(LogLevel level) {
+        switch (level) {
+            case LogLevel::DEBUG:   return 0;
+            case LogLevel::INFO:    return 1;
+            case LogLevel::WARNING: return 2;
+            case LogLevel::ERROR:   return 3;
+        }
+        return 1;
+    }
+
+    // True when the level survives the compile-time floor
+    static constexpr bool levelEnabled(LogLevel level) {
+        return severity(level) >= TRAFFIC_MIN_LOG_SEVERITY;
+    }
+
+    // Level-gated logging: the message is built by a callable that is
+    // only invoked when the level is compiled in, so a disabled level
+    // costs nothing at the call site - no ostringstream, no
+    // concatenation, no temporaries.
+    //
+    //   DebugLogger::logAt<DebugLogger::LogLevel::DEBUG>([&] {
+    //       return "Vehicle " + getLabel() + " reached waypoint ...";
+    //   });
+    template <LogLevel Level, typename MessageBuilder>
+    static void logAt(MessageBuilder&& buildMessage) {
+        if constexpr (levelEnabled(Level)) {
+            log(buildMessage(), Level);
+        } else {
+            (void)buildMessage;
+        }
+    }
+
     // Initialize the logger
     static void initialize(const std::string& logFilePath = "traffic_simulator.log");
 
-    // Log a message with a specific level
+    // Log a message with a specific level.
+    // Producer side is a lock-free push into a bounded ring; file and
+    // console writes happen on the background flush thread, so callers
+    // on the vehicle/manager hot path never block on I/O. The timestamp
+    // and level prefix are rendered on the flush thread too - the
+    // producer only stamps a raw millisecond clock reading.
     static void log(const std::string& message, LogLevel level = LogLevel::INFO);
 
+    // Structured fast path: enqueue a pointer to a static printf-style
+    // format plus up to four integral arguments, deferring ALL text
+    // work - argument formatting, timestamp rendering, level prefix -
+    // to the flush thread. Producer cost is one clock read and a ring
+    // push of a few dozen POD bytes; no ostringstream, no allocation.
+    //
+    // The format must outlive the queue (pass a string literal) and
+    // spell every placeholder as %lld - arguments are widened to
+    // long long at the call site:
+    //
+    //   DebugLogger::logf(DebugLogger::LogLevel::INFO,
+    //                     "Read %lld vehicles from lane files", count);
+    template <typename... Args>
+    static void logf(LogLevel level, const char* format, Args... args) {
+        static_assert(sizeof...(Args) <= MAX_STRUCTURED_ARGS,
+                      "logf carries at most four arguments");
+        if (!levelEnabled(level)) {
+            return;
+        }
+        long long packed[MAX_STRUCTURED_ARGS] = {
+            static_cast<long long>(args)...};
+        logStructured(format, packed, static_cast<int>(sizeof...(Args)),
+                      level);
+    }
+
     // Get recent log messages for display
     static std::vector<std::string> getRecentLogs(int count = 10);
 
+    // Arena-backed variant for the per-frame overlay: the snapshot lives
+    // in the caller's frame arena, so displaying it allocates no heap
+    static ArenaVector<ArenaString> getRecentLogs(int count, FrameArena& arena);
+
+    // Monotonic stamp that advances whenever the recent-log window
+    // changes (new message or clear). The overlay compares it against
+    // the stamp of its cached lines and skips re-snapshotting entirely
+    // when nothing new has arrived - which is most frames.
+    static uint64_t getRecentGeneration();
+
     // Clear all logs
     static void clearLogs();
 
-    // Shutdown the logger
+    // Shutdown the logger (drains the queue and joins the flush thread)
     static void shutdown();
 
+    // Messages discarded because the ring was full (overload indicator)
+    static uint64_t getDroppedCount();
+
+    // Messages currently waiting for the flush thread (occupancy
+    // telemetry; a depth pinned near the ring size means the flusher
+    // is starved)
+    static size_t getQueueDepth();
+
+    // Argument slots per structured entry (public so logf's
+    // static_assert can name it)
+    static constexpr size_t MAX_STRUCTURED_ARGS = 4;
+
 private:
+    // Bounded MPMC ring (Vyukov-style sequence numbers); we use it as
+    // multi-producer/single-consumer. Must be a power of two.
+    static constexpr size_t RING_SIZE = 4096;
+
+    // One queued message: either a pre-built string (format == null) or
+    // a structured format-plus-arguments record. Both carry the raw
+    // producer-side stamp; the flush thread renders it into text with a
+    // per-second strftime cache.
+    struct Entry {
+        std::string message;
+        const char* format;
+        long long args[MAX_STRUCTURED_ARGS];
+        int argCount;
+        LogLevel level;
+        uint64_t stampMs; // system_clock milliseconds since epoch
+    };
+
+    struct Cell {
+        std::atomic<size_t> sequence;
+        Entry entry;
+    };
+
+    // Recent-log window for the debug overlay: a fixed ring of reusable
+    // string slots. Stores recycle each slot's capacity in place, so the
+    // window neither grows on long soak runs nor pays the old vector's
+    // O(n) front-erase and reallocation churn per message.
+    static constexpr size_t RECENT_CAPACITY = 128;
+
     static std::string logFilePath;
-    static std::vector<std::string> recentLogs;
-    static std::mutex logMutex;
+    static std::string recentRing[RECENT_CAPACITY];
+    static uint64_t recentHead;           // Messages stored since start/clear
+    static std::atomic<uint64_t> recentGeneration;
+    static std::mutex logMutex;           // Guards the recent ring and file path
     static bool initialized;
 
+    static Cell ring[RING_SIZE];
+    static std::atomic<size_t> enqueuePos;
+    static std::atomic<size_t> dequeuePos;
+    static std::atomic<uint64_t> droppedCount;
+
+    static std::thread flushThread;
+    static std::atomic<bool> flushRunning;
+
+    // Compressed file sink (TRAFFIC_COMPRESS_LOGS=1): the flush thread
+    // accumulates formatted lines into a block and appends StreamCodec
+    // frames to <logFilePath>.z instead of writing plain text. Long
+    // soaks are disk-bandwidth bound and log text compresses ~10x; the
+    // compression itself runs on the flush thread, which is already off
+    // the hot path. Decode by walking the frames (see StreamCodec.h).
+    static constexpr size_t COMPRESS_BLOCK_BYTES = 64 * 1024;
+    static bool compressSink;
+    static std::string compressBuffer;
+
+    // Frame out the accumulated block (flush thread / shutdown only)
+    static void sealCompressedBlock();
+
+    // Out-of-line half of logf(): stamp the clock and push the record
+    static void logStructured(const char* format, const long long* args,
+                              int argCount, LogLevel level);
+
+    // Lock-free push; returns false (and counts a drop) when full
+    static bool tryPush(std::string&& message, const char* format,
+                        const long long* args, int argCount, LogLevel level);
+
+    // Consumer-side pop, called only from the flush thread
+    static bool tryPop(Entry& entry);
+
+    // Render one popped entry into its final text line (flush thread
+    // only - uses the cached-timestamp scratch)
+    static std::string formatEntry(Entry& entry);
+
+    // Flush thread main loop
+    static void flushLoop();
+
     // Get timestamp for log messages
     static std::string getTimestamp();
 
-    // Write to log file
+    // Write to log file (flush thread only)
     static void writeToFile(const std::string& message);
 };
 
@@ -0,0 +1,209 @@
+// FILE: include/utils/EventJournal.h
+#ifndef EVENT_JOURNAL_H
+#define EVENT_JOURNAL_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "utils/StateSnapshot.h"
+
+// One fixed-width journal record. Everything needed to re-create the
+// event lives inline (no pointers, no variable-length data), so a
+// journal file can be mapped and scanned without any parsing.
+struct JournalEvent {
+    enum Type : uint8_t {
+        SPAWN = 0,       // Vehicle entered the simulation
+        DEQUEUE = 1,     // Vehicle left the simulation
+        LIGHT_CHANGE = 2 // Traffic light switched state
+    };
+
+    uint64_t timeMs;   // Logical simulation time of the event
+    uint8_t type;      // One of Type
+    char lane;         // Road letter 'A'..'D' (' ' for light events)
+    int8_t laneNumber; // 1..3 (0 for light events)
+    int8_t lightState; // TrafficLight::State for LIGHT_CHANGE, else 0
+    int8_t emergency;  // 1 for emergency vehicles
+    char label[24];    // Vehicle label for SPAWN/DEQUEUE (null terminated)
+};
+
+// An mmap-backed append-only journal of simulation events. Recording a
+// run costs one struct copy per event (the kernel writes the pages back
+// lazily); replaying maps the file and walks the records in place, so a
+// captured traffic trace can be re-run against code changes repeatedly.
+// The header carries the event count, letting a reader distinguish
+// appended records from the preallocated tail of the mapping.
+//
+// Opt-in compressed recording (TRAFFIC_JOURNAL_COMPRESS=1): events are
+// batched into fixed-count blocks and written as StreamCodec frames
+// instead of an mmap array - multi-day soaks on disk-bandwidth-bound
+// edge devices are what always-on recording has to survive, and the
+// fixed-width records compress far below their raw 40 bytes. Blocks
+// are frame-aligned with the keyframe captures (the current block is
+// sealed before each keyframe), so seeking restores a keyframe and
+// resumes decoding at a block boundary; a per-block index in the
+// footer maps event numbers to frames. Replay decodes one cached
+// block at a time, which sequential access never thrashes. Both file
+// flavors open through the same openForRead().
+class EventJournal {
+public:
+    EventJournal();
+    ~EventJournal();
+
+    EventJournal(const EventJournal&) = delete;
+    EventJournal& operator=(const EventJournal&) = delete;
+
+    // Create (or truncate) a journal file for recording
+    bool openForWrite(const std::string& path);
+
+    // Map an existing journal read-only for replay
+    bool openForRead(const std::string& path);
+
+    // Append one event; grows the mapping when the preallocation fills
+    void append(const JournalEvent& event);
+
+    // Events recorded so far (or contained, in read mode)
+    size_t eventCount() const;
+
+    // Read-mode access to the mapped records
+    const JournalEvent& event(size_t index) const;
+
+    bool isOpen() const;
+
+    // --- Keyframes ---------------------------------------------------
+    // Periodic full-state keyframes (the snapshot format) let replay
+    // seek to any simulation time: restore the nearest keyframe at or
+    // before the target, then replay only the event delta - instead of
+    // replaying an 8-hour capture from t=0. Keyframes are staged in
+    // memory while recording and written after the trimmed event array
+    // at close(), followed by an index and a footer; files without the
+    // footer (including journals from older builds) open and replay
+    // unchanged.
+
+    struct KeyframeHeader {
+        uint64_t timeMs;      // Logical clock at capture
+        uint64_t eventIndex;  // Events already applied when captured
+        int32_t lightState;   // TrafficLight::State as an int
+        uint32_t vehicleCount;
+    };
+
+    // Write mode: stage one keyframe covering the state after the
+    // events appended so far
+    void appendKeyframe(uint64_t timeMs, int32_t lightState,
+                        const VehicleSnapshot* records, uint32_t vehicleCount);
+
+    // Read mode: indexed keyframes (0 for keyframe-less files)
+    size_t keyframeCount() const;
+
+    // Read mode: locate the last keyframe at or before timeMs. Returns
+    // false when no keyframe is that early; on success outRecords
+    // points at vehicleCount records inside the mapping.
+    bool findKeyframe(uint64_t timeMs, KeyframeHeader& outHeader,
+                      const VehicleSnapshot*& outRecords) const;
+
+    // Trim the file to its real size and land the staged keyframe
+    // section (write mode), then unmap
+    void close();
+
+private:
+    // Layout of the mapped file: header followed by the event slots
+    struct Header {
+        uint32_t magic;   // Sanity check for version mismatches
+        uint32_t version;
+        uint64_t count;   // Events appended so far
+    };
+
+    static constexpr uint32_t MAGIC = 0x4C4E524A; // "JRNL"
+    static constexpr uint32_t VERSION = 1;
+    static constexpr size_t GROW_EVENTS = 4096;   // ftruncate/remap step
+
+    // Compressed-flavor file magic and block granularity (1024 events
+    // = 40 KB raw per frame, enough context for the match coder)
+    static constexpr uint32_t COMPRESSED_MAGIC = 0x5A4E524A; // "JRNZ"
+    static constexpr size_t BLOCK_EVENTS = 1024;
+
+    // One index row per keyframe, sorted by time (append order)
+    struct KeyframeIndexEntry {
+        uint64_t timeMs;
+        uint64_t fileOffset; // Of the KeyframeHeader within the file
+    };
+
+    // Sits at the very end of the file; its magic is what tells a
+    // reader the keyframe section exists at all
+    struct KeyframeFooter {
+        uint64_t indexOffset;
+        uint64_t keyframeCount;
+        uint32_t magic;
+        uint32_t pad;
+    };
+
+    static constexpr uint32_t KEYFRAME_MAGIC = 0x59454B4A; // "JKEY"
+
+    // One index row per sealed event block in a compressed journal
+    struct BlockIndexEntry {
+        uint64_t firstEvent; // Journal-wide index of the block's first event
+        uint64_t fileOffset; // Of the block's frame header
+    };
+
+    // End-of-file footer for the compressed flavor: locates both
+    // indexes (block and keyframe rows are appended in order, so each
+    // index is binary-searchable)
+    struct CompressedFooter {
+        uint64_t blockIndexOffset;
+        uint64_t blockCount;
+        uint64_t keyframeIndexOffset;
+        uint64_t keyframeCount;
+        uint32_t magic;
+        uint32_t pad;
+    };
+
+    static constexpr uint32_t COMPRESSED_FOOTER_MAGIC = 0x58495A4A; // "JZIX"
+
+    // (Re)map the file at the given slot capacity
+    bool remap(size_t newCapacity);
+
+    // Compressed write mode: frame out the pending partial block
+    void sealEventBlock();
+
+    // Compressed mode: write/decode one StreamCodec frame at a file
+    // offset (reads go through pread; nothing is mapped)
+    bool writeFrameAt(const char* raw, size_t rawLen, uint64_t offset,
+                      size_t& frameBytes);
+    bool readFrameAt(uint64_t offset, std::vector<char>& out) const;
+
+    Header* header;
+    JournalEvent* events;
+    size_t capacity;    // Mapped event slots
+    size_t mappedBytes; // Exact mapping length (may exceed the slots in read mode)
+    bool writable;
+
+    // Writer-side staging for the keyframe section (see close())
+    std::vector<char> keyframeBuffer;
+    std::vector<KeyframeIndexEntry> keyframeIndex;
+
+    // Reader-side view of the footer index (null without keyframes)
+    const KeyframeIndexEntry* keyframes;
+    size_t keyframeTotal;
+
+    // --- Compressed-flavor state (unused for mmap journals) ----------
+    bool compressed;
+    Header ownHeader;    // Backs the header pointer; landed at close()
+    uint64_t writeOffset; // Next sequential file position (write mode)
+    std::vector<JournalEvent> blockBuffer;   // Events pending a seal
+    std::vector<BlockIndexEntry> blockTable; // Both modes
+    std::vector<KeyframeIndexEntry> keyframeTable; // Read mode
+
+    // Single-block decode cache: replay walks events in order, so one
+    // resident block makes event() a bounds check and an array index.
+    // Mutable because event()/findKeyframe() are logically const.
+    mutable size_t cachedBlock;
+    mutable std::vector<char> cachedEvents;
+    mutable std::vector<char> keyframeScratch;
+
+#ifndef _WIN32
+    int fd;
+#endif
+};
+
+#endif // EVENT_JOURNAL_H
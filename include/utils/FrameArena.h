@@ -0,0 +1,83 @@
+// FILE: include/utils/FrameArena.h
+#ifndef FRAME_ARENA_H
+#define FRAME_ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+// A bump-pointer arena for per-frame transient allocations (overlay log
+// snapshots, statistics strings). Allocation is a pointer increment;
+// reset() at the top of the frame reclaims everything at once, so the
+// steady-state render path performs zero heap allocations. Requests that
+// outgrow the buffer fall back to the heap and are freed on reset, so an
+// undersized arena degrades to the old behavior instead of failing.
+class FrameArena {
+public:
+    explicit FrameArena(size_t capacityBytes = DEFAULT_CAPACITY);
+    ~FrameArena();
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    // Carve bytes out of the buffer (aligned); heap fallback when full
+    void* allocate(size_t bytes, size_t alignment);
+
+    // Reclaim the whole frame: rewind the pointer, free any overflow
+    void reset();
+
+    // High-water mark of the current frame (for sizing the buffer)
+    size_t used() const { return offset; }
+
+private:
+    static constexpr size_t DEFAULT_CAPACITY = 64 * 1024;
+
+    std::unique_ptr<unsigned char[]> buffer;
+    size_t capacity;
+    size_t offset;
+
+    // Heap blocks handed out after the buffer filled, freed on reset()
+    std::vector<void*> overflowBlocks;
+    bool warnedOverflow;
+};
+
+// Minimal std::allocator adapter so standard containers can live in the
+// arena. deallocate() is a no-op - memory comes back on FrameArena::reset().
+template<typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(FrameArena& a) : arena(&a) {}
+
+    template<typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.arena) {}
+
+    T* allocate(size_t n) {
+        return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, size_t) {}
+
+    template<typename U>
+    bool operator==(const ArenaAllocator<U>& other) const {
+        return arena == other.arena;
+    }
+
+    template<typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const {
+        return arena != other.arena;
+    }
+
+    FrameArena* arena;
+};
+
+// Arena-backed container aliases used by the render path
+template<typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+using ArenaString =
+    std::basic_string<char, std::char_traits<char>, ArenaAllocator<char>>;
+
+#endif // FRAME_ARENA_H
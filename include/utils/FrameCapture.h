@@ -0,0 +1,84 @@
+// FILE: include/utils/FrameCapture.h
+#ifndef FRAME_CAPTURE_H
+#define FRAME_CAPTURE_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+#include <SDL3/SDL.h>
+
+// Asynchronous session recorder: captureFrame() reads the backbuffer
+// into a small staging ring and a dedicated thread quantizes and
+// LZW-encodes the frames into an animated GIF (the format of the
+// checked-in demo recording). The render thread pays only the readback;
+// when the encoder falls behind and the ring is full, the frame is
+// dropped and counted rather than ever blocking the render loop.
+//
+// MP4 would need an external codec library this tree doesn't carry, so
+// GIF is the one supported container.
+class FrameCapture {
+public:
+    FrameCapture();
+    ~FrameCapture();
+
+    // Open the output file and start the encoder thread. fps sets the
+    // capture cadence (frames between it are skipped, not queued); GIF
+    // timing is in 10ms steps, so rates above 50 are clamped.
+    bool start(const std::string& outputPath, int width, int height,
+               int fps = 30);
+
+    // Read the backbuffer and stage it for encoding. Must be called
+    // before SDL_RenderPresent() (the backbuffer is undefined after).
+    // No-op when capture isn't running or this frame falls between
+    // capture ticks.
+    void captureFrame(SDL_Renderer* renderer);
+
+    // Drain the ring, finalize the GIF and join the encoder thread
+    void stop();
+
+    bool isActive() const { return running.load(std::memory_order_relaxed); }
+
+    // Frames skipped because the encoder was behind (overload indicator)
+    uint64_t getDroppedCount() const {
+        return droppedFrames.load(std::memory_order_relaxed);
+    }
+
+private:
+    // Triple-buffered staging: the render thread fills slots in order,
+    // the encoder drains them in the same order. Slots carry the raw
+    // surface from SDL_RenderReadPixels(); all conversion, quantization
+    // and compression happen on the encoder thread.
+    static constexpr size_t STAGING_SLOTS = 3;
+
+    struct Slot {
+        std::atomic<bool> filled{false};
+        SDL_Surface* surface = nullptr;
+    };
+
+    Slot slots[STAGING_SLOTS];
+    size_t writeIndex;          // Render thread only
+    size_t readIndex;           // Encoder thread only
+
+    int frameWidth;
+    int frameHeight;
+    uint32_t captureIntervalMs; // 1000 / fps
+    uint32_t nextCaptureTime;   // Render-thread capture cadence clock
+    int frameDelayCentis;       // GIF per-frame delay, 1/100 s units
+
+    FILE* output;
+    std::atomic<bool> running;
+    std::atomic<uint64_t> droppedFrames;
+    std::thread encoderThread;
+
+    // Encoder thread main loop: pop staged surfaces, encode, free them
+    void encodeLoop();
+
+    // Quantize one RGBA surface and append it as a GIF frame; the
+    // scratch index buffer is reused across frames by the encoder loop
+    void encodeFrame(SDL_Surface* surface, std::vector<uint8_t>& indexScratch);
+};
+
+#endif // FRAME_CAPTURE_H
@@ -0,0 +1,39 @@
+// FILE: include/utils/FrameClock.h
+#ifndef FRAME_CLOCK_H
+#define FRAME_CLOCK_H
+
+#include <cstdint>
+
+// One "now" per tick. The manager, light, vehicles and renderer each
+// used to call SDL_GetTicks() themselves, so a single tick observed
+// several slightly different clocks (and paid a syscall per reading).
+// The driving loop freezes the clock once at the top of its tick or
+// frame via beginFrame(); everything underneath reads nowMs() and sees
+// the same instant. The frozen value is per thread, so the simulation
+// tick and the render frame each keep their own consistent "now", and
+// deterministic runs freeze the logical clock instead of the wall
+// clock (beginFrame(logicalMs)) - time-based logic then replays
+// identically regardless of wall-clock jitter.
+class FrameClock {
+public:
+    // Freeze this thread's clock at the current wall time
+    static void beginFrame();
+
+    // Freeze this thread's clock at a logical time (deterministic mode)
+    static void beginFrame(uint32_t logicalMs);
+
+    // The frozen "now" for this thread's current tick/frame. Threads
+    // that never froze (startup construction, helpers) get a live
+    // reading instead.
+    static uint32_t nowMs();
+
+    // Ticks/frames this thread has begun (monotonic tick counter)
+    static uint64_t frameIndex();
+
+private:
+    static thread_local uint32_t frozenMs;
+    static thread_local bool frozen;
+    static thread_local uint64_t frames;
+};
+
+#endif // FRAME_CLOCK_H
@@ -0,0 +1,43 @@
+// FILE: include/utils/FramePacer.h
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+#include <cstdint>
+
+// Adaptive frame pacing for the render loop. The old limiter slept a
+// whole-millisecond remainder computed from SDL_GetTicks(), so on a
+// 60Hz display it oscillated between ~55 and ~65fps and kept the CPU
+// warm even with nothing on screen. This engine instead tracks an
+// absolute next-frame deadline in nanoseconds, sleeps coarsely to just
+// short of it and spin-finishes on the high-resolution clock, and drops
+// to a low idle rate when the caller reports the scene is static - the
+// kiosk builds are passively cooled, so idle CPU burn matters.
+//
+// When the driver accepts vsync the present call already blocks on the
+// display; pace() then only rebases the deadline so a later idle
+// stretch starts from the right place.
+class FramePacer {
+public:
+    FramePacer(int targetFps, int idleFps);
+
+    // Target rate for an active scene (0 disables pacing entirely)
+    void setTargetFps(int fps);
+
+    // Tell the pacer the display is pacing active frames for us
+    void setVsyncActive(bool active);
+    bool isVsyncActive() const;
+
+    // Blocks until the next frame is due. sceneActive=false switches to
+    // the idle rate; the first active frame after an idle stretch is
+    // released immediately instead of serving out the idle period.
+    void pace(bool sceneActive);
+
+private:
+    int targetFps;
+    int idleFps;
+    bool vsyncActive;
+    bool wasIdle;
+    uint64_t nextDeadlineNs; // Absolute deadline on the SDL ns clock
+};
+
+#endif // FRAME_PACER_H
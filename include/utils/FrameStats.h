@@ -0,0 +1,54 @@
+// FILE: include/utils/FrameStats.h
+#ifndef FRAME_STATS_H
+#define FRAME_STATS_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Frame-time statistics for the render loop. The renderer used to keep
+// only lastFrameTime for pacing, so "it stutters sometimes" - the most
+// common field report - had no number attached. This collector keeps a
+// ring of recent frame intervals, summarizes p50/p95/p99/max on demand,
+// and counts stutters: frames longer than twice the ring's median,
+// which is the hitch a viewer actually notices at a steady target rate.
+class FrameStats {
+public:
+    FrameStats();
+
+    // Record one frame interval (present to present), in nanoseconds
+    void record(uint64_t frameNs);
+
+    // Percentile summary over the ring plus lifetime counters. Computed
+    // by sorting a copy of the ring, so callers should refresh a cached
+    // copy on a coarse cadence rather than every frame.
+    struct Summary {
+        float p50Ms;
+        float p95Ms;
+        float p99Ms;
+        float maxMs;      // Over the ring, not lifetime
+        uint64_t frames;   // Lifetime frames recorded
+        uint64_t stutters; // Lifetime frames > 2x the then-current median
+    };
+    Summary summarize() const;
+
+    // Log the final summary through DebugLogger (called once on
+    // renderer cleanup, so the number reaches the report even when
+    // nobody had the overlay open)
+    void logSummary() const;
+
+private:
+    // Two seconds at 60fps; old frames age out so the summary tracks
+    // the current session phase, while the stutter count is lifetime
+    static constexpr size_t RING_SIZE = 128;
+
+    uint64_t ring[RING_SIZE];
+    size_t ringCount;     // Valid entries (saturates at RING_SIZE)
+    size_t ringHead;      // Next write position
+    uint64_t totalFrames;
+    uint64_t stutterCount;
+
+    // Median of the current ring contents, in nanoseconds
+    uint64_t ringMedianNs() const;
+};
+
+#endif // FRAME_STATS_H
@@ -0,0 +1,79 @@
+// FILE: include/utils/LaneExchange.h
+#ifndef LANE_EXCHANGE_H
+#define LANE_EXCHANGE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "utils/SharedMemoryChannel.h"
+
+// A single preallocated memory-mapped exchange file that replaces the
+// four per-road lane files as the disk-backed spawn transport. The file
+// holds one fixed-size ring of VehicleMessage slots per lane, each with
+// its own write/read cursor pair in the header, so the handoff is the
+// same wait-free single-producer/single-consumer scheme as
+// SharedMemoryChannel - but backed by a regular file, so it also works
+// where POSIX shm is unavailable and it survives either side
+// restarting. Steady-state traffic costs no syscalls at all: no
+// open/append/truncate per poll, just cursor stores through the
+// mapping. The text lane files remain as the last-resort fallback.
+class LaneExchange {
+public:
+    static constexpr size_t SLOTS_PER_LANE = 256; // Per ring (power of two)
+
+    LaneExchange();
+    ~LaneExchange();
+
+    // Create the exchange file (producer side, called by the generator);
+    // replaces any stale file from a previous run
+    bool create(const std::string& path);
+
+    // Map an existing exchange file (consumer side, called by the
+    // simulator); fails until the producer has created it
+    bool open(const std::string& path);
+
+    // Push a record into its lane's ring (routed by message.lane);
+    // returns false when that ring is full
+    bool push(const VehicleMessage& message);
+
+    // Pop the next record from one lane's ring; returns false when empty
+    bool pop(char laneId, VehicleMessage& message);
+
+    // True once create() or open() succeeded
+    bool isAvailable() const;
+
+    // Unmap the file (and remove it if we created it)
+    void close();
+
+private:
+    // Each lane's cursor pair sits on its own cache line so cursor
+    // traffic for one road never bounces the others' lines
+    struct LaneCursors {
+        std::atomic<uint64_t> head;  // Next slot to read (consumer owned)
+        std::atomic<uint64_t> tail;  // Next slot to write (producer owned)
+        char padding[48];
+    };
+
+    // Layout of the mapped file: control block, then four slot regions
+    // back to back in lane order (A, B, C, D)
+    struct ExchangeHeader {
+        uint32_t magic;              // Sanity check for version mismatches
+        uint32_t slotsPerLane;
+        LaneCursors lanes[4];
+    };
+
+    static constexpr uint32_t MAGIC = 0x4C414E45; // "LANE"
+
+    ExchangeHeader* header;
+    VehicleMessage* slots;
+    std::string filePath;
+    bool owner;      // True if we created (and must remove) the file
+    bool available;
+
+#ifndef _WIN32
+    int fileFd;
+#endif
+};
+
+#endif // LANE_EXCHANGE_H
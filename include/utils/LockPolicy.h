@@ -0,0 +1,99 @@
+// FILE: include/utils/LockPolicy.h
+#ifndef LOCK_POLICY_H
+#define LOCK_POLICY_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+// Lock policies for the queue containers (Queue, PriorityQueue). The
+// containers take the policy as a template parameter, so the choice is
+// made at compile time and the uncontended path never pays for
+// machinery it doesn't use:
+//
+//  - MutexLock (default): a plain std::mutex.
+//  - InstrumentedLock (-DTRAFFIC_LOCK_PROFILE=1): std::mutex plus
+//    contention counters. A try_lock probe counts acquisitions that
+//    would have blocked and accumulates the time actually spent
+//    blocked, per instance and into the process-wide LockStats totals -
+//    this answers which of the many queue locks matter once the render
+//    and simulation threads split.
+//  - NoLock (-DTRAFFIC_SINGLE_THREADED=1): compiles the locking out
+//    entirely; only valid for single-thread headless runs.
+//
+// QueueLockPolicy below is the alias the containers default to; the
+// CMake options TRAFFIC_LOCK_PROFILE / TRAFFIC_SINGLE_THREADED select
+// the build-wide default.
+
+// Process-wide contention totals across every instrumented lock
+// (relaxed atomics; read by the stats report)
+struct LockStats {
+    static inline std::atomic<uint64_t> acquisitions{0};
+    static inline std::atomic<uint64_t> contentions{0};
+    static inline std::atomic<uint64_t> waitNs{0};
+};
+
+class MutexLock {
+public:
+    void lock() { mutex.lock(); }
+    void unlock() { mutex.unlock(); }
+
+private:
+    std::mutex mutex;
+};
+
+class InstrumentedLock {
+public:
+    void lock() {
+        LockStats::acquisitions.fetch_add(1, std::memory_order_relaxed);
+
+        // Fast path: uncontended acquisition costs one CAS, no clock
+        if (mutex.try_lock()) {
+            return;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        mutex.lock();
+        uint64_t blockedNs = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start).count());
+
+        instanceContentions.fetch_add(1, std::memory_order_relaxed);
+        instanceWaitNs.fetch_add(blockedNs, std::memory_order_relaxed);
+        LockStats::contentions.fetch_add(1, std::memory_order_relaxed);
+        LockStats::waitNs.fetch_add(blockedNs, std::memory_order_relaxed);
+    }
+
+    void unlock() { mutex.unlock(); }
+
+    // Per-instance counters for pinpointing the hot lock
+    uint64_t contentionCount() const {
+        return instanceContentions.load(std::memory_order_relaxed);
+    }
+    uint64_t waitNanos() const {
+        return instanceWaitNs.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::mutex mutex;
+    std::atomic<uint64_t> instanceContentions{0};
+    std::atomic<uint64_t> instanceWaitNs{0};
+};
+
+// Single-thread mode: every lock operation compiles to nothing
+class NoLock {
+public:
+    void lock() {}
+    void unlock() {}
+};
+
+#if defined(TRAFFIC_SINGLE_THREADED)
+using QueueLockPolicy = NoLock;
+#elif defined(TRAFFIC_LOCK_PROFILE)
+using QueueLockPolicy = InstrumentedLock;
+#else
+using QueueLockPolicy = MutexLock;
+#endif
+
+#endif // LOCK_POLICY_H
@@ -0,0 +1,46 @@
+// FILE: include/utils/MetricsHttpServer.h
+#ifndef METRICS_HTTP_SERVER_H
+#define METRICS_HTTP_SERVER_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+class MetricsSegment;
+struct MetricsBlock;
+
+// Opt-in Prometheus exposition endpoint (--metrics-port=<port>). A
+// background thread accepts scrapes and answers GET /metrics with the
+// counters and gauges from the seqlock metrics block - the same
+// non-perturbing path the shared-memory sidecar uses, so a scrape
+// never takes a lock the simulation thread can contend on. One
+// request is served at a time; Prometheus scrape intervals make that
+// plenty for a load-lab fleet.
+class MetricsHttpServer {
+public:
+    MetricsHttpServer();
+    ~MetricsHttpServer();
+
+    // Bind and start the serving thread; returns false if the port
+    // can't be bound (the simulator keeps running without the endpoint)
+    bool start(uint16_t port, MetricsSegment* metricsSegment);
+
+    // Stop the thread and close the socket (idempotent)
+    void stop();
+
+    bool isRunning() const;
+
+private:
+    void serveLoop();
+
+    // Render the block as Prometheus text exposition format
+    static std::string buildExposition(const MetricsBlock& block);
+
+    MetricsSegment* segment;
+    int listenFd;
+    std::thread serverThread;
+    std::atomic<bool> running;
+};
+
+#endif // METRICS_HTTP_SERVER_H
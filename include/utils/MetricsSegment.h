@@ -0,0 +1,87 @@
+// FILE: include/utils/MetricsSegment.h
+#ifndef METRICS_SEGMENT_H
+#define METRICS_SEGMENT_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+// The metrics block a monitoring sidecar samples. Plain fixed-width
+// fields only - the consumer maps the segment and reads the struct, no
+// text parsing. This replaces scraping the lane status file, which cost
+// the simulator a file write per lane and the consumer a parser.
+struct MetricsBlock {
+    static constexpr int LANE_SLOTS = 12; // 4 roads x 3 lanes
+
+    uint64_t simTimeMs;      // Logical simulation clock
+    uint32_t tickMs;         // Duration the last update() tick covered
+    int32_t lightState;      // TrafficLight::State as an int
+    uint64_t totalArrivals;  // Vehicles spawned since start
+    uint64_t totalDepartures;
+    float waitP50;           // Queue wait percentiles in seconds
+    float waitP90;
+    float waitP99;
+
+    struct LaneMetrics {
+        char laneId;         // 'A'..'D'
+        int8_t laneNumber;   // 1..3
+        int8_t priorityActive;
+        int8_t pad;
+        int32_t queueDepth;
+        float arrivalsPerMin;
+        float departuresPerMin;
+    } lanes[LANE_SLOTS];
+};
+
+// A single metrics block in a named shared-memory segment, published
+// with seqlock semantics: the writer bumps a sequence counter to odd,
+// copies the block, then bumps it to even. A sampling sidecar rereads
+// until it sees the same even sequence on both sides of its copy, so
+// it can poll at 10Hz (or any rate) without ever blocking the
+// simulation thread - the writer takes no lock and never waits.
+// Follows the SharedMemoryChannel conventions: POSIX shm, magic-checked
+// header, graceful unavailability on platforms without shm.
+class MetricsSegment {
+public:
+    MetricsSegment();
+    ~MetricsSegment();
+
+    // Create the segment (writer side, called by the simulator)
+    bool create(const std::string& name = "/traffic_metrics");
+
+    // Open an existing segment (reader side, called by the sidecar)
+    bool open(const std::string& name = "/traffic_metrics");
+
+    // Seqlock write of the whole block (writer side, one writer only)
+    void publish(const MetricsBlock& block);
+
+    // Seqlock read; returns false if the segment is unavailable or the
+    // writer raced us through the retry budget
+    bool sample(MetricsBlock& out) const;
+
+    // True once create() or open() succeeded
+    bool isAvailable() const;
+
+    // Close the mapping (and unlink it if we created the segment)
+    void close();
+
+private:
+    struct SharedHeader {
+        std::atomic<uint32_t> sequence; // Odd while a write is in flight
+        uint32_t magic;                 // Sanity check for version mismatches
+        MetricsBlock block;
+    };
+
+    static constexpr uint32_t MAGIC = 0x54454D54; // "TMET"
+
+    SharedHeader* header;
+    std::string shmName;
+    bool owner;      // True if we created (and must unlink) the segment
+    bool available;
+
+#ifndef _WIN32
+    int shmFd;
+#endif
+};
+
+#endif // METRICS_SEGMENT_H
@@ -5,10 +5,20 @@
 #include <vector>
 #include <algorithm>
 #include <functional>
+#include <memory>
 #include <mutex>
-
-// A priority queue implementation for the traffic simulation
-template<typename T>
+#include <stdexcept>
+#include <unordered_map>
+#include "utils/LockPolicy.h"
+
+// A priority queue implementation for the traffic simulation.
+// Backed by a binary max-heap with an element->slot index map, so
+// enqueue/dequeue are O(log n) and updatePriority() re-sifts just the
+// touched element - the old version ran std::sort over everything on
+// every insertion and priority change.
+// The Lock parameter selects the locking policy (plain mutex,
+// contention-instrumented, or compiled out - see utils/LockPolicy.h).
+template<typename T, typename Lock = QueueLockPolicy>
 class PriorityQueue {
 public:
     // Element with priority
@@ -16,17 +26,7 @@ public:
         T element;
         int priority;
 
-        // Constructor
         PriorityElement(const T& e, int p) : element(e), priority(p) {}
-
-        // Comparison operator for std::sort
-        bool operator<(const PriorityElement& other) const {
-            return priority < other.priority;
-        }
-
-        bool operator>(const PriorityElement& other) const {
-            return priority > other.priority;
-        }
     };
 
     PriorityQueue() = default;
@@ -34,33 +34,43 @@ public:
 
     // Add element with priority
     void enqueue(const T& element, int priority) {
-        std::lock_guard<std::mutex> lock(mutex);
+        std::lock_guard<Lock> lock(mutex);
 
-        // Add element with priority
         elements.push_back(PriorityElement(element, priority));
+        indexMap[element] = elements.size() - 1;
 
-        // Sort in descending order (higher priority first)
-        std::sort(elements.begin(), elements.end(), std::greater<PriorityElement>());
+        // Restore the heap property from the new leaf upward
+        siftUp(elements.size() - 1);
     }
 
     // Get the highest priority element
     T dequeue() {
-        std::lock_guard<std::mutex> lock(mutex);
+        std::lock_guard<Lock> lock(mutex);
 
         if (elements.empty()) {
             throw std::runtime_error("PriorityQueue is empty");
         }
 
-        // Get the highest priority element
         T element = elements.front().element;
-        elements.erase(elements.begin());
+        indexMap.erase(element);
+
+        // Move the last leaf to the root and sift it down
+        if (elements.size() > 1) {
+            elements.front() = elements.back();
+            indexMap[elements.front().element] = 0;
+        }
+        elements.pop_back();
+
+        if (!elements.empty()) {
+            siftDown(0);
+        }
 
         return element;
     }
 
     // Peek at the highest priority element without removing it
     T peek() const {
-        std::lock_guard<std::mutex> lock(mutex);
+        std::lock_guard<Lock> lock(mutex);
 
         if (elements.empty()) {
             throw std::runtime_error("PriorityQueue is empty");
@@ -69,64 +79,167 @@ public:
         return elements.front().element;
     }
 
-    // Update the priority of an element if it exists
+    // Update the priority of an element if it exists.
+    // The index map gives O(1) lookup; only the touched element is
+    // re-sifted instead of re-sorting the whole container.
     bool updatePriority(const T& element, int newPriority, std::function<bool(const T&, const T&)> comparator) {
-        std::lock_guard<std::mutex> lock(mutex);
-
-        // Find the element
-        auto it = std::find_if(elements.begin(), elements.end(),
-                             [&](const PriorityElement& pe) {
-                                 return comparator(pe.element, element);
-                             });
-
-        if (it != elements.end()) {
-            // Update the priority
-            it->priority = newPriority;
+        std::lock_guard<Lock> lock(mutex);
+
+        size_t index;
+        auto mapIt = indexMap.find(element);
+        if (mapIt != indexMap.end()) {
+            index = mapIt->second;
+        } else {
+            // Fall back to comparator identity for elements that don't
+            // compare equal directly
+            auto it = std::find_if(elements.begin(), elements.end(),
+                                 [&](const PriorityElement& pe) {
+                                     return comparator(pe.element, element);
+                                 });
+            if (it == elements.end()) {
+                return false;
+            }
+            index = static_cast<size_t>(it - elements.begin());
+        }
 
-            // Re-sort the elements
-            std::sort(elements.begin(), elements.end(), std::greater<PriorityElement>());
+        int oldPriority = elements[index].priority;
+        elements[index].priority = newPriority;
 
-            return true;
+        if (newPriority > oldPriority) {
+            siftUp(index);
+        } else if (newPriority < oldPriority) {
+            siftDown(index);
         }
 
-        return false;
+        return true;
     }
 
     // Check if the queue is empty
     bool isEmpty() const {
-        std::lock_guard<std::mutex> lock(mutex);
+        std::lock_guard<Lock> lock(mutex);
         return elements.empty();
     }
 
     // Get the size of the queue
     size_t size() const {
-        std::lock_guard<std::mutex> lock(mutex);
+        std::lock_guard<Lock> lock(mutex);
         return elements.size();
     }
 
     // Clear the queue
     void clear() {
-        std::lock_guard<std::mutex> lock(mutex);
+        std::lock_guard<Lock> lock(mutex);
         elements.clear();
+        indexMap.clear();
+    }
+
+    // Visit every element under one lock acquisition, in heap order
+    // (NOT priority order - no sort, no copy, no allocation). The
+    // visitor inlines as a template parameter; use this for membership
+    // scans and aggregate checks, and getAllElements() for the rare
+    // display paths that need strict ordering.
+    template<typename Visitor>
+    void forEach(Visitor&& visit) const {
+        std::lock_guard<Lock> lock(mutex);
+
+        for (const auto& pe : elements) {
+            visit(pe.element, pe.priority);
+        }
     }
 
     // Get all elements in priority order
     std::vector<T> getAllElements() const {
-        std::lock_guard<std::mutex> lock(mutex);
+        std::lock_guard<Lock> lock(mutex);
 
-        std::vector<T> result;
-        result.reserve(elements.size());
+        // The heap array isn't fully sorted, so sort a copy for callers
+        // that want strict priority order (rare, display-only path)
+        std::vector<PriorityElement> sorted = elements;
+        std::sort(sorted.begin(), sorted.end(),
+                  [](const PriorityElement& a, const PriorityElement& b) {
+                      return a.priority > b.priority;
+                  });
 
-        for (const auto& pe : elements) {
+        std::vector<T> result;
+        result.reserve(sorted.size());
+        for (const auto& pe : sorted) {
             result.push_back(pe.element);
         }
 
         return result;
     }
 
+    // Allocation-aware variant: fills a caller-supplied vector (e.g. an
+    // arena-backed ArenaVector), so per-frame snapshots don't touch the
+    // heap. The scratch copy for sorting uses the same allocator.
+    template<typename Alloc>
+    void getAllElements(std::vector<T, Alloc>& out) const {
+        std::lock_guard<Lock> lock(mutex);
+
+        using ElementAlloc = typename std::allocator_traits<Alloc>::
+            template rebind_alloc<PriorityElement>;
+        std::vector<PriorityElement, ElementAlloc> sorted{
+            ElementAlloc(out.get_allocator())};
+        sorted.assign(elements.begin(), elements.end());
+        std::sort(sorted.begin(), sorted.end(),
+                  [](const PriorityElement& a, const PriorityElement& b) {
+                      return a.priority > b.priority;
+                  });
+
+        out.clear();
+        out.reserve(sorted.size());
+        for (const auto& pe : sorted) {
+            out.push_back(pe.element);
+        }
+    }
+
 private:
-    std::vector<PriorityElement> elements;
-    mutable std::mutex mutex;
+    // Move the element at index toward the root while it outranks its parent
+    void siftUp(size_t index) {
+        while (index > 0) {
+            size_t parent = (index - 1) / 2;
+            if (elements[index].priority <= elements[parent].priority) {
+                break;
+            }
+            swapSlots(index, parent);
+            index = parent;
+        }
+    }
+
+    // Move the element at index toward the leaves while a child outranks it
+    void siftDown(size_t index) {
+        while (true) {
+            size_t left = index * 2 + 1;
+            size_t right = index * 2 + 2;
+            size_t largest = index;
+
+            if (left < elements.size() &&
+                elements[left].priority > elements[largest].priority) {
+                largest = left;
+            }
+            if (right < elements.size() &&
+                elements[right].priority > elements[largest].priority) {
+                largest = right;
+            }
+
+            if (largest == index) {
+                break;
+            }
+
+            swapSlots(index, largest);
+            index = largest;
+        }
+    }
+
+    // Swap two heap slots and keep the index map in sync
+    void swapSlots(size_t a, size_t b) {
+        std::swap(elements[a], elements[b]);
+        indexMap[elements[a].element] = a;
+        indexMap[elements[b].element] = b;
+    }
+
+    std::vector<PriorityElement> elements;        // Binary max-heap
+    std::unordered_map<T, size_t> indexMap;       // Element -> heap slot
+    mutable Lock mutex;
 };
 
-#endif // PRIORITY_QUEUE_Hendif // PRIORITY_QUEUE_H
+#endif // PRIORITY_QUEUE_H
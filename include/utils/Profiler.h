@@ -0,0 +1,113 @@
+// FILE: include/utils/Profiler.h
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Lightweight hot-path instrumentation: a Profiler::Scope stamps the
+// steady clock on entry and writes {phase, duration} into a per-thread
+// ring buffer on exit - no locks and no allocation on the timed path.
+// The debug overlay calls snapshot() to aggregate the recent samples
+// into a per-phase millisecond breakdown, so a frame spike can be
+// attributed to file I/O, overlap checking, drawing, etc. instead of
+// guessed at. Phase names must be string literals: the ring stores the
+// pointer and aggregation keys on pointer identity.
+class Profiler {
+public:
+    // RAII timer for one phase
+    class Scope {
+    public:
+        explicit Scope(const char* phaseName);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        const char* name;
+        uint64_t startNs;
+    };
+
+    // Aggregated view of one phase across the recent ring contents
+    struct PhaseStats {
+        const char* name;
+        float averageMs; // Mean over the samples still in the rings
+        float maxMs;     // Worst sample still in the rings
+        uint32_t samples;
+    };
+
+    // Aggregate all threads' rings (called from the overlay, ~once per
+    // frame; the rings keep being written while we read - entries are
+    // self-contained, so a torn read at worst misattributes one sample)
+    static std::vector<PhaseStats> snapshot();
+
+    // Chrome-tracing capture (--trace=out.json): while active, every
+    // Scope also emits a complete event into a bounded lock-free ring
+    // that a background writer streams out as chrome://tracing JSON.
+    // The timed threads never block on file I/O - on overload events
+    // are dropped and counted, same policy as the async logger. Load
+    // the result at chrome://tracing or https://ui.perfetto.dev.
+    static bool startTrace(const std::string& path);
+    static void stopTrace();
+
+private:
+    static constexpr size_t RING_SIZE = 256; // Per thread, power of two
+
+    struct Entry {
+        const char* name;
+        uint64_t durationNs;
+    };
+
+    struct ThreadRing {
+        std::atomic<uint32_t> head;
+        Entry entries[RING_SIZE];
+    };
+
+    // Ring for the calling thread, registered on first use
+    static ThreadRing* ringForThisThread();
+
+    // All registered rings plus the mutex guarding registration
+    static std::vector<ThreadRing*>& registry();
+    static std::mutex& registryMutex();
+
+    static void record(const char* name, uint64_t durationNs);
+
+    // --- Trace capture (same Vyukov ring scheme as DebugLogger) ---
+    static constexpr size_t TRACE_RING_SIZE = 16384; // Power of two
+
+    struct TraceCell {
+        std::atomic<size_t> sequence;
+        const char* name;
+        uint64_t startNs;
+        uint64_t durationNs;
+        uint32_t tid;
+    };
+
+    static std::atomic<bool> traceActive;
+    static TraceCell traceRing[TRACE_RING_SIZE];
+    static std::atomic<size_t> traceEnqueuePos;
+    static std::atomic<size_t> traceDequeuePos;
+    static std::atomic<uint64_t> traceDropped;
+    static std::thread traceThread;
+    static std::atomic<bool> traceRunning;
+    static FILE* traceFile; // Touched only by start/stop and the writer
+
+    static uint32_t threadId();
+    static void tracePush(const char* name, uint64_t startNs,
+                          uint64_t durationNs);
+    static void traceLoop();
+
+    friend class Scope;
+};
+
+// Convenience for instrumenting a block:
+//   PROFILE_SCOPE("sim.update");
+#define PROFILE_SCOPE(name) Profiler::Scope profilerScope_(name)
+
+#endif // PROFILER_H
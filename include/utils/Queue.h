@@ -3,95 +3,307 @@
 #define QUEUE_H
 
 #include <vector>
+#include <atomic>
 #include <mutex>
 #include <stdexcept>
 #include <algorithm>
+#include <cstdint>
 #include <string>
-#include <functional>
+#include "utils/LockPolicy.h"
 
-// A thread-safe queue implementation for the traffic simulation
-template<typename T>
+// A thread-safe queue implementation for the traffic simulation.
+// Backed by a circular buffer with head/count indices so both enqueue
+// and dequeue are O(1) amortized - the old vector-based version did
+// erase(begin()) which shuffled the whole lane on every dequeue.
+// The Lock parameter selects the locking policy (plain mutex,
+// contention-instrumented, or compiled out - see utils/LockPolicy.h).
+template<typename T, typename Lock = QueueLockPolicy>
 class Queue {
 public:
-    Queue() = default;
+    Queue()
+        : buffer(INITIAL_CAPACITY),
+          head(0),
+          count(0),
+          version(0),
+          liveCount(0),
+          snapshotDirty(true) {}
+
     ~Queue() = default;
 
     // Add element to the queue
     void enqueue(const T& element) {
-        std::lock_guard<std::mutex> lock(mutex);
-        elements.push_back(element);
+        std::lock_guard<Lock> lock(mutex);
+
+        if (count == buffer.size()) {
+            grow();
+        }
+
+        buffer[(head + count) % buffer.size()] = element;
+        count++;
+        liveCount.store(count, std::memory_order_relaxed);
+        version++;
+        snapshotDirty = true;
+    }
+
+    // Conditional enqueue: insert only while the queue holds fewer than
+    // maxCount elements. The check and the insert share one lock
+    // acquisition, so concurrent producers can never overshoot the cap.
+    // Returns false (and leaves the queue untouched) when full.
+    bool enqueueIfBelow(const T& element, size_t maxCount) {
+        std::lock_guard<Lock> lock(mutex);
+
+        if (count >= maxCount) {
+            return false;
+        }
+
+        if (count == buffer.size()) {
+            grow();
+        }
+
+        buffer[(head + count) % buffer.size()] = element;
+        count++;
+        liveCount.store(count, std::memory_order_relaxed);
+        version++;
+        snapshotDirty = true;
+        return true;
+    }
+
+    // Bulk conditional enqueue: admit elements in order under a single
+    // lock acquisition, stopping once the queue reaches maxCount, with
+    // one version bump for the whole batch. Returns the number
+    // admitted; the tail of the batch is left untouched for the caller.
+    size_t enqueueBulkIfBelow(const std::vector<T>& elements, size_t maxCount) {
+        std::lock_guard<Lock> lock(mutex);
+
+        size_t admitted = 0;
+        while (admitted < elements.size() && count < maxCount) {
+            if (count == buffer.size()) {
+                grow();
+            }
+            buffer[(head + count) % buffer.size()] = elements[admitted];
+            count++;
+            admitted++;
+        }
+
+        if (admitted > 0) {
+            liveCount.store(count, std::memory_order_relaxed);
+            version++;
+            snapshotDirty = true;
+        }
+        return admitted;
     }
 
     // Remove and return the front element
     T dequeue() {
-        std::lock_guard<std::mutex> lock(mutex);
+        std::lock_guard<Lock> lock(mutex);
 
-        if (elements.empty()) {
+        if (count == 0) {
             throw std::runtime_error("Queue is empty");
         }
 
-        T element = elements.front();
-        elements.erase(elements.begin());
+        T element = buffer[head];
+        head = (head + 1) % buffer.size();
+        count--;
+        liveCount.store(count, std::memory_order_relaxed);
+        version++;
+        snapshotDirty = true;
 
         return element;
     }
 
     // Peek at the front element without removing it
     T peek() const {
-        std::lock_guard<std::mutex> lock(mutex);
+        std::lock_guard<Lock> lock(mutex);
 
-        if (elements.empty()) {
+        if (count == 0) {
             throw std::runtime_error("Queue is empty");
         }
 
-        return elements.front();
+        return buffer[head];
     }
 
-    // Check if the queue is empty
+    // Check if the queue is empty (lock-free; see size())
     bool isEmpty() const {
-        std::lock_guard<std::mutex> lock(mutex);
-        return elements.empty();
+        return liveCount.load(std::memory_order_relaxed) == 0;
     }
 
-    // Get the size of the queue
+    // Get the size of the queue. Reads the mirrored atomic counter
+    // instead of taking the lock: the light controller's averaging pass,
+    // the priority update and the renderer together query every lane's
+    // depth 50+ times per frame, and each of those used to contend the
+    // queue mutex against the update path for a single size_t. A
+    // relaxed read can be at most one mutation stale, which none of
+    // those callers can distinguish anyway.
     size_t size() const {
-        std::lock_guard<std::mutex> lock(mutex);
-        return elements.size();
+        return liveCount.load(std::memory_order_relaxed);
     }
 
     // Clear the queue
     void clear() {
-        std::lock_guard<std::mutex> lock(mutex);
-        elements.clear();
+        std::lock_guard<Lock> lock(mutex);
+        head = 0;
+        count = 0;
+        liveCount.store(0, std::memory_order_relaxed);
+        version++;
+        snapshotDirty = true;
     }
 
-    // Remove a specific element from anywhere in the queue (used for vehicle removal by ID)
-    bool remove(const T& element, std::function<bool(const T&, const T&)> comparator) {
-        std::lock_guard<std::mutex> lock(mutex);
-
-        auto it = std::find_if(elements.begin(), elements.end(),
-                             [&](const T& e) {
-                                 return comparator(e, element);
-                             });
+    // Remove a specific element from anywhere in the queue (used for
+    // vehicle removal by ID). The comparator is a template parameter so
+    // the callable inlines instead of going through std::function.
+    template<typename Compare>
+    bool remove(const T& element, Compare comparator) {
+        std::lock_guard<Lock> lock(mutex);
 
-        if (it != elements.end()) {
-            elements.erase(it);
-            return true;
+        for (size_t i = 0; i < count; i++) {
+            size_t index = (head + i) % buffer.size();
+            if (comparator(buffer[index], element)) {
+                // Shift the tail portion forward one slot to fill the gap
+                for (size_t j = i; j + 1 < count; j++) {
+                    buffer[(head + j) % buffer.size()] =
+                        buffer[(head + j + 1) % buffer.size()];
+                }
+                count--;
+                liveCount.store(count, std::memory_order_relaxed);
+                version++;
+                snapshotDirty = true;
+                return true;
+            }
         }
 
         return false;
     }
 
+    // Batch removal: compact every element matching the predicate out
+    // of the queue in one stable sweep under a single lock acquisition.
+    // Matches are appended to `removed` in queue order, survivors keep
+    // their relative order, and the version bumps once for the whole
+    // batch. Returns the number removed.
+    template<typename Predicate>
+    size_t removeIf(Predicate pred, std::vector<T>& removed) {
+        std::lock_guard<Lock> lock(mutex);
+
+        size_t kept = 0;
+        for (size_t i = 0; i < count; i++) {
+            T& element = buffer[(head + i) % buffer.size()];
+            if (pred(element)) {
+                removed.push_back(element);
+            } else {
+                buffer[(head + kept) % buffer.size()] = element;
+                kept++;
+            }
+        }
+
+        size_t removedCount = count - kept;
+        if (removedCount > 0) {
+            count = kept;
+            liveCount.store(count, std::memory_order_relaxed);
+            version++;
+            snapshotDirty = true;
+        }
+
+        return removedCount;
+    }
+
+    // Visit every element in queue order under one lock acquisition.
+    // The visitor is a template parameter so the callable inlines
+    // instead of going through std::function, and nothing is copied -
+    // this is the safe replacement for holding the getAllElements()
+    // reference across queue mutations. Keep the visitor short: the
+    // lock is held for the whole sweep.
+    template<typename Visitor>
+    void forEach(Visitor&& visit) const {
+        std::lock_guard<Lock> lock(mutex);
+
+        for (size_t i = 0; i < count; i++) {
+            visit(buffer[(head + i) % buffer.size()]);
+        }
+    }
+
+    // forEach starting at the given queue position; the sweep LOD in
+    // TrafficManager::processLane() uses it to step over the parked
+    // front segment without visiting it
+    template<typename Visitor>
+    void forEachFrom(size_t start, Visitor&& visit) const {
+        std::lock_guard<Lock> lock(mutex);
+
+        for (size_t i = start; i < count; i++) {
+            visit(buffer[(head + i) % buffer.size()]);
+        }
+    }
+
+    // Bulk snapshot into a caller-supplied vector (reused scratch or an
+    // arena-backed ArenaVector), for callers that need random access
+    // after the lock is released without a fresh heap allocation
+    template<typename Alloc>
+    void getAllElements(std::vector<T, Alloc>& out) const {
+        std::lock_guard<Lock> lock(mutex);
+
+        out.clear();
+        out.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            out.push_back(buffer[(head + i) % buffer.size()]);
+        }
+    }
+
     // Get all elements for iteration (e.g., for rendering)
     const std::vector<T>& getAllElements() const {
-        // Note: This returns a const reference, so caller must not modify the vector
-        // This avoids copying the entire vector while still providing access for iteration
-        return elements;
+        // Note: This returns a const reference, so caller must not modify the vector.
+        // The linear snapshot is rebuilt lazily - only after a mutation - so
+        // repeated render-loop calls on an unchanged queue cost nothing.
+        std::lock_guard<Lock> lock(mutex);
+
+        if (snapshotDirty) {
+            snapshot.clear();
+            snapshot.reserve(count);
+            for (size_t i = 0; i < count; i++) {
+                snapshot.push_back(buffer[(head + i) % buffer.size()]);
+            }
+            snapshotDirty = false;
+        }
+
+        return snapshot;
+    }
+
+    // Monotonic mutation counter; lets callers publish a new snapshot
+    // only when the contents actually changed (see Lane::publishRenderSnapshot)
+    uint64_t getVersion() const {
+        std::lock_guard<Lock> lock(mutex);
+        return version;
+    }
+
+    // Bytes held by the ring's backing storage (for memory telemetry;
+    // the ring only ever grows, so this tracks the high-water mark)
+    size_t storageBytes() const {
+        std::lock_guard<Lock> lock(mutex);
+        return buffer.capacity() * sizeof(T);
     }
 
 private:
-    std::vector<T> elements;
-    mutable std::mutex mutex;
+    static constexpr size_t INITIAL_CAPACITY = 16;
+
+    // Double the ring capacity, re-linearizing the elements from head
+    void grow() {
+        std::vector<T> newBuffer(buffer.size() * 2);
+        for (size_t i = 0; i < count; i++) {
+            newBuffer[i] = buffer[(head + i) % buffer.size()];
+        }
+        buffer = std::move(newBuffer);
+        head = 0;
+    }
+
+    std::vector<T> buffer;  // Circular storage
+    size_t head;            // Index of the front element
+    size_t count;           // Number of live elements (guarded by mutex)
+    uint64_t version;       // Bumped on every mutation
+
+    // Mirror of count, stored under the lock by every mutation and read
+    // relaxed by size()/isEmpty() so depth queries never touch the lock
+    std::atomic<size_t> liveCount;
+
+    mutable std::vector<T> snapshot; // Linearized view for getAllElements()
+    mutable bool snapshotDirty;
+    mutable Lock mutex;
 };
 
-#endif // QUEUE_Hendif // QUEUE_Hendif // QUEUE_H
+#endif // QUEUE_H
@@ -0,0 +1,78 @@
+// FILE: include/utils/SharedMemoryChannel.h
+#ifndef SHARED_MEMORY_CHANNEL_H
+#define SHARED_MEMORY_CHANNEL_H
+
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <string>
+
+// A fixed-width vehicle record that fits in one ring buffer slot.
+// Both the traffic generator (producer) and the simulator (consumer)
+// speak this struct, so a spawn is a single memcpy on each side.
+struct VehicleMessage {
+    char id[24];          // Vehicle ID string, e.g. "V42_L2_LEFT" (null terminated)
+    char lane;            // 'A', 'B', 'C' or 'D'
+    int8_t laneNumber;    // 1, 2 or 3
+    int8_t destination;   // 0 = STRAIGHT, 1 = LEFT, 2 = RIGHT
+    int8_t emergency;     // 1 if emergency vehicle
+    uint64_t timestamp;   // Creation stamp: CLOCK_MONOTONIC microseconds.
+                          // Comparable across processes on one host, so
+                          // the simulator can measure write-to-enqueue
+                          // spawn latency (see SimulationStats)
+};
+
+// A lock-free single-producer/single-consumer ring buffer living in a
+// named shared memory segment. The generator process creates the segment
+// and pushes vehicles; the simulator opens it and pops them every frame,
+// so spawns no longer wait for the 200ms file poll or disk round trips.
+// If the segment can't be created/opened (e.g. on platforms without
+// POSIX shm), both sides fall back to the lane files transparently.
+class SharedMemoryChannel {
+public:
+    static constexpr size_t CAPACITY = 1024; // Slots (power of two)
+
+    SharedMemoryChannel();
+    ~SharedMemoryChannel();
+
+    // Create the segment (producer side, called by the generator)
+    bool create(const std::string& name = "/traffic_vehicle_channel");
+
+    // Open an existing segment (consumer side, called by the simulator)
+    bool open(const std::string& name = "/traffic_vehicle_channel");
+
+    // Push a vehicle record; returns false if the ring is full
+    bool push(const VehicleMessage& message);
+
+    // Pop the next vehicle record; returns false if the ring is empty
+    bool pop(VehicleMessage& message);
+
+    // True once create() or open() succeeded
+    bool isAvailable() const;
+
+    // Close the mapping (and unlink it if we created the segment)
+    void close();
+
+private:
+    // Layout of the shared segment: control block followed by the slots
+    struct SharedHeader {
+        std::atomic<uint64_t> head;  // Next slot to read (consumer owned)
+        std::atomic<uint64_t> tail;  // Next slot to write (producer owned)
+        uint32_t magic;              // Sanity check for version mismatches
+        uint32_t capacity;
+    };
+
+    static constexpr uint32_t MAGIC = 0x54524146; // "TRAF"
+
+    SharedHeader* header;
+    VehicleMessage* slots;
+    std::string shmName;
+    bool owner;      // True if we created (and must unlink) the segment
+    bool available;
+
+#ifndef _WIN32
+    int shmFd;
+#endif
+};
+
+#endif // SHARED_MEMORY_CHANNEL_H
@@ -0,0 +1,50 @@
+// FILE: include/utils/SpscRing.h
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <atomic>
+#include <cstddef>
+
+// A bounded lock-free single-producer/single-consumer ring buffer, used
+// as the mailbox between adjacent junctions in the JunctionGraph. Each
+// directed edge gets its own ring, and the step scheduler guarantees at
+// most one thread is on either end during a tick, so plain acquire/
+// release indices are all the synchronization needed. Capacity must be
+// a power of two.
+template<typename T, size_t Capacity>
+class SpscRing {
+    static_assert((Capacity & (Capacity - 1)) == 0,
+                  "SpscRing capacity must be a power of two");
+
+public:
+    SpscRing() : head(0), tail(0) {}
+
+    // Producer side; returns false when the ring is full
+    bool push(const T& item) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (t - head.load(std::memory_order_acquire) >= Capacity) {
+            return false;
+        }
+        buffer[t & (Capacity - 1)] = item;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side; returns false when the ring is empty
+    bool pop(T& item) {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = buffer[h & (Capacity - 1)];
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    T buffer[Capacity];
+    std::atomic<size_t> head; // Consumer cursor
+    std::atomic<size_t> tail; // Producer cursor
+};
+
+#endif // SPSC_RING_H
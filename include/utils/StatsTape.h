@@ -0,0 +1,117 @@
+// FILE: include/utils/StatsTape.h
+#ifndef STATS_TAPE_H
+#define STATS_TAPE_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Columnar per-tick statistics sink ("stats tape"). Every simulation
+// tick appends one fixed-width sample - per-lane queue depth, arrivals
+// and departures for that tick, plus the light state - and a background
+// writer lands them in a column-oriented binary file. Offline analysis
+// used to scrape these numbers out of DebugLogger text lines with
+// regex; the columnar layout loads a week-long run into analysis
+// tooling in seconds because each metric is one contiguous strip per
+// block instead of a field buried in every row. stats_csv converts a
+// tape to CSV as a post-step for tools that want rows.
+//
+// Samples accumulate row-wise in a front buffer on the simulation
+// thread; when a block fills, the buffers swap under a brief lock and
+// the writer thread transposes the full block into columns and writes
+// it. The tick therefore pays one struct copy per sample and one
+// pointer swap per block - never a transpose, never a write. If the
+// writer is still busy when the next block fills (disk stall), the
+// block is dropped and counted rather than stalling the tick, same
+// policy as the logger's ring.
+
+// On-disk layout, shared with the stats_csv converter. A file is one
+// StatsTapeHeader followed by blocks; each block is a
+// StatsTapeBlockHeader followed by its columns in declaration order:
+// timeMs[n], lightState[n], then depth, arrivals and departures as
+// LANE_SLOTS strips of n each. Lane slots are in canonical order
+// (A1..A3, B1..B3, C1..C3, D1..D3), recorded in the header.
+struct StatsTapeHeader {
+    uint32_t magic;      // Sanity check for version mismatches
+    uint32_t version;
+    uint32_t laneSlots;  // 12
+    uint32_t blockTicks; // Samples in every block but the last
+    char laneIds[12];
+    int8_t laneNumbers[12];
+};
+
+struct StatsTapeBlockHeader {
+    uint32_t tickCount; // <= blockTicks; short only for the final block
+};
+
+class StatsTape {
+public:
+    static constexpr int LANE_SLOTS = 12;       // 4 roads x 3 lanes
+    static constexpr uint32_t BLOCK_TICKS = 4096;
+    static constexpr uint32_t MAGIC = 0x50415453; // "STAP"
+    static constexpr uint32_t VERSION = 1;
+
+    // One tick's metrics. depth is the queue length at sample time;
+    // arrivals/departures are the counts for this tick only (saturated
+    // at 255, far above anything one 16ms tick produces).
+    struct TickSample {
+        uint32_t timeMs;              // Logical simulation time
+        uint8_t lightState;           // TrafficLight::State as an int
+        uint16_t depth[LANE_SLOTS];
+        uint8_t arrivals[LANE_SLOTS];
+        uint8_t departures[LANE_SLOTS];
+    };
+
+    StatsTape();
+    ~StatsTape();
+
+    StatsTape(const StatsTape&) = delete;
+    StatsTape& operator=(const StatsTape&) = delete;
+
+    // Create (or truncate) the tape file and start the writer thread
+    bool open(const std::string& path);
+
+    // Append one tick's sample (simulation thread only)
+    void append(const TickSample& sample);
+
+    // Flush the partial tail block and join the writer
+    void close();
+
+    bool isOpen() const;
+
+    // Blocks discarded because the writer couldn't keep up
+    uint64_t droppedBlocks() const;
+
+private:
+    void writerLoop();
+
+    // Transpose one block into columns and write it (writer thread, or
+    // the closing thread for the tail)
+    void writeBlock(const TickSample* samples, uint32_t tickCount);
+
+    std::FILE* file;
+
+    // Double buffer: the simulation thread fills front; full blocks
+    // swap into back for the writer
+    std::vector<TickSample> frontBuffer;
+    std::vector<TickSample> backBuffer;
+    uint32_t frontCount;
+    uint32_t backCount;
+    bool backPending;
+
+    bool running;
+    std::mutex swapMutex;
+    std::condition_variable wake;
+    std::thread writerThread;
+
+    uint64_t dropped;
+
+    // Column staging for the transpose (writer thread only)
+    std::vector<uint8_t> columnScratch;
+};
+
+#endif // STATS_TAPE_H
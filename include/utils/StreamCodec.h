@@ -0,0 +1,66 @@
+// FILE: include/utils/StreamCodec.h
+#ifndef STREAM_CODEC_H
+#define STREAM_CODEC_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+// Self-contained LZ4-class block codec for the always-on capture sinks
+// (the event journal and the async logger's file sink). Multi-day soaks
+// on the edge devices are disk-bandwidth bound, and the journal and log
+// are both highly repetitive - fixed-width records, recurring labels -
+// so a byte-oriented match coder recovers most of the redundancy at a
+// memcpy-class decode cost. Implemented here rather than vendored: the
+// tree vendors nothing but SDL3, and the format only has to round-trip
+// with itself.
+//
+// Block format (classic token scheme): each sequence is a token byte
+// whose high nibble is the literal count and low nibble the match
+// length minus 4 (both 15 = extended by 255-continuation bytes),
+// followed by the literals, a 2-byte little-endian backwards offset and
+// any match-length extension bytes. The final sequence is literals
+// only. Matches are found greedily through a 4-byte hash table over a
+// 64 KB window.
+//
+// Frame format (what the sinks actually write): a stream is a series of
+// independent frames, each [u32 rawBytes][u32 compBytes][payload], both
+// little-endian. compBytes == rawBytes marks a stored (incompressible)
+// frame whose payload is the raw bytes verbatim. Frames never reference
+// each other, so a reader can start decoding at any frame boundary -
+// which is what lets the journal's block and keyframe indexes keep
+// seeking by file offset.
+namespace StreamCodec {
+
+    // Bytes of frame header preceding every payload
+    constexpr size_t FRAME_HEADER_BYTES = 2 * sizeof(uint32_t);
+
+    // Worst-case compressed size for a raw block (expansion bound for
+    // sizing scratch buffers; stored frames never exceed rawBytes)
+    size_t maxCompressedSize(size_t rawBytes);
+
+    // Compress one block. Returns the compressed byte count, or 0 when
+    // the input doesn't shrink (caller stores it raw) or dst is too
+    // small.
+    size_t compressBlock(const char* src, size_t srcLen,
+                         char* dst, size_t dstCap);
+
+    // Decompress one block produced by compressBlock(). rawLen must be
+    // the exact original size (it is carried in the frame header).
+    // Returns false on corrupt input.
+    bool decompressBlock(const char* src, size_t srcLen,
+                         char* dst, size_t rawLen);
+
+    // Append one frame (header + payload, stored or compressed as the
+    // data dictates) for the given raw block to out.
+    void appendFrame(const char* src, size_t srcLen, std::vector<char>& out);
+
+    // Decode the frame starting at src (srcLen bytes available) into
+    // out, replacing its contents. On success sets frameBytes to the
+    // total encoded size (header + payload). Returns false on a
+    // truncated or corrupt frame.
+    bool readFrame(const char* src, size_t srcLen, std::vector<char>& out,
+                   size_t& frameBytes);
+}
+
+#endif // STREAM_CODEC_H
@@ -0,0 +1,63 @@
+// FILE: include/utils/TaskPool.h
+#ifndef TASK_POOL_H
+#define TASK_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A small pool of persistent worker threads for data-parallel sweeps.
+// parallelFor(count, task) runs task(i) for every index across the
+// workers and the calling thread, then returns when all are done -
+// indices are claimed with an atomic counter, so uneven lane depths
+// balance themselves. Workers block on a condition variable between
+// dispatches; there is no queue and no allocation per dispatch, which
+// suits the one-dispatch-per-tick usage in processVehicles().
+class TaskPool {
+public:
+    // threadCount 0 sizes to hardware concurrency minus one (the
+    // calling thread participates as the final worker)
+    explicit TaskPool(unsigned threadCount = 0);
+    ~TaskPool();
+
+    TaskPool(const TaskPool&) = delete;
+    TaskPool& operator=(const TaskPool&) = delete;
+
+    // Run task(i) for i in [0, count); blocks until every index has
+    // completed. One dispatch at a time per pool.
+    void parallelFor(size_t count, const std::function<void(size_t)>& task);
+
+    // Worker threads (excluding the caller); 0 means parallelFor runs
+    // everything inline
+    unsigned workerCount() const;
+
+private:
+    void workerLoop();
+
+    // Claim and run indices until the dispatch is drained. Operates on
+    // a snapshot taken under poolMutex so a straggler never touches
+    // state a later parallelFor() has reset.
+    void drainCurrentDispatch(const std::function<void(size_t)>& task,
+                              size_t count);
+
+    std::vector<std::thread> workers;
+
+    std::mutex poolMutex;
+    std::condition_variable workAvailable;
+    std::condition_variable workDone;
+
+    const std::function<void(size_t)>* currentTask;
+    size_t taskCount;
+    std::atomic<size_t> nextIndex;
+    std::atomic<size_t> remaining;
+    uint64_t generation; // Bumped per dispatch so each worker wakes once
+    unsigned activeDrainers; // Workers inside the claim loop (guarded by poolMutex)
+    bool shuttingDown;
+};
+
+#endif // TASK_POOL_H
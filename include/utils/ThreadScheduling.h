@@ -0,0 +1,32 @@
+// FILE: include/utils/ThreadScheduling.h
+#ifndef THREAD_SCHEDULING_H
+#define THREAD_SCHEDULING_H
+
+// Thread placement and priority helpers for the kiosk machines. Their
+// big.LITTLE parts migrate the tick thread mid-frame under the default
+// scheduler, which shows up as frame-time jitter, so the hot threads
+// can be pinned to distinct cores (--pin-sim / --pin-render) and the
+// tick thread optionally raised to real-time (--rt-sim). Background
+// flushers (logger, capture encoder, config watcher) demote themselves
+// instead, which steers them onto the efficiency cores under
+// energy-aware scheduling without hard-coding a core list.
+//
+// Every call is best-effort: unsupported platforms and missing
+// privileges return false and the thread runs with default scheduling.
+namespace ThreadScheduling {
+
+    // Pin the calling thread to one core (0-based)
+    bool pinCurrentThreadToCore(int core);
+
+    // Raise the calling thread to real-time round-robin scheduling.
+    // Usually needs elevated privileges; callers treat failure as a
+    // log-and-continue.
+    bool setCurrentThreadRealtime();
+
+    // Demote the calling thread to idle/background scheduling so it
+    // only runs on cycles the simulation and render threads don't want
+    bool setCurrentThreadBackground();
+
+}
+
+#endif // THREAD_SCHEDULING_H
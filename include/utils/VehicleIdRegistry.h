@@ -0,0 +1,28 @@
+// FILE: include/utils/VehicleIdRegistry.h
+#ifndef VEHICLE_ID_REGISTRY_H
+#define VEHICLE_ID_REGISTRY_H
+
+#include <cstdint>
+#include <string>
+
+// Interning table that maps the generator's textual vehicle labels
+// (e.g. "V123_L2_LEFT") to dense uint32_t ids. Vehicles used to carry
+// the label as a std::string member, so every spawn paid a heap
+// allocation and every id comparison was a string compare; now the hot
+// paths carry and compare plain integers and the label is only looked
+// up for log output.
+class VehicleIdRegistry {
+public:
+    // Register a label and get its integer id. Labels are unique per
+    // spawn, so this appends rather than deduplicating.
+    static uint32_t intern(const std::string& label);
+
+    // Display label for an interned id. The returned reference stays
+    // valid for the whole run.
+    static const std::string& label(uint32_t id);
+
+    // Number of interned labels (for diagnostics)
+    static size_t size();
+};
+
+#endif // VEHICLE_ID_REGISTRY_H
@@ -0,0 +1,52 @@
+// FILE: include/utils/VehiclePool.h
+#ifndef VEHICLE_POOL_H
+#define VEHICLE_POOL_H
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include "core/Vehicle.h"
+
+// A slab/pool allocator for Vehicle objects. Vehicles churn constantly
+// (spawned by the file handler, destroyed when they exit the junction),
+// and allocating each one with plain new/delete means thousands of small
+// heap allocations per minute plus fragmentation. The pool hands out
+// recycled slots from fixed-size slabs instead; construction/destruction
+// still runs normally via placement new, so Vehicle itself is unchanged.
+class VehiclePool {
+public:
+    // Construct a vehicle in a pooled slot (replaces `new Vehicle(...)`)
+    static Vehicle* acquire(const std::string& id, char lane, int laneNumber,
+                            bool isEmergency = false);
+
+    // Destroy a vehicle and recycle its slot (replaces `delete vehicle`)
+    static void release(Vehicle* vehicle);
+
+    // Destroy a whole batch and recycle the slots under one lock
+    // acquisition (exit bursts hand back dozens at once)
+    static void releaseAll(const std::vector<Vehicle*>& vehicles);
+
+    // Number of slots currently handed out (for diagnostics)
+    static size_t activeCount();
+
+    // Total slots across all slabs (for diagnostics)
+    static size_t capacity();
+
+private:
+    static constexpr size_t SLAB_SIZE = 64; // Vehicles per slab
+
+    // Raw, correctly aligned storage for one Vehicle
+    struct Slot {
+        alignas(Vehicle) unsigned char storage[sizeof(Vehicle)];
+    };
+
+    // Allocate another slab and push its slots onto the free list
+    static void addSlab();
+
+    static std::vector<Slot*> slabs;       // Owned slabs (never freed while running)
+    static std::vector<Slot*> freeSlots;   // Recycled slots ready for reuse
+    static size_t active;
+    static std::mutex poolMutex;
+};
+
+#endif // VEHICLE_POOL_H
@@ -0,0 +1,49 @@
+// FILE: include/utils/WaitHistogram.h
+#ifndef WAIT_HISTOGRAM_H
+#define WAIT_HISTOGRAM_H
+
+#include <cstdint>
+
+// High-dynamic-range histogram of queue wait times in milliseconds.
+// Buckets are geometric - eight linear sub-buckets per power of two -
+// so one fixed 320-counter array covers sub-second waits and multi-hour
+// pathologies alike with at most 12.5% relative error. record() is a
+// bit scan and an increment, cheap enough to run on every dequeue; the
+// quantiles this yields (p50/p99/p999) are what the priority thresholds
+// in Constants.h should be tuned against instead of eyeballing the
+// animation.
+//
+// Not synchronized: both record() and the readers run on the simulation
+// thread (dequeue and the periodic export in TrafficManager::update).
+class WaitHistogram {
+public:
+    WaitHistogram();
+
+    // O(1): bucket the wait and bump its counter
+    void record(uint64_t waitMs);
+
+    // Number of recorded waits
+    uint64_t totalCount() const;
+
+    // Largest wait seen, exact (not bucket-rounded)
+    uint64_t maxMs() const;
+
+    // Wait such that `fraction` of recorded waits were at or below it
+    // (bucket midpoint); fraction in (0, 1], e.g. 0.999 for p999.
+    // Returns 0 when nothing has been recorded.
+    uint64_t quantileMs(double fraction) const;
+
+private:
+    static constexpr int SUB_BITS = 3;
+    static constexpr int SUB = 1 << SUB_BITS; // Sub-buckets per power of two
+    static constexpr int BUCKET_COUNT = 320;  // Covers waits up to ~2^40 ms
+
+    static int bucketFor(uint64_t ms);
+    static uint64_t bucketMidpoint(int bucket);
+
+    uint32_t buckets[BUCKET_COUNT];
+    uint64_t total;
+    uint64_t maxSeen;
+};
+
+#endif // WAIT_HISTOGRAM_H
@@ -0,0 +1,75 @@
+// FILE: include/visualization/DrawList.h
+#ifndef DRAW_LIST_H
+#define DRAW_LIST_H
+
+#include <SDL3/SDL.h>
+#include <vector>
+
+#include "visualization/GeometryBatch.h"
+
+// Command buffer for draw calls that would otherwise interleave
+// SDL_SetRenderDrawColor with individual primitives. Frame captures of
+// the scenery and overlay paths showed thousands of one-primitive
+// batches because every color change breaks SDL's internal batching.
+//
+// Recording sidesteps the color problem entirely: setColor() only
+// updates a pending color, and each shape bakes it in as a per-vertex
+// attribute, so the whole untextured stream collapses into a single
+// SDL_RenderGeometry call with draw order preserved. Textured quads are
+// grouped into one run per texture and submitted after the shapes, so
+// the only remaining state changes at flush() are one texture bind per
+// distinct texture.
+//
+// Callers bracket a layer with begin()/flush(); ordering between
+// layers (scenery under vehicles under overlay) is expressed by
+// flushing each layer before starting the next, exactly as the
+// GeometryBatch call sites already do.
+class DrawList {
+public:
+    DrawList();
+
+    // Start a new layer's recording (keeps allocated capacity)
+    void begin();
+
+    // Set the color applied to shapes recorded after this call
+    void setColor(Uint8 r, Uint8 g, Uint8 b, Uint8 a = 255);
+
+    // Filled axis-aligned rectangle in the current color
+    void fillRect(const SDL_FRect& rect);
+
+    // 1px rectangle outline in the current color
+    void rectOutline(const SDL_FRect& rect);
+
+    // 1px line segment in the current color
+    void line(float x1, float y1, float x2, float y2);
+
+    // Filled triangle in the current color
+    void triangle(float x1, float y1, float x2, float y2,
+                  float x3, float y3);
+
+    // Textured quad; quads sharing a texture are submitted as one run
+    void texturedQuad(SDL_Texture* texture, const SDL_FRect& src,
+                      const SDL_FRect& dst);
+
+    // Submit everything recorded since begin(): the untextured shapes
+    // in one call, then one call per distinct texture
+    void flush(SDL_Renderer* renderer);
+
+private:
+    // Per-texture vertex/index run; the handful of textures in play
+    // makes a linear scan cheaper than any map
+    struct TextureRun {
+        SDL_Texture* texture;
+        std::vector<SDL_Vertex> vertices;
+        std::vector<int> indices;
+    };
+
+    TextureRun& runFor(SDL_Texture* texture);
+
+    SDL_Color currentColor;
+    GeometryBatch shapes;
+    std::vector<TextureRun> runs;
+    size_t activeRuns; // Runs in use this frame; the rest keep capacity
+};
+
+#endif // DRAW_LIST_H
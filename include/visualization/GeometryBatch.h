@@ -0,0 +1,45 @@
+// FILE: include/visualization/GeometryBatch.h
+#ifndef GEOMETRY_BATCH_H
+#define GEOMETRY_BATCH_H
+
+#include <SDL3/SDL.h>
+#include <vector>
+
+// Accumulates untextured quads, triangles and (thin-quad) lines into one
+// vertex/index buffer and submits them with a single SDL_RenderGeometry
+// call. Per-vehicle rendering used to issue a dozen SDL_RenderFillRect/
+// SDL_RenderLine calls each, so a busy junction paid more in SDL call
+// overhead than in rasterization; batched, the whole vehicle layer is
+// one draw call. The buffers keep their capacity across frames.
+class GeometryBatch {
+public:
+    GeometryBatch();
+
+    // Start a new frame's batch (keeps allocated capacity)
+    void begin();
+
+    // Filled axis-aligned rectangle
+    void pushQuad(const SDL_FRect& rect, SDL_Color color);
+
+    // 1px rectangle outline as four thin quads
+    void pushRectOutline(const SDL_FRect& rect, SDL_Color color);
+
+    // Filled triangle
+    void pushTriangle(float x1, float y1, float x2, float y2,
+                      float x3, float y3, SDL_Color color);
+
+    // 1px line segment as a thin quad
+    void pushLine(float x1, float y1, float x2, float y2, SDL_Color color);
+
+    // Submit everything accumulated since begin() in one call
+    void flush(SDL_Renderer* renderer);
+
+private:
+    // Append four corners as two indexed triangles
+    void pushCorners(const SDL_FPoint corners[4], const SDL_FColor& color);
+
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
+};
+
+#endif // GEOMETRY_BATCH_H
@@ -0,0 +1,73 @@
+// FILE: include/visualization/GlyphAtlas.h
+#ifndef GLYPH_ATLAS_H
+#define GLYPH_ATLAS_H
+
+#include <SDL3/SDL.h>
+#include <string>
+#include <unordered_map>
+
+class TextureCache;
+
+// All text in the simulator used to be rasterized character by character
+// from SDL line primitives on every frame - the statistics overlay alone
+// was hundreds of draw calls. GlyphAtlas rasterizes the vector font once
+// into a single texture; strings then render as textured quads off that
+// one texture, which SDL's render batching collapses into a handful of
+// draw calls. Stable labels can additionally be baked into their own
+// cached texture and drawn as a single quad.
+class GlyphAtlas {
+public:
+    // Shared instance (all rendering happens on the render thread)
+    static GlyphAtlas& get();
+
+    // Draw text as textured quads; builds the atlas on first use. Falls
+    // back to the old per-character line drawing if target textures are
+    // unavailable.
+    void drawText(SDL_Renderer* renderer, const char* text, size_t length,
+                  int x, int y, SDL_Color color);
+
+    // Draw a stable label through the per-string texture cache: the
+    // string is baked into its own texture once and drawn as one quad
+    void drawCachedString(SDL_Renderer* renderer, const std::string& text,
+                          int x, int y, SDL_Color color);
+
+    // Baked-texture cache used by ensureAtlas(); null disables caching.
+    // Set by the renderer that owns the cache, cleared at its cleanup.
+    void setTextureCache(TextureCache* cache);
+
+    // Destroy all textures (call before the renderer goes away)
+    void shutdown();
+
+    // Monospace cell metrics (glyphs are 6x10 in an 8x12 cell)
+    static constexpr int GLYPH_ADVANCE = 8;
+    static constexpr int GLYPH_HEIGHT = 12;
+
+    // Rasterize one character from line primitives in the current draw
+    // color (the pre-atlas code path, also used to build the atlas)
+    static void drawGlyphLines(SDL_Renderer* renderer, char c, int x, int y);
+
+private:
+    GlyphAtlas();
+
+    GlyphAtlas(const GlyphAtlas&) = delete;
+    GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+
+    // Printable ASCII range baked into the atlas
+    static constexpr int FIRST_CHAR = 32;
+    static constexpr int LAST_CHAR = 126;
+
+    // Keep the label cache from growing without bound if a caller feeds
+    // it dynamic strings by mistake
+    static constexpr size_t MAX_CACHED_STRINGS = 128;
+
+    // Build the atlas texture on first use; false if it can't be built
+    bool ensureAtlas(SDL_Renderer* renderer);
+
+    SDL_Texture* atlas;
+    bool atlasFailed; // Don't retry a failed build every frame
+    TextureCache* textureCache; // Not owned; may be null
+
+    std::unordered_map<std::string, SDL_Texture*> stringCache;
+};
+
+#endif // GLYPH_ATLAS_H
@@ -1,4 +1,4 @@
-// F// FILE: include/visualization/Renderer.h
+// FILE: include/visualization/Renderer.h
 #ifndef RENDERER_H
 #define RENDERER_H
 
@@ -8,7 +8,16 @@
 #include <memory>
 #include <random>
 #include <cmath>
+#include <unordered_map>
 #include "core/Vehicle.h" // For Direction enum
+#include "utils/FrameArena.h"
+#include "utils/FrameCapture.h"
+#include "utils/FramePacer.h"
+#include "utils/FrameStats.h"
+#include "visualization/DrawList.h"
+#include "visualization/GeometryBatch.h"
+#include "visualization/TextureCache.h"
+#include "visualization/VehicleSpriteAtlas.h"
 
 class Lane;
 class TrafficLight;
@@ -40,22 +49,55 @@ public:
     // Toggle debug overlay
     void toggleDebugOverlay();
 
-    // Set frame rate limiter
+    // Set the active-scene frame rate target (idle frames pace at 10fps
+    // regardless; see FramePacer)
     void setFrameRateLimit(int fps);
 
+    // Record the session to an animated GIF; frames are staged off the
+    // render thread and encoded asynchronously (see FrameCapture)
+    bool startCapture(const std::string& outputPath, int fps = 30);
+
 private:
     // SDL component
     SDL_Window* window;
     SDL_Renderer* renderer;
     SDL_Texture* carTexture;
+    SDL_Texture* backgroundTexture; // Static scenery rendered once at init
+    SDL_Texture* sceneTexture;      // Persistent composited frame for dirty-region mode
+    SDL_Texture* overlayTexture;    // Debug overlay layer, repainted on data changes only
     SDL_Surface* surface;
 
     // Rendering state
     bool active;
     bool showDebugOverlay;
-    int frameRateLimit;
     uint32_t lastFrameTime;
 
+    // Presentation suspended: the window is minimized, hidden or fully
+    // occluded, so compositing and presenting would be wasted work. The
+    // loop keeps ticking the simulation and processing events (an
+    // expose resumes immediately) but skips renderFrame() and idles on
+    // a coarse sleep instead of the frame pacer.
+    bool renderSuspended;
+
+    // Vsync-aware pacing with sleep/spin-finish and a 10fps idle floor
+    // for the passively cooled kiosk machines
+    FramePacer framePacer;
+
+    // Present-to-present interval collector for the stutter report
+    // (see FrameStats); the overlay shows a cached summary refreshed
+    // twice a second and cleanup() dumps the final one to the log
+    FrameStats frameStats;
+    FrameStats::Summary frameStatsSummary;
+    uint32_t frameStatsSummaryMs; // Last summary refresh (FrameClock)
+
+    // Asynchronous GIF session recorder (idle unless startCapture ran)
+    FrameCapture frameCapture;
+
+    // On-disk cache of the baked textures (background, atlases):
+    // relaunches upload the cached pixels instead of re-rasterizing,
+    // shrinking the watchdog-restart black-window gap
+    TextureCache textureCache;
+
     // Window dimensions
     int windowWidth;
     int windowHeight;
@@ -63,11 +105,67 @@ private:
     // Traffic manager
     TrafficManager* trafficManager;
 
+    // Bump allocator for per-frame transients (overlay log snapshot,
+    // statistics text); reset at the top of every renderFrame()
+    FrameArena frameArena;
+
+    // Shared vertex buffer: all vehicles push their geometry here and
+    // the layer is submitted in one SDL_RenderGeometry call
+    GeometryBatch vehicleBatch;
+    VehicleSpriteAtlas vehicleAtlas;
+
+    // Command buffer for the scenery and overlay layers: color changes
+    // are recorded per vertex and each layer flushes as sorted runs
+    // instead of interleaving draw-state calls with primitives
+    DrawList drawList;
+
+    // Statistics text, re-formatted only when the SimulationStats
+    // version moves; most frames just redraw these cached lines
+    std::vector<std::string> statsLines;
+    std::vector<SDL_Color> statsColors;
+    uint64_t statsVersion;
+
+    // Which lane slot each cached stats line describes (-1 for header
+    // and summary rows); positions the sparkline blit next to its row
+    std::vector<int> statsRowSlots;
+
+    // Queue-depth sparklines: one horizontal strip per lane slot,
+    // painted into a cached texture that refreshes only when the stats
+    // engine pushes a new depth sample (once a second). Steady frames
+    // just blit per-row slices of it.
+    SDL_Texture* sparklineTexture;
+    uint64_t sparklineGeneration;
+
+    // Recent-log lines for the overlay, re-snapshotted (and truncated)
+    // only when DebugLogger's generation stamp moves; most frames just
+    // redraw these cached lines without touching the logger's mutex
+    std::vector<std::string> overlayLogLines;
+    uint64_t overlayLogGeneration;
+
+    // Light state as painted into the overlay layer; a state change is
+    // one of the overlay's invalidation sources (the stats version
+    // doesn't cover it)
+    int overlayLightState;
+
+    // Dirty-region tracking: the scene persists in sceneTexture between
+    // frames, so a frame only re-composites the rectangles that changed
+    // (moved vehicles, the animated light panels, the overlay column).
+    // lastVehicleRects remembers where each vehicle was drawn so a mover
+    // dirties both its old and new footprint.
+    std::unordered_map<uint32_t, SDL_FRect> lastVehicleRects;
+    std::vector<SDL_FRect> dirtyRegions;
+    bool fullRedrawNeeded;
+
     // Helper drawing functions
     void drawRoadsAndLanes();
     void drawTrafficLights();
     void drawVehicles();
+    // Blit the overlay layer, repainting it first only when a source
+    // generation advanced (stats version, log generation, light state,
+    // or the coarse frame-summary refresh)
     void drawDebugOverlay();
+    bool overlayContentChanged() const;
+    void paintDebugOverlay();
     void drawLaneLabels();
     void drawStatistics();
     void drawAlertIcon(int x, int y);
@@ -86,7 +184,9 @@ private:
     void drawLaneLegend();
     void drawLaneFlowArrow(int x, int y, Direction dir);
 
-    // Text and character rendering
+    // Text and character rendering. The pointer/length core lets
+    // arena-backed strings draw without converting to std::string.
+    void drawText(const char* text, size_t length, int x, int y, SDL_Color color);
     void drawText(const std::string& text, int x, int y, SDL_Color color);
     void drawSimpleChar(char c, int x, int y);
 
@@ -98,12 +198,26 @@ private:
     // Load textures
     bool loadTextures();
 
+    // Render all static scenery (roads, lanes, labels) into a cached
+    // texture so renderFrame() can blit it instead of redrawing it
+    bool createBackgroundTexture();
+
     // Process SDL events
     bool processEvents();
 
+    // True while anything on screen is animating (i.e. vehicles exist);
+    // drives the pacer's idle mode
+    bool sceneIsActive() const;
+
+    // Dirty-region support: gather this frame's changed rectangles
+    // (escalating fullRedrawNeeded when they approach the whole window)
+    // and grow/clamp/queue a single rectangle
+    void collectDirtyRegions();
+    void markDirty(float x, float y, float w, float h);
+
     // Helper to draw a filled arrow
     void drawArrow(int x1, int y1, int x2, int y2, int x3, int y3, SDL_Color color);
     void drawDirectionArrow(int x, int y, Direction dir, SDL_Color color);
 };
 
-#endif // RENDERER_Hf // RENDERER_Hendif // RENDERER_Hendif // RENDERER_Hendif // RENDERER_Hendif // RENDERER_H
+#endif // RENDERER_H
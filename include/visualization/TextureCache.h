@@ -0,0 +1,72 @@
+// FILE: include/visualization/TextureCache.h
+#ifndef TEXTURE_CACHE_H
+#define TEXTURE_CACHE_H
+
+#include <SDL3/SDL.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// On-disk cache of procedurally rendered textures. The background
+// scenery, the glyph atlas and the vehicle sprite atlas are all baked
+// from primitives at startup; the kiosks relaunch the simulator on a
+// watchdog, and re-rasterizing everything is most of the user-visible
+// black-window gap. The cache captures each baked texture's pixels once
+// (StreamCodec-compressed - flat procedural art shrinks enormously) and
+// later launches upload them straight into textures instead of
+// re-drawing.
+//
+// Every entry is validated by key and dimensions, and the whole file by
+// a version constant: bump VERSION whenever any baked art changes and
+// the next launch silently re-bakes and re-stores everything. A
+// missing, truncated or mismatched cache is never an error - it just
+// means the slow path this class replaces.
+class TextureCache {
+public:
+    TextureCache();
+    ~TextureCache();
+
+    TextureCache(const TextureCache&) = delete;
+    TextureCache& operator=(const TextureCache&) = delete;
+
+    // Load the cache file if present and version-compatible; always
+    // succeeds in the sense that the cache is usable (possibly empty)
+    void open(const std::string& path);
+
+    // Upload a cached entry as a static texture. Null on a miss or a
+    // dimension mismatch - the caller then bakes and store()s as usual.
+    // Blend/scale modes are the caller's to set, same as after a bake.
+    SDL_Texture* load(SDL_Renderer* renderer, const std::string& key,
+                      int width, int height);
+
+    // Read back a freshly baked target texture and stage its pixels
+    // under the key (replacing any previous entry)
+    bool store(SDL_Renderer* renderer, SDL_Texture* texture,
+               const std::string& key);
+
+    // Write staged entries to disk; no-op unless something was stored
+    // since the last save
+    void save();
+
+private:
+    struct Entry {
+        std::string key;
+        int32_t width;
+        int32_t height;
+        std::vector<char> pixels; // RGBA8888, width*4 pitch
+    };
+
+    static constexpr uint32_t MAGIC = 0x48435854; // "TXCH"
+
+    // Bump when any procedurally baked art changes; a mismatch discards
+    // the file wholesale
+    static constexpr uint32_t VERSION = 1;
+
+    Entry* find(const std::string& key);
+
+    std::vector<Entry> entries;
+    std::string filePath;
+    bool dirty;
+};
+
+#endif // TEXTURE_CACHE_H
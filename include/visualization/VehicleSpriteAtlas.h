@@ -0,0 +1,98 @@
+// FILE: include/visualization/VehicleSpriteAtlas.h
+#ifndef VEHICLE_SPRITE_ATLAS_H
+#define VEHICLE_SPRITE_ATLAS_H
+
+#include <SDL3/SDL.h>
+#include <vector>
+
+class TextureCache;
+
+// Pre-rendered vehicle sprites in one texture. Vehicle::render() pushes
+// ~15 primitives per vehicle per frame into the geometry batch (body,
+// shading, border, destination indicator); all of that is static per
+// variant, so the atlas bakes every variant once at init - the twelve
+// lane color schemes plus the default and the two emergency flash
+// phases, each in the three destination-indicator columns - and a
+// vehicle then costs four textured vertices as a rotated atlas quad.
+// The whole vehicle layer stays a single SDL_RenderGeometry submission,
+// now against this texture, and vehicle count is nearly free for the
+// renderer.
+//
+// Sprites are baked facing DOWN at 2x resolution; direction and turn
+// animation are quad rotation at draw time. Falls back cleanly: if the
+// driver has no render-target support, build() fails and callers keep
+// the primitive path.
+//
+// The buffers follow the persistent-VBO discipline a dedicated GPU
+// backend would use: vertices and the quad index ladder live across
+// frames and only each vehicle's four vertices are rewritten per frame
+// (an instance update in all but name). A true SDL_GPU backend needs
+// precompiled shader blobs per driver format, which this tree has no
+// toolchain to produce - the 2D renderer's internal batching hands
+// these same arrays to the GPU in one dispatch, so the structure above
+// it is what matters.
+class VehicleSpriteAtlas {
+public:
+    // Body variant rows; 0..11 are the lane slots (A1..D3)
+    static constexpr int VARIANT_DEFAULT = 12;
+    static constexpr int VARIANT_EMERGENCY_BRIGHT = 13;
+    static constexpr int VARIANT_EMERGENCY_DARK = 14;
+    static constexpr int VARIANT_COUNT = 15;
+
+    // Vehicle sprite size in world pixels (matches the primitive path)
+    static constexpr float SPRITE_W = 14.0f;
+    static constexpr float SPRITE_H = 26.0f;
+
+    VehicleSpriteAtlas();
+    ~VehicleSpriteAtlas();
+
+    VehicleSpriteAtlas(const VehicleSpriteAtlas&) = delete;
+    VehicleSpriteAtlas& operator=(const VehicleSpriteAtlas&) = delete;
+
+    // Bake all variants into the atlas texture (render thread, once).
+    // With a cache, a hit uploads the stored pixels instead of baking,
+    // and a fresh bake is stored for the next launch.
+    bool build(SDL_Renderer* renderer, TextureCache* cache = nullptr);
+
+    bool isReady() const { return atlas != nullptr; }
+
+    // Row index for a vehicle's body style
+    static int bodyVariant(char lane, int laneNumber, bool emergency,
+                           bool flashPhase);
+
+    // Start a new frame's batch (keeps allocated capacity)
+    void begin();
+
+    // One vehicle: an atlas quad centered on (cx, cy), scaled to w x h
+    // and rotated by angleDegrees (0 = facing DOWN, as baked)
+    void pushSprite(int variant, int destinationColumn, float cx, float cy,
+                    float w, float h, float angleDegrees);
+
+    // Submit every sprite pushed since begin() in one call
+    void flush(SDL_Renderer* renderer);
+
+    // Destroy the texture (call before the renderer goes away)
+    void shutdown();
+
+private:
+    // Atlas cells are the sprite at 2x plus a 2px gutter against bleed
+    static constexpr int SCALE = 2;
+    static constexpr int CELL_W = static_cast<int>(SPRITE_W) * SCALE + 4;
+    static constexpr int CELL_H = static_cast<int>(SPRITE_H) * SCALE + 4;
+
+    // Draw one variant's primitives into its cell (render target bound)
+    void bakeCell(SDL_Renderer* renderer, int variant, int destinationColumn);
+
+    SDL_Texture* atlas;
+    float atlasW;
+    float atlasH;
+
+    // Persistent instance buffers: sized to the high-water sprite
+    // count and overwritten in place each frame (see begin()). The
+    // index ladder is append-only - all quads share its pattern.
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
+    size_t spriteCount; // Sprites pushed since begin()
+};
+
+#endif // VEHICLE_SPRITE_ATLAS_H
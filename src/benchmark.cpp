@@ -0,0 +1,209 @@
+// FILE: src/benchmark.cpp
+// Microbenchmark suite for the simulator's hot paths. Build the
+// `benchmarks` target and run it before/after touching the queues,
+// the file handler or the manager update loop:
+//
+//   ./benchmarks            (all suites)
+//
+// Numbers are wall-clock via steady_clock; each suite reports average
+// nanoseconds per operation so runs can be compared across commits.
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <filesystem>
+
+#include "core/Lane.h"
+#include "core/Vehicle.h"
+#include "managers/FileHandler.h"
+#include "managers/JunctionGraph.h"
+#include "managers/TrafficManager.h"
+#include "utils/Queue.h"
+#include "utils/PriorityQueue.h"
+#include "utils/VehiclePool.h"
+#include "utils/DebugLogger.h"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Run fn() `iterations` times and report average ns/op
+template<typename Fn>
+void bench(const std::string& name, size_t iterations, Fn&& fn) {
+    auto start = Clock::now();
+    for (size_t i = 0; i < iterations; i++) {
+        fn();
+    }
+    auto end = Clock::now();
+
+    auto totalNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        end - start).count();
+
+    std::cout << "  " << std::left << std::setw(48) << name
+              << std::right << std::setw(12) << (totalNs / iterations)
+              << " ns/op  (" << iterations << " iters)\n";
+}
+
+void benchQueue() {
+    std::cout << "Queue<Vehicle*>:\n";
+
+    Queue<Vehicle*> queue;
+    Vehicle* dummy = VehiclePool::acquire("VBENCH_L2", 'A', 2);
+
+    bench("enqueue", 100000, [&]() {
+        queue.enqueue(dummy);
+    });
+
+    bench("dequeue", 100000, [&]() {
+        queue.dequeue();
+    });
+
+    // remove() from the middle of a 100-element queue
+    for (int i = 0; i < 100; i++) {
+        queue.enqueue(dummy);
+    }
+    auto same = [](Vehicle* const& a, Vehicle* const& b) { return a == b; };
+    bench("remove (100-deep queue)", 10000, [&]() {
+        queue.remove(dummy, same);
+        queue.enqueue(dummy);
+    });
+
+    queue.clear();
+    VehiclePool::release(dummy);
+}
+
+void benchPriorityQueue() {
+    std::cout << "PriorityQueue<Lane*>:\n";
+
+    PriorityQueue<Lane*> pq;
+    std::vector<Lane*> lanes;
+    for (char road : {'A', 'B', 'C', 'D'}) {
+        for (int num = 1; num <= 3; num++) {
+            Lane* lane = new Lane(road, num);
+            lanes.push_back(lane);
+            pq.enqueue(lane, 0);
+        }
+    }
+
+    auto same = [](Lane* const& a, Lane* const& b) { return a == b; };
+    int priority = 0;
+    bench("updatePriority (12 lanes)", 100000, [&]() {
+        pq.updatePriority(lanes[priority % lanes.size()], priority % 100, same);
+        priority++;
+    });
+
+    pq.clear();
+    for (auto* lane : lanes) {
+        delete lane;
+    }
+}
+
+void benchFileIngestion() {
+    std::cout << "FileHandler ingestion:\n";
+
+    const std::string benchPath = "data/bench_lanes";
+    FileHandler handler(benchPath);
+    handler.initializeFiles();
+
+    // 100 text lines per read, same format the generator writes
+    bench("readVehiclesFromFiles (100 lines)", 200, [&]() {
+        {
+            std::ofstream file(benchPath + "/laneA.txt", std::ios::trunc);
+            for (int i = 0; i < 100; i++) {
+                file << "V" << i << "_L2_STRAIGHT:A\n";
+            }
+        }
+        auto vehicles = handler.readVehiclesFromFiles();
+        for (auto* vehicle : vehicles) {
+            VehiclePool::release(vehicle);
+        }
+    });
+
+    std::error_code ec;
+    fs::remove_all(benchPath, ec);
+}
+
+void benchManagerTick(int vehiclesPerLane) {
+    TrafficManager manager;
+    if (!manager.initialize()) {
+        std::cout << "  (manager init failed - skipping tick benchmark)\n";
+        return;
+    }
+    manager.start();
+
+    // Fill every spawnable lane (lanes 2 and 3) with synthetic vehicles
+    int spawned = 0;
+    for (auto* lane : manager.getLanes()) {
+        if (lane->getLaneNumber() == 1) {
+            continue;
+        }
+        for (int i = 0; i < vehiclesPerLane; i++) {
+            Vehicle* vehicle = VehiclePool::acquire(
+                "VB" + std::to_string(spawned++) + "_L" +
+                std::to_string(lane->getLaneNumber()),
+                lane->getLaneId(), lane->getLaneNumber());
+            lane->enqueue(vehicle);
+        }
+    }
+
+    // Closed loop: exited vehicles re-enter at a spawn edge, so the
+    // population stays constant across all iterations and the numbers
+    // measure processVehicles()/queue costs, not a draining junction
+    manager.setVehicleRecycling(true);
+
+    bench("update() tick @ " + std::to_string(vehiclesPerLane) +
+          " vehicles/lane", 500, [&]() {
+        manager.update(16);
+    });
+
+    manager.stop();
+}
+
+void benchJunctionGraph(int junctionCount) {
+    JunctionGraph graph(junctionCount);
+    graph.seed(20);
+
+    unsigned workerCount = std::thread::hardware_concurrency();
+    if (workerCount > 1) {
+        workerCount--; // tick() participates as a worker itself
+    }
+    graph.start(workerCount);
+
+    bench("tick @ " + std::to_string(junctionCount) + " junctions", 500,
+          [&]() {
+        graph.tick(16);
+    });
+
+    graph.stop();
+}
+
+} // namespace
+
+int main() {
+    // Log to a separate file so benchmark runs don't clobber the simulator log
+    DebugLogger::initialize("benchmark.log");
+
+    std::cout << "=== Traffic simulator microbenchmarks ===\n";
+
+    benchQueue();
+    benchPriorityQueue();
+    benchFileIngestion();
+
+    std::cout << "TrafficManager:\n";
+    for (int vehiclesPerLane : {10, 100, 1000}) {
+        benchManagerTick(vehiclesPerLane);
+    }
+
+    std::cout << "JunctionGraph:\n";
+    for (int junctionCount : {16, 64}) {
+        benchJunctionGraph(junctionCount);
+    }
+
+    std::cout << "=== done ===\n";
+    return 0;
+}
@@ -1,19 +0,0 @@
-// src/utils/vector2d.h
-#pragma once
-
-struct Vector2D {
-    float x;
-    float y;
-
-    Vector2D() : x(0.0f), y(0.0f) {}
-    Vector2D(float x, float y) : x(x), y(y) {}
-
-    Vector2D operator+(const Vector2D& other) const {
-        return Vector2D(x + other.x, y + other.y);
-    }
-
-    Vector2D operator*(float scalar) const {
-        return Vector2D(x * scalar, y * scalar);
-    }
-};
-
@@ -0,0 +1,158 @@
+// FILE: src/core/IntersectionReservations.cpp
+#include "core/IntersectionReservations.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "core/RoutePathCache.h"
+#include "core/TurnCurveCache.h"
+#include "utils/DebugLogger.h"
+#include "utils/TuningConfig.h"
+
+namespace {
+
+// The box: the overlap of the two ROAD_WIDTH-wide roads, centered in
+// the window
+constexpr float BOX_MIN =
+    (Constants::WINDOW_WIDTH - Constants::ROAD_WIDTH) / 2.0f; // 325
+constexpr float BOX_MAX =
+    (Constants::WINDOW_WIDTH + Constants::ROAD_WIDTH) / 2.0f; // 475
+
+// Sampling step along the path while rasterizing a footprint
+constexpr float SAMPLE_STEP = 4.0f;
+
+// Mark the grid cell containing (x, y) when it falls inside the box;
+// returns whether it did
+bool markCell(float x, float y, size_t grid, uint16_t& mask) {
+    if (x < BOX_MIN || x >= BOX_MAX || y < BOX_MIN || y >= BOX_MAX) {
+        return false;
+    }
+    float cellSize = (BOX_MAX - BOX_MIN) / static_cast<float>(grid);
+    size_t cx = static_cast<size_t>((x - BOX_MIN) / cellSize);
+    size_t cy = static_cast<size_t>((y - BOX_MIN) / cellSize);
+    mask |= static_cast<uint16_t>(1u << (cy * grid + cx));
+    return true;
+}
+
+// Walk a polyline at SAMPLE_STEP, marking cells and accumulating the
+// in-box path length
+void rasterize(const std::vector<Point>& points, size_t grid,
+               uint16_t& mask, float& lengthInBox) {
+    for (size_t i = 0; i + 1 < points.size(); i++) {
+        float dx = points[i + 1].x - points[i].x;
+        float dy = points[i + 1].y - points[i].y;
+        float length = std::sqrt(dx * dx + dy * dy);
+        if (length <= 0.0f) {
+            continue;
+        }
+        int steps = std::max(1, static_cast<int>(length / SAMPLE_STEP));
+        for (int s = 0; s <= steps; s++) {
+            float t = static_cast<float>(s) / static_cast<float>(steps);
+            if (markCell(points[i].x + dx * t, points[i].y + dy * t,
+                         grid, mask)) {
+                lengthInBox += length / static_cast<float>(steps);
+            }
+        }
+    }
+}
+
+} // namespace
+
+IntersectionReservations::IntersectionReservations()
+    : footprints{},
+      slotNumber{},
+      slotMask{},
+      granted(0),
+      denied(0) {
+    // Slot number 0 never matches a live claim from slotNumber[]'s
+    // zero-initialized state only if claims start past slot 0; mark
+    // every entry expired explicitly instead of relying on that
+    std::fill(slotNumber, slotNumber + SLOT_RING, ~0ULL);
+}
+
+const IntersectionReservations::Footprint&
+IntersectionReservations::footprintFor(char laneId, int laneNumber,
+                                       Destination destination) {
+    size_t index = static_cast<size_t>(
+        Constants::laneSlot(laneId, laneNumber) * 3 +
+        static_cast<int>(destination));
+    Footprint& footprint = footprints[index];
+    if (footprint.valid) {
+        return footprint;
+    }
+
+    // Rasterize once from the shared immutable geometry: the route
+    // polyline plus the turn curve (empty for straight movements)
+    uint16_t mask = 0;
+    float lengthInBox = 0.0f;
+    rasterize(RoutePathCache::getRoute(laneId, laneNumber, destination),
+              GRID, mask, lengthInBox);
+    rasterize(TurnCurveCache::getCurve(laneId, laneNumber, destination),
+              GRID, mask, lengthInBox);
+
+    footprint.cellMask = mask;
+    if (mask != 0) {
+        // Transit time at the turn-phase speed (the slowest the
+        // movement gets), rounded up a slot for slack
+        float speedPxPerMs = 0.7f * TuningConfig::getVehicleSpeedBase();
+        float transitMs = speedPxPerMs > 0.0f ? lengthInBox / speedPxPerMs
+                                              : 0.0f;
+        footprint.transitSlots = static_cast<uint8_t>(std::min<uint32_t>(
+            SLOT_RING / 2,
+            static_cast<uint32_t>(transitMs / SLOT_MS) + 1));
+    }
+    footprint.valid = true;
+
+    DebugLogger::logAt<DebugLogger::LogLevel::DEBUG>([&] {
+        return std::string("Box footprint ") + laneId +
+               std::to_string(laneNumber) + " dest " +
+               std::to_string(static_cast<int>(destination)) + ": cells 0x" +
+               std::to_string(footprint.cellMask) + ", " +
+               std::to_string(footprint.transitSlots) + " slots";
+    });
+    return footprint;
+}
+
+bool IntersectionReservations::tryReserve(char laneId, int laneNumber,
+                                          Destination destination,
+                                          uint64_t entryMs) {
+    if (!Constants::laneSlotValid(laneId, laneNumber)) {
+        return true;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    const Footprint& footprint = footprintFor(laneId, laneNumber, destination);
+    if (footprint.cellMask == 0) {
+        // The movement never crosses the box (shouldn't happen with the
+        // current routes); nothing to claim
+        return true;
+    }
+
+    uint64_t firstSlot = entryMs / SLOT_MS;
+
+    // Conflict scan: every slot of the transit must be free of this
+    // footprint's cells. An entry holding a different absolute slot
+    // number has expired and counts as empty.
+    for (uint8_t s = 0; s < footprint.transitSlots; s++) {
+        size_t index = (firstSlot + s) % SLOT_RING;
+        if (slotNumber[index] == firstSlot + s &&
+            (slotMask[index] & footprint.cellMask) != 0) {
+            denied++;
+            return false;
+        }
+    }
+
+    // Commit: claim the cells in every slot of the transit
+    for (uint8_t s = 0; s < footprint.transitSlots; s++) {
+        size_t index = (firstSlot + s) % SLOT_RING;
+        if (slotNumber[index] != firstSlot + s) {
+            slotNumber[index] = firstSlot + s;
+            slotMask[index] = 0;
+        }
+        slotMask[index] |= footprint.cellMask;
+    }
+    granted++;
+    return true;
+}
@@ -1,14 +1,23 @@
 // FILE: src/core/Lane.cpp
 #include "core/Lane.h"
+#include "core/TrafficLight.h"
 #include "utils/DebugLogger.h"
+#include "utils/TuningConfig.h"
+#include "utils/VehiclePool.h"
 #include <sstream>
 #include "core/Constants.h"
 
 Lane::Lane(char laneId, int laneNumber)
     : laneId(laneId),
       laneNumber(laneNumber),
-      isPriority(laneId == 'A' && laneNumber == 2), // AL2 is the priority lane 
-      priority(0) {
+      isPriority(laneId == 'A' && laneNumber == 2), // AL2 is the priority lane
+      priority(0),
+      countObserver(nullptr),
+      renderSnapshot(std::make_shared<std::vector<Vehicle*>>()),
+      publishedVersion(0),
+      emergencyCount(0),
+      queueLadderDirty(true),
+      dormantCount(0) {
 
     std::ostringstream oss;
     oss << "Created lane " << laneId << laneNumber;
@@ -19,7 +28,7 @@ Lane::~Lane() {
     // Clean up vehicles
     while (!vehicleQueue.isEmpty()) {
         Vehicle* vehicle = vehicleQueue.dequeue();
-        delete vehicle;
+        VehiclePool::release(vehicle);
     }
 }
 
@@ -30,11 +39,103 @@ void Lane::enqueue(Vehicle* vehicle) {
     }
 
     vehicleQueue.enqueue(vehicle);
+    afterEnqueue(vehicle);
+}
+
+bool Lane::tryEnqueue(Vehicle* vehicle, int maxCount) {
+    if (!vehicle) {
+        DebugLogger::log("Attempted to enqueue null vehicle", DebugLogger::LogLevel::ERROR);
+        return false;
+    }
+
+    // Check and insert share one lock inside the queue, so the cap
+    // holds even with concurrent producers
+    if (!vehicleQueue.enqueueIfBelow(vehicle, static_cast<size_t>(maxCount))) {
+        return false;
+    }
+
+    afterEnqueue(vehicle);
+    return true;
+}
+
+size_t Lane::tryEnqueueBulk(const std::vector<Vehicle*>& batch, int maxCount) {
+    if (batch.empty()) {
+        return 0;
+    }
+
+    size_t admitted = vehicleQueue.enqueueBulkIfBelow(
+        batch, static_cast<size_t>(maxCount));
+    if (admitted == 0) {
+        return 0;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(indexMutex);
+        for (size_t i = 0; i < admitted; i++) {
+            vehicleIndex[batch[i]->getId()] = batch[i];
+        }
+    }
+
+    // Emergency accounting, folded over the batch (mirrors removeExited)
+    int emergencyDelta = 0;
+    for (size_t i = 0; i < admitted; i++) {
+        if (batch[i]->isEmergencyVehicle()) {
+            emergencyDelta++;
+        }
+    }
+    emergencyCount += emergencyDelta;
+
+    int currentCount = vehicleQueue.size();
+    queueLadderDirty = true;
+
+    // One count push and one preemption-index update for the whole batch
+    if (countObserver) {
+        countObserver->onLaneCountChanged(laneId, laneNumber, currentCount);
+        if (emergencyDelta != 0) {
+            countObserver->onEmergencyCountChanged(laneId, emergencyDelta);
+        }
+    }
+
+    // Same activation rule as afterEnqueue(), checked once at the final
+    // count instead of once per vehicle
+    if (isPriority && currentCount > TuningConfig::getPriorityThresholdHigh() &&
+        priority == 0) {
+        priority = 100;
+        std::ostringstream oss;
+        oss << "*** Lane " << laneId << laneNumber
+            << " PRIORITY MODE ACTIVATED: " << currentCount << " vehicles (>10) ***";
+        DebugLogger::log(oss.str());
+    }
+
+    return admitted;
+}
+
+void Lane::afterEnqueue(Vehicle* vehicle) {
+    {
+        std::lock_guard<std::mutex> lock(indexMutex);
+        vehicleIndex[vehicle->getId()] = vehicle;
+    }
     int currentCount = vehicleQueue.size();
+    queueLadderDirty = true;
+
+    // Push the count delta so the traffic light never scans lanes
+    if (countObserver) {
+        countObserver->onLaneCountChanged(laneId, laneNumber, currentCount);
+    }
+
+    // Emergency vehicles additionally feed the light's preemption index;
+    // the push happens here, at the enqueue, so detection never waits for
+    // a scan
+    if (vehicle->isEmergencyVehicle()) {
+        emergencyCount++;
+        if (countObserver) {
+            countObserver->onEmergencyCountChanged(laneId, +1);
+        }
+    }
 
     // Log the action
     std::ostringstream oss;
-    oss << "Vehicle " << vehicle->getId() << " added to lane " << laneId << laneNumber;
+    oss << "Vehicle " << vehicle->getLabel() << " added to lane " << laneId << laneNumber;
     if (isPriority) {
         oss << " (PRIORITY LANE, count=" << currentCount << ")";
     } else if (laneNumber == 3) {
@@ -44,7 +145,7 @@ void Lane::enqueue(Vehicle* vehicle) {
 
     // CRITICAL: Update priority immediately if this is the priority lane
     if (isPriority) {
-        if (currentCount > Constants::PRIORITY_THRESHOLD_HIGH && priority == 0) {
+        if (currentCount > TuningConfig::getPriorityThresholdHigh() && priority == 0) {
             priority = 100; // High priority
             std::ostringstream priorityOss;
             priorityOss << "*** Lane " << laneId << laneNumber
@@ -60,16 +161,41 @@ Vehicle* Lane::dequeue() {
     }
 
     Vehicle* vehicle = vehicleQueue.dequeue();
+    {
+        std::lock_guard<std::mutex> lock(indexMutex);
+        vehicleIndex.erase(vehicle->getId());
+    }
     int currentCount = vehicleQueue.size();
+    queueLadderDirty = true;
+    dormantCount = 0; // Positions shifted; the parked segment must rewake
+    if (countObserver) {
+        countObserver->onLaneCountChanged(laneId, laneNumber, currentCount);
+    }
+
+    if (vehicle->isEmergencyVehicle()) {
+        emergencyCount--;
+        if (countObserver) {
+            countObserver->onEmergencyCountChanged(laneId, -1);
+        }
+    }
+
+    // Feed the wait distribution (arrival stamps are second-resolution,
+    // so sub-second waits land in bucket zero)
+    time_t waitSeconds = time(nullptr) - vehicle->getArrivalTime();
+    if (waitSeconds > 0) {
+        waitHistogram.record(static_cast<uint64_t>(waitSeconds) * 1000);
+    } else {
+        waitHistogram.record(0);
+    }
 
     // Log the action
     std::ostringstream oss;
-    oss << "Vehicle " << vehicle->getId() << " removed from lane " << laneId << laneNumber;
+    oss << "Vehicle " << vehicle->getLabel() << " removed from lane " << laneId << laneNumber;
     DebugLogger::log(oss.str());
 
     // Update priority if this is the priority lane
     if (isPriority) {
-        if (currentCount < Constants::PRIORITY_THRESHOLD_LOW && priority > 0) {
+        if (currentCount < TuningConfig::getPriorityThresholdLow() && priority > 0) {
             priority = 0; // Normal priority
             std::ostringstream priorityOss;
             priorityOss << "Lane " << laneId << laneNumber
@@ -81,6 +207,104 @@ Vehicle* Lane::dequeue() {
     return vehicle;
 }
 
+bool Lane::contains(uint32_t vehicleId) const {
+    std::lock_guard<std::mutex> lock(indexMutex);
+    return vehicleIndex.find(vehicleId) != vehicleIndex.end();
+}
+
+Vehicle* Lane::removeVehicle(uint32_t vehicleId) {
+    // O(1) miss rejection through the index; the queue is only walked
+    // when the vehicle is actually here (e.g. an emergency pull-forward)
+    Vehicle* vehicle = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(indexMutex);
+        auto it = vehicleIndex.find(vehicleId);
+        if (it == vehicleIndex.end()) {
+            return nullptr;
+        }
+        vehicle = it->second;
+        vehicleIndex.erase(it);
+    }
+
+    // Pointer-equality comparator inlines through the template parameter
+    vehicleQueue.remove(vehicle,
+                        [](Vehicle* const& a, Vehicle* const& b) { return a == b; });
+    queueLadderDirty = true;
+    dormantCount = 0;
+    if (countObserver) {
+        countObserver->onLaneCountChanged(laneId, laneNumber,
+                                          static_cast<int>(vehicleQueue.size()));
+    }
+
+    if (vehicle->isEmergencyVehicle()) {
+        emergencyCount--;
+        if (countObserver) {
+            countObserver->onEmergencyCountChanged(laneId, -1);
+        }
+    }
+
+    std::ostringstream oss;
+    oss << "Vehicle " << vehicle->getLabel() << " pulled from lane " << laneId << laneNumber;
+    DebugLogger::log(oss.str());
+
+    return vehicle;
+}
+
+size_t Lane::removeExited(std::vector<Vehicle*>& exited) {
+    size_t before = exited.size();
+    size_t removed = vehicleQueue.removeIf(
+        [](Vehicle* const& vehicle) { return vehicle && vehicle->hasExited(); },
+        exited);
+    if (removed == 0) {
+        return 0;
+    }
+
+    queueLadderDirty = true;
+    dormantCount = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(indexMutex);
+        for (size_t i = before; i < exited.size(); i++) {
+            vehicleIndex.erase(exited[i]->getId());
+        }
+    }
+
+    // Wait histogram and emergency accounting, folded over the batch
+    int emergencyDelta = 0;
+    for (size_t i = before; i < exited.size(); i++) {
+        Vehicle* vehicle = exited[i];
+
+        time_t waitSeconds = time(nullptr) - vehicle->getArrivalTime();
+        waitHistogram.record(waitSeconds > 0
+            ? static_cast<uint64_t>(waitSeconds) * 1000 : 0);
+
+        if (vehicle->isEmergencyVehicle()) {
+            emergencyDelta--;
+        }
+    }
+    emergencyCount += emergencyDelta;
+
+    // One count push for the whole batch
+    int currentCount = vehicleQueue.size();
+    if (countObserver) {
+        countObserver->onLaneCountChanged(laneId, laneNumber, currentCount);
+        if (emergencyDelta != 0) {
+            countObserver->onEmergencyCountChanged(laneId, emergencyDelta);
+        }
+    }
+
+    // Same priority exit rule per-vehicle dequeue() applies
+    if (isPriority && currentCount < TuningConfig::getPriorityThresholdLow() && priority > 0) {
+        priority = 0;
+        std::ostringstream oss;
+        oss << "Lane " << laneId << laneNumber
+            << " priority reset to normal (vehicles: " << currentCount << ")";
+        DebugLogger::log(oss.str());
+    }
+
+    return removed;
+}
+
 Vehicle* Lane::peek() const {
     if (vehicleQueue.isEmpty()) {
         return nullptr;
@@ -97,9 +321,74 @@ int Lane::getVehicleCount() const {
     return vehicleQueue.size();
 }
 
-const std::vector<Vehicle*>& Lane::getVehicles() const {
-    // Get all elements from the queue for rendering
-    return vehicleQueue.getAllElements();
+void Lane::copyVehicles(std::vector<Vehicle*>& out) const {
+    vehicleQueue.getAllElements(out);
+}
+
+void Lane::publishRenderSnapshot() {
+    // Only rebuild when the queue actually mutated since the last publish;
+    // an idle lane costs one counter read per tick
+    uint64_t currentVersion = vehicleQueue.getVersion();
+    if (currentVersion == publishedVersion) {
+        return;
+    }
+
+    auto snapshot = std::make_shared<std::vector<Vehicle*>>(
+        vehicleQueue.getAllElements());
+    publishedVersion = currentVersion;
+
+    // Atomic swap: readers still drawing from the old snapshot keep it
+    // alive through their shared_ptr; new readers see the new one
+    std::atomic_store_explicit(
+        &renderSnapshot,
+        std::shared_ptr<const std::vector<Vehicle*>>(std::move(snapshot)),
+        std::memory_order_release);
+}
+
+std::shared_ptr<const std::vector<Vehicle*>> Lane::getRenderSnapshot() const {
+    return std::atomic_load_explicit(&renderSnapshot, std::memory_order_acquire);
+}
+
+void Lane::setCountObserver(TrafficLight* light) {
+    countObserver = light;
+}
+
+const WaitHistogram& Lane::getWaitHistogram() const {
+    return waitHistogram;
+}
+
+int Lane::getEmergencyCount() const {
+    return emergencyCount;
+}
+
+size_t Lane::getQueueStorageBytes() const {
+    return vehicleQueue.storageBytes();
+}
+
+void Lane::warmQueueLadder() {
+    // The ladder only changes when the count does, but it is read once
+    // per queued vehicle per tick - so the rebuild is lazy and the
+    // steady-state cost is one size check per sweep
+    size_t needed = static_cast<size_t>(vehicleQueue.size());
+    if (queueLadderDirty || queueOffsetLadder.size() < needed) {
+        queueOffsetLadder.resize(needed);
+        for (size_t slot = 0; slot < needed; slot++) {
+            queueOffsetLadder[slot] = Constants::QUEUE_SPACING * (slot + 0.2f);
+        }
+        queueLadderDirty = false;
+    }
+}
+
+float Lane::queueOffset(int queuePos) const {
+    // Called from inside forEachVehicle() sweeps, so it must not touch
+    // the queue lock; warmQueueLadder() sizes the ladder before the
+    // sweep and the steady-state cost is one bounds check and one load
+    if (queuePos < 0 || static_cast<size_t>(queuePos) >= queueOffsetLadder.size()) {
+        // Out-of-ladder slot (e.g. a vehicle counted past the rebuild);
+        // fall back to the direct arithmetic
+        return Constants::QUEUE_SPACING * (queuePos + 0.2f);
+    }
+    return queueOffsetLadder[queuePos];
 }
 
 int Lane::getPriority() const {
@@ -112,7 +401,7 @@ void Lane::updatePriority() {
     // CRITICAL: Update priority based on vehicle count for AL2 lane
     if (isPriority) {
         // PRIORITY RULE: Enter priority mode when > PRIORITY_THRESHOLD_HIGH
-        if (count > Constants::PRIORITY_THRESHOLD_HIGH && priority == 0) {
+        if (count > TuningConfig::getPriorityThresholdHigh() && priority == 0) {
             priority = 100; // High priority
             std::ostringstream oss;
             oss << "*** Lane " << laneId << laneNumber
@@ -120,7 +409,7 @@ void Lane::updatePriority() {
             DebugLogger::log(oss.str(), DebugLogger::LogLevel::INFO);
         }
         // PRIORITY RULE: Exit priority mode when < PRIORITY_THRESHOLD_LOW
-        else if (count < Constants::PRIORITY_THRESHOLD_LOW && priority > 0) {
+        else if (count < TuningConfig::getPriorityThresholdLow() && priority > 0) {
             priority = 0; // Normal priority
             std::ostringstream oss;
             oss << "*** Lane " << laneId << laneNumber
@@ -143,9 +432,7 @@ int Lane::getLaneNumber() const {
     return laneNumber;
 }
 
-std::string Lane::getName() const {
-    std::string name;
-    name += laneId;
-    name += std::to_string(laneNumber);
-    return name;
+const std::string& Lane::getName() const {
+    // Names are fixed topology data; no per-call string assembly
+    return Constants::LANE_NAMES[Constants::laneSlot(laneId, laneNumber)];
 }
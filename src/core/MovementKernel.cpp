@@ -0,0 +1,86 @@
+// FILE: src/core/MovementKernel.cpp
+#include "core/MovementKernel.h"
+#include "core/VehicleStateStore.h"
+
+#include <cmath>
+
+#if defined(__SSE2__) || (defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define MOVEMENT_KERNEL_SSE2 1
+#include <emmintrin.h>
+#endif
+
+void MovementKernel::clear() {
+    moves.clear();
+}
+
+void MovementKernel::add(const Move& move) {
+    moves.push_back(move);
+}
+
+void MovementKernel::run() {
+    size_t count = moves.size();
+    if (count == 0) {
+        return;
+    }
+
+    float* xs = VehicleStateStore::xData();
+    float* ys = VehicleStateStore::yData();
+    float* anims = VehicleStateStore::animPosData();
+
+    // Gather the scattered slots into contiguous scratch arrays
+    posXs.resize(count);
+    posYs.resize(count);
+    targetXs.resize(count);
+    targetYs.resize(count);
+    speeds.resize(count);
+
+    for (size_t i = 0; i < count; i++) {
+        posXs[i] = xs[moves[i].slot];
+        posYs[i] = ys[moves[i].slot];
+        targetXs[i] = moves[i].targetX;
+        targetYs[i] = moves[i].targetY;
+        speeds[i] = moves[i].speed;
+    }
+
+    // Normalize the direction to each target and step by the adjusted
+    // speed - the same math as the scalar path in Vehicle::update().
+    // Eligibility (checked by Vehicle::queueStraightMove) guarantees the
+    // distance is well above zero, so the division is safe.
+    size_t i = 0;
+
+#ifdef MOVEMENT_KERNEL_SSE2
+    for (; i + 4 <= count; i += 4) {
+        __m128 px = _mm_loadu_ps(&posXs[i]);
+        __m128 py = _mm_loadu_ps(&posYs[i]);
+        __m128 dx = _mm_sub_ps(_mm_loadu_ps(&targetXs[i]), px);
+        __m128 dy = _mm_sub_ps(_mm_loadu_ps(&targetYs[i]), py);
+
+        __m128 distance = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx),
+                                                 _mm_mul_ps(dy, dy)));
+        __m128 scale = _mm_div_ps(_mm_loadu_ps(&speeds[i]), distance);
+
+        _mm_storeu_ps(&posXs[i], _mm_add_ps(px, _mm_mul_ps(dx, scale)));
+        _mm_storeu_ps(&posYs[i], _mm_add_ps(py, _mm_mul_ps(dy, scale)));
+    }
+#endif
+
+    // Scalar tail (and the whole batch on non-SSE2 builds)
+    for (; i < count; i++) {
+        float dx = targetXs[i] - posXs[i];
+        float dy = targetYs[i] - posYs[i];
+        float distance = std::sqrt(dx * dx + dy * dy);
+        float scale = speeds[i] / distance;
+
+        posXs[i] += dx * scale;
+        posYs[i] += dy * scale;
+    }
+
+    // Scatter the results back, updating animPos the same way the
+    // scalar path does
+    for (size_t j = 0; j < count; j++) {
+        uint32_t slot = moves[j].slot;
+        xs[slot] = posXs[j];
+        ys[slot] = posYs[j];
+        anims[slot] = moves[j].animAlongY ? posYs[j] : posXs[j];
+    }
+}
@@ -0,0 +1,220 @@
+// FILE: src/core/RoutePathCache.cpp
+#include "core/RoutePathCache.h"
+#include "utils/DebugLogger.h"
+#include <array>
+#include <mutex>
+#include <string>
+
+namespace {
+    // One slot per (road, laneNumber, destination) combination
+    std::array<std::vector<Point>, RoutePathCache::ROUTE_SLOTS> routes;
+    std::array<bool, RoutePathCache::ROUTE_SLOTS> routeBuilt = {};
+    std::mutex buildMutex;
+}
+
+const std::vector<Point>& RoutePathCache::getRoute(char lane, int laneNumber,
+                                                   Destination destination) {
+    int slot = slotIndex(lane, laneNumber, destination);
+
+    // Build lazily, once per slot; after that reads are contention-free
+    if (!routeBuilt[slot]) {
+        std::lock_guard<std::mutex> lock(buildMutex);
+        if (!routeBuilt[slot]) {
+            routes[slot] = buildRoute(lane, laneNumber, destination);
+            routeBuilt[slot] = true;
+
+            DebugLogger::log("RoutePathCache built route " +
+                           std::string(1, lane) + std::to_string(laneNumber) +
+                           " (" + std::to_string(routes[slot].size()) + " waypoints)");
+        }
+    }
+
+    return routes[slot];
+}
+
+int RoutePathCache::slotIndex(char lane, int laneNumber, Destination destination) {
+    int road = (lane >= 'A' && lane <= 'D') ? lane - 'A' : 0;
+    int num = (laneNumber >= 1 && laneNumber <= 3) ? laneNumber - 1 : 1;
+    int dest = static_cast<int>(destination);
+    if (dest < 0 || dest > 2) {
+        dest = 0;
+    }
+    return road * 9 + num * 3 + dest;
+}
+
+std::vector<Point> RoutePathCache::buildRoute(char lane, int laneNumber,
+                                              Destination destination) {
+    std::vector<Point> waypoints;
+
+    // Window dimensions (matches Vehicle's spawn positioning)
+    const int windowWidth = 800;
+    const int windowHeight = 800;
+    const float centerX = windowWidth / 2;
+    const float centerY = windowHeight / 2;
+
+    // Lane spacing - same constants the Vehicle constructor uses
+    const float laneOffset = 50.0f;
+
+    // Adjust intersection boundaries
+    const float intersectionHalf = 70.0f; // Intersection size
+    const float leftEdge = centerX - intersectionHalf;
+    const float rightEdge = centerX + intersectionHalf;
+    const float topEdge = centerY - intersectionHalf;
+    const float bottomEdge = centerY + intersectionHalf;
+
+    // L1 (incoming lane) should be offset inward from center
+    const float lane1Offset = -20.0f;
+
+    // Spawn position and travel direction are fully determined by the
+    // road letter and lane number (mirrors the Vehicle constructor)
+    float startX = 0.0f;
+    float startY = 0.0f;
+    Direction direction = Direction::DOWN;
+
+    switch (lane) {
+        case 'A': // North road (top), vehicles move DOWN
+            direction = Direction::DOWN;
+            startX = (laneNumber == 3) ? centerX + laneOffset : centerX;
+            startY = 20.0f;
+            break;
+        case 'B': // East road (right), vehicles move LEFT
+            direction = Direction::LEFT;
+            startY = (laneNumber == 3) ? centerY + laneOffset : centerY;
+            startX = windowWidth - 20.0f;
+            break;
+        case 'C': // South road (bottom), vehicles move UP
+            direction = Direction::UP;
+            startX = (laneNumber == 3) ? centerX - laneOffset : centerX;
+            startY = windowHeight - 20.0f;
+            break;
+        case 'D': // West road (left), vehicles move RIGHT
+            direction = Direction::RIGHT;
+            startY = (laneNumber == 3) ? centerY - laneOffset : centerY;
+            startX = 20.0f;
+            break;
+        default:
+            break;
+    }
+
+    // Add the starting position as first waypoint
+    waypoints.push_back({startX, startY});
+
+    // Add approach to intersection waypoint
+    switch (direction) {
+        case Direction::DOWN: // From North (A)
+            waypoints.push_back({startX, topEdge - 5.0f});
+            break;
+        case Direction::UP: // From South (C)
+            waypoints.push_back({startX, bottomEdge + 5.0f});
+            break;
+        case Direction::LEFT: // From East (B)
+            waypoints.push_back({rightEdge + 5.0f, startY});
+            break;
+        case Direction::RIGHT: // From West (D)
+            waypoints.push_back({leftEdge - 5.0f, startY});
+            break;
+    }
+
+    // CRITICAL: Strictly follow the assignment routing requirements:
+    // AL3 → BL1; AL2: Straight → CL1, Left → DL1
+    // BL3 → CL1; BL2: Straight → DL1, Left → AL1
+    // CL3 → DL1; CL2: Straight → AL1, Left → BL1
+    // DL3 → AL1; DL2: Straight → BL1, Left → CL1
+
+    if (laneNumber == 3) {
+        // CRITICAL: Lane 3 MUST ALWAYS turn left to L1
+        switch (direction) {
+            case Direction::DOWN:  // A(North) to B(East) - AL3 → BL1
+                waypoints.push_back({centerX, topEdge + 20.0f});
+                waypoints.push_back({rightEdge - 20.0f, centerY});
+                waypoints.push_back({rightEdge + 5.0f, centerY + lane1Offset});
+                waypoints.push_back({windowWidth + 30.0f, centerY + lane1Offset});
+                break;
+
+            case Direction::UP:    // C(South) to D(West) - CL3 → DL1
+                waypoints.push_back({centerX, bottomEdge - 20.0f});
+                waypoints.push_back({leftEdge + 20.0f, centerY});
+                waypoints.push_back({leftEdge - 5.0f, centerY + lane1Offset});
+                waypoints.push_back({-30.0f, centerY + lane1Offset});
+                break;
+
+            case Direction::LEFT:  // B(East) to C(South) - BL3 → CL1
+                waypoints.push_back({rightEdge - 20.0f, centerY});
+                waypoints.push_back({centerX, bottomEdge - 20.0f});
+                waypoints.push_back({centerX + lane1Offset, bottomEdge + 5.0f});
+                waypoints.push_back({centerX + lane1Offset, windowHeight + 30.0f});
+                break;
+
+            case Direction::RIGHT: // D(West) to A(North) - DL3 → AL1
+                waypoints.push_back({leftEdge + 20.0f, centerY});
+                waypoints.push_back({centerX, topEdge + 20.0f});
+                waypoints.push_back({centerX + lane1Offset, topEdge - 5.0f});
+                waypoints.push_back({centerX + lane1Offset, -30.0f});
+                break;
+        }
+    }
+    else if (laneNumber == 2) {
+        if (destination == Destination::STRAIGHT) {
+            // CRITICAL: L2 straight must go to L1 (incoming lane)
+            switch (direction) {
+                case Direction::DOWN:  // A(North) to C(South) - AL2(straight) → CL1
+                    waypoints.push_back({centerX, centerY});
+                    waypoints.push_back({centerX + lane1Offset, bottomEdge + 5.0f});
+                    waypoints.push_back({centerX + lane1Offset, windowHeight + 30.0f});
+                    break;
+
+                case Direction::UP:    // C(South) to A(North) - CL2(straight) → AL1
+                    waypoints.push_back({centerX, centerY});
+                    waypoints.push_back({centerX + lane1Offset, topEdge - 5.0f});
+                    waypoints.push_back({centerX + lane1Offset, -30.0f});
+                    break;
+
+                case Direction::LEFT:  // B(East) to D(West) - BL2(straight) → DL1
+                    waypoints.push_back({centerX, centerY});
+                    waypoints.push_back({leftEdge - 5.0f, centerY + lane1Offset});
+                    waypoints.push_back({-30.0f, centerY + lane1Offset});
+                    break;
+
+                case Direction::RIGHT: // D(West) to B(East) - DL2(straight) → BL1
+                    waypoints.push_back({centerX, centerY});
+                    waypoints.push_back({rightEdge + 5.0f, centerY + lane1Offset});
+                    waypoints.push_back({windowWidth + 30.0f, centerY + lane1Offset});
+                    break;
+            }
+        }
+        else if (destination == Destination::LEFT) {
+            // CRITICAL: L2 left turn must go to L1 (incoming lane)
+            switch (direction) {
+                case Direction::DOWN:  // A(North) to D(West) - AL2(left) → DL1
+                    waypoints.push_back({centerX, topEdge + 20.0f});
+                    waypoints.push_back({leftEdge + 20.0f, centerY});
+                    waypoints.push_back({leftEdge - 5.0f, centerY + lane1Offset});
+                    waypoints.push_back({-30.0f, centerY + lane1Offset});
+                    break;
+
+                case Direction::UP:    // C(South) to B(East) - CL2(left) → BL1
+                    waypoints.push_back({centerX, bottomEdge - 20.0f});
+                    waypoints.push_back({rightEdge - 20.0f, centerY});
+                    waypoints.push_back({rightEdge + 5.0f, centerY + lane1Offset});
+                    waypoints.push_back({windowWidth + 30.0f, centerY + lane1Offset});
+                    break;
+
+                case Direction::LEFT:  // B(East) to A(North) - BL2(left) → AL1
+                    waypoints.push_back({rightEdge - 20.0f, centerY});
+                    waypoints.push_back({centerX, topEdge + 20.0f});
+                    waypoints.push_back({centerX + lane1Offset, topEdge - 5.0f});
+                    waypoints.push_back({centerX + lane1Offset, -30.0f});
+                    break;
+
+                case Direction::RIGHT: // D(West) to C(South) - DL2(left) → CL1
+                    waypoints.push_back({leftEdge + 20.0f, centerY});
+                    waypoints.push_back({centerX, bottomEdge - 20.0f});
+                    waypoints.push_back({centerX + lane1Offset, bottomEdge + 5.0f});
+                    waypoints.push_back({centerX + lane1Offset, windowHeight + 30.0f});
+                    break;
+            }
+        }
+    }
+
+    return waypoints;
+}
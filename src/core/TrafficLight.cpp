@@ -1,46 +1,205 @@
 // FILE: src/core/TrafficLight.cpp
 #include "core/TrafficLight.h"
+#include "core/LightControlPolicy.h"
 #include "utils/DebugLogger.h"
+#include "utils/TuningConfig.h"
+#include "visualization/GlyphAtlas.h"
+#include "utils/Profiler.h"
 #include <sstream>
 #include <cmath>
+#include <cstdlib>
+#include <cstring>
 #include <SDL3/SDL.h>
+#include "utils/FrameClock.h"
 #include "core/Constants.h"
 
+namespace {
+
+// One-time policy selection; anything unrecognized falls back to the
+// shipped adaptive rotation so a typo degrades to default behavior
+TrafficLight::ControlPolicy selectControlPolicy() {
+    const char* env = std::getenv("TRAFFIC_LIGHT_POLICY");
+    if (!env) {
+        return TrafficLight::ControlPolicy::ADAPTIVE_ROTATION;
+    }
+    if (std::strcmp(env, "fixed") == 0) {
+        return TrafficLight::ControlPolicy::FIXED_CYCLE;
+    }
+    if (std::strcmp(env, "lqf") == 0) {
+        return TrafficLight::ControlPolicy::LONGEST_QUEUE_FIRST;
+    }
+    if (std::strcmp(env, "compositor") == 0) {
+        return TrafficLight::ControlPolicy::CONFLICT_COMPOSITOR;
+    }
+    return TrafficLight::ControlPolicy::ADAPTIVE_ROTATION;
+}
+
+const char* policyName(TrafficLight::ControlPolicy policy) {
+    switch (policy) {
+        case TrafficLight::ControlPolicy::FIXED_CYCLE:         return "fixed-cycle";
+        case TrafficLight::ControlPolicy::LONGEST_QUEUE_FIRST: return "longest-queue-first";
+        case TrafficLight::ControlPolicy::CONFLICT_COMPOSITOR: return "conflict-compositor";
+        default:                                               return "adaptive-rotation";
+    }
+}
+
+} // namespace
+
 TrafficLight::TrafficLight()
     : currentState(State::ALL_RED),
-      nextState(State::A_GREEN),
-      lastStateChangeTime(SDL_GetTicks()),
+      nextState(State::AC_GREEN),
+      lastStateChangeTime(FrameClock::nowMs()),
+      nextWakeTime(0),
+      countsDirty(true),
+      preemptedRoad(-1),
       isPriorityMode(false),
       shouldResumeNormalMode(false),
       forceAGreen(false),
-      priorityModeStartTime(0) {
+      priorityModeStartTime(0),
+      controlPolicy(selectControlPolicy()),
+      panelTexture(nullptr),
+      panelCacheKey(~0ULL) {
 
-    DebugLogger::log("TrafficLight initialized"); 
+    for (auto& count : lane2Counts) {
+        count.store(0, std::memory_order_relaxed);
+    }
+    for (auto& count : emergencyCounts) {
+        count.store(0, std::memory_order_relaxed);
+    }
+
+    DebugLogger::log(std::string("TrafficLight initialized, control policy: ") +
+                     policyName(controlPolicy));
 }
 
 TrafficLight::~TrafficLight() {
+    if (panelTexture) {
+        SDL_DestroyTexture(panelTexture);
+        panelTexture = nullptr;
+    }
+
     DebugLogger::log("TrafficLight destroyed");
 }
 
+void TrafficLight::onLaneCountChanged(char laneId, int laneNumber, int count) {
+    // Only lane 2 counts feed the timing formula
+    if (laneNumber != 2 || laneId < 'A' || laneId > 'D') {
+        return;
+    }
+
+    lane2Counts[laneId - 'A'].store(count, std::memory_order_relaxed);
+    countsDirty.store(true, std::memory_order_release);
+}
+
+void TrafficLight::onEmergencyCountChanged(char laneId, int delta) {
+    if (laneId < 'A' || laneId > 'D') {
+        return;
+    }
+
+    emergencyCounts[laneId - 'A'].fetch_add(delta, std::memory_order_relaxed);
+
+    // Reuse the count-dirty wakeup: the next update() tick re-evaluates
+    // regardless of the scheduled deadline, so detection latency is one
+    // tick no matter how long the current phase was going to run
+    countsDirty.store(true, std::memory_order_release);
+}
+
 void TrafficLight::update(const std::vector<Lane*>& lanes) {
-    uint32_t currentTime = SDL_GetTicks();
+    update(lanes, FrameClock::nowMs());
+}
+
+void TrafficLight::update(const std::vector<Lane*>& lanes, uint32_t currentTime) {
+    PROFILE_SCOPE("sim.light");
+    (void)lanes; // Counts are pushed from Lane::enqueue()/dequeue() now
+
+    // Event-driven fast path: the state machine can only act at the
+    // scheduled transition deadline or when a lane-count delta arrived,
+    // so every other tick returns without scanning anything. This keeps
+    // the per-tick cost flat if many junctions share a process.
+    bool deltaArrived = countsDirty.exchange(false, std::memory_order_acquire);
+    if (!deltaArrived && currentTime < nextWakeTime) {
+        return;
+    }
+
     uint32_t elapsedTime = currentTime - lastStateChangeTime;
 
-    // CRITICAL: Find priority lane A2 directly
-    Lane* al2Lane = nullptr;
-    for (auto* lane : lanes) {
-        if (lane->getLaneId() == 'A' && lane->getLaneNumber() == 2) {
-            al2Lane = lane;
-            break;
+    // Emergency preemption: an emergency vehicle anywhere on a road
+    // outranks every other rule, including A2 priority mode. The per-road
+    // index is pushed from the lanes at enqueue/dequeue time, so picking
+    // the corridor is four relaxed loads - never a lane scan - and the
+    // dirty flag above already woke us on the tick the vehicle arrived.
+    {
+        int emergencyRoad = -1;
+        for (int road = 0; road < 4; road++) {
+            if (emergencyCounts[road].load(std::memory_order_relaxed) > 0) {
+                emergencyRoad = road;
+                break;
+            }
+        }
+
+        if (emergencyRoad >= 0) {
+            State targetState = static_cast<State>(emergencyRoad + 1);
+
+            if (preemptedRoad != emergencyRoad) {
+                preemptedRoad = emergencyRoad;
+
+                std::ostringstream oss;
+                oss << "!!! EMERGENCY PREEMPTION: corridor "
+                    << static_cast<char>('A' + emergencyRoad) << " forced green";
+                DebugLogger::log(oss.str(), DebugLogger::LogLevel::ERROR);
+            }
+
+            if (currentState == targetState) {
+                // Hold the corridor green until the index clears; the
+                // clearing dequeue raises countsDirty, so the periodic
+                // wake here is only a safety net
+                nextWakeTime = currentTime + 1000;
+            } else if (currentState != State::ALL_RED) {
+                // Same interlock as priority mode: cross traffic gets a
+                // brief ALL_RED before the corridor goes green
+                currentState = State::ALL_RED;
+                nextState = targetState;
+                lastStateChangeTime = currentTime;
+                nextWakeTime = currentTime + allRedDuration;
+            } else {
+                nextState = targetState;
+                if (elapsedTime >= static_cast<uint32_t>(allRedDuration)) {
+                    currentState = targetState;
+                    nextState = State::ALL_RED;
+                    lastStateChangeTime = currentTime;
+                    nextWakeTime = currentTime + 1000;
+                } else {
+                    nextWakeTime = lastStateChangeTime + allRedDuration;
+                }
+            }
+            return; // Skip priority mode and normal cycling entirely
+        }
+
+        if (preemptedRoad >= 0) {
+            // Corridor cleared: rejoin the rotation through ALL_RED at
+            // the road after the one we preempted, so the others are not
+            // starved twice in a row
+            std::ostringstream oss;
+            oss << "Emergency preemption cleared on corridor "
+                << static_cast<char>('A' + preemptedRoad) << ", resuming rotation";
+            DebugLogger::log(oss.str());
+
+            currentState = State::ALL_RED;
+            nextState = (preemptedRoad == 0 || preemptedRoad == 2)
+                ? State::BD_GREEN
+                : State::AC_GREEN;
+            preemptedRoad = -1;
+            lastStateChangeTime = currentTime;
+            nextWakeTime = currentTime + allRedDuration;
+            return;
         }
     }
 
     // CRITICAL FIX: Direct priority detection and override
-    if (al2Lane) {
-        int vehicleCount = al2Lane->getVehicleCount();
+    {
+        int vehicleCount = lane2Counts[0].load(std::memory_order_relaxed); // A2
 
         // CRITICAL: Force immediate transition to A_GREEN when vehicle count exceeds threshold
-        if (vehicleCount > Constants::PRIORITY_THRESHOLD_HIGH) {
+        if (vehicleCount > TuningConfig::getPriorityThresholdHigh()) {
             if (!isPriorityMode) {
                 isPriorityMode = true;
                 forceAGreen = true;
@@ -67,7 +226,7 @@ void TrafficLight::update(const std::vector<Lane*>& lanes) {
             }
         }
         // Exit priority mode when count drops below threshold
-        else if (isPriorityMode && vehicleCount < Constants::PRIORITY_THRESHOLD_LOW) {
+        else if (isPriorityMode && vehicleCount < TuningConfig::getPriorityThresholdLow()) {
             isPriorityMode = false;
             forceAGreen = false;
 
@@ -90,7 +249,7 @@ void TrafficLight::update(const std::vector<Lane*>& lanes) {
     // CRITICAL FIX: If in priority mode, force the light to stay on A_GREEN longer
     if (isPriorityMode && forceAGreen) {
         if (currentState != State::A_GREEN) {
-            if (elapsedTime >= allRedDuration) {
+            if (elapsedTime >= static_cast<uint32_t>(allRedDuration)) {
                 // After ALL_RED, go back to A_GREEN in priority mode
                 currentState = State::A_GREEN;
                 nextState = State::ALL_RED;
@@ -112,34 +271,48 @@ void TrafficLight::update(const std::vector<Lane*>& lanes) {
             }
         }
 
+        // Sleep until the forced cycle's next boundary
+        nextWakeTime = lastStateChangeTime +
+                       (currentState == State::A_GREEN ? 6000 : allRedDuration);
         return; // Skip normal light cycling in priority mode
     }
 
-    // NORMAL MODE - Calculate appropriate duration
-    int stateDuration;
-    if (currentState == State::ALL_RED) {
-        stateDuration = allRedDuration; // 2 seconds for ALL_RED
-    } else {
-        // Calculate average using lane counts
-        float averageVehicleCount = calculateAverageVehicleCount(lanes);
-
-        // Set duration using formula: Total time = |V| * t (2 seconds per vehicle)
-        stateDuration = static_cast<int>(averageVehicleCount * 2000);
-
-        // Apply minimum and maximum limits for reasonable times
-        if (stateDuration < 3000) stateDuration = 3000; // Min 3 seconds
-        if (stateDuration > 15000) stateDuration = 15000; // Max 15 seconds
+    // NORMAL MODE - the startup-selected policy decides which phase
+    // follows the one just served and how long a green runs; dispatched
+    // once per evaluation so each instantiation inlines its policy's
+    // decision (see LightControlPolicy.h)
+    switch (controlPolicy) {
+        case ControlPolicy::FIXED_CYCLE:
+            advanceNormalPhase<FixedCyclePolicy>(currentTime, elapsedTime);
+            break;
+        case ControlPolicy::LONGEST_QUEUE_FIRST:
+            advanceNormalPhase<LongestQueueFirstPolicy>(currentTime, elapsedTime);
+            break;
+        case ControlPolicy::CONFLICT_COMPOSITOR:
+            advanceNormalPhase<ConflictCompositorPolicy>(currentTime, elapsedTime);
+            break;
+        default:
+            advanceNormalPhase<AdaptiveRotationPolicy>(currentTime, elapsedTime);
+            break;
+    }
+}
 
-        // Log the calculation
-        std::ostringstream oss;
-        oss << "Traffic light timing: |V| = " << averageVehicleCount
-            << ", Duration = " << stateDuration / 1000.0f << " seconds";
-        DebugLogger::log(oss.str());
+template <typename Policy>
+void TrafficLight::advanceNormalPhase(uint32_t currentTime, uint32_t elapsedTime) {
+    // One coherent snapshot of the pushed counts for this evaluation
+    LightPolicyContext ctx;
+    for (int road = 0; road < 4; road++) {
+        ctx.lane2Counts[road] = lane2Counts[road].load(std::memory_order_relaxed);
     }
 
-    // State transition in normal mode
-    if (elapsedTime >= stateDuration) {
-        // Change to next state
+    int stateDuration = (currentState == State::ALL_RED)
+        ? allRedDuration
+        : Policy::greenDurationMs(currentState, ctx);
+
+    if (elapsedTime >= static_cast<uint32_t>(stateDuration)) {
+        // The phase being left is what the policy keys its next green
+        // choice on (capture it before the assignment below)
+        State previousState = currentState;
         currentState = nextState;
 
         // Log the state change clearly
@@ -150,65 +323,59 @@ void TrafficLight::update(const std::vector<Lane*>& lanes) {
             case State::B_GREEN: stateStr = "B_GREEN"; break;
             case State::C_GREEN: stateStr = "C_GREEN"; break;
             case State::D_GREEN: stateStr = "D_GREEN"; break;
+            case State::AC_GREEN: stateStr = "AC_GREEN"; break;
+            case State::BD_GREEN: stateStr = "BD_GREEN"; break;
         }
 
         DebugLogger::log("Traffic light changed to: " + stateStr);
 
-        // Normal rotation pattern: ALL_RED → A → ALL_RED → B → ALL_RED → C → ALL_RED → D → ...
         if (currentState == State::ALL_RED) {
-            // Cycle through green states
-            switch (nextState) {
-                case State::A_GREEN: nextState = State::B_GREEN; break;
-                case State::B_GREEN: nextState = State::C_GREEN; break;
-                case State::C_GREEN: nextState = State::D_GREEN; break;
-                case State::D_GREEN: nextState = State::A_GREEN; break;
-                default: nextState = State::A_GREEN; break;
-            }
+            // Every green is followed by the ALL_RED interlock; during
+            // it the policy schedules the next green from the phase just
+            // served and the current queue depths
+            nextState = Policy::nextGreen(previousState, ctx);
+            stateDuration = allRedDuration;
         } else {
-            // Always go to ALL_RED after any green state
             nextState = State::ALL_RED;
-        }
 
-        lastStateChangeTime = currentTime;
-    }
-}
+            // The freshly entered green has its own duration
+            stateDuration = Policy::greenDurationMs(currentState, ctx);
 
-float TrafficLight::calculateAverageVehicleCount(const std::vector<Lane*>& lanes) {
-    int normalLaneCount = 0;
-    int totalVehicleCount = 0;
-
-    for (auto* lane : lanes) {
-        // Only count lane 2 (normal lanes)
-        // In priority mode, exclude the priority lane (A2) from calculation
-        if (lane->getLaneNumber() == 2 &&
-            !(isPriorityMode && lane->getLaneId() == 'A')) {
-            normalLaneCount++;
-            totalVehicleCount += lane->getVehicleCount();
+            std::ostringstream oss;
+            oss << "Traffic light timing: duration = "
+                << stateDuration / 1000.0f << " seconds";
+            DebugLogger::log(oss.str());
         }
-    }
 
-    // Calculate average: |V| = (1/n) * Σ|Li|
-    float average = (normalLaneCount > 0) ?
-        static_cast<float>(totalVehicleCount) / normalLaneCount : 0.0f;
+        lastStateChangeTime = currentTime;
+    }
 
-    // Return at least 1 to ensure some duration
-    return std::max(1.0f, average);
+    // Sleep until this state is due to end; a lane-count delta can still
+    // wake us earlier to re-derive the duration
+    nextWakeTime = lastStateChangeTime + stateDuration;
 }
 
 void TrafficLight::setNextState(State state) {
     nextState = state;
 }
 
+void TrafficLight::restoreState(State state) {
+    currentState = state;
+    nextState = state;
+
+    // Zero deadlines plus a forced count-dirty flag make the next
+    // update() re-evaluate and schedule off the restored queue depths
+    lastStateChangeTime = 0;
+    nextWakeTime = 0;
+    countsDirty.store(true, std::memory_order_release);
+}
+
 bool TrafficLight::isGreen(char lane) const {
-    // CRITICAL: Explicitly check the state machine state
-    switch (currentState) {
-        case State::A_GREEN: return lane == 'A';
-        case State::B_GREEN: return lane == 'B';
-        case State::C_GREEN: return lane == 'C';
-        case State::D_GREEN: return lane == 'D';
-        case State::ALL_RED: return false;
-        default: return false;
+    if (lane < 'A' || lane > 'D') {
+        return false;
     }
+    // One mask lookup covers single-road and composite phases alike
+    return (greenRoadMask(currentState) >> (lane - 'A')) & 1;
 }
 
 void TrafficLight::render(SDL_Renderer* renderer) {
@@ -220,17 +387,75 @@ void TrafficLight::render(SDL_Renderer* renderer) {
     const int CENTER_X = WINDOW_WIDTH / 2;
     const int CENTER_Y = WINDOW_HEIGHT / 2;
 
-    // Draw main traffic control center in top-right corner
-    drawTrafficControlCenter(renderer);
+    // Control center panel and state timer go through the texture
+    // cache; they redraw only when their displayed content changes
+    renderControlPanel(renderer);
 
-    // Draw junction lights (one at each road)
+    // Draw junction lights (one at each road); these sit in the
+    // animated center of the scene and stay immediate-mode
     drawJunctionLight(renderer, CENTER_X, CENTER_Y - 100, 'A', isGreen('A')); // North (A) light
     drawJunctionLight(renderer, CENTER_X + 100, CENTER_Y, 'B', isGreen('B')); // East (B) light
     drawJunctionLight(renderer, CENTER_X, CENTER_Y + 100, 'C', isGreen('C')); // South (C) light
     drawJunctionLight(renderer, CENTER_X - 100, CENTER_Y, 'D', isGreen('D')); // West (D) light
+}
+
+void TrafficLight::renderControlPanel(SDL_Renderer* renderer) {
+    // Region covering the control panel and the state timer arc
+    const SDL_FRect PANEL_REGION = {610.0f, 10.0f, 190.0f, 180.0f};
+
+    if (!panelTexture) {
+        // Window-sized target so the draw helpers keep their absolute
+        // coordinates; only PANEL_REGION is ever blitted from it
+        panelTexture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
+                                         SDL_TEXTUREACCESS_TARGET, 800, 800);
+        if (panelTexture) {
+            SDL_SetTextureBlendMode(panelTexture, SDL_BLENDMODE_BLEND);
+        } else {
+            DebugLogger::log("Panel cache texture unavailable; drawing panel directly",
+                             DebugLogger::LogLevel::WARNING);
+        }
+    }
+
+    if (!panelTexture) {
+        // No render-target support: fall back to immediate-mode drawing
+        drawTrafficControlCenter(renderer);
+        drawStateTimer(renderer);
+        return;
+    }
 
-    // Draw the state transition timer
-    drawStateTimer(renderer);
+    // Content key: everything the panel actually displays. The timer
+    // readout quantizes to whole seconds and the progress arc to
+    // 6-degree steps, so the steady-state frame pays one blit and the
+    // redraw runs roughly ten times a second instead of sixty.
+    uint32_t elapsed = FrameClock::nowMs() - lastStateChangeTime;
+    uint32_t duration = static_cast<uint32_t>(displayedStateDurationMs());
+    float progress = std::min(1.0f, static_cast<float>(elapsed) /
+                                    static_cast<float>(duration));
+    uint64_t arcStep = static_cast<uint64_t>(progress * 360.0f) / 6;
+    uint64_t secondsRemaining = (duration - std::min(elapsed, duration)) / 1000 + 1;
+    uint64_t flashPhase = isPriorityMode ? (FrameClock::nowMs() / 500) & 1 : 0;
+
+    uint64_t key = static_cast<uint64_t>(currentState)
+                 | (static_cast<uint64_t>(isPriorityMode) << 3)
+                 | (flashPhase << 4)
+                 | (secondsRemaining << 8)
+                 | (arcStep << 24);
+
+    if (key != panelCacheKey) {
+        SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+        SDL_SetRenderTarget(renderer, panelTexture);
+
+        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+        SDL_RenderClear(renderer);
+        drawTrafficControlCenter(renderer);
+        drawStateTimer(renderer);
+
+        SDL_SetRenderTarget(renderer, previousTarget);
+        panelCacheKey = key;
+    }
+
+    SDL_RenderTexture(renderer, panelTexture, &PANEL_REGION, &PANEL_REGION);
 }
 
 void TrafficLight::drawTrafficControlCenter(SDL_Renderer* renderer) {
@@ -322,7 +547,7 @@ void TrafficLight::drawTrafficControlCenter(SDL_Renderer* renderer) {
     // Draw priority mode indicator if active
     if (isPriorityMode) {
         // Flashing priority alert
-        uint32_t time = SDL_GetTicks();
+        uint32_t time = FrameClock::nowMs();
         bool flash = (time / 500) % 2 == 0;
 
         SDL_SetRenderDrawColor(renderer, flash ? 255 : 200, flash ? 140 : 100, 0, 200);
@@ -489,22 +714,26 @@ void TrafficLight::drawJunctionLight(SDL_Renderer* renderer, int x, int y, char
     SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
 }
 
+int TrafficLight::displayedStateDurationMs() const {
+    if (currentState == State::ALL_RED) {
+        return allRedDuration;
+    }
+    if (isPriorityMode && currentState == State::A_GREEN) {
+        return 6000; // 6 seconds in priority mode
+    }
+
+    float avgVehicleCount = 5.0f; // Default fallback
+    int stateDuration =
+        static_cast<int>(avgVehicleCount * TuningConfig::getGreenMsPerVehicle());
+    return std::max(3000, std::min(stateDuration, 15000));
+}
+
 void TrafficLight::drawStateTimer(SDL_Renderer* renderer) {
     // Draw a timer showing state progression with animation
-    uint32_t currentTime = SDL_GetTicks();
+    uint32_t currentTime = FrameClock::nowMs();
     uint32_t elapsedTime = currentTime - lastStateChangeTime;
 
-    // Calculate state duration
-    int stateDuration;
-    if (currentState == State::ALL_RED) {
-        stateDuration = allRedDuration;
-    } else if (isPriorityMode && currentState == State::A_GREEN) {
-        stateDuration = 6000; // 6 seconds in priority mode
-    } else {
-        float avgVehicleCount = 5.0f; // Default fallback
-        stateDuration = static_cast<int>(avgVehicleCount * 2000);
-        stateDuration = std::max(3000, std::min(stateDuration, 15000));
-    }
+    int stateDuration = displayedStateDurationMs();
 
     // Calculate progress (0.0 to 1.0)
     float progress = static_cast<float>(elapsedTime) / static_cast<float>(stateDuration);
@@ -577,7 +806,7 @@ void TrafficLight::drawHolographicLight(SDL_Renderer* renderer, int x, int y, in
     SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
 
     // Flickering effect for hologram
-    uint32_t time = SDL_GetTicks();
+    uint32_t time = FrameClock::nowMs();
     float flicker = 0.8f + 0.2f * sin(time * 0.01f);
 
     // Background
@@ -649,375 +878,13 @@ void TrafficLight::drawHolographicLight(SDL_Renderer* renderer, int x, int y, in
 }
 
 void TrafficLight::drawPanelText(SDL_Renderer* renderer, const char* text, int x, int y) {
-    // Simplified text drawing for the panel
-    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-
-    // Draw characters
-    for (int i = 0; text[i] != '\0'; i++) {
-        drawPanelChar(renderer, text[i], x + i*8, y);
-    }
+    // Text goes through the shared glyph atlas (one texture, batched
+    // quads) in whatever draw color the caller set
+    SDL_Color color;
+    SDL_GetRenderDrawColor(renderer, &color.r, &color.g, &color.b, &color.a);
 
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    GlyphAtlas::get().drawText(renderer, text, strlen(text), x, y, color);
     SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
 }
 
-void TrafficLight::drawPanelChar(SDL_Renderer* renderer, char c, int x, int y) {
-    // Simplified monospaced character drawing
-    switch (c) {
-        case 'A':
-            SDL_RenderLine(renderer, x+3, y, x, y+9);      // Left diagonal
-            SDL_RenderLine(renderer, x+3, y, x+6, y+9);    // Right diagonal
-            SDL_RenderLine(renderer, x+1, y+6, x+5, y+6);  // Middle
-            break;
-        case 'B':
-            SDL_RenderLine(renderer, x, y, x, y+9);        // Left vertical
-            SDL_RenderLine(renderer, x, y, x+4, y);        // Top
-            SDL_RenderLine(renderer, x+4, y, x+5, y+2);    // Top curve
-            SDL_RenderLine(renderer, x+5, y+2, x+4, y+4);  // Middle top
-            SDL_RenderLine(renderer, x, y+4, x+4, y+4);    // Middle
-            SDL_RenderLine(renderer, x+4, y+4, x+5, y+7);  // Middle bottom
-            SDL_RenderLine(renderer, x+5, y+7, x+4, y+9);  // Bottom curve
-            SDL_RenderLine(renderer, x+4, y+9, x, y+9);    // Bottom
-            break;
-        case 'C':
-            SDL_RenderLine(renderer, x+5, y+2, x+2, y);    // Top right
-            SDL_RenderLine(renderer, x+2, y, x, y+2);      // Top left
-            SDL_RenderLine(renderer, x, y+2, x, y+7);      // Left
-            SDL_RenderLine(renderer, x, y+7, x+2, y+9);    // Bottom left
-            SDL_RenderLine(renderer, x+2, y+9, x+5, y+7);  // Bottom right
-            break;
-        case 'D':
-            SDL_RenderLine(renderer, x, y, x, y+9);        // Left vertical
-            SDL_RenderLine(renderer, x, y, x+3, y);        // Top
-            SDL_RenderLine(renderer, x+3, y, x+5, y+2);    // Top right
-            SDL_RenderLine(renderer, x+5, y+2, x+5, y+7);  // Right
-            SDL_RenderLine(renderer, x+5, y+7, x+3, y+9);  // Bottom right
-            SDL_RenderLine(renderer, x+3, y+9, x, y+9);    // Bottom
-            break;
-        case 'E':
-            SDL_RenderLine(renderer, x, y, x, y+9);        // Vertical
-            SDL_RenderLine(renderer, x, y, x+5, y);        // Top
-            SDL_RenderLine(renderer, x, y+4, x+4, y+4);    // Middle
-            SDL_RenderLine(renderer, x, y+9, x+5, y+9);    // Bottom
-            break;
-        case 'F':
-            SDL_RenderLine(renderer, x, y, x, y+9);        // Vertical
-            SDL_RenderLine(renderer, x, y, x+5, y);        // Top
-            SDL_RenderLine(renderer, x, y+4, x+4, y+4);    // Middle
-            break;
-        case 'G':
-            SDL_RenderLine(renderer, x+5, y+2, x+2, y);    // Top right
-            SDL_RenderLine(renderer, x+2, y, x, y+2);      // Top left
-            SDL_RenderLine(renderer, x, y+2, x, y+7);      // Left
-            SDL_RenderLine(renderer, x, y+7, x+2, y+9);    // Bottom left
-            SDL_RenderLine(renderer, x+2, y+9, x+5, y+7);  // Bottom right
-            SDL_RenderLine(renderer, x+5, y+7, x+5, y+5);  // Right
-            SDL_RenderLine(renderer, x+5, y+5, x+3, y+5);  // G hook
-            break;
-        case 'H':
-            SDL_RenderLine(renderer, x, y, x, y+9);        // Left vertical
-            SDL_RenderLine(renderer, x+5, y, x+5, y+9);    // Right vertical
-            SDL_RenderLine(renderer, x, y+4, x+5, y+4);    // Middle
-            break;
-        case 'I':
-            SDL_RenderLine(renderer, x+2, y, x+2, y+9);    // Vertical
-            break;
-        case 'L':
-            SDL_RenderLine(renderer, x, y, x, y+9);        // Vertical
-            SDL_RenderLine(renderer, x, y+9, x+5, y+9);    // Bottom
-            break;
-        case 'M':
-            SDL_RenderLine(renderer, x, y, x, y+9);        // Left vertical
-            SDL_RenderLine(renderer, x+5, y, x+5, y+9);    // Right vertical
-            SDL_RenderLine(renderer, x, y, x+2, y+5);      // Left diagonal
-            SDL_RenderLine(renderer, x+5, y, x+3, y+5);    // Right diagonal
-            break;
-        case 'N':
-            SDL_RenderLine(renderer, x, y, x, y+9);        // Left vertical
-            SDL_RenderLine(renderer, x+5, y, x+5, y+9);    // Right vertical
-            SDL_RenderLine(renderer, x, y, x+5, y+9);      // Diagonal
-            break;
-        case 'O':
-            SDL_RenderLine(renderer, x+2, y, x+3, y);      // Top
-            SDL_RenderLine(renderer, x, y+2, x, y+7);      // Left
-            SDL_RenderLine(renderer, x+2, y+9, x+3, y+9);  // Bottom
-            SDL_RenderLine(renderer, x+5, y+2, x+5, y+7);  // Right
-            SDL_RenderLine(renderer, x+2, y, x, y+2);      // Top left
-            SDL_RenderLine(renderer, x+3, y, x+5, y+2);    // Top right
-            SDL_RenderLine(renderer, x, y+7, x+2, y+9);    // Bottom left
-            SDL_RenderLine(renderer, x+5, y+7, x+3, y+9);  // Bottom right
-            break;
-        case 'P':
-            SDL_RenderLine(renderer, x, y, x, y+9);        // Vertical
-            SDL_RenderLine(renderer, x, y, x+3, y);        // Top
-            SDL_RenderLine(renderer, x+3, y, x+5, y+2);    // Top curve
-            SDL_RenderLine(renderer, x+5, y+2, x+3, y+5);  // Bottom curve
-            SDL_RenderLine(renderer, x+3, y+5, x, y+5);    // Bottom
-            break;
-        case 'R':
-            SDL_RenderLine(renderer, x, y, x, y+9);        // Vertical
-            SDL_RenderLine(renderer, x, y, x+3, y);        // Top
-            SDL_RenderLine(renderer, x+3, y, x+5, y+2);    // Top curve
-            SDL_RenderLine(renderer, x+5, y+2, x+3, y+5);  // Bottom curve
-            SDL_RenderLine(renderer, x+3, y+5, x, y+5);    // Middle
-            SDL_RenderLine(renderer, x+2, y+5, x+5, y+9);  // Diagonal
-            break;
-        case 'S':
-            SDL_RenderLine(renderer, x+5, y+2, x+2, y);    // Top right
-            SDL_RenderLine(renderer, x+2, y, x, y+2);      // Top left
-            SDL_RenderLine(renderer, x, y+2, x+2, y+4);    // Middle left
-            SDL_RenderLine(renderer, x+2, y+4, x+3, y+4);  // Middle
-            SDL_RenderLine(renderer, x+3, y+4, x+5, y+6);  // Middle right
-            SDL_RenderLine(renderer, x+5, y+6, x+3, y+9);  // Bottom right
-            SDL_RenderLine(renderer, x+3, y+9, x, y+7);    // Bottom left
-            break;
-        case 'T':
-            SDL_RenderLine(renderer, x, y, x+5, y);        // Top
-            SDL_RenderLine(renderer, x+2, y, x+2, y+9);    // Vertical
-            break;
-        case 'Y':
-            SDL_RenderLine(renderer, x, y, x+2, y+4);      // Left diagonal
-            SDL_RenderLine(renderer, x+5, y, x+3, y+4);    // Right diagonal
-            SDL_RenderLine(renderer, x+2, y+4, x+2, y+9);  // Bottom vertical
-            break;
-        case '0':
-            SDL_RenderLine(renderer, x+2, y, x+3, y);      // Top
-            SDL_RenderLine(renderer, x, y+2, x, y+7);      // Left
-            SDL_RenderLine(renderer, x+2, y+9, x+3, y+9);  // Bottom
-            SDL_RenderLine(renderer, x+5, y+2, x+5, y+7);  // Right
-            SDL_RenderLine(renderer, x+2, y, x, y+2);      // Top left
-            SDL_RenderLine(renderer, x+3, y, x+5, y+2);    // Top right
-            SDL_RenderLine(renderer, x, y+7, x+2, y+9);    // Bottom left
-            SDL_RenderLine(renderer, x+5, y+7, x+3, y+9);  // Bottom right
-            break;
-        case '1':
-            SDL_RenderLine(renderer, x+2, y, x+2, y+9);    // Vertical
-            SDL_RenderLine(renderer, x+1, y+2, x+2, y);    // Diagonal
-            break;
-        case '2':
-            SDL_RenderLine(renderer, x+1, y+1, x+2, y);    // Top left curve
-            SDL_RenderLine(renderer, x+2, y, x+4, y);      // Top
-            SDL_RenderLine(renderer, x+4, y, x+5, y+2);    // Top right curve
-            SDL_RenderLine(renderer, x+5, y+2, x+3, y+5);  // Middle curve
-            SDL_RenderLine(renderer, x+3, y+5, x, y+9);    // Bottom left diagonal
-            SDL_RenderLine(renderer, x, y+9, x+5, y+9);    // Bottom
-            break;
-        case '3':
-            SDL_RenderLine(renderer, x+1, y+1, x+3, y);    // Top left curve
-            SDL_RenderLine(renderer, x+3, y, x+4, y+1);    // Top right curve
-            SDL_RenderLine(renderer, x+4, y+1, x+3, y+4);  // Middle top curve
-            SDL_RenderLine(renderer, x+3, y+4, x+4, y+5);  // Middle bottom curve
-            SDL_RenderLine(renderer, x+4, y+5, x+3, y+8);  // Bottom right curve
-            SDL_RenderLine(renderer, x+3, y+8, x+1, y+9);  // Bottom left curve
-            SDL_RenderLine(renderer, x+2, y+4, x+3, y+4);  // Middle connect
-            break;
-        case '4':
-            SDL_RenderLine(renderer, x+4, y, x+4, y+9);    // Right vertical
-            SDL_RenderLine(renderer, x+4, y, x, y+6);      // Diagonal
-            SDL_RenderLine(renderer, x, y+6, x+5, y+6);    // Horizontal
-            break;
-        case '5':
-            SDL_RenderLine(renderer, x+5, y, x, y);        // Top
-            SDL_RenderLine(renderer, x, y, x, y+4);        // Left vertical
-            SDL_RenderLine(renderer, x, y+4, x+4, y+4);    // Middle
-            SDL_RenderLine(renderer, x+4, y+4, x+5, y+6);  // Middle right curve
-            SDL_RenderLine(renderer, x+5, y+6, x+4, y+9);  // Bottom right curve
-            SDL_RenderLine(renderer, x+4, y+9, x, y+9);    // Bottom
-            break;
-        case '6':
-            SDL_RenderLine(renderer, x+5, y+1, x+3, y);    // Top right curve
-            SDL_RenderLine(renderer, x+3, y, x+1, y+1);    // Top left curve
-            SDL_RenderLine(renderer, x+1, y+1, x, y+3);    // Upper left curve
-            SDL_RenderLine(renderer, x, y+3, x, y+7);      // Left vertical
-            SDL_RenderLine(renderer, x, y+7, x+2, y+9);    // Bottom left curve
-            SDL_RenderLine(renderer, x+2, y+9, x+4, y+8);  // Bottom curve
-            SDL_RenderLine(renderer, x+4, y+8, x+5, y+6);  // Bottom right curve
-            SDL_RenderLine(renderer, x+5, y+6, x+4, y+4);  // Middle right curve
-            SDL_RenderLine(renderer, x+4, y+4, x, y+4);    // Middle
-            break;
-        case '7':
-            SDL_RenderLine(renderer, x, y, x+5, y);        // Top
-            SDL_RenderLine(renderer, x+5, y, x+2, y+9);    // Diagonal
-            break;
-        case '8':
-            SDL_RenderLine(renderer, x+1, y+1, x+2, y);    // Top left curve
-            SDL_RenderLine(renderer, x+2, y, x+3, y);      // Top
-            SDL_RenderLine(renderer, x+3, y, x+4, y+1);    // Top right curve
-            SDL_RenderLine(renderer, x+4, y+1, x+4, y+3);  // Upper right vertical
-            SDL_RenderLine(renderer, x+4, y+3, x+3, y+4);  // Middle top right
-            SDL_RenderLine(renderer, x+3, y+4, x+2, y+4);  // Middle
-            SDL_RenderLine(renderer, x+2, y+4, x+1, y+3);  // Middle top left
-            SDL_RenderLine(renderer, x+1, y+3, x+1, y+1);  // Upper left vertical
-            SDL_RenderLine(renderer, x+1, y+5, x+2, y+4);  // Middle bottom left
-            SDL_RenderLine(renderer, x+2, y+4, x+3, y+4);  // Middle
-            SDL_RenderLine(renderer, x+3, y+4, x+4, y+5);  // Middle bottom right
-            SDL_RenderLine(renderer, x+4, y+5, x+4, y+7);  // Lower right vertical
-            SDL_RenderLine(renderer, x+4, y+7, x+3, y+9);  // Bottom right curve
-            SDL_RenderLine(renderer, x+3, y+9, x+2, y+9);  // Bottom
-            SDL_RenderLine(renderer, x+2, y+9, x+1, y+7);  // Bottom left curve
-            SDL_RenderLine(renderer, x+1, y+7, x+1, y+5);  // Lower left vertical
-            break;
-        case '9':
-            SDL_RenderLine(renderer, x+1, y+1, x+2, y);    // Top left curve
-            SDL_RenderLine(renderer, x+2, y, x+3, y);      // Top
-            SDL_RenderLine(renderer, x+3, y, x+4, y+1);    // Top right curve
-            SDL_RenderLine(renderer, x+4, y+1, x+5, y+3);  // Upper right curve
-            SDL_RenderLine(renderer, x+5, y+3, x+5, y+7);  // Right vertical
-            SDL_RenderLine(renderer, x+5, y+7, x+3, y+9);  // Bottom right curve
-            SDL_RenderLine(renderer, x+3, y+9, x+1, y+8);  // Bottom curve
-            SDL_RenderLine(renderer, x+1, y+1, x, y+3);    // Upper left curve
-            SDL_RenderLine(renderer, x, y+3, x+1, y+5);    // Middle left curve
-            SDL_RenderLine(renderer, x+1, y+5, x+5, y+5);  // Middle
-            break;
-        case ':':
-            SDL_RenderPoint(renderer, x+2, y+2);           // Top dot
-            SDL_RenderPoint(renderer, x+2, y+7);           // Bottom dot
-            break;
-        case ' ':
-            // Space - do nothing
-            break;
-        case '-':
-            SDL_RenderLine(renderer, x, y+4, x+4, y+4);    // Middle
-            break;
-        case '_':
-            SDL_RenderLine(renderer, x, y+9, x+5, y+9);    // Bottom
-            break;
-        case '.':
-            SDL_RenderPoint(renderer, x+2, y+9);           // Dot
-            break;
-        case ',':
-            SDL_RenderLine(renderer, x+2, y+7, x+1, y+9);  // Comma
-            break;
-        case '!':
-            SDL_RenderLine(renderer, x+2, y, x+2, y+6);    // Vertical
-            SDL_RenderPoint(renderer, x+2, y+9);           // Bottom dot
-            break;
-        case '/':
-            SDL_RenderLine(renderer, x+5, y, x, y+9);      // Diagonal
-            break;
-        case '\\':
-            SDL_RenderLine(renderer, x, y, x+5, y+9);      // Diagonal
-            break;
-        case '(':
-            SDL_RenderLine(renderer, x+3, y, x+1, y+4);    // Top curve
-            SDL_RenderLine(renderer, x+1, y+4, x+3, y+9);  // Bottom curve
-            break;
-        case ')':
-            SDL_RenderLine(renderer, x+1, y, x+3, y+4);    // Top curve
-            SDL_RenderLine(renderer, x+3, y+4, x+1, y+9);  // Bottom curve
-            break;
-        case '+':
-            SDL_RenderLine(renderer, x, y+4, x+4, y+4);    // Horizontal
-            SDL_RenderLine(renderer, x+2, y+2, x+2, y+7);  // Vertical
-            break;
-        case '=':
-            SDL_RenderLine(renderer, x, y+3, x+4, y+3);    // Top
-            SDL_RenderLine(renderer, x, y+6, x+4, y+6);    // Bottom
-            break;
-        case '[':
-            SDL_RenderLine(renderer, x+3, y, x+1, y);      // Top
-            SDL_RenderLine(renderer, x+1, y, x+1, y+9);    // Vertical
-            SDL_RenderLine(renderer, x+1, y+9, x+3, y+9);  // Bottom
-            break;
-        case ']':
-            SDL_RenderLine(renderer, x+1, y, x+3, y);      // Top
-            SDL_RenderLine(renderer, x+3, y, x+3, y+9);    // Vertical
-            SDL_RenderLine(renderer, x+3, y+9, x+1, y+9);  // Bottom
-            break;
-        case '{':
-            SDL_RenderLine(renderer, x+3, y, x+2, y+1);    // Top curve
-            SDL_RenderLine(renderer, x+2, y+1, x+2, y+3);  // Upper vertical
-            SDL_RenderLine(renderer, x+2, y+3, x+1, y+4);  // Middle top curve
-            SDL_RenderLine(renderer, x+1, y+4, x+2, y+5);  // Middle bottom curve
-            SDL_RenderLine(renderer, x+2, y+5, x+2, y+8);  // Lower vertical
-            SDL_RenderLine(renderer, x+2, y+8, x+3, y+9);  // Bottom curve
-            break;
-        case '}':
-            SDL_RenderLine(renderer, x+1, y, x+2, y+1);    // Top curve
-            SDL_RenderLine(renderer, x+2, y+1, x+2, y+3);  // Upper vertical
-            SDL_RenderLine(renderer, x+2, y+3, x+3, y+4);  // Middle top curve
-            SDL_RenderLine(renderer, x+3, y+4, x+2, y+5);  // Middle bottom curve
-            SDL_RenderLine(renderer, x+2, y+5, x+2, y+8);  // Lower vertical
-            SDL_RenderLine(renderer, x+2, y+8, x+1, y+9);  // Bottom curve
-            break;
-        case '>':
-            SDL_RenderLine(renderer, x, y+2, x+3, y+4);    // Top
-            SDL_RenderLine(renderer, x+3, y+4, x, y+7);    // Bottom
-            break;
-        case '<':
-            SDL_RenderLine(renderer, x+3, y+2, x, y+4);    // Top
-            SDL_RenderLine(renderer, x, y+4, x+3, y+7);    // Bottom
-            break;
-        case '\'':
-            SDL_RenderLine(renderer, x+2, y, x+2, y+2);    // Quote
-            break;
-        case '"':
-            SDL_RenderLine(renderer, x+1, y, x+1, y+2);    // Left quote
-            SDL_RenderLine(renderer, x+3, y, x+3, y+2);    // Right quote
-            break;
-        case '`':
-            SDL_RenderLine(renderer, x+1, y, x+2, y+2);    // Backtick
-            break;
-        case '~':
-            SDL_RenderLine(renderer, x, y+4, x+2, y+3);    // Left curve
-            SDL_RenderLine(renderer, x+2, y+3, x+4, y+5);  // Right curve
-            break;
-        case '@':
-            SDL_RenderLine(renderer, x+3, y, x+1, y+2);    // Top left curve
-            SDL_RenderLine(renderer, x+1, y+2, x+1, y+7);  // Left vertical
-            SDL_RenderLine(renderer, x+1, y+7, x+3, y+9);  // Bottom left curve
-            SDL_RenderLine(renderer, x+3, y+9, x+5, y+7);  // Bottom right curve
-            SDL_RenderLine(renderer, x+5, y+7, x+5, y+2);  // Right vertical
-            SDL_RenderLine(renderer, x+5, y+2, x+3, y);    // Top right curve
-            SDL_RenderLine(renderer, x+3, y+5, x+3, y+7);  // Inner vertical
-            SDL_RenderLine(renderer, x+3, y+7, x+4, y+7);  // Inner horizontal
-            SDL_RenderLine(renderer, x+4, y+7, x+5, y+5);  // Inner curve
-            break;
-        case '#':
-            SDL_RenderLine(renderer, x+1, y+1, x+1, y+8);  // Left vertical
-            SDL_RenderLine(renderer, x+4, y+1, x+4, y+8);  // Right vertical
-            SDL_RenderLine(renderer, x, y+3, x+5, y+3);    // Top horizontal
-            SDL_RenderLine(renderer, x, y+6, x+5, y+6);    // Bottom horizontal
-            break;
-        case '$':
-            SDL_RenderLine(renderer, x+2, y, x+2, y+9);    // Middle vertical
-            SDL_RenderLine(renderer, x+4, y+1, x+2, y+1);  // Top right
-            SDL_RenderLine(renderer, x+2, y+1, x, y+3);    // Top left curve
-            SDL_RenderLine(renderer, x, y+3, x+2, y+5);    // Middle left curve
-            SDL_RenderLine(renderer, x+2, y+5, x+4, y+5);  // Middle
-            SDL_RenderLine(renderer, x+4, y+5, x+5, y+7);  // Bottom right curve
-            SDL_RenderLine(renderer, x+5, y+7, x+3, y+9);  // Bottom curve
-            break;
-        case '%':
-            SDL_RenderLine(renderer, x+5, y, x, y+9);      // Main diagonal
-            SDL_RenderPoint(renderer, x+1, y+2);           // Top circle
-            SDL_RenderPoint(renderer, x+4, y+7);           // Bottom circle
-            break;
-        case '^':
-            SDL_RenderLine(renderer, x+1, y+3, x+2, y);    // Left diagonal
-            SDL_RenderLine(renderer, x+2, y, x+3, y+3);    // Right diagonal
-            break;
-        case '&':
-            SDL_RenderLine(renderer, x+4, y+1, x+2, y);    // Top right
-            SDL_RenderLine(renderer, x+2, y, x, y+2);      // Top left curve
-            SDL_RenderLine(renderer, x, y+2, x+2, y+4);    // Middle left curve
-            SDL_RenderLine(renderer, x+2, y+4, x, y+7);    // Middle right curve
-            SDL_RenderLine(renderer, x, y+7, x+2, y+9);    // Bottom left curve
-            SDL_RenderLine(renderer, x+2, y+9, x+4, y+7);  // Bottom right curve
-            SDL_RenderLine(renderer, x+4, y+7, x+5, y+9);  // Bottom right diagonal
-            break;
-        case '*':
-            SDL_RenderLine(renderer, x+2, y+2, x+2, y+7);  // Vertical
-            SDL_RenderLine(renderer, x, y+4, x+4, y+4);    // Horizontal
-            SDL_RenderLine(renderer, x+1, y+2, x+3, y+7);  // Diagonal 1
-            SDL_RenderLine(renderer, x+3, y+2, x+1, y+7);  // Diagonal 2
-            break;
-        default:
-            // For unknown characters, draw a rectangle
-            SDL_FRect charBox = {
-                static_cast<float>(x), static_cast<float>(y),
-                5.0f, 9.0f
-            };
-            SDL_RenderRect(renderer, &charBox);
-            break;
-    }
-}
@@ -0,0 +1,117 @@
+// FILE: src/core/TurnCurveCache.cpp
+#include "core/TurnCurveCache.h"
+#include "core/RoutePathCache.h"
+#include "utils/DebugLogger.h"
+#include <array>
+#include <mutex>
+#include <string>
+
+namespace {
+    // One slot per (road, laneNumber, destination) combination
+    std::array<std::vector<Point>, TurnCurveCache::CURVE_SLOTS> curves;
+    std::array<bool, TurnCurveCache::CURVE_SLOTS> curveBuilt = {};
+    std::mutex buildMutex;
+
+    // Ease-in-out pacing, baked into the table at build time (moved
+    // from Vehicle::easeInOutQuad)
+    float easeInOutQuad(float t) {
+        return t < 0.5f ? 2.0f * t * t : -1.0f + (4.0f - 2.0f * t) * t;
+    }
+}
+
+const std::vector<Point>& TurnCurveCache::getCurve(char lane, int laneNumber,
+                                                   Destination destination) {
+    int slot = slotIndex(lane, laneNumber, destination);
+
+    // Build lazily, once per slot; after that reads are contention-free
+    if (!curveBuilt[slot]) {
+        std::lock_guard<std::mutex> lock(buildMutex);
+        if (!curveBuilt[slot]) {
+            curves[slot] = buildCurve(lane, laneNumber, destination);
+            curveBuilt[slot] = true;
+
+            if (!curves[slot].empty()) {
+                DebugLogger::log("TurnCurveCache built curve " +
+                               std::string(1, lane) + std::to_string(laneNumber) +
+                               " (" + std::to_string(curves[slot].size()) + " samples)");
+            }
+        }
+    }
+
+    return curves[slot];
+}
+
+Point TurnCurveCache::sample(const std::vector<Point>& curve, float progress) {
+    if (curve.empty()) {
+        return {0.0f, 0.0f};
+    }
+
+    if (progress <= 0.0f) {
+        return curve.front();
+    }
+    if (progress >= 1.0f) {
+        return curve.back();
+    }
+
+    // Two table loads and a lerp between adjacent samples
+    float scaled = progress * SAMPLES;
+    int index = static_cast<int>(scaled);
+    float frac = scaled - index;
+    return pointLerp(curve[index], curve[index + 1], frac);
+}
+
+int TurnCurveCache::slotIndex(char lane, int laneNumber, Destination destination) {
+    int road = (lane >= 'A' && lane <= 'D') ? lane - 'A' : 0;
+    int num = (laneNumber >= 1 && laneNumber <= 3) ? laneNumber - 1 : 1;
+    int dest = static_cast<int>(destination);
+    if (dest < 0 || dest > 2) {
+        dest = 0;
+    }
+    return road * 9 + num * 3 + dest;
+}
+
+std::vector<Point> TurnCurveCache::buildCurve(char lane, int laneNumber,
+                                              Destination destination) {
+    std::vector<Point> samples;
+
+    // Only left-turning configurations have a turn phase (L3 always, L2
+    // when heading LEFT); everything else keeps an empty curve
+    bool turns = (laneNumber == 3) ||
+                 (laneNumber == 2 && destination == Destination::LEFT);
+    if (!turns) {
+        return samples;
+    }
+
+    // The turn runs between waypoints 2 and 3 of the shared route (the
+    // same indices where Vehicle::update() flips `turning` on and off)
+    const std::vector<Point>& route =
+        RoutePathCache::getRoute(lane, laneNumber, destination);
+    if (route.size() < 4) {
+        return samples;
+    }
+
+    const Point& start = route[2];
+    const Point& end = route[3];
+
+    // The bezier control point is the corner where the entry and exit
+    // legs would meet: entry travel is vertical on roads A/C and
+    // horizontal on roads B/D
+    Point control;
+    if (lane == 'A' || lane == 'C') {
+        control = {start.x, end.y};
+    } else {
+        control = {end.x, start.y};
+    }
+
+    // Quantize the eased quadratic bezier (the same math the old
+    // per-frame path evaluated) into SAMPLES + 1 points, through the
+    // batch evaluator so the whole table vectorizes
+    float ts[SAMPLES + 1];
+    for (int i = 0; i <= SAMPLES; i++) {
+        ts[i] = easeInOutQuad(static_cast<float>(i) / SAMPLES);
+    }
+    samples.resize(SAMPLES + 1);
+    bezierQuadSpan(start, control, end, ts, samples.data(), samples.size());
+
+    return samples;
+}
@@ -1,33 +1,53 @@
 // FILE: src/core/Vehicle.cpp
 #include "core/Vehicle.h"
+#include "visualization/GeometryBatch.h"
+#include "visualization/VehicleSpriteAtlas.h"
 #include "core/Constants.h"
+#include "core/MovementKernel.h"
+#include "core/RoutePathCache.h"
+#include "core/TurnCurveCache.h"
+#include "core/VehicleStateStore.h"
 #include "utils/DebugLogger.h"
+#include "utils/FrameClock.h"
+#include "utils/TuningConfig.h"
+#include "utils/VehicleIdRegistry.h"
 #include <cmath>
+#include <cstring>
 #include <sstream>
 #include <random> // Add this for random number generation
 
-Vehicle::Vehicle(const std::string& id, char lane, int laneNumber, bool isEmergency)
+// The hot core must stay within 48 bytes so a 1200-vehicle working set
+// fits comfortably in L2 during processVehicles() (see the member
+// layout comment in Vehicle.h)
+static_assert(sizeof(Vehicle) <= 48, "Vehicle hot core grew past 48 bytes");
+
+Vehicle::Vehicle(uint32_t id, char lane, int laneNumber, bool isEmergency)
     : id(id),
+      arrivalTime(static_cast<uint32_t>(time(nullptr))),
+      stateSlot(VehicleStateStore::acquire()),
+      currentWaypoint(0),
+      routePath(nullptr),
+      turnCurve(nullptr),
       lane(lane),
-      laneNumber(laneNumber),
+      laneNumber(static_cast<int8_t>(laneNumber)),
       isEmergency(isEmergency),
-      arrivalTime(time(nullptr)),
-      animPos(0.0f),
       turning(false),
-      turnProgress(0.0f),
-      turnPosX(0.0f),
-      turnPosY(0.0f),
-      queuePos(0),
+      boxReserved(false),
       destination(Destination::STRAIGHT),
       currentDirection(Direction::DOWN),
       state(VehicleState::APPROACHING),
-      currentWaypoint(0) {
+      bucket(MoveBucket::EDGE), // Scalar-safe until the route attaches
+      queuePos(0) {
 
     // Log creation
     std::ostringstream oss;
-    oss << "Created vehicle " << id << " in lane " << lane << laneNumber;
+    oss << "Created vehicle " << getLabel() << " in lane " << lane << laneNumber;
     DebugLogger::log(oss.str());
 
+    initializeSpawnState();
+}
+
+void Vehicle::initializeSpawnState() {
     // Window dimensions
     const int windowWidth = 800;
     const int windowHeight = 800;
@@ -69,385 +89,187 @@ Vehicle::Vehicle(const std::string& id, char lane, int laneNumber, bool isEmerge
             // Lane 3 is rightmost lane - always turns left
             switch (laneNumber) {
                 case 2:
-                    turnPosX = centerX; // Center lane
+                    posX() = centerX; // Center lane
                     break;
                 case 3:
-                    turnPosX = centerX + laneOffset; // Right lane
+                    posX() = centerX + laneOffset; // Right lane
                     break;
                 default:
-                    turnPosX = centerX; // Default to center if invalid
+                    posX() = centerX; // Default to center if invalid
                     DebugLogger::log("Invalid lane number for Road A: " + std::to_string(laneNumber), DebugLogger::LogLevel::WARNING);
                     break;
             }
-            turnPosY = 20.0f; // Near top of screen
+            posY() = 20.0f; // Near top of screen
             break;
 
         case 'B': // East road (right)
             switch (laneNumber) {
                 case 2:
-                    turnPosY = centerY; // Center lane
+                    posY() = centerY; // Center lane
                     break;
                 case 3:
-                    turnPosY = centerY + laneOffset; // Bottom lane
+                    posY() = centerY + laneOffset; // Bottom lane
                     break;
                 default:
-                    turnPosY = centerY; // Default to center if invalid
+                    posY() = centerY; // Default to center if invalid
                     DebugLogger::log("Invalid lane number for Road B: " + std::to_string(laneNumber), DebugLogger::LogLevel::WARNING);
                     break;
             }
-            turnPosX = windowWidth - 20.0f; // Near right edge of screen
+            posX() = windowWidth - 20.0f; // Near right edge of screen
             break;
 
         case 'C': // South road (bottom)
             switch (laneNumber) {
                 case 2:
-                    turnPosX = centerX; // Center lane
+                    posX() = centerX; // Center lane
                     break;
                 case 3:
-                    turnPosX = centerX - laneOffset; // Left lane
+                    posX() = centerX - laneOffset; // Left lane
                     break;
                 default:
-                    turnPosX = centerX; // Default to center if invalid
+                    posX() = centerX; // Default to center if invalid
                     DebugLogger::log("Invalid lane number for Road C: " + std::to_string(laneNumber), DebugLogger::LogLevel::WARNING);
                     break;
             }
-            turnPosY = windowHeight - 20.0f; // Near bottom of screen
+            posY() = windowHeight - 20.0f; // Near bottom of screen
             break;
 
         case 'D': // West road (left)
             switch (laneNumber) {
                 case 2:
-                    turnPosY = centerY; // Center lane
+                    posY() = centerY; // Center lane
                     break;
                 case 3:
-                    turnPosY = centerY - laneOffset; // Top lane
+                    posY() = centerY - laneOffset; // Top lane
                     break;
                 default:
-                    turnPosY = centerY; // Default to center if invalid
+                    posY() = centerY; // Default to center if invalid
                     DebugLogger::log("Invalid lane number for Road D: " + std::to_string(laneNumber), DebugLogger::LogLevel::WARNING);
                     break;
             }
-            turnPosX = 20.0f; // Near left edge of screen
+            posX() = 20.0f; // Near left edge of screen
             break;
     }
 
     // Set initial animation position
-    animPos = (currentDirection == Direction::UP || currentDirection == Direction::DOWN) ?
-              turnPosY : turnPosX;
+    animPosRef() = (currentDirection == Direction::UP || currentDirection == Direction::DOWN) ?
+              posY() : posX();
 
     // Determine destination based on lane number following the assignment rules
     if (laneNumber == 3) {
         // Lane 3 (L3) always turns left
         destination = Destination::LEFT;
-        std::string msg = "Vehicle " + id + " on lane " + lane + std::to_string(laneNumber) + " will turn LEFT (free lane rule)";
+        std::string msg = "Vehicle " + getLabel() + " on lane " + lane + std::to_string(laneNumber) + " will turn LEFT (free lane rule)";
         DebugLogger::log(msg);
     }
     else if (laneNumber == 2) {
         // Lane 2 (L2) can go straight or left (not right)
-        // Check for direction indication in ID
-        if (id.find("_LEFT") != std::string::npos) {
+        // Check for direction indication in the display label
+        const std::string& label = getLabel();
+        if (label.find("_LEFT") != std::string::npos) {
             destination = Destination::LEFT;
-        } else if (id.find("_STRAIGHT") != std::string::npos) {
+        } else if (label.find("_STRAIGHT") != std::string::npos) {
             destination = Destination::STRAIGHT;
         } else {
             // Default behavior: 60% straight, 40% left
             int idHash = 0;
-            for (char c : id) idHash += c;
+            for (char c : label) idHash += c;
             destination = (idHash % 10 < 6) ? Destination::STRAIGHT : Destination::LEFT;
         }
 
         std::string destStr = (destination == Destination::STRAIGHT) ? "STRAIGHT" : "LEFT";
-        DebugLogger::log("Vehicle " + id + " on lane " + lane + std::to_string(laneNumber) + " will go " + destStr);
+        DebugLogger::log("Vehicle " + getLabel() + " on lane " + lane + std::to_string(laneNumber) + " will go " + destStr);
     }
     else if (laneNumber == 1) {
         // Lane 1 (L1) is incoming lane (vehicles don't spawn here)
         destination = Destination::STRAIGHT;
-        DebugLogger::log("WARNING: Vehicle " + id + " created in lane " + lane + "1 (incoming lane)");
+        DebugLogger::log("WARNING: Vehicle " + getLabel() + " created in lane " + lane + "1 (incoming lane)");
     }
 
     // Initialize waypoints for movement
     initializeWaypoints();
 }
 
-Vehicle::~Vehicle() {
-    std::ostringstream oss;
-    oss << "Destroyed vehicle " << id;
-    DebugLogger::log(oss.str());
-}
-
-void Vehicle::initializeWaypoints() {
-    // Window dimensions
-    const int windowWidth = 800;
-    const int windowHeight = 800;
-    const int centerX = windowWidth / 2;
-    const int centerY = windowHeight / 2;
-
-    // Clear existing waypoints
-    waypoints.clear();
-
-    // Adjust intersection boundaries
-    const float intersectionHalf = 70.0f; // Intersection size
-    const float leftEdge = centerX - intersectionHalf;
-    const float rightEdge = centerX + intersectionHalf;
-    const float topEdge = centerY - intersectionHalf;
-    const float bottomEdge = centerY + intersectionHalf;
-
-    // CRITICAL: Lane offsets for proper alignment
-    // These define the x/y positions of lanes for proper alignment
-    const float laneOffset = Constants::LANE_WIDTH;
-
-    // L1 (incoming lane) should be offset inward from center
-    const float lane1Offset = -20.0f;
-
-    // L2 is in the center of each road
-    const float lane2Offset = 0.0f;
-
-    // L3 (free lane) should be offset outward from center
-    const float lane3Offset = 20.0f;
-
-    // Add the starting position as first waypoint
-    waypoints.push_back({turnPosX, turnPosY});
-
-    // Add approach to intersection waypoint
-    switch (currentDirection) {
-        case Direction::DOWN: // From North (A)
-            waypoints.push_back({turnPosX, topEdge - 5.0f});
-            break;
-        case Direction::UP: // From South (C)
-            waypoints.push_back({turnPosX, bottomEdge + 5.0f});
-            break;
-        case Direction::LEFT: // From East (B)
-            waypoints.push_back({rightEdge + 5.0f, turnPosY});
-            break;
-        case Direction::RIGHT: // From West (D)
-            waypoints.push_back({leftEdge - 5.0f, turnPosY});
-            break;
-    }
-
-    // CRITICAL: Strictly follow the assignment routing requirements:
-    // AL3 → BL1; AL2: Straight → CL1, Left → DL1
-    // BL3 → CL1; BL2: Straight → DL1, Left → AL1
-    // CL3 → DL1; CL2: Straight → AL1, Left → BL1
-    // DL3 → AL1; DL2: Straight → BL1, Left → CL1
-
-    // CRITICAL: Before initializing, log the vehicle's details
-    std::ostringstream debugLog;
-    debugLog << "Routing vehicle " << id << " from " << lane << laneNumber;
-    if (laneNumber == 3) {
-        debugLog << " (free lane, always turns LEFT)";
-    } else if (laneNumber == 2) {
-        debugLog << " going " << (destination == Destination::LEFT ? "LEFT" : "STRAIGHT");
-    }
-    DebugLogger::log(debugLog.str(), DebugLogger::LogLevel::ERROR);
-
-    if (laneNumber == 3) {
-        // CRITICAL: Lane 3 MUST ALWAYS turn left to L1
-        switch (currentDirection) {
-            case Direction::DOWN:  // A(North) to B(East) - AL3 → BL1
-                // First intermediate point inside intersection
-                waypoints.push_back({centerX, topEdge + 20.0f});
-
-                // Second intermediate point
-                waypoints.push_back({rightEdge - 20.0f, centerY});
-
-                // CRITICAL: Exit precisely in BL1
-                waypoints.push_back({rightEdge + 5.0f, centerY + lane1Offset});
-
-                // Off screen
-                waypoints.push_back({windowWidth + 30.0f, centerY + lane1Offset});
-
-                DebugLogger::log("AL3 route: LEFT to BL1", DebugLogger::LogLevel::ERROR);
-                break;
-
-            case Direction::UP:    // C(South) to D(West) - CL3 → DL1
-                // First intermediate point
-                waypoints.push_back({centerX, bottomEdge - 20.0f});
-
-                // Second intermediate point
-                waypoints.push_back({leftEdge + 20.0f, centerY});
-
-                // CRITICAL: Exit precisely in DL1
-                waypoints.push_back({leftEdge - 5.0f, centerY + lane1Offset});
-
-                // Off screen
-                waypoints.push_back({-30.0f, centerY + lane1Offset});
-
-                DebugLogger::log("CL3 route: LEFT to DL1", DebugLogger::LogLevel::ERROR);
-                break;
-
-            case Direction::LEFT:  // B(East) to C(South) - BL3 → CL1
-                // First intermediate point
-                waypoints.push_back({rightEdge - 20.0f, centerY});
-
-                // Second intermediate point
-                waypoints.push_back({centerX, bottomEdge - 20.0f});
-
-                // CRITICAL: Exit precisely in CL1
-                waypoints.push_back({centerX + lane1Offset, bottomEdge + 5.0f});
-
-                // Off screen
-                waypoints.push_back({centerX + lane1Offset, windowHeight + 30.0f});
-
-                DebugLogger::log("BL3 route: LEFT to CL1", DebugLogger::LogLevel::ERROR);
-                break;
-
-            case Direction::RIGHT: // D(West) to A(North) - DL3 → AL1
-                // First intermediate point
-                waypoints.push_back({leftEdge + 20.0f, centerY});
-
-                // Second intermediate point
-                waypoints.push_back({centerX, topEdge + 20.0f});
-
-                // CRITICAL: Exit precisely in AL1
-                waypoints.push_back({centerX + lane1Offset, topEdge - 5.0f});
-
-                // Off screen
-                waypoints.push_back({centerX + lane1Offset, -30.0f});
-
-                DebugLogger::log("DL3 route: LEFT to AL1", DebugLogger::LogLevel::ERROR);
-                break;
-        }
-    }
-    else if (laneNumber == 2) {
-        if (destination == Destination::STRAIGHT) {
-            // CRITICAL: L2 straight must go to L1 (incoming lane)
-            switch (currentDirection) {
-                case Direction::DOWN:  // A(North) to C(South) - AL2(straight) → CL1
-                    // Through intersection
-                    waypoints.push_back({centerX, centerY});
-
-                    // CRITICAL: Exit precisely in CL1
-                    waypoints.push_back({centerX + lane1Offset, bottomEdge + 5.0f});
-
-                    // Off screen
-                    waypoints.push_back({centerX + lane1Offset, windowHeight + 30.0f});
-
-                    DebugLogger::log("AL2 route: STRAIGHT to CL1", DebugLogger::LogLevel::ERROR);
-                    break;
-
-                case Direction::UP:    // C(South) to A(North) - CL2(straight) → AL1
-                    // Through intersection
-                    waypoints.push_back({centerX, centerY});
-
-                    // CRITICAL: Exit precisely in AL1
-                    waypoints.push_back({centerX + lane1Offset, topEdge - 5.0f});
-
-                    // Off screen
-                    waypoints.push_back({centerX + lane1Offset, -30.0f});
-
-                    DebugLogger::log("CL2 route: STRAIGHT to AL1", DebugLogger::LogLevel::ERROR);
-                    break;
-
-                case Direction::LEFT:  // B(East) to D(West) - BL2(straight) → DL1
-                    // Through intersection
-                    waypoints.push_back({centerX, centerY});
-
-                    // CRITICAL: Exit precisely in DL1
-                    waypoints.push_back({leftEdge - 5.0f, centerY + lane1Offset});
-
-                    // Off screen
-                    waypoints.push_back({-30.0f, centerY + lane1Offset});
-
-                    DebugLogger::log("BL2 route: STRAIGHT to DL1", DebugLogger::LogLevel::ERROR);
-                    break;
-
-                case Direction::RIGHT: // D(West) to B(East) - DL2(straight) → BL1
-                    // Through intersection
-                    waypoints.push_back({centerX, centerY});
-
-                    // CRITICAL: Exit precisely in BL1
-                    waypoints.push_back({rightEdge + 5.0f, centerY + lane1Offset});
-
-                    // Off screen
-                    waypoints.push_back({windowWidth + 30.0f, centerY + lane1Offset});
-
-                    DebugLogger::log("DL2 route: STRAIGHT to BL1", DebugLogger::LogLevel::ERROR);
-                    break;
-            }
-        }
-        else if (destination == Destination::LEFT) {
-            // CRITICAL: L2 left turn must go to L1 (incoming lane)
-            switch (currentDirection) {
-                case Direction::DOWN:  // A(North) to D(West) - AL2(left) → DL1
-                    // First turn point
-                    waypoints.push_back({centerX, topEdge + 20.0f});
-
-                    // Second turn point
-                    waypoints.push_back({leftEdge + 20.0f, centerY});
-
-                    // CRITICAL: Exit precisely in DL1
-                    waypoints.push_back({leftEdge - 5.0f, centerY + lane1Offset});
-
-                    // Off screen
-                    waypoints.push_back({-30.0f, centerY + lane1Offset});
-
-                    DebugLogger::log("AL2 route: LEFT to DL1", DebugLogger::LogLevel::ERROR);
-                    break;
-
-                case Direction::UP:    // C(South) to B(East) - CL2(left) → BL1
-                    // First turn point
-                    waypoints.push_back({centerX, bottomEdge - 20.0f});
-
-                    // Second turn point
-                    waypoints.push_back({rightEdge - 20.0f, centerY});
+void Vehicle::resetForReentry(char newLane, int newLaneNumber) {
+    lane = newLane;
+    laneNumber = static_cast<int8_t>(newLaneNumber);
+    arrivalTime = static_cast<uint32_t>(time(nullptr));
+    state = VehicleState::APPROACHING;
+    queuePos = 0;
+    turning = false;
+    boxReserved = false;
+    turnProgressRef() = 0.0f;
 
-                    // CRITICAL: Exit precisely in BL1
-                    waypoints.push_back({rightEdge + 5.0f, centerY + lane1Offset});
+    // No ingestion pipeline to close out on a re-entry
+    VehicleStateStore::spawnCreatedUs(stateSlot) = 0;
+    VehicleStateStore::spawnPickedUpUs(stateSlot) = 0;
 
-                    // Off screen
-                    waypoints.push_back({windowWidth + 30.0f, centerY + lane1Offset});
+    // The jump back to the spawn edge is a teleport; the render blend
+    // must not sweep it across the screen
+    VehicleStateStore::noteRespawn(stateSlot);
 
-                    DebugLogger::log("CL2 route: LEFT to BL1", DebugLogger::LogLevel::ERROR);
-                    break;
+    initializeSpawnState();
+}
 
-                case Direction::LEFT:  // B(East) to A(North) - BL2(left) → AL1
-                    // First turn point
-                    waypoints.push_back({rightEdge - 20.0f, centerY});
+Vehicle::~Vehicle() {
+    VehicleStateStore::release(stateSlot);
 
-                    // Second turn point
-                    waypoints.push_back({centerX, topEdge + 20.0f});
+    std::ostringstream oss;
+    oss << "Destroyed vehicle " << getLabel();
+    DebugLogger::log(oss.str());
+}
 
-                    // CRITICAL: Exit precisely in AL1
-                    waypoints.push_back({centerX + lane1Offset, topEdge - 5.0f});
+float& Vehicle::posX() const {
+    return VehicleStateStore::x(stateSlot);
+}
 
-                    // Off screen
-                    waypoints.push_back({centerX + lane1Offset, -30.0f});
+float& Vehicle::posY() const {
+    return VehicleStateStore::y(stateSlot);
+}
 
-                    DebugLogger::log("BL2 route: LEFT to AL1", DebugLogger::LogLevel::ERROR);
-                    break;
+float Vehicle::renderPosX() const {
+    return VehicleStateStore::renderX(stateSlot);
+}
 
-                case Direction::RIGHT: // D(West) to C(South) - DL2(left) → CL1
-                    // First turn point
-                    waypoints.push_back({leftEdge + 20.0f, centerY});
+float Vehicle::renderPosY() const {
+    return VehicleStateStore::renderY(stateSlot);
+}
 
-                    // Second turn point
-                    waypoints.push_back({centerX, bottomEdge - 20.0f});
+float& Vehicle::animPosRef() const {
+    return VehicleStateStore::animPos(stateSlot);
+}
 
-                    // CRITICAL: Exit precisely in CL1
-                    waypoints.push_back({centerX + lane1Offset, bottomEdge + 5.0f});
+float& Vehicle::turnProgressRef() const {
+    return VehicleStateStore::turnProgress(stateSlot);
+}
 
-                    // Off screen
-                    waypoints.push_back({centerX + lane1Offset, windowHeight + 30.0f});
+void Vehicle::initializeWaypoints() {
+    // Routes are shared and immutable: look up the precomputed path for
+    // this (lane, laneNumber, destination) instead of rebuilding it
+    routePath = &RoutePathCache::getRoute(lane, laneNumber, destination);
 
-                    DebugLogger::log("DL2 route: LEFT to CL1", DebugLogger::LogLevel::ERROR);
-                    break;
-            }
-        }
-    }
+    // Attach the precomputed turn curve for this configuration (empty
+    // for routes with no turn phase)
+    turnCurve = &TurnCurveCache::getCurve(lane, laneNumber, destination);
 
     // Set current waypoint index
     currentWaypoint = 0;
     turning = false;
+    boxReserved = false;
+    reclassifyBucket();
 
-    // CRITICAL: log the total waypoints for debugging
-    DebugLogger::log("Vehicle " + id + " initialized with " +
-                   std::to_string(waypoints.size()) + " waypoints");
+    DebugLogger::log("Vehicle " + getLabel() + " attached to route with " +
+                   std::to_string(route().size()) + " waypoints");
 }
 
-std::string Vehicle::getId() const {
+uint32_t Vehicle::getId() const {
     return id;
 }
 
+const std::string& Vehicle::getLabel() const {
+    return VehicleIdRegistry::label(id);
+}
+
 char Vehicle::getLane() const {
     return lane;
 }
@@ -461,7 +283,7 @@ int Vehicle::getLaneNumber() const {
 }
 
 void Vehicle::setLaneNumber(int number) {
-    this->laneNumber = number;
+    this->laneNumber = static_cast<int8_t>(number);
 }
 
 bool Vehicle::isEmergencyVehicle() const {
@@ -473,11 +295,11 @@ time_t Vehicle::getArrivalTime() const {
 }
 
 float Vehicle::getAnimationPos() const {
-    return animPos;
+    return animPosRef();
 }
 
 void Vehicle::setAnimationPos(float pos) {
-    this->animPos = pos;
+    this->animPosRef() = pos;
 }
 
 bool Vehicle::isTurning() const {
@@ -486,30 +308,52 @@ bool Vehicle::isTurning() const {
 
 void Vehicle::setTurning(bool turning) {
     this->turning = turning;
+    reclassifyBucket();
 }
 
 float Vehicle::getTurnProgress() const {
-    return turnProgress;
+    return turnProgressRef();
 }
 
 void Vehicle::setTurnProgress(float progress) {
-    this->turnProgress = progress;
+    this->turnProgressRef() = progress;
 }
 
 float Vehicle::getTurnPosX() const {
-    return turnPosX;
+    return posX();
 }
 
 void Vehicle::setTurnPosX(float x) {
-    this->turnPosX = x;
+    this->posX() = x;
 }
 
 float Vehicle::getTurnPosY() const {
-    return turnPosY;
+    return posY();
 }
 
 void Vehicle::setTurnPosY(float y) {
-    this->turnPosY = y;
+    this->posY() = y;
+}
+
+float Vehicle::getPosX() const {
+    return renderPosX();
+}
+
+float Vehicle::getPosY() const {
+    return renderPosY();
+}
+
+void Vehicle::setSpawnStamps(uint32_t createdUs, uint32_t pickedUpUs) {
+    VehicleStateStore::spawnCreatedUs(stateSlot) = createdUs;
+    VehicleStateStore::spawnPickedUpUs(stateSlot) = pickedUpUs;
+}
+
+uint32_t Vehicle::getSpawnCreatedUs() const {
+    return VehicleStateStore::spawnCreatedUs(stateSlot);
+}
+
+uint32_t Vehicle::getSpawnPickedUpUs() const {
+    return VehicleStateStore::spawnPickedUpUs(stateSlot);
 }
 
 void Vehicle::setDestination(Destination dest) {
@@ -527,7 +371,7 @@ void Vehicle::setDestination(Destination dest) {
             case Destination::LEFT: destStr = "LEFT"; break;
             case Destination::RIGHT: destStr = "RIGHT"; break;
         }
-        oss << "Vehicle " << id << " destination set to " << destStr;
+        oss << "Vehicle " << getLabel() << " destination set to " << destStr;
         DebugLogger::log(oss.str());
     }
 }
@@ -536,11 +380,230 @@ Destination Vehicle::getDestination() const {
     return destination;
 }
 
-float Vehicle::easeInOutQuad(float t) const {
-    return t < 0.5f ? 2.0f * t * t : -1.0f + (4.0f - 2.0f * t) * t;
+bool Vehicle::queueStraightMove(MovementKernel& kernel, uint32_t delta,
+                                float maxAdvance, float& plannedStep) {
+    // The caller already dispatched on the cached CRUISE bucket and the
+    // lane's movable bit, so the turning and route-bounds checks this
+    // used to re-derive per vehicle are settled; only the positional
+    // hand-off test below needs this tick's data. Turning vehicles
+    // (bezier path), red-light queueing and waypoint hand-offs all stay
+    // on the scalar path in update(), which owns the state transitions.
+    const auto& next = route()[currentWaypoint + 1];
+    float dx = next.x - posX();
+    float dy = next.y - posY();
+    float distance = std::sqrt(dx * dx + dy * dy);
+
+    // Same speed adjustment as update()
+    const float SPEED_BASE = TuningConfig::getVehicleSpeedBase();
+    float speed = SPEED_BASE * delta;
+    if (currentWaypoint == 1) {
+        speed *= 0.9f;
+    } else if (currentWaypoint >= 3) {
+        speed *= 1.2f;
+    }
+
+    // Gap-propagation clamp from the vehicle ahead; a fully blocked
+    // vehicle stays scalar (update() holds position and runs the
+    // queue-approach logic)
+    if (maxAdvance <= 0.0f) {
+        return false;
+    }
+    speed = std::min(speed, maxAdvance);
+
+    // Leave the waypoint hand-off zone (plus a full step of slack) to
+    // update() so a batched step can never cross a waypoint unnoticed
+    if (distance < 3.0f + speed * 2.0f) {
+        return false;
+    }
+
+    MovementKernel::Move move;
+    move.slot = stateSlot;
+    move.targetX = next.x;
+    move.targetY = next.y;
+    move.speed = speed;
+    move.animAlongY = (currentDirection == Direction::UP ||
+                       currentDirection == Direction::DOWN);
+    kernel.add(move);
+    plannedStep = speed;
+    return true;
+}
+
+void Vehicle::reclassifyBucket() {
+    if (turning) {
+        bucket = MoveBucket::TURN;
+    } else if (!routePath || route().empty() ||
+               currentWaypoint >= route().size() - 1) {
+        bucket = MoveBucket::EDGE;
+    } else {
+        bucket = MoveBucket::CRUISE;
+    }
+}
+
+// One waypoint crossing: the logging, turn-phase entry, exit detection
+// and lane reassignment rules shared by update() (at 3px range) and
+// fastForward() (whenever a step consumes a whole segment)
+void Vehicle::advanceWaypoint() {
+    currentWaypoint++;
+
+    // Log progress through waypoints for debugging (compiles out in
+    // release - this fires for every waypoint of every tracked vehicle)
+    if (laneNumber == 3 || (lane == 'A' && laneNumber == 2)) {
+        DebugLogger::logAt<DebugLogger::LogLevel::DEBUG>([&] {
+            return "Vehicle " + getLabel() + " on " + lane + std::to_string(laneNumber) +
+                   " reached waypoint " + std::to_string(currentWaypoint) +
+                   " of " + std::to_string(route().size());
+        });
+    }
+
+    // For L3 (always turns left) and L2 (turns left if specified)
+    if ((laneNumber == 3) ||
+        (laneNumber == 2 && destination == Destination::LEFT)) {
+
+        // When entering turning points (varies by direction)
+        if (currentWaypoint == 2) {
+            turning = true;
+            turnProgressRef() = 0.0f;
+            state = VehicleState::IN_INTERSECTION;
+
+            // Log turn start
+            std::ostringstream oss;
+            oss << "Vehicle " << getLabel() << " on " << lane << laneNumber << " is now turning LEFT";
+            DebugLogger::log(oss.str(), DebugLogger::LogLevel::ERROR);
+        }
+    }
+
+    // Determine when a vehicle has exited the intersection
+    bool isExiting = false;
+
+    if (laneNumber == 3) {
+        // L3 vehicles typically reach exit point at waypoint 3
+        isExiting = (currentWaypoint == 3);
+    } else if (laneNumber == 2) {
+        if (destination == Destination::LEFT) {
+            // L2 turning left typically reaches exit at waypoint 3
+            isExiting = (currentWaypoint == 3);
+        } else {
+            // L2 going straight typically reaches exit at waypoint 2
+            isExiting = (currentWaypoint == 2);
+        }
+    }
+
+    // Update vehicle state when exiting
+    if (isExiting) {
+        turning = false;
+        state = VehicleState::EXITING;
+
+        // CRITICAL: Ensure the lane assignments strictly follow the rules
+        std::string newLaneStr;
+        switch (currentDirection) {
+            case Direction::DOWN:  // From North (A)
+                if (laneNumber == 3) {
+                    // AL3 → BL1
+                    lane = 'B';
+                    laneNumber = 1;
+                    currentDirection = Direction::LEFT;
+                    newLaneStr = "B1 (turned LEFT from A3)";
+                }
+                else if (destination == Destination::LEFT) {
+                    // AL2(left) → DL1
+                    lane = 'D';
+                    laneNumber = 1;
+                    currentDirection = Direction::RIGHT;
+                    newLaneStr = "D1 (turned LEFT from A2)";
+                }
+                else {
+                    // AL2(straight) → CL1
+                    lane = 'C';
+                    laneNumber = 1;
+                    currentDirection = Direction::UP;
+                    newLaneStr = "C1 (going STRAIGHT from A2)";
+                }
+                break;
+
+            case Direction::UP:    // From South (C)
+                if (laneNumber == 3) {
+                    // CL3 → DL1
+                    lane = 'D';
+                    laneNumber = 1;
+                    currentDirection = Direction::RIGHT;
+                    newLaneStr = "D1 (turned LEFT from C3)";
+                }
+                else if (destination == Destination::LEFT) {
+                    // CL2(left) → BL1
+                    lane = 'B';
+                    laneNumber = 1;
+                    currentDirection = Direction::LEFT;
+                    newLaneStr = "B1 (turned LEFT from C2)";
+                }
+                else {
+                    // CL2(straight) → AL1
+                    lane = 'A';
+                    laneNumber = 1;
+                    currentDirection = Direction::DOWN;
+                    newLaneStr = "A1 (going STRAIGHT from C2)";
+                }
+                break;
+
+            case Direction::LEFT:  // From East (B)
+                if (laneNumber == 3) {
+                    // BL3 → CL1
+                    lane = 'C';
+                    laneNumber = 1;
+                    currentDirection = Direction::UP;
+                    newLaneStr = "C1 (turned LEFT from B3)";
+                }
+                else if (destination == Destination::LEFT) {
+                    // BL2(left) → AL1
+                    lane = 'A';
+                    laneNumber = 1;
+                    currentDirection = Direction::DOWN;
+                    newLaneStr = "A1 (turned LEFT from B2)";
+                }
+                else {
+                    // BL2(straight) → DL1
+                    lane = 'D';
+                    laneNumber = 1;
+                    currentDirection = Direction::RIGHT;
+                    newLaneStr = "D1 (going STRAIGHT from B2)";
+                }
+                break;
+
+            case Direction::RIGHT: // From West (D)
+                if (laneNumber == 3) {
+                    // DL3 → AL1
+                    lane = 'A';
+                    laneNumber = 1;
+                    currentDirection = Direction::DOWN;
+                    newLaneStr = "A1 (turned LEFT from D3)";
+                }
+                else if (destination == Destination::LEFT) {
+                    // DL2(left) → CL1
+                    lane = 'C';
+                    laneNumber = 1;
+                    currentDirection = Direction::UP;
+                    newLaneStr = "C1 (turned LEFT from D2)";
+                }
+                else {
+                    // DL2(straight) → BL1
+                    lane = 'B';
+                    laneNumber = 1;
+                    currentDirection = Direction::LEFT;
+                    newLaneStr = "B1 (going STRAIGHT from D2)";
+                }
+                break;
+        }
+
+        // Log lane change
+        DebugLogger::log("==================== Vehicle " + getLabel() + " now on " + newLaneStr +
+                      " ====================", DebugLogger::LogLevel::ERROR);
+    }
+
+    // Waypoint crossings are the movement-bucket transition points
+    reclassifyBucket();
 }
 
-void Vehicle::update(uint32_t delta, bool isGreenLight, float targetPos) {
+void Vehicle::update(uint32_t delta, bool isGreenLight, float targetPos,
+                     float maxAdvance) {
     // CRITICAL FIX: Free lane vehicles (L3) can ALWAYS move regardless of traffic light
     bool canMove = isGreenLight;
 
@@ -550,9 +613,9 @@ void Vehicle::update(uint32_t delta, bool isGreenLight, float targetPos) {
 
         // Debug log for free lane
         static uint32_t lastLogTime = 0;
-        uint32_t currentTime = SDL_GetTicks();
+        uint32_t currentTime = FrameClock::nowMs();
         if (currentTime - lastLogTime > 3000) {
-DebugLogger::log("FREE LANE (" + std::string(1, lane) + "3): Vehicle " + id + " moving freely",
+DebugLogger::log("FREE LANE (" + std::string(1, lane) + "3): Vehicle " + getLabel() + " moving freely",
                DebugLogger::LogLevel::ERROR);
             lastLogTime = currentTime;
         }
@@ -561,187 +624,36 @@ DebugLogger::log("FREE LANE (" + std::string(1, lane) + "3): Vehicle " + id + "
     // DEBUG: Log A2 priority lane status
     if (lane == 'A' && laneNumber == 2) {
         static uint32_t lastLogTime = 0;
-        uint32_t currentTime = SDL_GetTicks();
+        uint32_t currentTime = FrameClock::nowMs();
         if (currentTime - lastLogTime > 3000) {
-            DebugLogger::log("PRIORITY LANE (A2): Vehicle " + id + " canMove=" +
+            DebugLogger::log("PRIORITY LANE (A2): Vehicle " + getLabel() + " canMove=" +
                          (canMove ? "true" : "false"), DebugLogger::LogLevel::ERROR);
             lastLogTime = currentTime;
         }
     }
 
     // Fine-tune speed for smoother animation
-    const float SPEED_BASE = 0.018f;
+    const float SPEED_BASE = TuningConfig::getVehicleSpeedBase();
     const float SPEED = SPEED_BASE * delta;
     const float VEHICLE_SPACING = 50.0f; // Increased from 35.0f for better separation
 
     if (canMove) {
         // We have more waypoints to travel
-        if (currentWaypoint < waypoints.size() - 1) {
+        if (currentWaypoint < route().size() - 1) {
             // Get current and next waypoint
-            auto& current = waypoints[currentWaypoint];
-            auto& next = waypoints[currentWaypoint + 1];
+            const auto& current = route()[currentWaypoint];
+            const auto& next = route()[currentWaypoint + 1];
 
             // Calculate direction vector
-            float dx = next.x - turnPosX;
-            float dy = next.y - turnPosY;
+            float dx = next.x - posX();
+            float dy = next.y - posY();
 
             // Calculate distance to next waypoint
             float distance = std::sqrt(dx*dx + dy*dy);
 
             // If close enough to waypoint, move to next
             if (distance < 3.0f) {
-                currentWaypoint++;
-
-                // Log progress through waypoints for debugging
-                if (laneNumber == 3 || (lane == 'A' && laneNumber == 2)) {
-                    DebugLogger::log("Vehicle " + id + " on " + lane + std::to_string(laneNumber) +
-                                 " reached waypoint " + std::to_string(currentWaypoint) +
-                                 " of " + std::to_string(waypoints.size()),
-                                 DebugLogger::LogLevel::DEBUG);
-                }
-
-                // For L3 (always turns left) and L2 (turns left if specified)
-                if ((laneNumber == 3) ||
-                    (laneNumber == 2 && destination == Destination::LEFT)) {
-
-                    // When entering turning points (varies by direction)
-                    if (currentWaypoint == 2) {
-                        turning = true;
-                        turnProgress = 0.0f;
-                        state = VehicleState::IN_INTERSECTION;
-
-                        // Log turn start
-                        std::ostringstream oss;
-                        oss << "Vehicle " << id << " on " << lane << laneNumber << " is now turning LEFT";
-                        DebugLogger::log(oss.str(), DebugLogger::LogLevel::ERROR);
-                    }
-                }
-
-                // Determine when a vehicle has exited the intersection
-                bool isExiting = false;
-
-                if (laneNumber == 3) {
-                    // L3 vehicles typically reach exit point at waypoint 3
-                    isExiting = (currentWaypoint == 3);
-                } else if (laneNumber == 2) {
-                    if (destination == Destination::LEFT) {
-                        // L2 turning left typically reaches exit at waypoint 3
-                        isExiting = (currentWaypoint == 3);
-                    } else {
-                        // L2 going straight typically reaches exit at waypoint 2
-                        isExiting = (currentWaypoint == 2);
-                    }
-                }
-
-                // Update vehicle state when exiting
-                if (isExiting) {
-                    turning = false;
-                    state = VehicleState::EXITING;
-
-                    // CRITICAL: Ensure the lane assignments strictly follow the rules
-                    std::string newLaneStr;
-                    switch (currentDirection) {
-                        case Direction::DOWN:  // From North (A)
-                            if (laneNumber == 3) {
-                                // AL3 → BL1
-                                lane = 'B';
-                                laneNumber = 1;
-                                currentDirection = Direction::LEFT;
-                                newLaneStr = "B1 (turned LEFT from A3)";
-                            }
-                            else if (destination == Destination::LEFT) {
-                                // AL2(left) → DL1
-                                lane = 'D';
-                                laneNumber = 1;
-                                currentDirection = Direction::RIGHT;
-                                newLaneStr = "D1 (turned LEFT from A2)";
-                            }
-                            else {
-                                // AL2(straight) → CL1
-                                lane = 'C';
-                                laneNumber = 1;
-                                currentDirection = Direction::UP;
-                                newLaneStr = "C1 (going STRAIGHT from A2)";
-                            }
-                            break;
-
-                        case Direction::UP:    // From South (C)
-                            if (laneNumber == 3) {
-                                // CL3 → DL1
-                                lane = 'D';
-                                laneNumber = 1;
-                                currentDirection = Direction::RIGHT;
-                                newLaneStr = "D1 (turned LEFT from C3)";
-                            }
-                            else if (destination == Destination::LEFT) {
-                                // CL2(left) → BL1
-                                lane = 'B';
-                                laneNumber = 1;
-                                currentDirection = Direction::LEFT;
-                                newLaneStr = "B1 (turned LEFT from C2)";
-                            }
-                            else {
-                                // CL2(straight) → AL1
-                                lane = 'A';
-                                laneNumber = 1;
-                                currentDirection = Direction::DOWN;
-                                newLaneStr = "A1 (going STRAIGHT from C2)";
-                            }
-                            break;
-
-                        case Direction::LEFT:  // From East (B)
-                            if (laneNumber == 3) {
-                                // BL3 → CL1
-                                lane = 'C';
-                                laneNumber = 1;
-                                currentDirection = Direction::UP;
-                                newLaneStr = "C1 (turned LEFT from B3)";
-                            }
-                            else if (destination == Destination::LEFT) {
-                                // BL2(left) → AL1
-                                lane = 'A';
-                                laneNumber = 1;
-                                currentDirection = Direction::DOWN;
-                                newLaneStr = "A1 (turned LEFT from B2)";
-                            }
-                            else {
-                                // BL2(straight) → DL1
-                                lane = 'D';
-                                laneNumber = 1;
-                                currentDirection = Direction::RIGHT;
-                                newLaneStr = "D1 (going STRAIGHT from B2)";
-                            }
-                            break;
-
-                        case Direction::RIGHT: // From West (D)
-                            if (laneNumber == 3) {
-                                // DL3 → AL1
-                                lane = 'A';
-                                laneNumber = 1;
-                                currentDirection = Direction::DOWN;
-                                newLaneStr = "A1 (turned LEFT from D3)";
-                            }
-                            else if (destination == Destination::LEFT) {
-                                // DL2(left) → CL1
-                                lane = 'C';
-                                laneNumber = 1;
-                                currentDirection = Direction::UP;
-                                newLaneStr = "C1 (turned LEFT from D2)";
-                            }
-                            else {
-                                // DL2(straight) → BL1
-                                lane = 'B';
-                                laneNumber = 1;
-                                currentDirection = Direction::LEFT;
-                                newLaneStr = "B1 (going STRAIGHT from D2)";
-                            }
-                            break;
-                    }
-
-                    // Log lane change
-                    DebugLogger::log("==================== Vehicle " + id + " now on " + newLaneStr +
-                                  " ====================", DebugLogger::LogLevel::ERROR);
-                }
+                advanceWaypoint();
             }
 
             // Adjust speed based on position and turn status
@@ -760,6 +672,10 @@ DebugLogger::log("FREE LANE (" + std::string(1, lane) + "3): Vehicle " + id + "
                 adjustedSpeed *= 1.2f;
             }
 
+            // Gap-propagation clamp from the vehicle ahead (see
+            // TrafficManager::processLane)
+            adjustedSpeed = std::min(adjustedSpeed, std::max(0.0f, maxAdvance));
+
             // Move toward next waypoint
             if (distance > 0) {
                 // Normalize direction vector
@@ -767,32 +683,34 @@ DebugLogger::log("FREE LANE (" + std::string(1, lane) + "3): Vehicle " + id + "
                 dy /= distance;
 
                 // Move toward waypoint with adjusted speed
-                turnPosX += dx * adjustedSpeed;
-                turnPosY += dy * adjustedSpeed;
+                posX() += dx * adjustedSpeed;
+                posY() += dy * adjustedSpeed;
 
                 // Update animation position
-                animPos = (currentDirection == Direction::UP || currentDirection == Direction::DOWN) ?
-                         turnPosY : turnPosX;
+                animPosRef() = (currentDirection == Direction::UP || currentDirection == Direction::DOWN) ?
+                         posY() : posX();
             }
 
             // Update turn progress for visualization
             if (turning) {
-                turnProgress = std::min(1.0f, turnProgress + 0.002f * delta);
+                turnProgressRef() = std::min(1.0f, turnProgressRef() + 0.002f * delta);
             }
         }
 
         // Check if we've reached the last waypoint
-        if (currentWaypoint == waypoints.size() - 1) {
+        if (currentWaypoint == route().size() - 1) {
             // Get screen dimensions
             const int windowWidth = 800;
             const int windowHeight = 800;
 
             // Check if off-screen
-            if (turnPosX < -30.0f || turnPosX > windowWidth + 30.0f ||
-                turnPosY < -30.0f || turnPosY > windowHeight + 30.0f) {
+            if (posX() < -30.0f || posX() > windowWidth + 30.0f ||
+                posY() < -30.0f || posY() > windowHeight + 30.0f) {
                 // Flag for removal
                 state = VehicleState::EXITED;
-                DebugLogger::log("Vehicle " + id + " has left the screen", DebugLogger::LogLevel::DEBUG);
+                DebugLogger::logAt<DebugLogger::LogLevel::DEBUG>([&] {
+                    return "Vehicle " + getLabel() + " has left the screen";
+                });
             }
         }
     }
@@ -800,10 +718,15 @@ DebugLogger::log("FREE LANE (" + std::string(1, lane) + "3): Vehicle " + id + "
         // Red light - handle queue positioning with deceleration
         if (currentWaypoint <= 1) {  // Vehicle is approaching or at the stop line
             // Get the stop line waypoint
-            auto& stopLine = waypoints[1];
-
-            // Calculate target position based on queue position with improved spacing
-            float queueOffsetDistance = VEHICLE_SPACING * (queuePos + 0.2f); // Added small offset for better staggering
+            const auto& stopLine = route()[1];
+
+            // Stop offset for this queue slot: normally handed in via
+            // targetPos from the lane's precomputed ladder (see
+            // Lane::queueOffset); the arithmetic remains as a fallback
+            // for callers that don't pass one
+            float queueOffsetDistance = (targetPos > 0.0f)
+                ? targetPos
+                : VEHICLE_SPACING * (queuePos + 0.2f);
             float queueStopX = stopLine.x;
             float queueStopY = stopLine.y;
 
@@ -824,8 +747,8 @@ DebugLogger::log("FREE LANE (" + std::string(1, lane) + "3): Vehicle " + id + "
             }
 
             // Calculate direction and distance to queue position
-            float dx = queueStopX - turnPosX;
-            float dy = queueStopY - turnPosY;
+            float dx = queueStopX - posX();
+            float dy = queueStopY - posY();
             float distance = std::sqrt(dx*dx + dy*dy);
 
             // Adjust speed based on distance (decelerate as approaching)
@@ -835,6 +758,10 @@ DebugLogger::log("FREE LANE (" + std::string(1, lane) + "3): Vehicle " + id + "
                 adjustedSpeed *= (distance / 50.0f) + 0.2f;
             }
 
+            // Gap-propagation clamp: never roll up closer than the
+            // vehicle ahead allows, even while settling into the queue
+            adjustedSpeed = std::min(adjustedSpeed, std::max(0.0f, maxAdvance));
+
             // Only move if far enough from target position (prevents jitter)
             if (distance > 2.0f) {
                 // Normalize direction
@@ -842,35 +769,175 @@ DebugLogger::log("FREE LANE (" + std::string(1, lane) + "3): Vehicle " + id + "
                 dy /= distance;
 
                 // Move toward queue position with adjusted speed
-                turnPosX += dx * adjustedSpeed;
-                turnPosY += dy * adjustedSpeed;
+                posX() += dx * adjustedSpeed;
+                posY() += dy * adjustedSpeed;
 
                 // Update animation position
-                animPos = (currentDirection == Direction::UP || currentDirection == Direction::DOWN) ?
-                        turnPosY : turnPosX;
+                animPosRef() = (currentDirection == Direction::UP || currentDirection == Direction::DOWN) ?
+                        posY() : posX();
             }
         }
     }
 }
 
-void Vehicle::calculateTurnPath(float startX, float startY, float controlX, float controlY,
-                              float endX, float endY, float progress) {
-    // Quadratic bezier curve calculation for smooth turning
-    float oneMinusT = 1.0f - progress;
+void Vehicle::fastForward(uint32_t delta, bool isGreenLight) {
+    // Same movement permission as update()
+    bool canMove = isGreenLight || laneNumber == 3; // L3 is the free lane
+    if (!canMove) {
+        // Held at the light. Queue creep is pure animation, so a
+        // compressed run just leaves the vehicle where it stands.
+        return;
+    }
+
+    // Distance budget for this slice at the cruising speed; the phase
+    // multipliers update() applies are folded in per segment below
+    const float SPEED_BASE = TuningConfig::getVehicleSpeedBase();
+    float remaining = SPEED_BASE * static_cast<float>(delta);
+
+    while (remaining > 0.0f && currentWaypoint < route().size() - 1) {
+        const auto& next = route()[currentWaypoint + 1];
+        float dx = next.x - posX();
+        float dy = next.y - posY();
+        float distance = std::sqrt(dx * dx + dy * dy);
+
+        // Same phase adjustments as update()
+        float multiplier = 1.0f;
+        if (currentWaypoint == 1) {
+            multiplier = 0.9f;
+        } else if (turning) {
+            multiplier = 0.7f;
+        } else if (currentWaypoint >= 3) {
+            multiplier = 1.2f;
+        }
+
+        float step = remaining * multiplier;
+        if (step < distance) {
+            // Lands inside this segment: teleport straight to the spot,
+            // no per-frame interpolation in between
+            posX() += dx / distance * step;
+            posY() += dy / distance * step;
+            remaining = 0.0f;
+        } else {
+            // Consumes the whole segment: snap to the waypoint and run
+            // the same hand-off update() performs at 3px range
+            posX() = next.x;
+            posY() = next.y;
+            remaining -= distance / multiplier;
+            advanceWaypoint();
+        }
+
+        // At this compression the eased bezier is skipped entirely; a
+        // turn in progress just reads as complete
+        if (turning) {
+            turnProgressRef() = 1.0f;
+        }
+    }
+
+    animPosRef() = (currentDirection == Direction::UP || currentDirection == Direction::DOWN) ?
+              posY() : posX();
+
+    // Same exit check as update()
+    if (currentWaypoint == route().size() - 1) {
+        const int windowWidth = 800;
+        const int windowHeight = 800;
+
+        if (posX() < -30.0f || posX() > windowWidth + 30.0f ||
+            posY() < -30.0f || posY() > windowHeight + 30.0f) {
+            state = VehicleState::EXITED;
+            DebugLogger::logAt<DebugLogger::LogLevel::DEBUG>([&] {
+                    return "Vehicle " + getLabel() + " has left the screen";
+                });
+        }
+    }
+}
+
+void Vehicle::calculateTurnPath(float progress) {
+    // The eased quadratic bezier used to be evaluated here per frame;
+    // it is now quantized once per configuration in TurnCurveCache and
+    // this just samples the shared table
+    if (!turnCurve || turnCurve->empty()) {
+        return;
+    }
+
+    Point p = TurnCurveCache::sample(*turnCurve, progress);
+    posX() = p.x;
+    posY() = p.y;
+}
+
+void Vehicle::renderSprite(VehicleSpriteAtlas& atlas, int queuePos) {
+    this->queuePos = static_cast<int16_t>(queuePos);
+
+    bool flash = isEmergency && (FrameClock::nowMs() / 250) % 2 == 0;
+    int variant = VehicleSpriteAtlas::bodyVariant(lane, laneNumber,
+                                                  isEmergency, flash);
+    int column = (destination == Destination::LEFT) ? 1
+               : (destination == Destination::STRAIGHT) ? 0 : 2;
+
+    // Screen-space extents, with the same gradual dimension morph the
+    // primitive path applies through a turn
+    float width = VehicleSpriteAtlas::SPRITE_W;
+    float length = VehicleSpriteAtlas::SPRITE_H;
+    float screenW;
+    float screenH;
+
+    if (turning) {
+        float progress = turnProgressRef();
+        if (currentDirection == Direction::UP ||
+            currentDirection == Direction::DOWN) {
+            screenW = width * (1.0f - progress) + length * progress;
+            screenH = length * (1.0f - progress) + width * progress;
+        } else {
+            screenW = length * (1.0f - progress) + width * progress;
+            screenH = width * (1.0f - progress) + length * progress;
+        }
+    } else if (currentDirection == Direction::UP ||
+               currentDirection == Direction::DOWN) {
+        screenW = width;
+        screenH = length;
+    } else {
+        screenW = length;
+        screenH = width;
+    }
 
-    // Calculate position on the curve
-    turnPosX = oneMinusT * oneMinusT * startX +
-               2.0f * oneMinusT * progress * controlX +
-               progress * progress * endX;
+    // Sprites are baked facing DOWN; rotation covers the other three
+    // headings (the rotated sprite dims swap back to the screen rect)
+    float angle;
+    float spriteW;
+    float spriteH;
+    switch (currentDirection) {
+        case Direction::UP:
+            angle = 180.0f;
+            spriteW = screenW;
+            spriteH = screenH;
+            break;
+        case Direction::LEFT:
+            angle = 90.0f;
+            spriteW = screenH;
+            spriteH = screenW;
+            break;
+        case Direction::RIGHT:
+            angle = -90.0f;
+            spriteW = screenH;
+            spriteH = screenW;
+            break;
+        case Direction::DOWN:
+        default:
+            angle = 0.0f;
+            spriteW = screenW;
+            spriteH = screenH;
+            break;
+    }
 
-    turnPosY = oneMinusT * oneMinusT * startY +
-               2.0f * oneMinusT * progress * controlY +
-               progress * progress * endY;
+    atlas.pushSprite(variant, column, renderPosX(), renderPosY(), spriteW,
+                     spriteH, angle);
 }
 
-void Vehicle::render(SDL_Renderer* renderer, SDL_Texture* vehicleTexture, int queuePos) {
+void Vehicle::render(GeometryBatch& batch, int queuePos) {
     // Store queue position for use in update method
-    this->queuePos = queuePos;
+    this->queuePos = static_cast<int16_t>(queuePos);
+
+    // Current "pen" color; primitives below are pushed into the batch
+    SDL_Color drawColor = {255, 255, 255, 255};
 
     // ENHANCED VEHICLE RENDERING FOR BETTER VISUALIZATION
     SDL_Color color;
@@ -878,7 +945,7 @@ void Vehicle::render(SDL_Renderer* renderer, SDL_Texture* vehicleTexture, int qu
     // STEP 1: Choose appropriate vehicle color based on lane and type
     if (isEmergency) {
         // Emergency vehicles are bright red with flashing effect
-        uint32_t time = SDL_GetTicks();
+        uint32_t time = FrameClock::nowMs();
         bool flash = (time / 250) % 2 == 0; // Flash every 250ms
         color = flash ? SDL_Color{255, 0, 0, 255} : SDL_Color{180, 0, 0, 255};
     }
@@ -942,7 +1009,7 @@ void Vehicle::render(SDL_Renderer* renderer, SDL_Texture* vehicleTexture, int qu
     }
 
     // Set color for vehicle body
-    SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
+    drawColor = {color.r, color.g, color.b, color.a};
 
     // STEP 2: Determine vehicle dimensions - LARGER for better visibility
     float vehicleWidth = 14.0f;  // Wider than original
@@ -953,7 +1020,7 @@ void Vehicle::render(SDL_Renderer* renderer, SDL_Texture* vehicleTexture, int qu
 
     if (turning) {
         // For turning vehicles, adjust dimensions gradually for smooth turns
-        float progress = turnProgress;
+        float progress = turnProgressRef();
         float width = vehicleWidth;
         float length = vehicleLength;
 
@@ -972,25 +1039,25 @@ void Vehicle::render(SDL_Renderer* renderer, SDL_Texture* vehicleTexture, int qu
             }
         }
 
-        vehicleRect = {turnPosX - width/2, turnPosY - length/2, width, length};
+        vehicleRect = {renderPosX() - width/2, renderPosY() - length/2, width, length};
     } else {
         // Non-turning vehicles have fixed orientation based on direction
         switch (currentDirection) {
             case Direction::DOWN:
             case Direction::UP:
                 // Vertical roads (taller than wide)
-                vehicleRect = {turnPosX - vehicleWidth/2, turnPosY - vehicleLength/2, vehicleWidth, vehicleLength};
+                vehicleRect = {renderPosX() - vehicleWidth/2, renderPosY() - vehicleLength/2, vehicleWidth, vehicleLength};
                 break;
             case Direction::LEFT:
             case Direction::RIGHT:
                 // Horizontal roads (wider than tall)
-                vehicleRect = {turnPosX - vehicleLength/2, turnPosY - vehicleWidth/2, vehicleLength, vehicleWidth};
+                vehicleRect = {renderPosX() - vehicleLength/2, renderPosY() - vehicleWidth/2, vehicleLength, vehicleWidth};
                 break;
         }
     }
 
     // STEP 4: Draw the vehicle body with border
-    SDL_RenderFillRect(renderer, &vehicleRect);
+    batch.pushQuad(vehicleRect, drawColor);
 
     // Add 3D effect with gradient
     SDL_Color shadowColor = {
@@ -1008,7 +1075,7 @@ void Vehicle::render(SDL_Renderer* renderer, SDL_Texture* vehicleTexture, int qu
     };
 
     // Add shadow edge
-    SDL_SetRenderDrawColor(renderer, shadowColor.r, shadowColor.g, shadowColor.b, shadowColor.a);
+    drawColor = {shadowColor.r, shadowColor.g, shadowColor.b, shadowColor.a};
     SDL_FRect shadowEdge;
 
     if (currentDirection == Direction::DOWN || currentDirection == Direction::UP) {
@@ -1016,10 +1083,10 @@ void Vehicle::render(SDL_Renderer* renderer, SDL_Texture* vehicleTexture, int qu
     } else {
         shadowEdge = {vehicleRect.x, vehicleRect.y + vehicleRect.h * 0.6f, vehicleRect.w, vehicleRect.h * 0.4f};
     }
-    SDL_RenderFillRect(renderer, &shadowEdge);
+    batch.pushQuad(shadowEdge, drawColor);
 
     // Add highlight edge
-    SDL_SetRenderDrawColor(renderer, highlightColor.r, highlightColor.g, highlightColor.b, highlightColor.a);
+    drawColor = {highlightColor.r, highlightColor.g, highlightColor.b, highlightColor.a};
     SDL_FRect highlightEdge;
 
     if (currentDirection == Direction::DOWN || currentDirection == Direction::UP) {
@@ -1027,18 +1094,18 @@ void Vehicle::render(SDL_Renderer* renderer, SDL_Texture* vehicleTexture, int qu
     } else {
         highlightEdge = {vehicleRect.x, vehicleRect.y, vehicleRect.w, vehicleRect.h * 0.3f};
     }
-    SDL_RenderFillRect(renderer, &highlightEdge);
+    batch.pushQuad(highlightEdge, drawColor);
 
     // Add border outline for better definition
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255); // Black border
-    SDL_RenderRect(renderer, &vehicleRect);
+    drawColor = {0, 0, 0, 255}; // Black border
+    batch.pushRectOutline(vehicleRect, drawColor);
 
     // STEP 5: Draw destination indicator - VERY CLEAR directional arrows
     // This shows exactly where each vehicle is going - LEFT or STRAIGHT
 
     if (destination == Destination::LEFT) {
         // LEFT TURN indicator - arrow pointing left relative to vehicle direction
-        SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255); // Bright yellow
+        drawColor = {255, 255, 0, 255}; // Bright yellow
 
         // Draw left arrow based on vehicle direction
         SDL_FPoint arrow[3];
@@ -1075,22 +1142,22 @@ void Vehicle::render(SDL_Renderer* renderer, SDL_Texture* vehicleTexture, int qu
         }
 
         // Draw filled triangle
-        SDL_RenderFillTriangleF(renderer, arrow[0].x, arrow[0].y, arrow[1].x, arrow[1].y, arrow[2].x, arrow[2].y);
+        batch.pushTriangle(arrow[0].x, arrow[0].y, arrow[1].x, arrow[1].y, arrow[2].x, arrow[2].y, drawColor);
 
         // Draw "L" symbol in bright yellow to indicate LEFT turn
-        SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255);
+        drawColor = {255, 255, 0, 255};
         float centerX = vehicleRect.x + vehicleRect.w/2;
         float centerY = vehicleRect.y + vehicleRect.h/2;
         float symbolSize = 6.0f;
 
-        SDL_RenderLine(renderer, centerX - symbolSize/2, centerY - symbolSize/2,
-                       centerX - symbolSize/2, centerY + symbolSize/2);
-        SDL_RenderLine(renderer, centerX - symbolSize/2, centerY + symbolSize/2,
-                       centerX + symbolSize/2, centerY + symbolSize/2);
+        batch.pushLine(centerX - symbolSize/2, centerY - symbolSize/2,
+                       centerX - symbolSize/2, centerY + symbolSize/2, drawColor);
+        batch.pushLine(centerX - symbolSize/2, centerY + symbolSize/2,
+                       centerX + symbolSize/2, centerY + symbolSize/2, drawColor);
     }
     else if (destination == Destination::STRAIGHT) {
         // STRAIGHT indicator - double parallel lines
-        SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255); // Bright yellow
+        drawColor = {255, 255, 0, 255}; // Bright yellow
 
         SDL_FRect line1, line2;
         float lineWidth = 2.5f;
@@ -1123,157 +1190,218 @@ void Vehicle::render(SDL_Renderer* renderer, SDL_Texture* vehicleTexture, int qu
                 break;
         }
 
-        SDL_RenderFillRect(renderer, &line1);
-        SDL_RenderFillRect(renderer, &line2);
+        batch.pushQuad(line1, drawColor);
+        batch.pushQuad(line2, drawColor);
 
         // Draw "S" symbol in bright yellow to indicate STRAIGHT
-        SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255);
+        drawColor = {255, 255, 0, 255};
         float centerX = vehicleRect.x + vehicleRect.w/2;
         float centerY = vehicleRect.y + vehicleRect.h/2;
         float symbolSize = 6.0f;
 
         // Draw S shape with 5 line segments
-        SDL_RenderLine(renderer, centerX + symbolSize/2, centerY - symbolSize/2,
-                      centerX - symbolSize/2, centerY - symbolSize/2);
-        SDL_RenderLine(renderer, centerX - symbolSize/2, centerY - symbolSize/2,
-                      centerX - symbolSize/2, centerY);
-        SDL_RenderLine(renderer, centerX - symbolSize/2, centerY,
-                      centerX + symbolSize/2, centerY);
-        SDL_RenderLine(renderer, centerX + symbolSize/2, centerY,
-                      centerX + symbolSize/2, centerY + symbolSize/2);
-        SDL_RenderLine(renderer, centerX + symbolSize/2, centerY + symbolSize/2,
-                      centerX - symbolSize/2, centerY + symbolSize/2);
+        batch.pushLine(centerX + symbolSize/2, centerY - symbolSize/2,
+                      centerX - symbolSize/2, centerY - symbolSize/2, drawColor);
+        batch.pushLine(centerX - symbolSize/2, centerY - symbolSize/2,
+                      centerX - symbolSize/2, centerY, drawColor);
+        batch.pushLine(centerX - symbolSize/2, centerY,
+                      centerX + symbolSize/2, centerY, drawColor);
+        batch.pushLine(centerX + symbolSize/2, centerY,
+                      centerX + symbolSize/2, centerY + symbolSize/2, drawColor);
+        batch.pushLine(centerX + symbolSize/2, centerY + symbolSize/2,
+                      centerX - symbolSize/2, centerY + symbolSize/2, drawColor);
     }
 
     // STEP 6: Add lane number indicators as distinctive marks
-    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); // White for indicators
+    drawColor = {255, 255, 255, 255}; // White for indicators
 
     // Draw large lane number on vehicle
     float numX = vehicleRect.x + vehicleRect.w*0.5f;
     float numY = vehicleRect.y + vehicleRect.h*0.5f;
     float numSize = 8.0f;
 
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255); // Black for number
+    drawColor = {0, 0, 0, 255}; // Black for number
 
     switch (laneNumber) {
         case 1: // Draw "1"
-            SDL_RenderLine(renderer, numX, numY - numSize/2, numX, numY + numSize/2);
+            batch.pushLine(numX, numY - numSize/2, numX, numY + numSize/2, drawColor);
             break;
 
         case 2: // Draw "2"
-            SDL_RenderLine(renderer, numX - numSize/2, numY - numSize/2, numX + numSize/2, numY - numSize/2);
-            SDL_RenderLine(renderer, numX + numSize/2, numY - numSize/2, numX + numSize/2, numY);
-            SDL_RenderLine(renderer, numX + numSize/2, numY, numX - numSize/2, numY);
-            SDL_RenderLine(renderer, numX - numSize/2, numY, numX - numSize/2, numY + numSize/2);
-            SDL_RenderLine(renderer, numX - numSize/2, numY + numSize/2, numX + numSize/2, numY + numSize/2);
+            batch.pushLine(numX - numSize/2, numY - numSize/2, numX + numSize/2, numY - numSize/2, drawColor);
+            batch.pushLine(numX + numSize/2, numY - numSize/2, numX + numSize/2, numY, drawColor);
+            batch.pushLine(numX + numSize/2, numY, numX - numSize/2, numY, drawColor);
+            batch.pushLine(numX - numSize/2, numY, numX - numSize/2, numY + numSize/2, drawColor);
+            batch.pushLine(numX - numSize/2, numY + numSize/2, numX + numSize/2, numY + numSize/2, drawColor);
             break;
 
         case 3: // Draw "3"
-            SDL_RenderLine(renderer, numX - numSize/2, numY - numSize/2, numX + numSize/2, numY - numSize/2);
-            SDL_RenderLine(renderer, numX + numSize/2, numY - numSize/2, numX + numSize/2, numY);
-            SDL_RenderLine(renderer, numX - numSize/2, numY, numX + numSize/2, numY);
-            SDL_RenderLine(renderer, numX + numSize/2, numY, numX + numSize/2, numY + numSize/2);
-            SDL_RenderLine(renderer, numX - numSize/2, numY + numSize/2, numX + numSize/2, numY + numSize/2);
+            batch.pushLine(numX - numSize/2, numY - numSize/2, numX + numSize/2, numY - numSize/2, drawColor);
+            batch.pushLine(numX + numSize/2, numY - numSize/2, numX + numSize/2, numY, drawColor);
+            batch.pushLine(numX - numSize/2, numY, numX + numSize/2, numY, drawColor);
+            batch.pushLine(numX + numSize/2, numY, numX + numSize/2, numY + numSize/2, drawColor);
+            batch.pushLine(numX - numSize/2, numY + numSize/2, numX + numSize/2, numY + numSize/2, drawColor);
             break;
     }
 
     // STEP 7: Emergency vehicle indicators (if applicable)
     if (isEmergency) {
         // Draw a flashing effect
-        uint32_t time = SDL_GetTicks();
+        uint32_t time = FrameClock::nowMs();
         bool flash = (time / 200) % 2 == 0; // Flash every 200ms
 
         if (flash) {
             // Draw a cross symbol for emergency vehicles when flashing
-            SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); // White
+            drawColor = {255, 255, 255, 255}; // White
 
             float crossSize = 10.0f;
             SDL_FRect crossV, crossH;
 
-            crossH = {turnPosX - crossSize/2, turnPosY - 1.5f, crossSize, 3.0f};
-            crossV = {turnPosX - 1.5f, turnPosY - crossSize/2, 3.0f, crossSize};
+            crossH = {posX() - crossSize/2, posY() - 1.5f, crossSize, 3.0f};
+            crossV = {posX() - 1.5f, posY() - crossSize/2, 3.0f, crossSize};
 
-            SDL_RenderFillRect(renderer, &crossH);
-            SDL_RenderFillRect(renderer, &crossV);
+            batch.pushQuad(crossH, drawColor);
+            batch.pushQuad(crossV, drawColor);
 
             // Draw "E" for Emergency
-            SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
+            drawColor = {255, 255, 255, 255};
             float eX = vehicleRect.x + vehicleRect.w*0.3f;
             float eY = vehicleRect.y + vehicleRect.h*0.3f;
             float eSize = 6.0f;
 
-            SDL_RenderLine(renderer, eX, eY, eX, eY + eSize);
-            SDL_RenderLine(renderer, eX, eY, eX + eSize/2, eY);
-            SDL_RenderLine(renderer, eX, eY + eSize/2, eX + eSize/2, eY + eSize/2);
-            SDL_RenderLine(renderer, eX, eY + eSize, eX + eSize/2, eY + eSize);
+            batch.pushLine(eX, eY, eX, eY + eSize, drawColor);
+            batch.pushLine(eX, eY, eX + eSize/2, eY, drawColor);
+            batch.pushLine(eX, eY + eSize/2, eX + eSize/2, eY + eSize/2, drawColor);
+            batch.pushLine(eX, eY + eSize, eX + eSize/2, eY + eSize, drawColor);
         }
     }
 
     // STEP 8: Add road indicator
     // Draw small road letter (A,B,C,D) on each vehicle for easy identification
-    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
+    drawColor = {255, 255, 255, 255};
     float roadX = vehicleRect.x + vehicleRect.w*0.25f;
     float roadY = vehicleRect.y + vehicleRect.h*0.25f;
     float roadSize = 6.0f;
 
     switch (lane) {
         case 'A': // Draw "A"
-            SDL_RenderLine(renderer, roadX - roadSize/2, roadY + roadSize/2, roadX, roadY - roadSize/2);
-            SDL_RenderLine(renderer, roadX, roadY - roadSize/2, roadX + roadSize/2, roadY + roadSize/2);
-            SDL_RenderLine(renderer, roadX - roadSize/4, roadY, roadX + roadSize/4, roadY);
+            batch.pushLine(roadX - roadSize/2, roadY + roadSize/2, roadX, roadY - roadSize/2, drawColor);
+            batch.pushLine(roadX, roadY - roadSize/2, roadX + roadSize/2, roadY + roadSize/2, drawColor);
+            batch.pushLine(roadX - roadSize/4, roadY, roadX + roadSize/4, roadY, drawColor);
             break;
 
         case 'B': // Draw "B"
-            SDL_RenderLine(renderer, roadX - roadSize/2, roadY - roadSize/2, roadX - roadSize/2, roadY + roadSize/2);
-            SDL_RenderLine(renderer, roadX - roadSize/2, roadY - roadSize/2, roadX + roadSize/2, roadY - roadSize/2);
-            SDL_RenderLine(renderer, roadX + roadSize/2, roadY - roadSize/2, roadX + roadSize/2, roadY);
-            SDL_RenderLine(renderer, roadX + roadSize/2, roadY, roadX - roadSize/2, roadY);
-            SDL_RenderLine(renderer, roadX - roadSize/2, roadY, roadX - roadSize/2, roadY + roadSize/2);
-            SDL_RenderLine(renderer, roadX - roadSize/2, roadY + roadSize/2, roadX + roadSize/2, roadY + roadSize/2);
-            SDL_RenderLine(renderer, roadX + roadSize/2, roadY + roadSize/2, roadX + roadSize/2, roadY);
+            batch.pushLine(roadX - roadSize/2, roadY - roadSize/2, roadX - roadSize/2, roadY + roadSize/2, drawColor);
+            batch.pushLine(roadX - roadSize/2, roadY - roadSize/2, roadX + roadSize/2, roadY - roadSize/2, drawColor);
+            batch.pushLine(roadX + roadSize/2, roadY - roadSize/2, roadX + roadSize/2, roadY, drawColor);
+            batch.pushLine(roadX + roadSize/2, roadY, roadX - roadSize/2, roadY, drawColor);
+            batch.pushLine(roadX - roadSize/2, roadY, roadX - roadSize/2, roadY + roadSize/2, drawColor);
+            batch.pushLine(roadX - roadSize/2, roadY + roadSize/2, roadX + roadSize/2, roadY + roadSize/2, drawColor);
+            batch.pushLine(roadX + roadSize/2, roadY + roadSize/2, roadX + roadSize/2, roadY, drawColor);
             break;
 
         case 'C': // Draw "C"
-            SDL_RenderLine(renderer, roadX + roadSize/2, roadY - roadSize/2, roadX - roadSize/2, roadY - roadSize/2);
-            SDL_RenderLine(renderer, roadX - roadSize/2, roadY - roadSize/2, roadX - roadSize/2, roadY + roadSize/2);
-            SDL_RenderLine(renderer, roadX - roadSize/2, roadY + roadSize/2, roadX + roadSize/2, roadY + roadSize/2);
+            batch.pushLine(roadX + roadSize/2, roadY - roadSize/2, roadX - roadSize/2, roadY - roadSize/2, drawColor);
+            batch.pushLine(roadX - roadSize/2, roadY - roadSize/2, roadX - roadSize/2, roadY + roadSize/2, drawColor);
+            batch.pushLine(roadX - roadSize/2, roadY + roadSize/2, roadX + roadSize/2, roadY + roadSize/2, drawColor);
             break;
 
         case 'D': // Draw "D"
-            SDL_RenderLine(renderer, roadX - roadSize/2, roadY - roadSize/2, roadX - roadSize/2, roadY + roadSize/2);
-            SDL_RenderLine(renderer, roadX - roadSize/2, roadY - roadSize/2, roadX, roadY - roadSize/2);
-            SDL_RenderLine(renderer, roadX, roadY - roadSize/2, roadX + roadSize/2, roadY);
-            SDL_RenderLine(renderer, roadX + roadSize/2, roadY, roadX, roadY + roadSize/2);
-            SDL_RenderLine(renderer, roadX, roadY + roadSize/2, roadX - roadSize/2, roadY + roadSize/2);
+            batch.pushLine(roadX - roadSize/2, roadY - roadSize/2, roadX - roadSize/2, roadY + roadSize/2, drawColor);
+            batch.pushLine(roadX - roadSize/2, roadY - roadSize/2, roadX, roadY - roadSize/2, drawColor);
+            batch.pushLine(roadX, roadY - roadSize/2, roadX + roadSize/2, roadY, drawColor);
+            batch.pushLine(roadX + roadSize/2, roadY, roadX, roadY + roadSize/2, drawColor);
+            batch.pushLine(roadX, roadY + roadSize/2, roadX - roadSize/2, roadY + roadSize/2, drawColor);
             break;
     }
 }
-// Helper for drawing triangles (SDL3 compatible)
-void Vehicle::SDL_RenderFillTriangleF(SDL_Renderer* renderer, float x1, float y1, float x2, float y2, float x3, float y3) {
-    // Create vertices for rendering with SDL_RenderGeometry
-    SDL_Vertex vertices[3];
-
-    // Create color with normalized values (0.0-1.0)
-    SDL_FColor fcolor = {
-        1.0f,  // r (normalized to 0.0-1.0)
-        1.0f,  // g
-        1.0f,  // b
-        1.0f   // a
-    };
 
-    // Set vertices
-    vertices[0].position.x = x1;
-    vertices[0].position.y = y1;
-    vertices[0].color = fcolor;
+bool Vehicle::isParkedAt(float targetPos) const {
+    // Only the red-light approach regime can park: past the stop line
+    // or mid-turn the vehicle is moving through the junction
+    if (state != VehicleState::APPROACHING || turning ||
+        currentWaypoint > 1 || !routePath) {
+        return false;
+    }
 
-    vertices[1].position.x = x2;
-    vertices[1].position.y = y2;
-    vertices[1].color = fcolor;
+    // Same stop-point derivation as the red-light branch of update()
+    const Point& stopLine = route()[1];
+    float queueOffsetDistance = (targetPos > 0.0f)
+        ? targetPos
+        : 50.0f * (queuePos + 0.2f);
+    float queueStopX = stopLine.x;
+    float queueStopY = stopLine.y;
+    switch (currentDirection) {
+        case Direction::DOWN:  queueStopY -= queueOffsetDistance; break;
+        case Direction::UP:    queueStopY += queueOffsetDistance; break;
+        case Direction::LEFT:  queueStopX += queueOffsetDistance; break;
+        case Direction::RIGHT: queueStopX -= queueOffsetDistance; break;
+    }
 
-    vertices[2].position.x = x3;
-    vertices[2].position.y = y3;
-    vertices[2].color = fcolor;
+    // update() stops moving inside its 2px anti-jitter radius; inside
+    // it, a further update is a guaranteed no-op
+    float dx = queueStopX - posX();
+    float dy = queueStopY - posY();
+    return dx * dx + dy * dy <= 2.0f * 2.0f;
+}
+
+bool Vehicle::isOffscreen(float margin) const {
+    float x = renderPosX();
+    float y = renderPosY();
+
+    return x < -margin || x > Constants::WINDOW_WIDTH + margin ||
+           y < -margin || y > Constants::WINDOW_HEIGHT + margin;
+}
+
+bool Vehicle::isBeyondSpawnEdge(float margin) const {
+    // Each road spawns off one window edge; a vehicle out past that edge
+    // hasn't entered the visible queue yet
+    switch (lane) {
+        case 'A': return renderPosY() < -margin;                          // North, spawns above
+        case 'B': return renderPosX() > Constants::WINDOW_WIDTH + margin; // East, spawns right
+        case 'C': return renderPosY() > Constants::WINDOW_HEIGHT + margin;// South, spawns below
+        case 'D': return renderPosX() < -margin;                          // West, spawns left
+        default:  return false;
+    }
+}
+
+void Vehicle::captureSnapshot(VehicleSnapshot& out) const {
+    out = {};
+    strncpy(out.label, getLabel().c_str(), sizeof(out.label) - 1);
+    out.lane = lane;
+    out.laneNumber = static_cast<int8_t>(laneNumber);
+    out.emergency = isEmergency ? 1 : 0;
+    out.destination = static_cast<int8_t>(destination);
+    out.vehicleState = static_cast<int8_t>(state);
+    out.direction = static_cast<int8_t>(currentDirection);
+    out.turning = turning ? 1 : 0;
+    out.queuePos = queuePos;
+    out.currentWaypoint = static_cast<uint32_t>(currentWaypoint);
+    out.posX = posX();
+    out.posY = posY();
+    out.animPos = animPosRef();
+    out.turnProgress = turnProgressRef();
+}
+
+void Vehicle::restoreSnapshot(const VehicleSnapshot& in) {
+    // Reattach the shared route for the recorded destination, then put
+    // the vehicle back exactly where the snapshot left it
+    destination = static_cast<Destination>(in.destination);
+    initializeWaypoints();
+
+    state = static_cast<VehicleState>(in.vehicleState);
+    currentDirection = static_cast<Direction>(in.direction);
+    turning = in.turning != 0;
+    queuePos = in.queuePos;
+
+    currentWaypoint = in.currentWaypoint;
+    if (!route().empty() && currentWaypoint >= route().size()) {
+        currentWaypoint = static_cast<uint32_t>(route().size() - 1);
+    }
+    reclassifyBucket();
 
-    // Draw the triangle
-    SDL_RenderGeometry(renderer, NULL, vertices, 3, NULL, 0);
+    posX() = in.posX;
+    posY() = in.posY;
+    animPosRef() = in.animPos;
+    turnProgressRef() = in.turnProgress;
 }
@@ -0,0 +1,149 @@
+// FILE: src/core/VehicleStateStore.cpp
+#include "core/VehicleStateStore.h"
+#include "utils/DebugLogger.h"
+
+#include <algorithm>
+
+// Static class members initialization
+VehicleStateStore::FloatArray VehicleStateStore::xs(VehicleStateStore::INITIAL_CAPACITY, 0.0f);
+VehicleStateStore::FloatArray VehicleStateStore::ys(VehicleStateStore::INITIAL_CAPACITY, 0.0f);
+VehicleStateStore::FloatArray VehicleStateStore::animPositions(VehicleStateStore::INITIAL_CAPACITY, 0.0f);
+VehicleStateStore::FloatArray VehicleStateStore::turnProgresses(VehicleStateStore::INITIAL_CAPACITY, 0.0f);
+VehicleStateStore::IndexArray VehicleStateStore::spawnCreated(VehicleStateStore::INITIAL_CAPACITY, 0);
+VehicleStateStore::IndexArray VehicleStateStore::spawnPicked(VehicleStateStore::INITIAL_CAPACITY, 0);
+
+std::vector<uint32_t> VehicleStateStore::freeSlots;
+size_t VehicleStateStore::highWater = 0;
+size_t VehicleStateStore::active = 0;
+std::mutex VehicleStateStore::storeMutex;
+
+bool VehicleStateStore::publishEnabled = false;
+VehicleStateStore::TickBuffer VehicleStateStore::tickBuffers[2];
+int VehicleStateStore::newestBuffer = 0;
+std::mutex VehicleStateStore::publishMutex;
+std::vector<uint32_t> VehicleStateStore::slotEpochs(VehicleStateStore::INITIAL_CAPACITY, 0);
+std::vector<float> VehicleStateStore::renderXs;
+std::vector<float> VehicleStateStore::renderYs;
+
+uint32_t VehicleStateStore::acquire() {
+    std::lock_guard<std::mutex> lock(storeMutex);
+
+    uint32_t slot;
+    if (!freeSlots.empty()) {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+    } else {
+        if (highWater == xs.size()) {
+            grow();
+        }
+        slot = static_cast<uint32_t>(highWater++);
+    }
+
+    // A new occupant: the render blend must not interpolate from the
+    // previous vehicle's published position
+    slotEpochs[slot]++;
+
+    // Zero the recycled fields so a new vehicle starts clean
+    xs[slot] = 0.0f;
+    ys[slot] = 0.0f;
+    animPositions[slot] = 0.0f;
+    turnProgresses[slot] = 0.0f;
+    spawnCreated[slot] = 0;
+    spawnPicked[slot] = 0;
+
+    active++;
+    return slot;
+}
+
+void VehicleStateStore::noteRespawn(uint32_t slot) {
+    std::lock_guard<std::mutex> lock(storeMutex);
+    slotEpochs[slot]++;
+}
+
+void VehicleStateStore::release(uint32_t slot) {
+    std::lock_guard<std::mutex> lock(storeMutex);
+    freeSlots.push_back(slot);
+    if (active > 0) {
+        active--;
+    }
+}
+
+size_t VehicleStateStore::activeCount() {
+    std::lock_guard<std::mutex> lock(storeMutex);
+    return active;
+}
+
+void VehicleStateStore::grow() {
+    size_t newCapacity = xs.size() * 2;
+    xs.resize(newCapacity, 0.0f);
+    ys.resize(newCapacity, 0.0f);
+    animPositions.resize(newCapacity, 0.0f);
+    turnProgresses.resize(newCapacity, 0.0f);
+    spawnCreated.resize(newCapacity, 0);
+    spawnPicked.resize(newCapacity, 0);
+    slotEpochs.resize(newCapacity, 0);
+
+    DebugLogger::log("VehicleStateStore grew to " + std::to_string(newCapacity) +
+                   " slots");
+}
+
+void VehicleStateStore::enableTickPublish() {
+    publishEnabled = true;
+}
+
+void VehicleStateStore::publishTick(uint32_t nowMs) {
+    if (!publishEnabled) {
+        return;
+    }
+
+    // storeMutex keeps the array sizes stable against a concurrent
+    // acquire(); the position writes themselves all happened earlier
+    // this tick on this (the simulation) thread
+    std::lock_guard<std::mutex> store(storeMutex);
+    std::lock_guard<std::mutex> lock(publishMutex);
+
+    TickBuffer& buffer = tickBuffers[newestBuffer ^ 1];
+    buffer.xs.assign(xs.begin(), xs.end());
+    buffer.ys.assign(ys.begin(), ys.end());
+    buffer.epochs.assign(slotEpochs.begin(), slotEpochs.end());
+    buffer.stampMs = nowMs;
+    newestBuffer ^= 1;
+}
+
+void VehicleStateStore::blendForRender(uint32_t nowMs) {
+    if (!publishEnabled) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(publishMutex);
+    const TickBuffer& curr = tickBuffers[newestBuffer];
+    const TickBuffer& prev = tickBuffers[newestBuffer ^ 1];
+
+    size_t count = curr.xs.size();
+    renderXs.resize(count);
+    renderYs.resize(count);
+
+    // Interpolation renders one tick in the past: at the moment a
+    // publish lands the blend shows the previous tick's positions and
+    // reaches the new ones just as the next publish is due. A stalled
+    // or first-ever publish (no usable interval) snaps to the newest.
+    uint32_t interval = curr.stampMs - prev.stampMs;
+    bool blend = prev.xs.size() == count && interval > 0 && interval < 500;
+    float alpha = 1.0f;
+    if (blend) {
+        alpha = static_cast<float>(nowMs - curr.stampMs) /
+                static_cast<float>(interval);
+        alpha = std::min(1.0f, std::max(0.0f, alpha));
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        if (blend && prev.epochs[i] == curr.epochs[i]) {
+            renderXs[i] = prev.xs[i] + (curr.xs[i] - prev.xs[i]) * alpha;
+            renderYs[i] = prev.ys[i] + (curr.ys[i] - prev.ys[i]) * alpha;
+        } else {
+            // Fresh occupant (or no previous tick): no history to blend
+            renderXs[i] = curr.xs[i];
+            renderYs[i] = curr.ys[i];
+        }
+    }
+}
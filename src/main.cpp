@@ -1,24 +1,36 @@
-#include <iostream>
 #include <string>
 #include <thread>
 #include <chrono>
 #include <SDL3/SDL.h>
-#include <fstream>
 #include <filesystem>
 #include <vector>
 #include <map>
 #include <algorithm>
 #include <random>
 #include <cmath>
+#include <atomic>
+#include <csignal>
 
 // Include the necessary headers
 #include "core/Vehicle.h"
 #include "core/Lane.h"
 #include "core/TrafficLight.h"
+#include "managers/CorridorLink.h"
+#include "managers/JunctionGraph.h"
 #include "managers/TrafficManager.h"
 #include "managers/FileHandler.h"
+#include "core/VehicleStateStore.h"
 #include "visualization/Renderer.h"
+#include "visualization/GeometryBatch.h"
+#include "visualization/VehicleSpriteAtlas.h"
 #include "utils/DebugLogger.h"
+#include "utils/FrameClock.h"
+#include "utils/FrameCapture.h"
+#include "utils/FramePacer.h"
+#include "utils/Profiler.h"
+#include "utils/ThreadScheduling.h"
+#include "utils/TuningConfig.h"
+#include "utils/MetricsHttpServer.h"
 
 namespace fs = std::filesystem;
 
@@ -51,19 +63,14 @@ const SDL_Color INTERSECTION_COLOR = {50, 50, 50, 255};
 const SDL_Color SIDEWALK_COLOR = {180, 180, 180, 255};
 const SDL_Color GRASS_COLOR = {100, 200, 100, 255};
 
-// Simple logging function
+// Simple logging wrapper. Everything funnels into DebugLogger's async
+// sink, whose flush thread already fans out to the console, the log
+// file and the overlay's recent-log buffer - the old version duplicated
+// the first two synchronously here (including an open/append/close of a
+// second log file per call), costing three I/O operations per message
+// on the startup and error paths.
 void log_message(const std::string& msg) {
-    std::cout << "[Simulator] " << msg << std::endl;
-
-    // Also log to file
-    std::ofstream log("simulator_debug.log", std::ios::app);
-    if (log.is_open()) {
-        log << "[Simulator] " << msg << std::endl;
-        log.close();
-    }
-
-    // Also use DebugLogger
-    DebugLogger::log(msg);
+    DebugLogger::log("[Simulator] " + msg);
 }
 
 // Ensure data directories exist
@@ -99,7 +106,21 @@ public:
     int windowHeight;
     bool active;
     bool showDebug;
+
+    // Presentation suspended (window minimized/hidden/occluded): the
+    // simulation thread keeps ticking, the render loop just stops
+    // drawing and idles until an expose event
+    bool renderSuspended;
     TrafficManager* trafficMgr;
+    GeometryBatch vehicleBatch;
+    VehicleSpriteAtlas vehicleAtlas;
+
+    // Vsync-aware pacing with a 10fps idle floor (see FramePacer)
+    FramePacer framePacer;
+
+    // Asynchronous GIF session recorder, armed by --capture=<out.gif>;
+    // the render loop only pays the backbuffer readback
+    FrameCapture frameCapture;
 
     RenderSystem()
         : window(nullptr),
@@ -108,7 +129,9 @@ public:
           windowHeight(800),
           active(false),
           showDebug(false), // Set to false to disable debug overlay
-          trafficMgr(nullptr) {}
+          renderSuspended(false),
+          trafficMgr(nullptr),
+          framePacer(60, 10) {}
 
     ~RenderSystem() {
         cleanup();
@@ -133,6 +156,20 @@ public:
             return false;
         }
 
+        // Prefer display-driven pacing; the FramePacer covers both the
+        // fallback and the idle floor either way
+        if (SDL_SetRenderVSync(rendererSDL, 1)) {
+            framePacer.setVsyncActive(true);
+            log_message("Renderer vsync enabled");
+        } else {
+            log_message("Vsync unavailable (" + std::string(SDL_GetError()) +
+                        ") - pacing with timed sleeps");
+        }
+
+        // Bake every vehicle variant into the sprite atlas; on failure
+        // the per-primitive vehicle path keeps working
+        vehicleAtlas.build(rendererSDL);
+
         active = true;
         log_message("Renderer initialized successfully");
         return true;
@@ -276,6 +313,12 @@ public:
             return;
         }
 
+        // Blend the two newest simulation publishes into the
+        // presentation positions the vehicle drawing below reads; the
+        // simulation ticks at half the display rate and this fills in
+        // the in-between frames
+        VehicleStateStore::blendForRender(FrameClock::nowMs());
+
         // Draw realistic road layout
         drawRoadLayout();
 
@@ -284,22 +327,44 @@ public:
             trafficMgr->getTrafficLight()->render(rendererSDL);
         }
 
-        // Draw vehicles
+        // Draw vehicles from the published snapshots (the simulation
+        // thread owns the live queues), batched into one geometry call
+        vehicleBatch.begin();
+        const float CULL_MARGIN = 40.0f;
         for (auto* lane : trafficMgr->getLanes()) {
-            for (auto* vehicle : lane->getVehicles()) {
+            auto vehicles = lane->getRenderSnapshot();
+            for (auto* vehicle : *vehicles) {
                 if (vehicle) {
+                    // Queues run intersection -> spawn edge, so stop at
+                    // the first vehicle still out past the spawn side
+                    if (vehicle->isBeyondSpawnEdge(CULL_MARGIN)) {
+                        break;
+                    }
+                    if (vehicle->isOffscreen(CULL_MARGIN)) {
+                        continue;
+                    }
                     // Create default parameters for vehicle rendering
                     int queuePos = 0; // Not important for this call
-                    vehicle->render(rendererSDL, nullptr, queuePos);
+                    if (vehicleAtlas.isReady()) {
+                        vehicle->renderSprite(vehicleAtlas, queuePos);
+                    } else {
+                        vehicle->render(vehicleBatch, queuePos);
+                    }
                 }
             }
         }
+        vehicleBatch.flush(rendererSDL);
+        vehicleAtlas.flush(rendererSDL);
 
         // Draw debug overlay only if enabled
         if (showDebug) {
             drawDebugOverlay();
         }
 
+        // Stage the finished backbuffer for the capture encoder (no-op
+        // when not recording; must happen before present)
+        frameCapture.captureFrame(rendererSDL);
+
         // Present render
         SDL_RenderPresent(rendererSDL);
     }
@@ -313,7 +378,7 @@ public:
         log_message("Starting render loop");
 
         bool running = true;
-        uint32_t lastUpdateTime = SDL_GetTicks();
+        uint32_t lastUpdateTime = FrameClock::nowMs();
 
         while (running) {
             // Process events
@@ -331,23 +396,56 @@ public:
                     } else if (key == SDL_SCANCODE_ESCAPE) {
                         running = false;
                     }
+                } else if (event.type == SDL_EVENT_WINDOW_MINIMIZED ||
+                           event.type == SDL_EVENT_WINDOW_HIDDEN ||
+                           event.type == SDL_EVENT_WINDOW_OCCLUDED) {
+                    // Nothing we present is visible; stop drawing. The
+                    // simulation thread is unaffected.
+                    if (!renderSuspended) {
+                        renderSuspended = true;
+                        log_message("Window hidden - suspending presentation");
+                    }
+                } else if (event.type == SDL_EVENT_WINDOW_RESTORED ||
+                           event.type == SDL_EVENT_WINDOW_SHOWN ||
+                           event.type == SDL_EVENT_WINDOW_EXPOSED) {
+                    if (renderSuspended) {
+                        renderSuspended = false;
+                        log_message("Window exposed - resuming presentation");
+                    }
                 }
             }
 
-            // Calculate delta time
-            uint32_t currentTime = SDL_GetTicks();
+            // Calculate delta time (one frozen "now" per frame)
+            FrameClock::beginFrame();
+            uint32_t currentTime = FrameClock::nowMs();
             uint32_t deltaTime = currentTime - lastUpdateTime;
+            (void)deltaTime;
+
+            // NOTE: simulation now runs on its own fixed-timestep thread
+            // (see simulationLoop); the render loop only draws
 
-            // Update traffic manager
-            if (trafficMgr) {
-                trafficMgr->update(deltaTime);
+            if (renderSuspended) {
+                // Idle coarsely while hidden; events are still polled
+                // every pass so the expose resumes within one interval
+                lastUpdateTime = currentTime;
+                SDL_Delay(100);
+                continue;
             }
 
             // Render frame
             renderFrame();
 
-            // Limit frame rate
-            SDL_Delay(16); // ~60 FPS
+            // Pace the next frame: vsync or sleep/spin at the target
+            // rate while vehicles are on screen, 10fps once the junction
+            // drains (these kiosks are passively cooled)
+            bool sceneActive = false;
+            for (auto* lane : trafficMgr->getLanes()) {
+                if (lane->getVehicleCount() > 0) {
+                    sceneActive = true;
+                    break;
+                }
+            }
+            framePacer.pace(sceneActive);
 
             lastUpdateTime = currentTime;
         }
@@ -409,6 +507,14 @@ public:
                 stateStr += "D Green";
                 stateColor = {100, 255, 100, 255};
                 break;
+            case TrafficLight::State::AC_GREEN:
+                stateStr += "A+C Green";
+                stateColor = {100, 255, 100, 255};
+                break;
+            case TrafficLight::State::BD_GREEN:
+                stateStr += "B+D Green";
+                stateColor = {100, 255, 100, 255};
+                break;
         }
 
         drawText(stateStr, 20, 45, stateColor);
@@ -424,6 +530,11 @@ public:
 
     // Clean up resources
     void cleanup() {
+        // Finalize any active recording while SDL is still up
+        frameCapture.stop();
+
+        vehicleAtlas.shutdown();
+
         if (rendererSDL) {
             SDL_DestroyRenderer(rendererSDL);
             rendererSDL = nullptr;
@@ -438,6 +549,284 @@ public:
     }
 };
 
+// Flag that keeps the dedicated simulation thread alive
+std::atomic<bool> simulationActive(false);
+
+// Placement requests for the simulation thread (--pin-sim / --rt-sim),
+// applied by the thread itself right after it starts; -1 = unpinned
+std::atomic<int> simPinCore(-1);
+std::atomic<bool> simRealtime(false);
+
+// Fixed-timestep simulation loop, run on its own thread so a slow frame
+// (the renderer redraws the whole city backdrop) can no longer stall
+// vehicle physics or traffic-light timing. If a tick overruns, we catch
+// up rather than slow the simulated clock down.
+void simulationLoop(TrafficManager* trafficMgr) {
+    // Apply the requested placement from the thread itself; both are
+    // best-effort (pinning needs the core to exist, real-time usually
+    // needs privileges), so failures just log and carry on
+    int pinCore = simPinCore.load();
+    if (pinCore >= 0) {
+        if (ThreadScheduling::pinCurrentThreadToCore(pinCore)) {
+            log_message("Simulation thread pinned to core " + std::to_string(pinCore));
+        } else {
+            log_message("Could not pin simulation thread to core " + std::to_string(pinCore));
+        }
+    }
+    if (simRealtime.load()) {
+        if (ThreadScheduling::setCurrentThreadRealtime()) {
+            log_message("Simulation thread running at real-time priority");
+        } else {
+            log_message("Could not raise simulation thread priority (needs privileges?)");
+        }
+    }
+
+    // Half the display rate: the renderer interpolates between the two
+    // newest published ticks (see VehicleStateStore::blendForRender),
+    // so presentation stays smooth while simulation CPU halves - the
+    // kinematics are simple enough that blended in-between frames are
+    // indistinguishable from simulated ones
+    const uint32_t TICK_MS = 32;
+    auto nextTick = std::chrono::steady_clock::now();
+
+    log_message("Simulation thread started (fixed 32ms timestep)");
+
+    while (simulationActive) {
+        trafficMgr->update(TICK_MS);
+
+        nextTick += std::chrono::milliseconds(TICK_MS);
+        auto now = std::chrono::steady_clock::now();
+
+        if (nextTick > now) {
+            std::this_thread::sleep_until(nextTick);
+        } else if (now - nextTick > std::chrono::milliseconds(250)) {
+            // Fell far behind (debugger pause, machine suspend) - resync
+            // instead of issuing a burst of catch-up ticks
+            nextTick = now;
+        }
+    }
+
+    log_message("Simulation thread stopped");
+}
+
+// Flag for stopping a headless run with Ctrl+C
+std::atomic<bool> headlessRunning(true);
+
+void headlessSignalHandler(int) {
+    headlessRunning = false;
+}
+
+// Run the simulation without a window or any SDL_Render calls.
+// Ticks are fixed-size and issued back to back, so simulated hours of
+// traffic complete in seconds of wall time on a machine with no display.
+// A time scale above 1 compresses further: each tick covers
+// TICK_MS * scale of logical time, vehicles teleport along their routes
+// and the light runs off the logical clock (see TrafficManager::setTimeScale).
+// A nonzero fixedDtMs pins the tick size and switches the manager to its
+// logical clock, so runs with identical seeded spawn sequences (see the
+// generator's --seed flag) are bit-for-bit comparable.
+// recordPath/replayPath wire up the mmap event journal: record captures
+// every spawn into a binary trace, replay feeds that trace back in place
+// of the generator (see TrafficManager::startRecording/startReplay).
+int run_headless(uint64_t durationSimSeconds, uint32_t timeScale, uint32_t fixedDtMs,
+                 const std::string& recordPath, const std::string& replayPath,
+                 const std::string& schedulePath, uint16_t metricsPort,
+                 const std::string& loadStatePath,
+                 const std::string& saveStatePath, bool parallelLanes,
+                 bool inprocGenerator) {
+    log_message("Starting in headless mode (no window, no rendering)");
+
+    std::signal(SIGINT, headlessSignalHandler);
+
+    TrafficManager trafficManager;
+    if (!trafficManager.initialize()) {
+        log_message("Failed to initialize traffic manager");
+        return 1;
+    }
+
+    MetricsHttpServer metricsServer;
+    if (metricsPort > 0) {
+        metricsServer.start(metricsPort, &trafficManager.getMetricsSegment());
+    }
+
+    if (parallelLanes) {
+        trafficManager.setParallelLaneProcessing(true);
+    }
+
+    if (inprocGenerator && replayPath.empty() && schedulePath.empty()) {
+        if (!trafficManager.startInProcessGeneration()) {
+            log_message("Failed to start in-process generation");
+            return 1;
+        }
+        log_message("In-process generator: spawns bypass the filesystem");
+    }
+
+    trafficManager.setTimeScale(timeScale);
+    if (timeScale > 1) {
+        log_message("Time compression: " + std::to_string(timeScale) + "x fast-forward");
+    }
+
+    if (fixedDtMs > 0) {
+        trafficManager.setDeterministicClock(true);
+        log_message("Deterministic mode: fixed " + std::to_string(fixedDtMs) + "ms timestep");
+    }
+
+    if (!recordPath.empty()) {
+        if (!trafficManager.startRecording(recordPath)) {
+            log_message("Failed to open journal for recording: " + recordPath);
+            return 1;
+        }
+        log_message("Recording event journal to " + recordPath);
+    } else if (!replayPath.empty()) {
+        if (!trafficManager.startReplay(replayPath)) {
+            log_message("Failed to open journal for replay: " + replayPath);
+            return 1;
+        }
+        log_message("Replaying event journal from " + replayPath);
+    } else if (!schedulePath.empty()) {
+        if (!trafficManager.startScheduleStream(schedulePath)) {
+            log_message("Failed to open compiled schedule: " + schedulePath);
+            return 1;
+        }
+        log_message("Streaming compiled arrival schedule from " + schedulePath);
+    }
+
+    if (!loadStatePath.empty()) {
+        auto restoreStart = std::chrono::steady_clock::now();
+        if (!trafficManager.loadSnapshot(loadStatePath)) {
+            log_message("Failed to restore state snapshot: " + loadStatePath);
+            return 1;
+        }
+        auto restoreMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - restoreStart).count();
+        log_message("Restored state snapshot in " + std::to_string(restoreMs) + "ms");
+    }
+
+    trafficManager.start();
+
+    // Same delta the render loop produces unless --fixed-dt pinned it
+    const uint32_t TICK_MS = (fixedDtMs > 0) ? fixedDtMs : 16;
+    const uint64_t targetMs = durationSimSeconds * 1000;
+    uint64_t simulatedMs = 0;
+    uint64_t lastReportMs = 0;
+    auto wallStart = std::chrono::steady_clock::now();
+
+    while (headlessRunning && simulatedMs < targetMs) {
+        trafficManager.update(TICK_MS);
+        simulatedMs += TICK_MS * trafficManager.getTimeScale();
+
+        // Progress report every simulated 5 minutes
+        if (simulatedMs - lastReportMs >= 5 * 60 * 1000) {
+            lastReportMs = simulatedMs;
+            log_message("Headless: simulated " + std::to_string(simulatedMs / 1000) +
+                        "s of " + std::to_string(durationSimSeconds) + "s");
+        }
+    }
+
+    auto wallEnd = std::chrono::steady_clock::now();
+    auto wallMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        wallEnd - wallStart).count();
+
+    trafficManager.stop();
+
+    if (!saveStatePath.empty()) {
+        trafficManager.saveSnapshot(saveStatePath);
+        log_message("Saved state snapshot to " + saveStatePath);
+    }
+
+    log_message("Headless run complete: " + std::to_string(simulatedMs / 1000) +
+                "s simulated in " + std::to_string(wallMs) + "ms wall time");
+    log_message(trafficManager.getStatistics());
+
+    return 0;
+}
+
+// Run one slice of a distributed corridor: this process steps its
+// junctions on a worker pool and exchanges boundary vehicles with the
+// neighboring slices over TCP (see CorridorLink). Launch convention:
+// every slice but the westmost listens (--corridor-listen), every slice
+// but the eastmost dials its eastern neighbor (--corridor-peer), e.g.
+//   simulator --corridor=50 --corridor-peer=10.0.0.2:9500
+//   simulator --corridor=50 --corridor-listen=9500   (on 10.0.0.2)
+int run_corridor(int junctionCount, uint16_t listenPort,
+                 const std::string& peer, unsigned workerCount,
+                 uint64_t durationSimSeconds) {
+    log_message("Starting corridor slice: " + std::to_string(junctionCount) +
+                " junctions, " + std::to_string(workerCount) + " workers");
+
+    std::signal(SIGINT, headlessSignalHandler);
+
+    CorridorLink westBoundary;
+    CorridorLink eastBoundary;
+    CorridorLink* west = nullptr;
+    CorridorLink* east = nullptr;
+
+    if (listenPort > 0) {
+        if (!westBoundary.listen(listenPort)) {
+            log_message("Failed to open west boundary on port " +
+                        std::to_string(listenPort));
+            return 1;
+        }
+        west = &westBoundary;
+    }
+    if (!peer.empty()) {
+        size_t colon = peer.find(':');
+        if (colon == std::string::npos) {
+            log_message("Bad --corridor-peer (want host:port): " + peer);
+            return 1;
+        }
+        std::string host = peer.substr(0, colon);
+        uint16_t port = static_cast<uint16_t>(std::stoul(peer.substr(colon + 1)));
+        if (!eastBoundary.connect(host, port)) {
+            log_message("Failed to reach east boundary peer " + peer);
+            return 1;
+        }
+        east = &eastBoundary;
+    }
+
+    JunctionGraph graph(junctionCount);
+    graph.attachBoundaryLinks(west, east);
+    graph.seed(4);
+    graph.start(workerCount);
+
+    const uint32_t TICK_MS = 16;
+    const uint64_t targetMs = durationSimSeconds * 1000;
+    uint64_t simulatedMs = 0;
+    uint64_t lastReportMs = 0;
+    auto wallStart = std::chrono::steady_clock::now();
+
+    while (headlessRunning && simulatedMs < targetMs) {
+        graph.tick(TICK_MS);
+        simulatedMs += TICK_MS;
+
+        // Progress report every simulated 5 minutes
+        if (simulatedMs - lastReportMs >= 5 * 60 * 1000) {
+            lastReportMs = simulatedMs;
+            uint64_t droppedWire =
+                (west ? west->getDroppedHandoffs() : 0) +
+                (east ? east->getDroppedHandoffs() : 0);
+            log_message("Corridor: simulated " + std::to_string(simulatedMs / 1000) +
+                        "s, " + std::to_string(graph.totalVehicleCount()) +
+                        " vehicles queued, " +
+                        std::to_string(graph.getDroppedHandoffs()) +
+                        " mailbox drops, " + std::to_string(droppedWire) +
+                        " wire drops");
+        }
+    }
+
+    auto wallMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - wallStart).count();
+
+    graph.stop();
+    westBoundary.stop();
+    eastBoundary.stop();
+
+    log_message("Corridor slice done: " + std::to_string(simulatedMs / 1000) +
+                "s simulated in " + std::to_string(wallMs) + "ms wall time, " +
+                std::to_string(graph.totalVehicleCount()) + " vehicles still queued");
+    return 0;
+}
+
 // Main function
 int main(int argc, char* argv[]) {
     try {
@@ -445,33 +834,231 @@ int main(int argc, char* argv[]) {
         DebugLogger::initialize();
         log_message("Starting Traffic Junction Simulator");
 
+        // Headless mode: --headless [--duration=<simulated seconds>]
+        //                [--time-scale=<multiplier>] [--fixed-dt=<ms>]
+        //                [--record=<journal>] [--replay=<journal>]
+        //                [--schedule=<bin>] (compiled arrival schedule,
+        //                 see scenario_compiler)
+        // Either mode:   [--trace=<out.json>] (chrome://tracing capture)
+        //                [--metrics-port=<port>] (Prometheus endpoint)
+        //                [--load-state=<snap>] [--save-state=<snap>]
+        //                [--tuning=<cfg>] (hot-reloaded tuning values)
+        //                [--pin-sim=<core>] [--pin-render=<core>] [--rt-sim]
+        //                 (thread placement; see ThreadScheduling)
+        //                [--parallel-lanes] (task-pool lane sweeps)
+        //                [--inproc-generator] (fused generator thread,
+        //                 no external generator process or lane files)
+        // Windowed only: [--capture=<out.gif>] (async session recording)
+        // Corridor:      --corridor=<junctions> [--corridor-listen=<port>]
+        //                [--corridor-peer=<host:port>] [--corridor-workers=<n>]
+        //                 (one slice of a distributed corridor, headless)
+        bool headless = false;
+        uint64_t durationSimSeconds = 3600; // Default: one simulated hour
+        uint32_t timeScale = 1;             // 10/100 = fast-forward replay
+        uint32_t fixedDtMs = 0;             // >0 = deterministic logical clock
+        std::string recordPath;             // Journal to record into
+        std::string replayPath;             // Journal to replay from
+        std::string schedulePath;           // Compiled arrival schedule
+        std::string tracePath;              // Chrome-tracing JSON output
+        uint16_t metricsPort = 0;           // >0 = serve /metrics there
+        std::string loadStatePath;          // Snapshot to restore at launch
+        std::string saveStatePath;          // Snapshot to write when done
+        bool parallelLanes = false;         // Task-pool lane processing
+        bool inprocGenerator = false;       // Fused generator thread
+        std::string capturePath;            // GIF recording of the session
+        std::string tuningPath = "traffic_tuning.cfg"; // Hot-reload config
+        int corridorJunctions = 0;          // >0 = corridor slice mode
+        uint16_t corridorListen = 0;        // West boundary accept port
+        std::string corridorPeer;           // East boundary host:port
+        unsigned corridorWorkers =          // Junction step workers
+            std::max(1u, std::thread::hardware_concurrency() / 2);
+        int pinSimCore = -1;                // Core for the tick thread
+        int pinRenderCore = -1;             // Core for the render thread
+        bool rtSim = false;                 // Real-time tick thread
+        for (int i = 1; i < argc; i++) {
+            std::string arg = argv[i];
+            if (arg == "--headless") {
+                headless = true;
+            } else if (arg.rfind("--duration=", 0) == 0) {
+                durationSimSeconds = std::stoull(arg.substr(11));
+            } else if (arg.rfind("--time-scale=", 0) == 0) {
+                timeScale = static_cast<uint32_t>(std::stoul(arg.substr(13)));
+            } else if (arg.rfind("--fixed-dt=", 0) == 0) {
+                fixedDtMs = static_cast<uint32_t>(std::stoul(arg.substr(11)));
+            } else if (arg.rfind("--record=", 0) == 0) {
+                recordPath = arg.substr(9);
+            } else if (arg.rfind("--replay=", 0) == 0) {
+                replayPath = arg.substr(9);
+            } else if (arg.rfind("--schedule=", 0) == 0) {
+                schedulePath = arg.substr(11);
+            } else if (arg.rfind("--trace=", 0) == 0) {
+                tracePath = arg.substr(8);
+            } else if (arg.rfind("--metrics-port=", 0) == 0) {
+                metricsPort = static_cast<uint16_t>(std::stoul(arg.substr(15)));
+            } else if (arg.rfind("--load-state=", 0) == 0) {
+                loadStatePath = arg.substr(13);
+            } else if (arg.rfind("--save-state=", 0) == 0) {
+                saveStatePath = arg.substr(13);
+            } else if (arg == "--parallel-lanes") {
+                parallelLanes = true;
+            } else if (arg == "--inproc-generator") {
+                inprocGenerator = true;
+            } else if (arg.rfind("--capture=", 0) == 0) {
+                capturePath = arg.substr(10);
+            } else if (arg.rfind("--tuning=", 0) == 0) {
+                tuningPath = arg.substr(9);
+            } else if (arg.rfind("--pin-sim=", 0) == 0) {
+                pinSimCore = std::stoi(arg.substr(10));
+            } else if (arg.rfind("--pin-render=", 0) == 0) {
+                pinRenderCore = std::stoi(arg.substr(13));
+            } else if (arg == "--rt-sim") {
+                rtSim = true;
+            } else if (arg.rfind("--corridor=", 0) == 0) {
+                corridorJunctions = std::stoi(arg.substr(11));
+            } else if (arg.rfind("--corridor-listen=", 0) == 0) {
+                corridorListen = static_cast<uint16_t>(std::stoul(arg.substr(18)));
+            } else if (arg.rfind("--corridor-peer=", 0) == 0) {
+                corridorPeer = arg.substr(16);
+            } else if (arg.rfind("--corridor-workers=", 0) == 0) {
+                corridorWorkers = static_cast<unsigned>(std::stoul(arg.substr(19)));
+            }
+        }
+
+        // Watched tuning parameters (speed, light timing, priority
+        // thresholds, spawn cadence); editing the file retunes the
+        // running simulator without losing its queue state
+        TuningConfig::initialize(tuningPath);
+
+        // Tracing covers both modes; stopTrace() at exit joins the
+        // writer so the JSON is closed even on the early-return paths
+        if (!tracePath.empty()) {
+            if (!Profiler::startTrace(tracePath)) {
+                return 1;
+            }
+            std::atexit([]() { Profiler::stopTrace(); });
+        }
 
-        // Create traffic manager
+        if (corridorJunctions > 0) {
+            return run_corridor(corridorJunctions, corridorListen,
+                                corridorPeer, corridorWorkers,
+                                durationSimSeconds);
+        }
+
+        if (headless) {
+            // Headless ticks run on this thread, so its placement is
+            // applied here rather than through the simulation thread
+            if (pinSimCore >= 0 &&
+                !ThreadScheduling::pinCurrentThreadToCore(pinSimCore)) {
+                log_message("Could not pin tick thread to core " +
+                            std::to_string(pinSimCore));
+            }
+            if (rtSim && !ThreadScheduling::setCurrentThreadRealtime()) {
+                log_message("Could not raise tick thread priority (needs privileges?)");
+            }
+            return run_headless(durationSimSeconds, timeScale, fixedDtMs,
+                                recordPath, replayPath, schedulePath,
+                                metricsPort, loadStatePath, saveStatePath,
+                                parallelLanes, inprocGenerator);
+        }
+
+
+        // Overlap the two independent startup stages: manager
+        // initialization is filesystem-bound (lane file creation with
+        // retries in FileHandler::initializeFiles), renderer
+        // initialization is window- and GPU-bound (window creation,
+        // vsync negotiation, sprite-atlas bake). Running them serially
+        // added their latencies together on every watchdog relaunch in
+        // the field, where time-to-first-frame matters. The window/GPU
+        // half stays on the main thread, which SDL requires; both
+        // results are checked only after the join.
         TrafficManager trafficManager;
-        if (!trafficManager.initialize()) {
+        std::atomic<bool> managerReady{false};
+        std::thread managerInitThread([&trafficManager, &managerReady]() {
+            managerReady.store(trafficManager.initialize(),
+                               std::memory_order_release);
+        });
+
+        RenderSystem renderer;
+        bool rendererReady = renderer.initialize(
+            WINDOW_WIDTH, WINDOW_HEIGHT, "Traffic Junction Simulator");
+
+        managerInitThread.join();
+
+        if (!managerReady.load(std::memory_order_acquire)) {
             log_message("Failed to initialize traffic manager");
             SDL_Quit();
             return 1;
         }
-
-        // Create renderer
-        RenderSystem renderer;
-        if (!renderer.initialize(WINDOW_WIDTH, WINDOW_HEIGHT, "Traffic Junction Simulator")) {
+        if (!rendererReady) {
             log_message("Failed to initialize renderer");
             SDL_Quit();
             return 1;
         }
 
+        // Optional Prometheus endpoint (load labs scrape it instead of
+        // reading the log over ssh)
+        MetricsHttpServer metricsServer;
+        if (metricsPort > 0) {
+            metricsServer.start(metricsPort, &trafficManager.getMetricsSegment());
+        }
+
+        if (parallelLanes) {
+            trafficManager.setParallelLaneProcessing(true);
+        }
+
+        if (inprocGenerator &&
+            !trafficManager.startInProcessGeneration()) {
+            log_message("Failed to start in-process generation");
+            SDL_Quit();
+            return 1;
+        }
+
+        // Restore a saved junction state before the first frame
+        if (!loadStatePath.empty() &&
+            !trafficManager.loadSnapshot(loadStatePath)) {
+            log_message("Failed to restore state snapshot: " + loadStatePath);
+        }
+
         // Connect traffic manager to renderer
         renderer.setTrafficManager(&trafficManager);
 
+        // Start the session recording; failure is logged but never
+        // stops the simulator itself
+        if (!capturePath.empty() &&
+            !renderer.frameCapture.start(capturePath, WINDOW_WIDTH,
+                                         WINDOW_HEIGHT)) {
+            log_message("Failed to start frame capture: " + capturePath);
+        }
+
         // Start traffic manager
         trafficManager.start();
 
-        // Start render loop
+        // Keep the render (main) thread and the tick thread on their
+        // assigned cores; the kiosks' big.LITTLE scheduler otherwise
+        // migrates them mid-frame
+        if (pinRenderCore >= 0 &&
+            !ThreadScheduling::pinCurrentThreadToCore(pinRenderCore)) {
+            log_message("Could not pin render thread to core " +
+                        std::to_string(pinRenderCore));
+        }
+
+        // Run simulation on its own fixed-timestep thread so rendering
+        // hiccups don't affect traffic timing. Ticks run at half the
+        // display rate; the render loop interpolates between the
+        // published tick snapshots enabled here (headless runs leave
+        // publishing off and skip the per-tick copy).
+        VehicleStateStore::enableTickPublish();
+        simulationActive = true;
+        simPinCore = pinSimCore;
+        simRealtime = rtSim;
+        std::thread simulationThread(simulationLoop, &trafficManager);
+
+        // Start render loop (blocks until the window closes)
         renderer.startRenderLoop();
 
         // Cleanup
+        simulationActive = false;
+        simulationThread.join();
         trafficManager.stop();
         renderer.cleanup();
         SDL_Quit();
@@ -0,0 +1,289 @@
+// FILE: src/managers/CorridorLink.cpp
+#include "managers/CorridorLink.h"
+#include "utils/DebugLogger.h"
+
+#include <chrono>
+#include <cstring>
+
+#ifndef _WIN32
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+// Wire format: each frame is a little 2-byte count header followed by
+// count fixed-size WireHandoff records. Both ends of a link run the
+// same build, so the records go over as-is.
+
+CorridorLink::CorridorLink()
+    : socketFd(-1),
+      listenFd(-1) {
+}
+
+CorridorLink::~CorridorLink() {
+    stop();
+}
+
+bool CorridorLink::listen(uint16_t port) {
+#ifndef _WIN32
+    if (running.load()) {
+        return false;
+    }
+
+    listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    if (listenFd < 0) {
+        DebugLogger::log("Corridor link: socket() failed",
+                         DebugLogger::LogLevel::ERROR);
+        return false;
+    }
+
+    int reuse = 1;
+    setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(port);
+
+    if (bind(listenFd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 ||
+        ::listen(listenFd, 1) < 0) {
+        DebugLogger::log("Corridor link: cannot bind port " +
+                         std::to_string(port), DebugLogger::LogLevel::ERROR);
+        ::close(listenFd);
+        listenFd = -1;
+        return false;
+    }
+
+    DebugLogger::log("Corridor link: waiting for peer on port " +
+                     std::to_string(port));
+
+    running.store(true);
+
+    // Wait for the one peer; poll so stop() can interrupt the wait
+    while (running.load()) {
+        pollfd pfd = {listenFd, POLLIN, 0};
+        if (poll(&pfd, 1, 200) <= 0) {
+            continue;
+        }
+        socketFd = accept(listenFd, nullptr, nullptr);
+        break;
+    }
+
+    ::close(listenFd);
+    listenFd = -1;
+
+    if (socketFd < 0) {
+        running.store(false);
+        return false;
+    }
+
+    int nodelay = 1;
+    setsockopt(socketFd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+
+    connected.store(true);
+    receiverThread = std::thread(&CorridorLink::receiveLoop, this);
+
+    DebugLogger::log("Corridor link: peer connected");
+    return true;
+#else
+    (void)port;
+    return false; // No corridor links on Windows
+#endif
+}
+
+bool CorridorLink::connect(const std::string& host, uint16_t port) {
+#ifndef _WIN32
+    if (running.load()) {
+        return false;
+    }
+
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    if (inet_pton(AF_INET, host.c_str(), &addr.sin_addr) != 1) {
+        DebugLogger::log("Corridor link: bad peer address " + host,
+                         DebugLogger::LogLevel::ERROR);
+        return false;
+    }
+
+    // Retry for a while so the slices can be launched in any order
+    const int MAX_ATTEMPTS = 40;
+    for (int attempt = 0; attempt < MAX_ATTEMPTS; attempt++) {
+        socketFd = socket(AF_INET, SOCK_STREAM, 0);
+        if (socketFd < 0) {
+            return false;
+        }
+        if (::connect(socketFd, reinterpret_cast<sockaddr*>(&addr),
+                      sizeof(addr)) == 0) {
+            break;
+        }
+        ::close(socketFd);
+        socketFd = -1;
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    }
+
+    if (socketFd < 0) {
+        DebugLogger::log("Corridor link: could not reach peer " + host + ":" +
+                         std::to_string(port), DebugLogger::LogLevel::ERROR);
+        return false;
+    }
+
+    int nodelay = 1;
+    setsockopt(socketFd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+
+    running.store(true);
+    connected.store(true);
+    receiverThread = std::thread(&CorridorLink::receiveLoop, this);
+
+    DebugLogger::log("Corridor link: connected to " + host + ":" +
+                     std::to_string(port));
+    return true;
+#else
+    (void)host;
+    (void)port;
+    return false;
+#endif
+}
+
+void CorridorLink::queueHandoff(const std::string& label, bool emergency) {
+    if (!connected.load(std::memory_order_relaxed)) {
+        droppedHandoffs.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    WireHandoff handoff = {};
+    strncpy(handoff.label, label.c_str(), sizeof(handoff.label) - 1);
+    handoff.emergency = emergency ? 1 : 0;
+    outbound.push_back(handoff);
+}
+
+void CorridorLink::flush() {
+#ifndef _WIN32
+    if (outbound.empty() || !connected.load(std::memory_order_relaxed)) {
+        outbound.clear();
+        return;
+    }
+
+    uint16_t count = static_cast<uint16_t>(outbound.size());
+    bool ok = sendAll(reinterpret_cast<const uint8_t*>(&count), sizeof(count)) &&
+              sendAll(reinterpret_cast<const uint8_t*>(outbound.data()),
+                      outbound.size() * sizeof(WireHandoff));
+    if (!ok) {
+        droppedHandoffs.fetch_add(outbound.size(), std::memory_order_relaxed);
+        if (connected.exchange(false)) {
+            DebugLogger::log("Corridor link: peer lost, dropping handoffs",
+                             DebugLogger::LogLevel::WARNING);
+        }
+    }
+
+    outbound.clear();
+#endif
+}
+
+bool CorridorLink::popInbound(WireHandoff& handoff) {
+    return inbound.pop(handoff);
+}
+
+#ifndef _WIN32
+void CorridorLink::receiveLoop() {
+    while (running.load()) {
+        uint16_t count = 0;
+        if (!recvAll(reinterpret_cast<uint8_t*>(&count), sizeof(count))) {
+            break;
+        }
+
+        for (uint16_t i = 0; i < count; i++) {
+            WireHandoff handoff;
+            if (!recvAll(reinterpret_cast<uint8_t*>(&handoff),
+                         sizeof(handoff))) {
+                return;
+            }
+            handoff.label[sizeof(handoff.label) - 1] = '\0';
+            if (!inbound.push(handoff)) {
+                droppedHandoffs.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    if (connected.exchange(false) && running.load()) {
+        DebugLogger::log("Corridor link: peer disconnected",
+                         DebugLogger::LogLevel::WARNING);
+    }
+}
+
+bool CorridorLink::sendAll(const uint8_t* data, size_t length) {
+    size_t sent = 0;
+    while (sent < length) {
+        ssize_t n = send(socketFd, data + sent, length - sent, MSG_NOSIGNAL);
+        if (n <= 0) {
+            return false;
+        }
+        sent += static_cast<size_t>(n);
+    }
+    return true;
+}
+
+bool CorridorLink::recvAll(uint8_t* data, size_t length) {
+    size_t received = 0;
+    while (received < length) {
+        // Poll with a timeout so stop() can join without peer traffic
+        pollfd pfd = {socketFd, POLLIN, 0};
+        int ready = poll(&pfd, 1, 200);
+        if (ready < 0) {
+            return false;
+        }
+        if (ready == 0) {
+            if (!running.load()) {
+                return false;
+            }
+            continue;
+        }
+
+        ssize_t n = recv(socketFd, data + received, length - received, 0);
+        if (n <= 0) {
+            return false;
+        }
+        received += static_cast<size_t>(n);
+    }
+    return true;
+}
+#endif
+
+void CorridorLink::stop() {
+#ifndef _WIN32
+    if (!running.exchange(false)) {
+        return;
+    }
+
+    if (receiverThread.joinable()) {
+        receiverThread.join();
+    }
+
+    if (socketFd >= 0) {
+        ::close(socketFd);
+        socketFd = -1;
+    }
+    if (listenFd >= 0) {
+        ::close(listenFd);
+        listenFd = -1;
+    }
+    connected.store(false);
+
+    uint64_t dropped = droppedHandoffs.load(std::memory_order_relaxed);
+    if (dropped > 0) {
+        DebugLogger::log("Corridor link closed; " + std::to_string(dropped) +
+                         " handoffs dropped", DebugLogger::LogLevel::WARNING);
+    }
+#endif
+}
+
+bool CorridorLink::isConnected() const {
+    return connected.load(std::memory_order_relaxed);
+}
+
+uint64_t CorridorLink::getDroppedHandoffs() const {
+    return droppedHandoffs.load(std::memory_order_relaxed);
+}
@@ -1,24 +1,638 @@
 // FILE: src/managers/FileHandler.cpp
 #include "managers/FileHandler.h"
+#include <SDL3/SDL_error.h>
 #include "utils/DebugLogger.h"
+#include "utils/ThreadScheduling.h"
+#include "utils/VehiclePool.h"
 #include <fstream>
 #include <sstream>
+#include <cstring>
+#include <cstdlib>
 #include <filesystem>
+#include <iterator>
 #include <thread>
 #include <chrono>
 
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
 namespace fs = std::filesystem;
 
+namespace {
+
+// Same clock the generator stamps VehicleMessage::timestamp with;
+// monotonic, so readings are comparable across processes on one host
+uint64_t monotonicMicros() {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+} // namespace
+
+bool FileHandler::binaryFormatEnabled() {
+    // Checked once at startup; both the generator and the simulator must be
+    // launched with the same setting
+    static const bool enabled = []() {
+        const char* env = std::getenv("TRAFFIC_BINARY_FORMAT");
+        return env && env[0] == '1';
+    }();
+    return enabled;
+}
+
+bool FileHandler::appendLogEnabled() {
+    // Checked once at startup, same contract as the binary format
+    static const bool enabled = []() {
+        const char* env = std::getenv("TRAFFIC_APPEND_LOG");
+        return env && env[0] == '1';
+    }();
+    return enabled;
+}
+
 FileHandler::FileHandler(const std::string& dataPath)
-    : dataPath(dataPath) {
+    : dataPath(dataPath),
+      shmOpenAttempted(false),
+      watcherRunning(false),
+      inotifyFd(-1),
+      stageEnqueuePos(0),
+      stageDequeuePos(0),
+      asyncIOQueue(nullptr),
+      pendingLaneOps(0) {
+
+    for (size_t i = 0; i < STAGE_RING_SIZE; i++) {
+        stageRing[i].sequence.store(i, std::memory_order_relaxed);
+        stageRing[i].vehicle = nullptr;
+    }
+
+    for (int i = 0; i < 4; i++) {
+        laneReads[i].io = nullptr;
+        laneReads[i].laneId = static_cast<char>('A' + i);
+        logCursor[i] = 0;
+    }
+    statusWrite.io = nullptr;
+    statusWrite.inFlight.store(false);
 
     DebugLogger::log("FileHandler created with path: " + dataPath);
 }
 
 FileHandler::~FileHandler() {
+    stopFileWatcher();
+
+    // Anything parsed but never drained still belongs to the pool
+    while (Vehicle* vehicle = tryUnstage()) {
+        VehiclePool::release(vehicle);
+    }
+
     DebugLogger::log("FileHandler destroyed");
 }
 
+bool FileHandler::tryStage(Vehicle* vehicle) {
+    size_t pos = stageEnqueuePos.load(std::memory_order_relaxed);
+    for (;;) {
+        StageCell& cell = stageRing[pos & (STAGE_RING_SIZE - 1)];
+        size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+        if (diff == 0) {
+            if (stageEnqueuePos.compare_exchange_weak(pos, pos + 1,
+                                                      std::memory_order_relaxed)) {
+                cell.vehicle = vehicle;
+                cell.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            return false; // Ring full
+        } else {
+            pos = stageEnqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+Vehicle* FileHandler::tryUnstage() {
+    size_t pos = stageDequeuePos.load(std::memory_order_relaxed);
+    StageCell& cell = stageRing[pos & (STAGE_RING_SIZE - 1)];
+    size_t sequence = cell.sequence.load(std::memory_order_acquire);
+    if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1) < 0) {
+        return nullptr; // Empty
+    }
+
+    Vehicle* vehicle = cell.vehicle;
+    cell.vehicle = nullptr;
+    cell.sequence.store(pos + STAGE_RING_SIZE, std::memory_order_release);
+    stageDequeuePos.store(pos + 1, std::memory_order_relaxed);
+    return vehicle;
+}
+
+void FileHandler::stageParsed(const std::vector<Vehicle*>& parsed) {
+    for (Vehicle* vehicle : parsed) {
+        // A full ring means the simulation thread is behind by a whole
+        // ring's worth; wait it out rather than dropping pool-owned
+        // vehicles (the drain empties hundreds of slots per tick)
+        while (!tryStage(vehicle)) {
+            if (!watcherRunning.load()) {
+                VehiclePool::release(vehicle);
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
+
+bool FileHandler::startFileWatcher() {
+    if (watcherRunning.load()) {
+        return true;
+    }
+
+    // The async queue serves both ingestion loops and the status
+    // writer; without one every path stays on the blocking streams
+    if (!asyncIOQueue) {
+        asyncIOQueue = SDL_CreateAsyncIOQueue();
+        if (!asyncIOQueue) {
+            DebugLogger::log(std::string("SDL_CreateAsyncIOQueue failed: ") +
+                           SDL_GetError() + " - using blocking file I/O",
+                           DebugLogger::LogLevel::WARNING);
+        }
+    }
+
+#ifdef __linux__
+    inotifyFd = inotify_init1(IN_NONBLOCK);
+    if (inotifyFd >= 0) {
+        // IN_CLOSE_WRITE catches the generator finishing a write;
+        // IN_MOVED_TO covers writers that rename a temp file into place
+        int watchDescriptor = inotify_add_watch(inotifyFd, dataPath.c_str(),
+                                                IN_CLOSE_WRITE | IN_MOVED_TO);
+        if (watchDescriptor >= 0) {
+            watcherRunning.store(true);
+            watcherThread = std::thread(&FileHandler::watcherLoop, this);
+
+            DebugLogger::log("File watcher started on " + dataPath);
+            return true;
+        }
+
+        DebugLogger::log("inotify_add_watch failed for " + dataPath +
+                       " - using the polling ingestion thread",
+                       DebugLogger::LogLevel::WARNING);
+        close(inotifyFd);
+        inotifyFd = -1;
+    } else {
+        DebugLogger::log("inotify_init1 failed - using the polling ingestion thread",
+                       DebugLogger::LogLevel::WARNING);
+    }
+#endif
+
+    // No inotify: same 200ms cadence update() used to poll at, but the
+    // reads now happen off the simulation thread - on the SD-card boxes
+    // a slow read stalled movement and light timing for its whole
+    // duration
+    watcherRunning.store(true);
+    watcherThread = std::thread(&FileHandler::pollingLoop, this);
+
+    DebugLogger::log("File ingestion thread started (polling mode)");
+    return true;
+}
+
+void FileHandler::stopFileWatcher() {
+    if (!watcherRunning.exchange(false)) {
+        return;
+    }
+
+    if (asyncIOQueue) {
+        // Wake a thread parked in SDL_WaitAsyncIOResult() so the join
+        // below can't wait out a full poll interval
+        SDL_SignalAsyncIOQueue(asyncIOQueue);
+    }
+
+    if (watcherThread.joinable()) {
+        watcherThread.join();
+    }
+
+#ifdef __linux__
+    if (inotifyFd >= 0) {
+        close(inotifyFd);
+        inotifyFd = -1;
+    }
+#endif
+
+    if (asyncIOQueue) {
+        // Let an in-flight status report finish so its rename still
+        // happens; bounded so shutdown can't hang on a dead filesystem
+        std::vector<Vehicle*> parsed;
+        for (int i = 0; i < 25 && statusWrite.inFlight.load(); i++) {
+            SDL_AsyncIOOutcome outcome;
+            if (SDL_WaitAsyncIOResult(asyncIOQueue, &outcome, 200)) {
+                std::lock_guard<std::mutex> lock(mutex);
+                handleAsyncOutcome(outcome, parsed);
+            }
+        }
+        for (Vehicle* vehicle : parsed) {
+            VehiclePool::release(vehicle);
+        }
+
+        SDL_DestroyAsyncIOQueue(asyncIOQueue);
+        asyncIOQueue = nullptr;
+    }
+
+    DebugLogger::log("File watcher stopped");
+}
+
+bool FileHandler::hasFileWatcher() const {
+    return watcherRunning.load();
+}
+
+std::vector<Vehicle*> FileHandler::drainStagedVehicles() {
+    std::vector<Vehicle*> drained;
+    while (Vehicle* vehicle = tryUnstage()) {
+        drained.push_back(vehicle);
+    }
+    return drained;
+}
+
+void FileHandler::pollingLoop() {
+    while (watcherRunning.load()) {
+        pumpAsyncOutcomes();
+
+        auto parsed = readVehiclesFromFiles();
+        if (!parsed.empty()) {
+            stageParsed(parsed);
+        }
+
+        // 200ms cadence, sliced so shutdown stays responsive
+        for (int i = 0; i < 20 && watcherRunning.load(); i++) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+}
+
+#ifdef __linux__
+void FileHandler::watcherLoop() {
+    // Ingestion staging tolerates latency; keep it off the hot cores
+    ThreadScheduling::setCurrentThreadBackground();
+
+    // Big enough for a burst of events; names are short ("laneA.txt")
+    char eventBuffer[4096];
+
+    while (watcherRunning.load()) {
+        // poll() with a timeout so stopFileWatcher() is never stuck
+        // waiting for a write that isn't coming
+        struct pollfd pfd;
+        pfd.fd = inotifyFd;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+
+        int ready = poll(&pfd, 1, 200);
+
+        // Whether or not files changed, retire any async status stages
+        // that completed since the last pass
+        pumpAsyncOutcomes();
+
+        // The exchange file generates no inotify traffic (the producer
+        // writes through its mapping), so drain it on the poll cadence
+        std::vector<Vehicle*> exchanged;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            drainExchange(exchanged);
+        }
+        if (!exchanged.empty()) {
+            stageParsed(exchanged);
+        }
+
+        if (ready <= 0) {
+            continue;
+        }
+
+        ssize_t length = read(inotifyFd, eventBuffer, sizeof(eventBuffer));
+        if (length <= 0) {
+            continue;
+        }
+
+        // Coalesce the batch down to which lanes were touched, so a
+        // flurry of writes to one file costs a single read
+        bool touched[4] = {false, false, false, false};
+        ssize_t offset = 0;
+        while (offset < length) {
+            auto* event = reinterpret_cast<struct inotify_event*>(eventBuffer + offset);
+            if (event->len > 0) {
+                // Lane files are named lane<ID>.txt / lane<ID>.bin
+                std::string name(event->name);
+                if (name.size() > 4 && name.compare(0, 4, "lane") == 0 &&
+                    name[4] >= 'A' && name[4] <= 'D') {
+                    touched[name[4] - 'A'] = true;
+                }
+            }
+            offset += sizeof(struct inotify_event) + event->len;
+        }
+
+        // Parse on this thread: even a slow disk read in
+        // readVehiclesFromFile() only ever blocks the watcher, never
+        // the simulation
+        std::vector<Vehicle*> parsed;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (asyncIOQueue && !binaryFormatEnabled() && !appendLogEnabled()) {
+                readLanesAsync(touched, parsed);
+            } else {
+                for (int i = 0; i < 4; i++) {
+                    if (!touched[i]) {
+                        continue;
+                    }
+                    auto laneVehicles = readVehiclesFromFile(static_cast<char>('A' + i));
+                    parsed.insert(parsed.end(), laneVehicles.begin(), laneVehicles.end());
+                }
+            }
+        }
+
+        if (!parsed.empty()) {
+            stageParsed(parsed);
+        }
+    }
+}
+#else
+void FileHandler::watcherLoop() {
+    // startFileWatcher() never spawns the thread off Linux
+}
+#endif
+
+void FileHandler::readLanesAsync(const bool touched[4], std::vector<Vehicle*>& parsed) {
+    // Issue every read before collecting any result, so the touched
+    // lanes overlap in the kernel instead of serializing behind one
+    // another the way the blocking loop did
+    for (int i = 0; i < 4; i++) {
+        if (!touched[i]) {
+            continue;
+        }
+
+        // Claim first: the batch is ours after one atomic rename, so
+        // the async read races nothing
+        std::string claimedPath;
+        if (!claimLaneFile(getLaneFilePath(laneReads[i].laneId), claimedPath)) {
+            continue; // Nothing published
+        }
+
+        SDL_AsyncIO* io = SDL_AsyncIOFromFile(claimedPath.c_str(), "r");
+        if (!io) {
+            // Fall back to a blocking slurp of the batch we claimed
+            std::ifstream file(claimedPath);
+            if (file.is_open()) {
+                std::string text((std::istreambuf_iterator<char>(file)),
+                                 std::istreambuf_iterator<char>());
+                parseLaneText(text, parsed);
+            }
+            std::error_code removeError;
+            fs::remove(claimedPath, removeError);
+            continue;
+        }
+        laneReads[i].claimedPath = claimedPath;
+
+        Sint64 size = SDL_GetAsyncIOSize(io);
+        if (size <= 0) {
+            SDL_CloseAsyncIO(io, false, asyncIOQueue, &laneReads[i]);
+            pendingLaneOps++;
+            continue;
+        }
+
+        laneReads[i].io = io;
+        laneReads[i].buffer.resize(static_cast<size_t>(size));
+        if (SDL_ReadAsyncIO(io, &laneReads[i].buffer[0], 0,
+                            static_cast<Uint64>(size), asyncIOQueue, &laneReads[i])) {
+            pendingLaneOps++;
+        } else {
+            laneReads[i].io = nullptr;
+            SDL_CloseAsyncIO(io, false, asyncIOQueue, &laneReads[i]);
+            pendingLaneOps++;
+        }
+    }
+
+    // Collect completions; each lane is parsed the moment its bytes
+    // land, so a slow file never delays the fast ones
+    while (pendingLaneOps > 0) {
+        SDL_AsyncIOOutcome outcome;
+        if (SDL_WaitAsyncIOResult(asyncIOQueue, &outcome, 200)) {
+            handleAsyncOutcome(outcome, parsed);
+        } else if (!watcherRunning.load()) {
+            // Shutdown with operations still in flight: the buffers are
+            // member storage, so abandoning the tail is safe until the
+            // queue itself is destroyed
+            pendingLaneOps = 0;
+            break;
+        }
+    }
+}
+
+void FileHandler::handleAsyncOutcome(const SDL_AsyncIOOutcome& outcome,
+                                     std::vector<Vehicle*>& parsed) {
+    // Status report chain: write -> flush-close -> rename
+    if (outcome.userdata == &statusWrite) {
+        if (outcome.result != SDL_ASYNCIO_COMPLETE) {
+            DebugLogger::log(std::string("Async lane status write failed: ") +
+                           SDL_GetError(), DebugLogger::LogLevel::ERROR);
+            if (outcome.type == SDL_ASYNCIO_TASK_WRITE) {
+                SDL_CloseAsyncIO(statusWrite.io, false, asyncIOQueue, &statusWrite);
+            } else {
+                statusWrite.io = nullptr;
+                statusWrite.inFlight.store(false);
+            }
+            return;
+        }
+
+        if (outcome.type == SDL_ASYNCIO_TASK_WRITE) {
+            // Bytes are down; flush-close before the rename so readers
+            // never see a short temp file promoted
+            SDL_CloseAsyncIO(statusWrite.io, true, asyncIOQueue, &statusWrite);
+        } else if (outcome.type == SDL_ASYNCIO_TASK_CLOSE) {
+            std::error_code renameError;
+            fs::rename(statusWrite.tempPath, statusWrite.finalPath, renameError);
+            if (renameError) {
+                DebugLogger::log("Failed to publish lane status file: " +
+                               renameError.message(), DebugLogger::LogLevel::ERROR);
+            }
+            statusWrite.io = nullptr;
+            statusWrite.inFlight.store(false);
+        }
+        return;
+    }
+
+    // Everything else is a lane read or one of its trailing closes
+    auto* entry = static_cast<AsyncLaneRead*>(outcome.userdata);
+    if (!entry) {
+        return;
+    }
+
+    if (outcome.type == SDL_ASYNCIO_TASK_READ) {
+        if (outcome.result == SDL_ASYNCIO_COMPLETE && outcome.bytes_transferred > 0) {
+            entry->buffer.resize(static_cast<size_t>(outcome.bytes_transferred));
+            size_t before = parsed.size();
+            parseLaneText(entry->buffer, parsed);
+
+            if (parsed.size() > before) {
+                std::ostringstream oss;
+                oss << "Read " << (parsed.size() - before) << " vehicles from lane "
+                    << entry->laneId;
+                DebugLogger::log(oss.str());
+            }
+
+        } else if (outcome.result != SDL_ASYNCIO_COMPLETE) {
+            DebugLogger::log(std::string("Async read failed for lane ") +
+                           entry->laneId + ": " + SDL_GetError(),
+                           DebugLogger::LogLevel::ERROR);
+        }
+
+        // The claimed batch is consumed whether the read succeeded or
+        // not; the remove replaces the old async truncation chain
+        if (!entry->claimedPath.empty()) {
+            std::error_code removeError;
+            fs::remove(entry->claimedPath, removeError);
+            entry->claimedPath.clear();
+        }
+
+        // The read retires and its close takes the slot, so
+        // pendingLaneOps is unchanged here
+        SDL_CloseAsyncIO(entry->io, false, asyncIOQueue, entry);
+        entry->io = nullptr;
+        return;
+    }
+
+    if (outcome.type == SDL_ASYNCIO_TASK_CLOSE) {
+        // Claims that never reached a read (empty or unreadable batch)
+        // are released here
+        if (!entry->claimedPath.empty()) {
+            std::error_code removeError;
+            fs::remove(entry->claimedPath, removeError);
+            entry->claimedPath.clear();
+        }
+        pendingLaneOps--;
+    }
+}
+
+void FileHandler::pumpAsyncOutcomes() {
+    if (!asyncIOQueue) {
+        return;
+    }
+
+    std::vector<Vehicle*> parsed;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        SDL_AsyncIOOutcome outcome;
+        while (SDL_GetAsyncIOResult(asyncIOQueue, &outcome)) {
+            handleAsyncOutcome(outcome, parsed);
+        }
+    }
+
+    // Only the status chain's later stages surface here, but any stray
+    // parsed vehicles still belong in the ring
+    if (!parsed.empty()) {
+        stageParsed(parsed);
+    }
+}
+
+std::vector<Vehicle*> FileHandler::readVehiclesFromSharedMemory() {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<Vehicle*> vehicles;
+
+    // Try to attach to the generator's segment once per poll until it appears
+    // (the generator may start after the simulator)
+    if (!shmChannel.isAvailable()) {
+        if (shmChannel.open()) {
+            DebugLogger::log("Shared memory channel opened - using fast spawn path");
+            shmOpenAttempted = true;
+        } else {
+            return vehicles;
+        }
+    }
+
+    // Drain everything the generator has pushed since the last frame
+    VehicleMessage message;
+    while (shmChannel.pop(message)) {
+        Vehicle* vehicle = vehicleFromMessage(message);
+        if (vehicle) {
+            vehicles.push_back(vehicle);
+        }
+    }
+
+    if (!vehicles.empty()) {
+        // Structured log: this fires every spawn batch, so defer the
+        // formatting to the logger's flush thread
+        DebugLogger::logf(DebugLogger::LogLevel::INFO,
+                          "Read %lld vehicles from shared memory",
+                          vehicles.size());
+    }
+
+    return vehicles;
+}
+
+bool FileHandler::hasSharedMemoryChannel() const {
+    return shmChannel.isAvailable();
+}
+
+void FileHandler::drainExchange(std::vector<Vehicle*>& parsed) {
+    // Attach lazily until the generator has created the file (it may
+    // start after the simulator), same as the shm channel
+    if (!laneExchange.isAvailable()) {
+        if (!laneExchange.open(getExchangeFilePath())) {
+            return;
+        }
+        DebugLogger::log("Lane exchange file mapped - using mmap spawn transport");
+    }
+
+    size_t before = parsed.size();
+    VehicleMessage message;
+    for (char laneId : {'A', 'B', 'C', 'D'}) {
+        while (laneExchange.pop(laneId, message)) {
+            Vehicle* vehicle = vehicleFromMessage(message);
+            if (vehicle) {
+                parsed.push_back(vehicle);
+            }
+        }
+    }
+
+    if (parsed.size() > before) {
+        DebugLogger::logf(DebugLogger::LogLevel::INFO,
+                          "Read %lld vehicles from the lane exchange",
+                          parsed.size() - before);
+    }
+}
+
+std::string FileHandler::getExchangeFilePath() const {
+    return dataPath + "/exchange.map";
+}
+
+Vehicle* FileHandler::vehicleFromMessage(const VehicleMessage& message) {
+    // Validate the record the same way parseVehicleLine validates text lines
+    if (message.lane != 'A' && message.lane != 'B' &&
+        message.lane != 'C' && message.lane != 'D') {
+        DebugLogger::log("Invalid lane ID in shared memory record",
+                       DebugLogger::LogLevel::ERROR);
+        return nullptr;
+    }
+
+    // Don't spawn vehicles in Lane 1 (L1)
+    if (message.laneNumber < 2 || message.laneNumber > 3) {
+        return nullptr;
+    }
+
+    // Guarantee null termination before constructing the ID string
+    char idBuffer[sizeof(message.id)];
+    std::memcpy(idBuffer, message.id, sizeof(idBuffer));
+    idBuffer[sizeof(idBuffer) - 1] = '\0';
+    std::string vehicleId(idBuffer);
+
+    Destination destination = Destination::STRAIGHT;
+    if (message.destination == 1) {
+        destination = Destination::LEFT;
+    } else if (message.destination == 2) {
+        destination = Destination::RIGHT;
+    }
+
+    Vehicle* vehicle = VehiclePool::acquire(vehicleId, message.lane, message.laneNumber,
+                                            message.emergency != 0);
+    vehicle->setDestination(destination);
+    vehicle->setSpawnStamps(static_cast<uint32_t>(message.timestamp),
+                            static_cast<uint32_t>(monotonicMicros()));
+
+    return vehicle;
+}
+
 std::vector<Vehicle*> FileHandler::readVehiclesFromFiles() {
     std::lock_guard<std::mutex> lock(mutex);
     std::vector<Vehicle*> vehicles;
@@ -29,96 +643,138 @@ std::vector<Vehicle*> FileHandler::readVehiclesFromFiles() {
         return vehicles;
     }
 
-    // Read from each lane file (A, B, C, D) with lane ID
-    for (char laneId : {'A', 'B', 'C', 'D'}) {
-        std::string filePath = getLaneFilePath(laneId);
+    // Preferred transport: drain the memory-mapped exchange rings
+    // (no syscalls, no truncate race with the generator's appends)
+    drainExchange(vehicles);
 
-        // Only try to read if file exists
-        if (fs::exists(filePath)) {
-            auto laneVehicles = readVehiclesFromFile(laneId);
-            vehicles.insert(vehicles.end(), laneVehicles.begin(), laneVehicles.end());
+    // Read from each lane file (A, B, C, D) with lane ID. The async
+    // claim path is built around rename/remove, so append-log mode
+    // (which renames nothing) always takes the cursor reads below.
+    if (asyncIOQueue && !binaryFormatEnabled() && !appendLogEnabled()) {
+        bool touched[4];
+        for (int i = 0; i < 4; i++) {
+            touched[i] = fs::exists(getLaneFilePath(static_cast<char>('A' + i)));
+        }
+        readLanesAsync(touched, vehicles);
+    } else {
+        for (char laneId : {'A', 'B', 'C', 'D'}) {
+            // Only try to read if file exists (the append log keeps its
+            // own cursor and tolerates a log that isn't there yet)
+            if (appendLogEnabled() || fs::exists(getLaneFilePath(laneId))) {
+                auto laneVehicles = readVehiclesFromFile(laneId);
+                vehicles.insert(vehicles.end(), laneVehicles.begin(), laneVehicles.end());
+            }
         }
     }
 
     // If we found any vehicles, log the total
     if (!vehicles.empty()) {
-        std::ostringstream oss;
-        oss << "Read " << vehicles.size() << " vehicles from lane files";
-        DebugLogger::log(oss.str());
+        DebugLogger::logf(DebugLogger::LogLevel::INFO,
+                          "Read %lld vehicles from lane files",
+                          vehicles.size());
     }
 
     return vehicles;
 }
 
-std::vector<Vehicle*> FileHandler::readVehiclesFromFile(char laneId) {
+bool FileHandler::claimLaneFile(const std::string& filePath,
+                                std::string& claimedPath) {
+    // Rename the published file away; the generator only ever creates
+    // the published name, so after this succeeds it is ours alone and
+    // can be parsed at leisure. ENOENT just means nothing is published.
+    claimedPath = filePath + ".claim";
+    std::error_code renameError;
+    fs::rename(filePath, claimedPath, renameError);
+    return !renameError;
+}
+
+std::vector<Vehicle*> FileHandler::readVehiclesFromBinaryFile(char laneId) {
     std::vector<Vehicle*> vehicles;
-    std::string filePath = getLaneFilePath(laneId);
-
-    // Multiple attempts to open file (addresses file locking issues)
-    std::ifstream file;
-    int attempts = 0;
-    while (attempts < 3) {
-        file.open(filePath);
-        if (file.is_open()) {
-            break;
+
+    std::string claimedPath;
+    if (!claimLaneFile(getLaneFilePath(laneId), claimedPath)) {
+        return vehicles;
+    }
+
+    std::ifstream file(claimedPath, std::ios::binary);
+    if (file.is_open()) {
+        // Each record is a fixed-width VehicleMessage; read them back to back
+        VehicleMessage message;
+        while (file.read(reinterpret_cast<char*>(&message), sizeof(message))) {
+            Vehicle* vehicle = vehicleFromMessage(message);
+            if (vehicle) {
+                vehicles.push_back(vehicle);
+            }
         }
-        // Wait and retry if file is locked
-        std::this_thread::sleep_for(std::chrono::milliseconds(50));
-        attempts++;
+        file.close();
     }
 
-    if (!file.is_open()) {
-        return vehicles;
+    // The claimed batch is consumed; removal instead of truncation, so
+    // the published name's existence always means "new batch"
+    std::error_code removeError;
+    fs::remove(claimedPath, removeError);
+
+    if (!vehicles.empty()) {
+        std::ostringstream oss;
+        oss << "Read " << vehicles.size() << " binary records from lane " << laneId;
+        DebugLogger::log(oss.str());
     }
 
-    std::vector<std::string> lines;
-    std::string line;
+    return vehicles;
+}
 
-    // Read all lines from file
-    while (std::getline(file, line)) {
-        if (!line.empty()) {
-            lines.push_back(line);
-        }
+std::vector<Vehicle*> FileHandler::readVehiclesFromFile(char laneId) {
+    std::vector<Vehicle*> vehicles;
+
+    // Append-log mode replaces the claim protocol entirely (and handles
+    // both formats itself)
+    if (appendLogEnabled()) {
+        return readVehiclesFromAppendLog(laneId);
     }
-    file.close();
 
-    // Don't modify file if no lines were read
-    if (lines.empty()) {
-        return vehicles;
+    // Binary mode skips all the text parsing below
+    if (binaryFormatEnabled()) {
+        return readVehiclesFromBinaryFile(laneId);
     }
 
-    // Process lines first before clearing file (prevents data loss if parsing fails)
-    std::vector<Vehicle*> parsedVehicles;
-    for (const auto& line : lines) {
-        Vehicle* vehicle = parseVehicleLine(line);
-        if (vehicle) {
-            parsedVehicles.push_back(vehicle);
-        }
+    // Claim the published batch with one atomic rename; the generator
+    // can keep publishing new batches while we parse this one. The old
+    // shared-path scheme needed 3-attempt/50ms retry loops on both the
+    // open and the clear - worst-case 150ms of ingestion stall that is
+    // now a single rename.
+    std::string claimedPath;
+    if (!claimLaneFile(getLaneFilePath(laneId), claimedPath)) {
+        return vehicles;
     }
 
-    // Clear the file after reading to prevent duplicates - with error handling
-    bool fileClearedSuccessfully = false;
-    attempts = 0;
-    while (!fileClearedSuccessfully && attempts < 3) {
-        try {
-            std::ofstream clearFile(filePath, std::ios::trunc);
-            if (clearFile.is_open()) {
-                clearFile.close();
-                fileClearedSuccessfully = true;
-            } else {
-                std::this_thread::sleep_for(std::chrono::milliseconds(50));
-                attempts++;
-            }
-        } catch (const std::exception& e) {
-            DebugLogger::log("Error clearing file: " + std::string(e.what()), DebugLogger::LogLevel::ERROR);
-            attempts++;
-            std::this_thread::sleep_for(std::chrono::milliseconds(50));
-        }
+    std::ifstream file(claimedPath);
+    if (!file.is_open()) {
+        std::error_code removeError;
+        fs::remove(claimedPath, removeError);
+        return vehicles;
     }
 
-    if (!fileClearedSuccessfully) {
-        DebugLogger::log("Failed to clear file after reading: " + filePath, DebugLogger::LogLevel::ERROR);
+    // Slurp the whole file into the reusable buffer: one read per poll
+    // and no per-line strings, which matters during burst spawns when a
+    // poll ingests hundreds of lines
+    readBuffer.clear();
+    file.seekg(0, std::ios::end);
+    std::streampos fileSize = file.tellg();
+    if (fileSize > 0) {
+        readBuffer.resize(static_cast<size_t>(fileSize));
+        file.seekg(0, std::ios::beg);
+        file.read(&readBuffer[0], fileSize);
+        readBuffer.resize(static_cast<size_t>(file.gcount()));
     }
+    file.close();
+
+    // Each line is a view into readBuffer
+    std::vector<Vehicle*> parsedVehicles;
+    parseLaneText(readBuffer, parsedVehicles);
+
+    // The claimed batch is consumed
+    std::error_code removeError;
+    fs::remove(claimedPath, removeError);
 
     // Log number of vehicles read
     if (!parsedVehicles.empty()) {
@@ -130,30 +786,124 @@ std::vector<Vehicle*> FileHandler::readVehiclesFromFile(char laneId) {
     return parsedVehicles;
 }
 
-Vehicle* FileHandler::parseVehicleLine(const std::string& line) {
+std::vector<Vehicle*> FileHandler::readVehiclesFromAppendLog(char laneId) {
+    std::vector<Vehicle*> vehicles;
+    int index = laneId - 'A';
+
+    std::ifstream file(getAppendLogPath(laneId), std::ios::binary);
+    if (!file.is_open()) {
+        return vehicles; // Nothing appended yet this run
+    }
+
+    file.seekg(0, std::ios::end);
+    std::streamoff size = file.tellg();
+    if (size <= logCursor[index]) {
+        return vehicles; // No new bytes since the last poll
+    }
+
+    // Read only the bytes past the cursor: the cost of a poll is the
+    // new vehicles, not the session's whole history. Nobody renames or
+    // removes anything, so there is no batch the generator could lose;
+    // the log grows for the run's duration (a few bytes per vehicle)
+    // and the next startup's initializeFiles() clears it.
+    readBuffer.resize(static_cast<size_t>(size - logCursor[index]));
+    file.seekg(logCursor[index], std::ios::beg);
+    file.read(&readBuffer[0], static_cast<std::streamsize>(readBuffer.size()));
+    readBuffer.resize(static_cast<size_t>(file.gcount()));
+    file.close();
+
+    // Consume whole units only - a record or line still being appended
+    // stays behind the cursor until the next poll completes it
+    size_t consumed;
+    if (binaryFormatEnabled()) {
+        consumed = readBuffer.size() - readBuffer.size() % sizeof(VehicleMessage);
+        VehicleMessage message;
+        for (size_t offset = 0; offset < consumed; offset += sizeof(message)) {
+            std::memcpy(&message, readBuffer.data() + offset, sizeof(message));
+            Vehicle* vehicle = vehicleFromMessage(message);
+            if (vehicle) {
+                vehicles.push_back(vehicle);
+            }
+        }
+    } else {
+        size_t lastNewline = readBuffer.find_last_of('\n');
+        if (lastNewline == std::string::npos) {
+            return vehicles; // Only a partial line so far
+        }
+        consumed = lastNewline + 1;
+        parseLaneText(std::string_view(readBuffer.data(), consumed), vehicles);
+    }
+    logCursor[index] += static_cast<std::streamoff>(consumed);
+
+    if (!vehicles.empty()) {
+        std::ostringstream oss;
+        oss << "Read " << vehicles.size() << " vehicles from lane " << laneId
+            << " append log";
+        DebugLogger::log(oss.str());
+    }
+
+    return vehicles;
+}
+
+void FileHandler::parseLaneText(std::string_view text, std::vector<Vehicle*>& parsed) {
+    // Each line is a view into the caller's buffer; nothing is copied
+    // until a vehicle is actually created
+    std::string_view remaining = text;
+    while (!remaining.empty()) {
+        size_t eol = remaining.find('\n');
+        std::string_view line = remaining.substr(0, eol);
+        remaining = (eol == std::string_view::npos)
+            ? std::string_view()
+            : remaining.substr(eol + 1);
+
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        if (line.empty()) {
+            continue;
+        }
+
+        Vehicle* vehicle = parseVehicleLine(line);
+        if (vehicle) {
+            parsed.push_back(vehicle);
+        }
+    }
+}
+
+Vehicle* FileHandler::parseVehicleLine(std::string_view line) {
     // Expected formats:
     // "vehicleId_L{laneNumber}:laneId"
     // "vehicleId_L{laneNumber}_DIRECTION:laneId"
-    size_t pos = line.find(":");
-    if (pos == std::string::npos) {
-        DebugLogger::log("Error parsing line (missing colon): " + line, DebugLogger::LogLevel::ERROR);
+    size_t pos = line.find(':');
+    if (pos == std::string_view::npos) {
+        DebugLogger::log("Error parsing line (missing colon): " + std::string(line),
+                       DebugLogger::LogLevel::ERROR);
         return nullptr;
     }
 
-    std::string vehicleId = line.substr(0, pos);
+    std::string_view vehicleId = line.substr(0, pos);
 
     // Ensure there's a lane ID after the colon
     if (pos + 1 >= line.length()) {
-        DebugLogger::log("Error parsing line (missing lane ID): " + line, DebugLogger::LogLevel::ERROR);
+        DebugLogger::log("Error parsing line (missing lane ID): " + std::string(line),
+                       DebugLogger::LogLevel::ERROR);
         return nullptr;
     }
 
     char laneId = line[pos + 1];
 
+    // Optional creation stamp appended by newer generators:
+    // "vehicleId:laneId@createdUs" (monotonic microseconds)
+    uint64_t createdUs = 0;
+    if (pos + 2 < line.length() && line[pos + 2] == '@') {
+        createdUs = std::strtoull(std::string(line.substr(pos + 3)).c_str(),
+                                  nullptr, 10);
+    }
+
     // Extract lane number from ID (format: V1_L2 where 2 is the lane number)
     int laneNumber = 2; // Default is lane 2
     size_t lanePos = vehicleId.find("_L");
-    if (lanePos != std::string::npos && lanePos + 2 < vehicleId.length()) {
+    if (lanePos != std::string_view::npos && lanePos + 2 < vehicleId.length()) {
         char laneNumChar = vehicleId[lanePos + 2];
         if (laneNumChar >= '1' && laneNumChar <= '3') {
             laneNumber = laneNumChar - '0';
@@ -162,7 +912,8 @@ Vehicle* FileHandler::parseVehicleLine(const std::string& line) {
 
     // Don't spawn vehicles in Lane 1 (L1)
     if (laneNumber == 1) {
-        DebugLogger::log("Ignoring vehicle in Lane 1: " + line, DebugLogger::LogLevel::WARNING);
+        DebugLogger::log("Ignoring vehicle in Lane 1: " + std::string(line),
+                       DebugLogger::LogLevel::WARNING);
         return nullptr;
     }
 
@@ -174,9 +925,9 @@ Vehicle* FileHandler::parseVehicleLine(const std::string& line) {
         destination = Destination::LEFT;
     } else if (laneNumber == 2) {
         // Check for direction in ID
-        if (vehicleId.find("_LEFT") != std::string::npos) {
+        if (vehicleId.find("_LEFT") != std::string_view::npos) {
             destination = Destination::LEFT;
-        } else if (vehicleId.find("_STRAIGHT") != std::string::npos) {
+        } else if (vehicleId.find("_STRAIGHT") != std::string_view::npos) {
             destination = Destination::STRAIGHT;
         } else {
             // Default for L2 if not specified is STRAIGHT
@@ -185,17 +936,24 @@ Vehicle* FileHandler::parseVehicleLine(const std::string& line) {
     }
 
     // Determine if it's an emergency vehicle
-    bool isEmergency = vehicleId.find("_E") != std::string::npos || vehicleId.find("E_") != std::string::npos;
+    bool isEmergency = vehicleId.find("_E") != std::string_view::npos ||
+                       vehicleId.find("E_") != std::string_view::npos;
 
     // Validate lane ID
     if (laneId != 'A' && laneId != 'B' && laneId != 'C' && laneId != 'D') {
-        DebugLogger::log("Invalid lane ID in line: " + line, DebugLogger::LogLevel::ERROR);
+        DebugLogger::log("Invalid lane ID in line: " + std::string(line),
+                       DebugLogger::LogLevel::ERROR);
         return nullptr;
     }
 
-    // Create the vehicle with the specified destination
-    Vehicle* vehicle = new Vehicle(vehicleId, laneId, laneNumber, isEmergency);
+    // Create the vehicle with the specified destination; the label copy
+    // into the pool slot is the line's only allocation
+    Vehicle* vehicle = VehiclePool::acquire(std::string(vehicleId), laneId, laneNumber, isEmergency);
     vehicle->setDestination(destination);
+    if (createdUs != 0) {
+        vehicle->setSpawnStamps(static_cast<uint32_t>(createdUs),
+                                static_cast<uint32_t>(monotonicMicros()));
+    }
 
     std::ostringstream oss;
     oss << "Created vehicle " << vehicleId << " for lane " << laneId << laneNumber;
@@ -212,8 +970,25 @@ Vehicle* FileHandler::parseVehicleLine(const std::string& line) {
     return vehicle;
 }
 
-void FileHandler::writeLaneStatus(char laneId, int laneNumber, int vehicleCount, bool isPriority) {
+void FileHandler::bufferLaneStatus(char laneId, int laneNumber, int vehicleCount, bool isPriority) {
     std::lock_guard<std::mutex> lock(mutex);
+    statusBuffer += laneId;
+    statusBuffer += static_cast<char>('0' + laneNumber);
+    statusBuffer += ": ";
+    statusBuffer += std::to_string(vehicleCount);
+    statusBuffer += " vehicles";
+    if (isPriority) {
+        statusBuffer += " (PRIORITY)";
+    }
+    statusBuffer += '\n';
+}
+
+void FileHandler::flushLaneStatus() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (statusBuffer.empty()) {
+        return;
+    }
+
     std::string statusPath = getLaneStatusFilePath();
 
     // Make sure the directory exists
@@ -224,39 +999,96 @@ void FileHandler::writeLaneStatus(char laneId, int laneNumber, int vehicleCount,
         } catch (const std::exception& e) {
             DebugLogger::log("Error creating directory: " + std::string(e.what()),
                            DebugLogger::LogLevel::ERROR);
+            statusBuffer.clear();
             return;
         }
     }
 
-    std::ofstream file(statusPath, std::ios::app);
-    if (file.is_open()) {
-        file << laneId << laneNumber << ": " << vehicleCount << " vehicles"
-             << (isPriority ? " (PRIORITY)" : "") << std::endl;
-        file.close();
-    } else {
-        DebugLogger::log("Warning: Could not open lane status file for writing",
+    // Write the whole report to a sibling temp file, then rename it
+    // into place: readers never see a half-written snapshot and the
+    // report costs one open regardless of lane count
+    std::string tempPath = statusPath + ".tmp";
+
+    // With the async queue up, hand the report to SDL and return
+    // immediately; the ingestion thread drives the remaining
+    // write -> flush-close -> rename stages, so the caller never waits
+    // on the filesystem
+    if (asyncIOQueue && watcherRunning.load()) {
+        if (statusWrite.inFlight.load()) {
+            // Previous report still in flight (filesystem is struggling);
+            // keep accumulating and retry at the next interval
+            return;
+        }
+
+        SDL_AsyncIO* io = SDL_AsyncIOFromFile(tempPath.c_str(), "w");
+        if (io) {
+            statusWrite.payload.swap(statusBuffer);
+            statusBuffer.clear();
+            statusWrite.tempPath = tempPath;
+            statusWrite.finalPath = statusPath;
+            statusWrite.io = io;
+            statusWrite.inFlight.store(true);
+            if (SDL_WriteAsyncIO(io, statusWrite.payload.data(), 0,
+                                 statusWrite.payload.size(), asyncIOQueue,
+                                 &statusWrite)) {
+                return;
+            }
+
+            // Couldn't queue the write; reclaim the buffer and fall
+            // through to the blocking path (null userdata keeps the
+            // close out of the status chain)
+            statusBuffer.swap(statusWrite.payload);
+            statusWrite.io = nullptr;
+            statusWrite.inFlight.store(false);
+            SDL_CloseAsyncIO(io, false, asyncIOQueue, nullptr);
+        }
+    }
+
+    std::ofstream file(tempPath, std::ios::trunc);
+    if (!file.is_open()) {
+        DebugLogger::log("Warning: Could not open lane status temp file for writing",
                        DebugLogger::LogLevel::WARNING);
+        statusBuffer.clear();
+        return;
+    }
+    file << statusBuffer;
+    file.close();
+
+    std::error_code renameError;
+    fs::rename(tempPath, statusPath, renameError);
+    if (renameError) {
+        DebugLogger::log("Failed to publish lane status file: " + renameError.message(),
+                       DebugLogger::LogLevel::ERROR);
     }
+
+    statusBuffer.clear();
+}
+
+uint32_t FileHandler::statusWriteIntervalMs() {
+    // Checked once; monitoring cadence rarely changes mid-run
+    static const uint32_t interval = []() {
+        const char* env = std::getenv("TRAFFIC_STATUS_INTERVAL_MS");
+        if (env) {
+            long value = std::strtol(env, nullptr, 10);
+            if (value > 0) {
+                return static_cast<uint32_t>(value);
+            }
+        }
+        return 5000u;
+    }();
+    return interval;
 }
 
 bool FileHandler::checkFilesExist() {
-    // Make sure data directory exists
+    // Only the data directory is persistent now: under the rename-swap
+    // protocol a lane file exists exactly while a published batch waits
+    // to be claimed, so its absence is the normal idle state
     if (!fs::exists(dataPath)) {
         DebugLogger::log("Data directory doesn't exist: " + dataPath, DebugLogger::LogLevel::WARNING);
         return false;
     }
 
-    // Check for lane files
-    bool allFilesExist = true;
-    for (char laneId : {'A', 'B', 'C', 'D'}) {
-        std::string filePath = getLaneFilePath(laneId);
-        if (!fs::exists(filePath)) {
-            DebugLogger::log("Lane file doesn't exist: " + filePath, DebugLogger::LogLevel::WARNING);
-            allFilesExist = false;
-        }
-    }
-
-    return allFilesExist;
+    return true;
 }
 
 bool FileHandler::initializeFiles() {
@@ -273,19 +1105,19 @@ bool FileHandler::initializeFiles() {
             DebugLogger::log("Created directory: " + dataPath);
         }
 
-        // Create lane files if they don't exist
+        // Under the rename-swap protocol the published lane file only
+        // exists while a batch is waiting, so nothing is pre-created;
+        // just clear leftovers from a previous run (stale batches and
+        // claims a crashed reader never consumed)
         for (char laneId : {'A', 'B', 'C', 'D'}) {
             std::string filePath = getLaneFilePath(laneId);
-            if (!fs::exists(filePath)) {
-                std::ofstream file(filePath);
-                if (!file.is_open()) {
-                    DebugLogger::log("Error: Failed to create file " + filePath,
-                                   DebugLogger::LogLevel::ERROR);
-                    return false;
-                }
-                file.close();
-                DebugLogger::log("Created file: " + filePath);
-            }
+            std::error_code removeError;
+            fs::remove(filePath, removeError);
+            fs::remove(filePath + ".claim", removeError);
+            // A previous run's append log would replay its whole
+            // session; remove it and start the cursor at zero
+            fs::remove(getAppendLogPath(laneId), removeError);
+            logCursor[laneId - 'A'] = 0;
         }
 
         // Create or clear lane status file
@@ -309,9 +1141,19 @@ bool FileHandler::initializeFiles() {
 }
 
 std::string FileHandler::getLaneFilePath(char laneId) const {
+    // Binary records live in .bin files so the two formats never mix
+    if (binaryFormatEnabled()) {
+        return dataPath + "/lane" + laneId + ".bin";
+    }
     return dataPath + "/lane" + laneId + ".txt";
 }
 
 std::string FileHandler::getLaneStatusFilePath() const {
     return dataPath + "/lane_status.txt";
 }
+
+std::string FileHandler::getAppendLogPath(char laneId) const {
+    // One log per lane regardless of format; the cursor, not the
+    // extension, is what frames the content
+    return dataPath + "/lane" + laneId + ".log";
+}
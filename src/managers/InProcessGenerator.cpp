@@ -0,0 +1,190 @@
+// FILE: src/managers/InProcessGenerator.cpp
+#include "managers/InProcessGenerator.h"
+#include "utils/DebugLogger.h"
+#include "utils/TuningConfig.h"
+#include "utils/VehiclePool.h"
+#include <chrono>
+#include <string>
+
+InProcessGenerator::InProcessGenerator()
+    : spawnEnqueuePos(0),
+      spawnDequeuePos(0),
+      running(false),
+      rng(std::random_device{}()),
+      nextVehicleNumber(1) {
+
+    for (size_t i = 0; i < SPAWN_RING_SIZE; i++) {
+        spawnRing[i].sequence.store(i, std::memory_order_relaxed);
+        spawnRing[i].vehicle = nullptr;
+    }
+
+    DebugLogger::log("InProcessGenerator created");
+}
+
+InProcessGenerator::~InProcessGenerator() {
+    stop();
+
+    // Anything spawned but never drained still belongs to the pool
+    while (Vehicle* vehicle = tryDequeue()) {
+        VehiclePool::release(vehicle);
+    }
+
+    DebugLogger::log("InProcessGenerator destroyed");
+}
+
+bool InProcessGenerator::start(const std::vector<Lane*>& simulationLanes) {
+    if (running.load()) {
+        return true;
+    }
+
+    lanes = simulationLanes;
+    running = true;
+    spawnThread = std::thread(&InProcessGenerator::generatorLoop, this);
+
+    DebugLogger::log("In-process generation started (no filesystem round-trip)");
+    return true;
+}
+
+void InProcessGenerator::stop() {
+    if (!running.load()) {
+        return;
+    }
+
+    running = false;
+    if (spawnThread.joinable()) {
+        spawnThread.join();
+    }
+
+    DebugLogger::log("In-process generation stopped");
+}
+
+bool InProcessGenerator::isRunning() const {
+    return running.load();
+}
+
+bool InProcessGenerator::tryEnqueue(Vehicle* vehicle) {
+    size_t pos = spawnEnqueuePos.load(std::memory_order_relaxed);
+    for (;;) {
+        SpawnCell& cell = spawnRing[pos & (SPAWN_RING_SIZE - 1)];
+        size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+        if (diff == 0) {
+            if (spawnEnqueuePos.compare_exchange_weak(pos, pos + 1,
+                                                      std::memory_order_relaxed)) {
+                cell.vehicle = vehicle;
+                cell.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            return false; // Ring full
+        } else {
+            pos = spawnEnqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+Vehicle* InProcessGenerator::tryDequeue() {
+    size_t pos = spawnDequeuePos.load(std::memory_order_relaxed);
+    SpawnCell& cell = spawnRing[pos & (SPAWN_RING_SIZE - 1)];
+    size_t sequence = cell.sequence.load(std::memory_order_acquire);
+    if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1) < 0) {
+        return nullptr; // Empty
+    }
+
+    Vehicle* vehicle = cell.vehicle;
+    cell.vehicle = nullptr;
+    cell.sequence.store(pos + SPAWN_RING_SIZE, std::memory_order_release);
+    spawnDequeuePos.store(pos + 1, std::memory_order_relaxed);
+    return vehicle;
+}
+
+std::vector<Vehicle*> InProcessGenerator::drainSpawned() {
+    std::vector<Vehicle*> spawned;
+    while (Vehicle* vehicle = tryDequeue()) {
+        spawned.push_back(vehicle);
+    }
+    return spawned;
+}
+
+void InProcessGenerator::spawnVehicle(char lane, int laneNumber, bool straight) {
+    // Same encoded label the lane-file format carries; Vehicle's parser
+    // derives the turn from it exactly as it does for file spawns
+    std::string fullId = "V" + std::to_string(nextVehicleNumber++) +
+                         "_L" + std::to_string(laneNumber);
+    if (laneNumber == 3) {
+        fullId += "_LEFT"; // Lane 3 always turns left
+    } else if (laneNumber == 2) {
+        fullId += straight ? "_STRAIGHT" : "_LEFT";
+    }
+
+    Vehicle* vehicle = VehiclePool::acquire(fullId, lane, laneNumber);
+
+    // A full ring means the simulation is behind by a whole ring's
+    // worth; wait it out rather than dropping a pool-owned vehicle
+    while (!tryEnqueue(vehicle)) {
+        if (!running.load()) {
+            VehiclePool::release(vehicle);
+            return;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+int InProcessGenerator::vehiclesInSystem() const {
+    // Lane counts are read cross-thread the same way the renderer reads
+    // them; staged-but-undrained spawns count against the cap too
+    int total = 0;
+    for (const Lane* lane : lanes) {
+        total += lane->getVehicleCount();
+    }
+
+    size_t enqueued = spawnEnqueuePos.load(std::memory_order_relaxed);
+    size_t dequeued = spawnDequeuePos.load(std::memory_order_relaxed);
+    total += static_cast<int>(enqueued - dequeued);
+
+    return total;
+}
+
+void InProcessGenerator::sleepMs(int ms) {
+    for (int waited = 0; waited < ms && running.load(); waited += 10) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+}
+
+void InProcessGenerator::generatorLoop() {
+    // Same spawn model as the external generator (traffic_generator.cpp):
+    // an initial A2 burst to exercise the priority path, then continuous
+    // flow with the usual lane/direction biases and interval jitter
+    std::uniform_int_distribution<int> roadDist(0, 3);
+    std::uniform_real_distribution<double> delayDist(0.7, 1.3);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+    for (int i = 0; i < PRIORITY_SEED_COUNT && running.load(); i++) {
+        spawnVehicle('A', 2, i % 2 == 0);
+        sleepMs(static_cast<int>(
+            TuningConfig::getSpawnIntervalMs() * delayDist(rng)));
+    }
+
+    while (running.load()) {
+        if (vehiclesInSystem() < MAX_TOTAL_VEHICLES) {
+            char lane = static_cast<char>('A' + roadDist(rng));
+            int laneNumber = (uniform(rng) < 0.6) ? 2 : 3;
+            bool straight = (laneNumber == 2) && (uniform(rng) < 0.6);
+
+            // Occasional A2 bias / forced lane 3, as in pick_spawn()
+            if (rng() % 10 == 0) {
+                lane = 'A';
+                laneNumber = 2;
+                straight = (rng() % 2 == 0);
+            } else if (rng() % 15 == 0) {
+                laneNumber = 3;
+                straight = false;
+            }
+
+            spawnVehicle(lane, laneNumber, straight);
+        }
+
+        sleepMs(static_cast<int>(
+            TuningConfig::getSpawnIntervalMs() * delayDist(rng)));
+    }
+}
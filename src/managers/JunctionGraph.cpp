@@ -0,0 +1,312 @@
+// FILE: src/managers/JunctionGraph.cpp
+#include "managers/JunctionGraph.h"
+#include "utils/DebugLogger.h"
+#include "utils/VehicleIdRegistry.h"
+#include "utils/VehiclePool.h"
+
+#include <sstream>
+#include <string>
+
+JunctionGraph::JunctionGraph(int junctionCount) {
+    if (junctionCount < 1) {
+        junctionCount = 1;
+    }
+
+    // Build the junctions, each with the same 4x3 lane layout and its
+    // own light wired to its own lanes
+    junctions.reserve(junctionCount);
+    for (int j = 0; j < junctionCount; j++) {
+        auto junction = std::make_unique<Junction>();
+        junction->id = j;
+        junction->light = new TrafficLight();
+
+        for (char road : {'A', 'B', 'C', 'D'}) {
+            for (int laneNum = 1; laneNum <= 3; laneNum++) {
+                Lane* lane = new Lane(road, laneNum);
+                lane->setCountObserver(junction->light);
+                junction->lanes.push_back(lane);
+            }
+        }
+
+        junctions.push_back(std::move(junction));
+    }
+
+    // Wire the corridor: one mailbox per directed edge between neighbors
+    for (size_t j = 0; j + 1 < junctions.size(); j++) {
+        auto eastbound = std::make_unique<Mailbox>(); // j -> j+1
+        auto westbound = std::make_unique<Mailbox>(); // j+1 -> j
+
+        junctions[j + 1]->fromWest = eastbound.get();
+        junctions[j]->fromEast = westbound.get();
+
+        mailboxes.push_back(std::move(eastbound));
+        mailboxes.push_back(std::move(westbound));
+    }
+
+    std::ostringstream oss;
+    oss << "JunctionGraph created with " << junctions.size() << " junctions";
+    DebugLogger::log(oss.str());
+}
+
+JunctionGraph::~JunctionGraph() {
+    stop();
+
+    for (auto& junction : junctions) {
+        for (auto* lane : junction->lanes) {
+            delete lane;
+        }
+        delete junction->light;
+    }
+}
+
+void JunctionGraph::start(unsigned workerCount) {
+    if (running.load()) {
+        return;
+    }
+    running.store(true);
+
+    for (unsigned i = 0; i < workerCount; i++) {
+        workers.emplace_back(&JunctionGraph::workerLoop, this);
+    }
+
+    std::ostringstream oss;
+    oss << "JunctionGraph started with " << workerCount << " workers";
+    DebugLogger::log(oss.str());
+}
+
+void JunctionGraph::stop() {
+    if (!running.exchange(false)) {
+        return;
+    }
+
+    for (auto& worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    workers.clear();
+
+    DebugLogger::log("JunctionGraph stopped");
+}
+
+void JunctionGraph::attachBoundaryLinks(CorridorLink* west, CorridorLink* east) {
+    westLink = west;
+    eastLink = east;
+}
+
+void JunctionGraph::tick(uint32_t delta) {
+    // Admit vehicles that arrived from neighboring slices since the
+    // last tick; this runs on the caller before the tick is published,
+    // so the boundary junctions aren't being stepped concurrently
+    CorridorLink::WireHandoff wire;
+    if (westLink) {
+        while (westLink->popInbound(wire)) {
+            admitWire(*junctions.front(), wire, 'D');
+        }
+    }
+    if (eastLink) {
+        while (eastLink->popInbound(wire)) {
+            admitWire(*junctions.back(), wire, 'B');
+        }
+    }
+
+    tickDelta = delta;
+    nextJunction.store(0, std::memory_order_relaxed);
+    pendingJunctions.store(junctions.size(), std::memory_order_relaxed);
+
+    // Publish the new tick to the workers, then join in ourselves -
+    // the shared cursor hands each junction to exactly one thread
+    tickGeneration.fetch_add(1, std::memory_order_release);
+    drainJunctions();
+
+    // The cursor may be exhausted while workers are still finishing
+    // their last junctions
+    while (pendingJunctions.load(std::memory_order_acquire) != 0) {
+        std::this_thread::yield();
+    }
+
+    // One serialized frame per link per tick, however many vehicles
+    // crossed the boundary
+    if (westLink) {
+        westLink->flush();
+    }
+    if (eastLink) {
+        eastLink->flush();
+    }
+}
+
+void JunctionGraph::workerLoop() {
+    uint64_t seenGeneration = tickGeneration.load(std::memory_order_acquire);
+
+    while (running.load(std::memory_order_relaxed)) {
+        uint64_t generation = tickGeneration.load(std::memory_order_acquire);
+        if (generation == seenGeneration) {
+            std::this_thread::yield();
+            continue;
+        }
+        seenGeneration = generation;
+        drainJunctions();
+    }
+}
+
+void JunctionGraph::drainJunctions() {
+    for (;;) {
+        size_t index = nextJunction.fetch_add(1, std::memory_order_relaxed);
+        if (index >= junctions.size()) {
+            return;
+        }
+        stepJunction(*junctions[index], tickDelta);
+        pendingJunctions.fetch_sub(1, std::memory_order_release);
+    }
+}
+
+void JunctionGraph::stepJunction(Junction& junction, uint32_t delta) {
+    // Admit vehicles handed off by the neighbors since our last step
+    Handoff handoff;
+    if (junction.fromWest) {
+        while (junction.fromWest->pop(handoff)) {
+            admit(junction, handoff, 'D'); // Arrived from the west: enter on the west road
+        }
+    }
+    if (junction.fromEast) {
+        while (junction.fromEast->pop(handoff)) {
+            admit(junction, handoff, 'B'); // Arrived from the east: enter on the east road
+        }
+    }
+
+    junction.light->update(junction.lanes);
+
+    // Same movement rules as TrafficManager::processVehicles()
+    uint8_t greenMask =
+        TrafficLight::greenRoadMask(junction.light->getCurrentState());
+
+    for (auto* lane : junction.lanes) {
+        bool isGreenLight =
+            ((greenMask >> (lane->getLaneId() - 'A')) & 1) ||
+            (lane->getLaneNumber() == 3); // Free lane always moves
+
+        lane->forEachVehicle([&](Vehicle* vehicle) {
+            if (vehicle) {
+                vehicle->update(delta, isGreenLight, 0.0f);
+            }
+        });
+    }
+
+    // Retire or hand off vehicles that left this junction's screen area
+    for (auto* lane : junction.lanes) {
+        while (!lane->isEmpty()) {
+            Vehicle* vehicle = lane->peek();
+            if (!vehicle || !vehicle->hasExited()) {
+                break;
+            }
+            lane->dequeue();
+
+            // The lane letter at exit names the side the vehicle left
+            // on: B is the east edge, D the west edge. North/south
+            // exits leave the corridor entirely.
+            char exitSide = vehicle->getLane();
+            Mailbox* outbound = nullptr;
+            if (exitSide == 'B') {
+                if (junction.id + 1 < static_cast<int>(junctions.size())) {
+                    outbound = junctions[junction.id + 1]->fromWest;
+                } else if (eastLink) {
+                    // East end of this slice: hand off to the next
+                    // process (only this junction's worker touches the
+                    // link during a tick)
+                    eastLink->queueHandoff(vehicle->getLabel(),
+                                           vehicle->isEmergencyVehicle());
+                }
+            } else if (exitSide == 'D') {
+                if (junction.id > 0) {
+                    outbound = junctions[junction.id - 1]->fromEast;
+                } else if (westLink) {
+                    westLink->queueHandoff(vehicle->getLabel(),
+                                           vehicle->isEmergencyVehicle());
+                }
+            }
+
+            if (outbound) {
+                Handoff out{vehicle->getId(), vehicle->isEmergencyVehicle()};
+                if (!outbound->push(out)) {
+                    droppedHandoffs.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+
+            VehiclePool::release(vehicle);
+        }
+    }
+}
+
+void JunctionGraph::admit(Junction& junction, const Handoff& handoff, char road) {
+    // Entry alternates between the two spawnable lanes so a saturated
+    // corridor loads both
+    int laneNumber = (handoff.id % 2 == 0) ? 2 : 3;
+
+    Lane* lane = findLane(junction, road, laneNumber);
+    if (!lane) {
+        return;
+    }
+
+    // Respawn under the same label; the pool interns it again for the
+    // new junction's leg of the trip
+    Vehicle* vehicle = VehiclePool::acquire(VehicleIdRegistry::label(handoff.id),
+                                            road, laneNumber, handoff.emergency);
+    lane->enqueue(vehicle);
+}
+
+void JunctionGraph::admitWire(Junction& junction,
+                              const CorridorLink::WireHandoff& wire,
+                              char road) {
+    // Wire handoffs carry no interned id, so entry alternates by a
+    // plain toggle instead of id parity
+    int laneNumber = (wireAdmitToggle++ % 2 == 0) ? 2 : 3;
+
+    Lane* lane = findLane(junction, road, laneNumber);
+    if (!lane) {
+        return;
+    }
+
+    lane->enqueue(VehiclePool::acquire(wire.label, road, laneNumber,
+                                       wire.emergency != 0));
+}
+
+void JunctionGraph::seed(int vehiclesPerLane) {
+    int spawned = 0;
+    for (auto& junction : junctions) {
+        for (auto* lane : junction->lanes) {
+            if (lane->getLaneNumber() == 1) {
+                continue; // Lane 1 is incoming-only
+            }
+            for (int i = 0; i < vehiclesPerLane; i++) {
+                std::string label = "J" + std::to_string(junction->id) +
+                                    "V" + std::to_string(spawned++) +
+                                    "_L" + std::to_string(lane->getLaneNumber());
+                lane->enqueue(VehiclePool::acquire(label, lane->getLaneId(),
+                                                   lane->getLaneNumber()));
+            }
+        }
+    }
+}
+
+size_t JunctionGraph::totalVehicleCount() const {
+    size_t total = 0;
+    for (const auto& junction : junctions) {
+        for (const auto* lane : junction->lanes) {
+            total += lane->getVehicleCount();
+        }
+    }
+    return total;
+}
+
+uint64_t JunctionGraph::getDroppedHandoffs() const {
+    return droppedHandoffs.load(std::memory_order_relaxed);
+}
+
+Lane* JunctionGraph::findLane(Junction& junction, char laneId, int laneNumber) const {
+    for (auto* lane : junction.lanes) {
+        if (lane->getLaneId() == laneId && lane->getLaneNumber() == laneNumber) {
+            return lane;
+        }
+    }
+    return nullptr;
+}
@@ -0,0 +1,211 @@
+// FILE: src/managers/ScenarioEngine.cpp
+#include "managers/ScenarioEngine.h"
+#include "utils/DebugLogger.h"
+
+#include <sstream>
+#include <utility>
+
+ScenarioEngine::Script::Script(std::string name)
+    : name(std::move(name)) {
+}
+
+ScenarioEngine::Script& ScenarioEngine::Script::at(uint32_t timeMs, Action action) {
+    Step step;
+    step.isExpect = false;
+    step.absolute = true;
+    step.timeMs = timeMs;
+    step.repeatCount = 1;
+    step.action = std::move(action);
+    step.deadlineMs = 0;
+    steps.push_back(std::move(step));
+    return *this;
+}
+
+ScenarioEngine::Script& ScenarioEngine::Script::after(uint32_t delayMs, Action action) {
+    Step step;
+    step.isExpect = false;
+    step.absolute = false;
+    step.timeMs = delayMs;
+    step.repeatCount = 1;
+    step.action = std::move(action);
+    step.deadlineMs = 0;
+    steps.push_back(std::move(step));
+    return *this;
+}
+
+ScenarioEngine::Script& ScenarioEngine::Script::every(uint32_t intervalMs,
+                                                      uint32_t repeatCount,
+                                                      Action action) {
+    Step step;
+    step.isExpect = false;
+    step.absolute = false;
+    step.timeMs = intervalMs;
+    step.repeatCount = repeatCount > 0 ? repeatCount : 1;
+    step.action = std::move(action);
+    step.deadlineMs = 0;
+    steps.push_back(std::move(step));
+    return *this;
+}
+
+ScenarioEngine::Script& ScenarioEngine::Script::expectWithin(uint32_t deadlineMs,
+                                                             Predicate condition,
+                                                             std::string description) {
+    Step step;
+    step.isExpect = true;
+    step.absolute = false;
+    step.timeMs = 0;
+    step.repeatCount = 1;
+    step.condition = std::move(condition);
+    step.deadlineMs = deadlineMs;
+    step.description = std::move(description);
+    steps.push_back(std::move(step));
+    return *this;
+}
+
+void ScenarioEngine::add(Script script) {
+    ScriptState state;
+    state.name = std::move(script.name);
+    state.steps = std::move(script.steps);
+    state.nextStep = 0;
+    state.repeatsLeft = 0;
+    state.expectDeadline = 0;
+    state.scheduled = false;
+    state.failed = false;
+    state.done = false;
+    scripts.push_back(std::move(state));
+}
+
+void ScenarioEngine::update(uint32_t nowMs, TrafficManager& manager) {
+    if (!baselineSet) {
+        baselineMs = nowMs;
+        baselineSet = true;
+    }
+
+    // Seed the wake for any script added since the last tick
+    for (size_t i = 0; i < scripts.size(); i++) {
+        if (!scripts[i].scheduled) {
+            scripts[i].scheduled = true;
+            scheduleCurrentStep(i, nowMs);
+        }
+    }
+
+    // Resume everything that came due, as one batch; scripts with no
+    // pending wake this tick cost nothing
+    Context context{manager, nowMs};
+    while (!wakeQueue.empty() && wakeQueue.top().wakeMs <= nowMs) {
+        size_t scriptIndex = wakeQueue.top().scriptIndex;
+        wakeQueue.pop();
+        resumeScript(scriptIndex, context);
+    }
+}
+
+void ScenarioEngine::resumeScript(size_t scriptIndex, Context& context) {
+    ScriptState& state = scripts[scriptIndex];
+    if (state.done || state.nextStep >= state.steps.size()) {
+        return;
+    }
+
+    const Script::Step& step = state.steps[state.nextStep];
+
+    if (step.isExpect) {
+        if (step.condition && step.condition(context)) {
+            passed++;
+        } else if (context.nowMs >= state.expectDeadline) {
+            failedCount++;
+            state.failed = true;
+            state.done = true;
+            DebugLogger::log("Scenario '" + state.name + "' FAILED: " +
+                           step.description + " (not met within " +
+                           std::to_string(step.deadlineMs) + "ms)",
+                           DebugLogger::LogLevel::ERROR);
+            return;
+        } else {
+            // Still inside the budget: recheck on the coarse cadence
+            // instead of every tick
+            uint32_t recheck = context.nowMs + EXPECT_RECHECK_MS;
+            if (recheck > state.expectDeadline) {
+                recheck = state.expectDeadline;
+            }
+            wakeQueue.push({recheck, scriptIndex});
+            return;
+        }
+    } else {
+        if (state.repeatsLeft == 0) {
+            state.repeatsLeft = step.repeatCount;
+        }
+        if (step.action) {
+            step.action(context);
+        }
+        state.repeatsLeft--;
+        if (state.repeatsLeft > 0) {
+            wakeQueue.push({context.nowMs + step.timeMs, scriptIndex});
+            return;
+        }
+    }
+
+    state.nextStep++;
+    scheduleCurrentStep(scriptIndex, context.nowMs);
+}
+
+void ScenarioEngine::scheduleCurrentStep(size_t scriptIndex, uint32_t nowMs) {
+    ScriptState& state = scripts[scriptIndex];
+    if (state.nextStep >= state.steps.size()) {
+        state.done = true;
+        DebugLogger::log("Scenario '" + state.name + "' completed");
+        return;
+    }
+
+    const Script::Step& step = state.steps[state.nextStep];
+    uint32_t wake;
+
+    if (step.isExpect) {
+        // The deadline runs from the previous step's completion; the
+        // first check happens right away
+        state.expectDeadline = nowMs + step.deadlineMs;
+        wake = nowMs;
+    } else if (step.absolute) {
+        uint32_t target = baselineMs + step.timeMs;
+        wake = target > nowMs ? target : nowMs;
+    } else if (step.repeatCount > 1) {
+        // every(): the first repetition runs immediately, the interval
+        // paces the rest
+        wake = nowMs;
+    } else {
+        wake = nowMs + step.timeMs;
+    }
+
+    wakeQueue.push({wake, scriptIndex});
+}
+
+bool ScenarioEngine::finished() const {
+    for (const auto& state : scripts) {
+        if (!state.done) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t ScenarioEngine::passedAssertions() const {
+    return passed;
+}
+
+size_t ScenarioEngine::failedAssertions() const {
+    return failedCount;
+}
+
+void ScenarioEngine::logSummary() const {
+    for (const auto& state : scripts) {
+        std::string verdict = state.failed ? "FAILED"
+                            : state.done  ? "passed"
+                                          : "still running";
+        DebugLogger::log("Scenario '" + state.name + "': " + verdict,
+                       state.failed ? DebugLogger::LogLevel::ERROR
+                                    : DebugLogger::LogLevel::INFO);
+    }
+
+    std::ostringstream oss;
+    oss << "Scenario assertions: " << passed << " passed, "
+        << failedCount << " failed across " << scripts.size() << " scripts";
+    DebugLogger::log(oss.str());
+}
@@ -0,0 +1,205 @@
+// FILE: src/managers/SimulationStats.cpp
+#include "managers/SimulationStats.h"
+
+#include <cstring>
+
+SimulationStats::SimulationStats()
+    : totalArrivals(0),
+      totalDepartures(0),
+      totalRejected(0),
+      windowStartMs(0),
+      version(0),
+      depthHead(0),
+      depthCount(0),
+      depthGeneration(0) {
+    memset(laneCounters, 0, sizeof(laneCounters));
+    memset(waitHistogram, 0, sizeof(waitHistogram));
+    memset(depthHistory, 0, sizeof(depthHistory));
+    memory = {};
+}
+
+int SimulationStats::slotFor(char laneId, int laneNumber) {
+    int road = laneId - 'A';
+    int lane = laneNumber - 1;
+    if (road < 0 || road > 3 || lane < 0 || lane > 2) {
+        return 0; // Malformed ids fold into A1 rather than indexing wild
+    }
+    return road * 3 + lane;
+}
+
+void SimulationStats::rollWindow(uint64_t simTimeMs) {
+    const uint64_t WINDOW_MS = 60000;
+
+    if (simTimeMs - windowStartMs < WINDOW_MS) {
+        return;
+    }
+
+    // If more than one window elapsed (fast-forward, long idle), the
+    // intermediate windows saw no events - the latest completed one is
+    // whatever accumulated, the rest are zero, so a single close-out
+    // after a gap reports zero rates, which is accurate
+    bool singleWindow = (simTimeMs - windowStartMs < 2 * WINDOW_MS);
+
+    for (auto& counters : laneCounters) {
+        counters.lastArrivalsPerMin =
+            singleWindow ? static_cast<float>(counters.windowArrivals) : 0.0f;
+        counters.lastDeparturesPerMin =
+            singleWindow ? static_cast<float>(counters.windowDepartures) : 0.0f;
+        counters.windowArrivals = 0;
+        counters.windowDepartures = 0;
+    }
+
+    // Realign to the window grid so scale changes don't drift it
+    windowStartMs = simTimeMs - (simTimeMs - windowStartMs) % WINDOW_MS;
+    version++;
+}
+
+void SimulationStats::recordArrival(char laneId, int laneNumber,
+                                    int laneCount, bool priorityActive,
+                                    uint64_t simTimeMs) {
+    std::lock_guard<std::mutex> lock(statsMutex);
+    rollWindow(simTimeMs);
+
+    LaneCounters& counters = laneCounters[slotFor(laneId, laneNumber)];
+    counters.count = laneCount;
+    counters.priorityActive = priorityActive;
+    counters.arrivals++;
+    counters.windowArrivals++;
+
+    totalArrivals++;
+    version++;
+}
+
+void SimulationStats::recordDeparture(char laneId, int laneNumber,
+                                      int laneCount, bool priorityActive,
+                                      uint64_t simTimeMs,
+                                      uint32_t waitSeconds) {
+    std::lock_guard<std::mutex> lock(statsMutex);
+    rollWindow(simTimeMs);
+
+    LaneCounters& counters = laneCounters[slotFor(laneId, laneNumber)];
+    counters.count = laneCount;
+    counters.priorityActive = priorityActive;
+    counters.departures++;
+    counters.windowDepartures++;
+
+    if (waitSeconds >= WAIT_BUCKETS) {
+        waitSeconds = WAIT_BUCKETS - 1;
+    }
+    waitHistogram[waitSeconds]++;
+
+    totalDepartures++;
+    version++;
+}
+
+void SimulationStats::recordSpawnLatency(uint64_t totalUs, uint64_t transportUs,
+                                         uint64_t stageUs) {
+    std::lock_guard<std::mutex> lock(statsMutex);
+
+    spawnTotal.record(totalUs);
+    spawnTransport.record(transportUs);
+    spawnStage.record(stageUs);
+    version++;
+}
+
+void SimulationStats::recordRejectedSpawn(char laneId, int laneNumber) {
+    std::lock_guard<std::mutex> lock(statsMutex);
+
+    laneCounters[slotFor(laneId, laneNumber)].rejected++;
+    totalRejected++;
+    version++;
+}
+
+void SimulationStats::recordMemory(const MemoryRow& row) {
+    std::lock_guard<std::mutex> lock(statsMutex);
+    memory = row;
+    version++;
+}
+
+void SimulationStats::sampleDepths() {
+    std::lock_guard<std::mutex> lock(statsMutex);
+
+    for (int slot = 0; slot < LANE_SLOTS; slot++) {
+        int count = laneCounters[slot].count;
+        depthHistory[slot][depthHead] =
+            static_cast<uint8_t>(count < 255 ? count : 255);
+    }
+    depthHead = (depthHead + 1) % DEPTH_HISTORY;
+    if (depthCount < DEPTH_HISTORY) {
+        depthCount++;
+    }
+
+    // Deliberately not bumping `version`: the formatted overlay text
+    // did not change, only the history did
+    depthGeneration++;
+}
+
+uint64_t SimulationStats::getDepthGeneration() const {
+    std::lock_guard<std::mutex> lock(statsMutex);
+    return depthGeneration;
+}
+
+uint64_t SimulationStats::getVersion() const {
+    std::lock_guard<std::mutex> lock(statsMutex);
+    return version;
+}
+
+float SimulationStats::percentileLocked(float fraction) const {
+    if (totalDepartures == 0) {
+        return 0.0f;
+    }
+
+    uint64_t target = static_cast<uint64_t>(fraction * totalDepartures);
+    uint64_t seen = 0;
+    for (int bucket = 0; bucket < WAIT_BUCKETS; bucket++) {
+        seen += waitHistogram[bucket];
+        if (seen > target) {
+            return static_cast<float>(bucket);
+        }
+    }
+    return static_cast<float>(WAIT_BUCKETS - 1);
+}
+
+SimulationStats::Snapshot SimulationStats::getSnapshot() {
+    std::lock_guard<std::mutex> lock(statsMutex);
+
+    Snapshot snap = {};
+    for (int slot = 0; slot < LANE_SLOTS; slot++) {
+        const LaneCounters& counters = laneCounters[slot];
+        LaneRow& row = snap.lanes[slot];
+        row.laneId = static_cast<char>('A' + slot / 3);
+        row.laneNumber = slot % 3 + 1;
+        row.count = counters.count;
+        row.priorityActive = counters.priorityActive;
+        row.arrivalsPerMin = counters.lastArrivalsPerMin;
+        row.departuresPerMin = counters.lastDeparturesPerMin;
+        snap.totalVehicles += counters.count;
+    }
+    snap.totalArrivals = totalArrivals;
+    snap.totalDepartures = totalDepartures;
+    snap.totalRejected = totalRejected;
+    snap.waitP50 = percentileLocked(0.50f);
+    snap.waitP90 = percentileLocked(0.90f);
+    snap.waitP99 = percentileLocked(0.99f);
+    snap.spawnSamples = spawnTotal.totalCount();
+    snap.spawnP50Ms = static_cast<float>(spawnTotal.quantileMs(0.50)) / 1000.0f;
+    snap.spawnP99Ms = static_cast<float>(spawnTotal.quantileMs(0.99)) / 1000.0f;
+    snap.spawnTransportP99Ms =
+        static_cast<float>(spawnTransport.quantileMs(0.99)) / 1000.0f;
+    snap.spawnStageP99Ms =
+        static_cast<float>(spawnStage.quantileMs(0.99)) / 1000.0f;
+    snap.memory = memory;
+    // Unroll the history ring oldest-first so the overlay can paint
+    // columns left to right without ring arithmetic
+    snap.depthSamples = depthCount;
+    snap.depthGeneration = depthGeneration;
+    int oldest = (depthHead + DEPTH_HISTORY - depthCount) % DEPTH_HISTORY;
+    for (int slot = 0; slot < LANE_SLOTS; slot++) {
+        for (int i = 0; i < depthCount; i++) {
+            snap.depth[slot][i] =
+                depthHistory[slot][(oldest + i) % DEPTH_HISTORY];
+        }
+    }
+    snap.version = version;
+    return snap;
+}
@@ -1,17 +1,94 @@
 // FILE: src/managers/TrafficManager.cpp
 #include "managers/TrafficManager.h"
 #include "utils/DebugLogger.h"
+#include "utils/FrameClock.h"
+#include "utils/TuningConfig.h"
+#include "utils/VehiclePool.h"
+#include "utils/Profiler.h"
 #include <sstream>
 #include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
 #include <wchar.h>
+#ifdef __linux__
+#include <unistd.h>
+#endif
 #include "core/Constants.h"
+#include "core/VehicleStateStore.h"
+
+namespace {
+
+// Resident set size in KB from /proc (Linux); other platforms report 0
+// rather than guessing
+size_t readRssKb() {
+#ifdef __linux__
+    FILE* file = fopen("/proc/self/statm", "r");
+    if (!file) {
+        return 0;
+    }
+    long total = 0;
+    long resident = 0;
+    int matched = fscanf(file, "%ld %ld", &total, &resident);
+    fclose(file);
+    if (matched != 2) {
+        return 0;
+    }
+    return static_cast<size_t>(resident) *
+           static_cast<size_t>(sysconf(_SC_PAGESIZE)) / 1024;
+#else
+    return 0;
+#endif
+}
+
+} // namespace
 
 TrafficManager::TrafficManager()
     : trafficLight(nullptr),
+      priorityLaneA2(nullptr),
+      parallelLanes(false),
+      taskPool(nullptr),
+      recycleVehicles(false),
+      recycleLaneId(0),
+      recycleLaneNumber(0),
+      recycleCursor(0),
       fileHandler(nullptr),
+      inProcessGenerator(nullptr),
+      scenarioEngine(nullptr),
+      priorityLaneMask(0),
+      activeLaneMask(0x0FFF), // Every lane gets one startup sweep
+      lastMovableMask(0),
+      running(false),
       lastFileCheckTime(0),
+      lastWaitExportTime(0),
+      lastStatusWriteTime(0),
       lastPriorityUpdateTime(0),
-      running(false) {
+      timeScale(1),
+      simTimeMs(0),
+      deterministicClock(false),
+      journalRecording(false),
+      journalReplaying(false),
+      replayCursor(0),
+      lastJournaledLightState(TrafficLight::State::ALL_RED),
+      scheduleStreaming(false),
+      scheduleCursor(0),
+      lastKeyframeTime(0),
+      statsTapeEnabled(false),
+      tapeSample{},
+      lastMetricsPublishTime(0),
+      lastMemorySampleTime(0),
+      shedLevel(0),
+      tickCounter(0),
+      ticksUnderBudget(0),
+      shedOverlapPasses(0),
+      shedStatusWrites(0),
+      shedExports(0),
+      statusDeadlines(0),
+      exportDeadlines(0),
+      metricsDeadlines(0) {
 
     DebugLogger::log("TrafficManager created");
 }
@@ -33,6 +110,16 @@ TrafficManager::~TrafficManager() {
         fileHandler = nullptr;
     }
 
+    if (inProcessGenerator) {
+        delete inProcessGenerator;
+        inProcessGenerator = nullptr;
+    }
+
+    if (taskPool) {
+        delete taskPool;
+        taskPool = nullptr;
+    }
+
     DebugLogger::log("TrafficManager destroyed");
 }
 
@@ -44,19 +131,45 @@ bool TrafficManager::initialize() {
         return false;
     }
 
+    // Event-driven ingestion where the platform supports it; update()
+    // keeps the 200ms poll as the fallback when this returns false
+    fileHandler->startFileWatcher();
+
     // Create lanes for each road and lane numberr
     for (char road : {'A', 'B', 'C', 'D'}) {
         for (int laneNum = 1; laneNum <= 3; laneNum++) {
             Lane* lane = new Lane(road, laneNum);
             lanes.push_back(lane);
+            if (road == 'A' && laneNum == 2) {
+                priorityLaneA2 = lane;
+            }
 
             // Add to priority queue with initial priority
             lanePriorityQueue.enqueue(lane, lane->getPriority());
         }
     }
 
-    // Create traffic light
+    // Create traffic light and wire it to receive lane count deltas
     trafficLight = new TrafficLight();
+    for (auto* lane : lanes) {
+        lane->setCountObserver(trafficLight);
+    }
+
+    // Metrics export for the monitoring sidecar; absence of shm support
+    // just means no external metrics, the simulation runs the same
+    if (metricsSegment.create()) {
+        DebugLogger::log("Metrics segment created for external monitoring");
+    } else {
+        DebugLogger::log("Metrics segment unavailable; external monitoring disabled",
+                         DebugLogger::LogLevel::WARNING);
+    }
+
+    // Opt-in columnar metrics export for offline analysis; one sample
+    // per tick through a double-buffered background writer
+    const char* tapePath = std::getenv("TRAFFIC_STATS_TAPE");
+    if (tapePath && tapePath[0] != '\0') {
+        statsTapeEnabled = statsTape.open(tapePath);
+    }
 
     std::ostringstream oss;
     oss << "TrafficManager initialized with " << lanes.size() << " lanes";
@@ -65,6 +178,31 @@ bool TrafficManager::initialize() {
     return true;
 }
 
+bool TrafficManager::startInProcessGeneration() {
+    if (journalReplaying) {
+        DebugLogger::log("Cannot fuse the generator while replaying",
+                         DebugLogger::LogLevel::ERROR);
+        return false;
+    }
+    if (lanes.empty()) {
+        DebugLogger::log("startInProcessGeneration() requires initialize() first",
+                         DebugLogger::LogLevel::ERROR);
+        return false;
+    }
+    if (inProcessGenerator) {
+        return true;
+    }
+
+    // Spawns now arrive through the in-process ring only; the ingestion
+    // thread and its inotify watch have nothing left to watch
+    if (fileHandler) {
+        fileHandler->stopFileWatcher();
+    }
+
+    inProcessGenerator = new InProcessGenerator();
+    return inProcessGenerator->start(lanes);
+}
+
 void TrafficManager::start() {
     running = true;
     DebugLogger::log("TrafficManager started");
@@ -72,32 +210,442 @@ void TrafficManager::start() {
 
 void TrafficManager::stop() {
     running = false;
+
+    if (inProcessGenerator) {
+        inProcessGenerator->stop();
+    }
     DebugLogger::log("TrafficManager stopped");
 }
 
+void TrafficManager::setTimeScale(uint32_t scale) {
+    timeScale = (scale < 1) ? 1 : scale;
+
+    // Quiescence rules differ between real time and compression, so
+    // every lane gets re-examined under the new scale
+    activeLaneMask.store(0x0FFF, std::memory_order_relaxed);
+
+    DebugLogger::log("Time scale set to " + std::to_string(timeScale) + "x" +
+                     (timeScale > 1 ? " (fast-forward: teleport movement, logical light clock)" : ""));
+}
+
+uint32_t TrafficManager::getTimeScale() const {
+    return timeScale;
+}
+
+void TrafficManager::setDeterministicClock(bool enabled) {
+    deterministicClock = enabled;
+
+    DebugLogger::log(enabled
+        ? "Deterministic clock enabled - periodic work keys off logical time"
+        : "Deterministic clock disabled");
+}
+
+bool TrafficManager::startRecording(const std::string& path) {
+    if (journalReplaying) {
+        DebugLogger::log("Cannot record while replaying", DebugLogger::LogLevel::ERROR);
+        return false;
+    }
+    if (!journal.openForWrite(path)) {
+        return false;
+    }
+
+    journalRecording = true;
+
+    // Keyframe zero covers whatever state recording started from (e.g.
+    // a loaded snapshot), so seeks can land before the first minute
+    lastKeyframeTime = simTimeMs;
+    captureKeyframe();
+    return true;
+}
+
+bool TrafficManager::startReplay(const std::string& path) {
+    if (journalRecording) {
+        DebugLogger::log("Cannot replay while recording", DebugLogger::LogLevel::ERROR);
+        return false;
+    }
+    if (!journal.openForRead(path)) {
+        return false;
+    }
+
+    journalReplaying = true;
+    replayCursor = 0;
+
+    // Replay only makes sense against the logical clock the journal was
+    // stamped with
+    setDeterministicClock(true);
+    return true;
+}
+
+void TrafficManager::pumpReplay() {
+    // Spawn everything whose recorded time has been reached; dequeue and
+    // light events re-derive naturally from the simulation itself
+    while (replayCursor < journal.eventCount()) {
+        const JournalEvent& event = journal.event(replayCursor);
+        if (event.timeMs > simTimeMs) {
+            break;
+        }
+        replayCursor++;
+
+        if (event.type != JournalEvent::SPAWN) {
+            continue;
+        }
+
+        Vehicle* vehicle = VehiclePool::acquire(event.label, event.lane,
+                                                event.laneNumber,
+                                                event.emergency != 0);
+        addVehicle(vehicle);
+    }
+}
+
+bool TrafficManager::startScheduleStream(const std::string& path) {
+    if (journalReplaying) {
+        DebugLogger::log("Cannot stream a schedule while replaying a journal",
+                       DebugLogger::LogLevel::ERROR);
+        return false;
+    }
+    if (!compiledSchedule.openForRead(path)) {
+        return false;
+    }
+
+    scheduleStreaming = true;
+    scheduleCursor = 0;
+
+    // Precomputed arrival times only mean anything against the logical
+    // clock; same rule as journal replay
+    setDeterministicClock(true);
+    return true;
+}
+
+void TrafficManager::pumpSchedule() {
+    // Spawn everything whose scheduled time has been reached; the
+    // compiler sorted the records, so this is one cursor walk with no
+    // RNG, no parsing and no I/O on the tick
+    while (scheduleCursor < compiledSchedule.count()) {
+        const CompiledArrival& arrival = compiledSchedule.arrival(scheduleCursor);
+        if (arrival.arrivalMs > simTimeMs) {
+            break;
+        }
+        scheduleCursor++;
+
+        // Same label shape the generator would have produced, derived
+        // from the record's time-ordered sequence number
+        std::string label = "S" + std::to_string(arrival.sequence) + "_L" +
+                            std::to_string(arrival.laneNumber);
+
+        Vehicle* vehicle = VehiclePool::acquire(label, arrival.lane,
+                                                arrival.laneNumber,
+                                                arrival.emergency != 0);
+        Destination destination = Destination::STRAIGHT;
+        if (arrival.destination == 1) {
+            destination = Destination::LEFT;
+        } else if (arrival.destination == 2) {
+            destination = Destination::RIGHT;
+        }
+        vehicle->setDestination(destination);
+        addVehicle(vehicle);
+    }
+}
+
+void TrafficManager::captureKeyframe() {
+    // Same capture as saveSnapshot(), but the records go to the
+    // journal's staged keyframe section instead of their own file
+    std::vector<VehicleSnapshot> records;
+    size_t total = 0;
+    for (auto* lane : lanes) {
+        total += lane->getVehicleCount();
+    }
+    records.reserve(total);
+
+    for (auto* lane : lanes) {
+        lane->forEachVehicle([&](Vehicle* vehicle) {
+            records.emplace_back();
+            vehicle->captureSnapshot(records.back());
+        });
+    }
+
+    int32_t lightState = trafficLight
+        ? static_cast<int32_t>(trafficLight->getCurrentState()) : 0;
+    journal.appendKeyframe(simTimeMs, lightState, records.data(),
+                           static_cast<uint32_t>(records.size()));
+}
+
+void TrafficManager::clearAllVehicles() {
+    for (auto* lane : lanes) {
+        while (!lane->isEmpty()) {
+            Vehicle* vehicle = lane->dequeue();
+            if (!vehicle) {
+                break;
+            }
+            VehiclePool::release(vehicle);
+        }
+    }
+}
+
+bool TrafficManager::seekReplay(uint32_t targetMs) {
+    if (!journalReplaying) {
+        DebugLogger::log("seekReplay: no replay in progress",
+                       DebugLogger::LogLevel::ERROR);
+        return false;
+    }
+
+    EventJournal::KeyframeHeader keyframe;
+    const VehicleSnapshot* records = nullptr;
+    bool haveKeyframe = journal.findKeyframe(targetMs, keyframe, records);
+
+    if (!haveKeyframe && targetMs < simTimeMs) {
+        // Nothing to rewind to; replaying backwards would mean starting
+        // over from t=0, which the caller can do explicitly
+        DebugLogger::log("seekReplay: journal has no keyframe at or before " +
+                       std::to_string(targetMs) + "ms",
+                       DebugLogger::LogLevel::WARNING);
+        return false;
+    }
+
+    // Restore from the keyframe when it gets us closer than the current
+    // position (always for backward seeks; for forward seeks only when
+    // it lies ahead of where the replay already is)
+    if (haveKeyframe && (targetMs < simTimeMs || keyframe.timeMs > simTimeMs)) {
+        clearAllVehicles();
+
+        simTimeMs = static_cast<uint32_t>(keyframe.timeMs);
+        if (trafficLight) {
+            trafficLight->restoreState(
+                static_cast<TrafficLight::State>(keyframe.lightState));
+            lastJournaledLightState = trafficLight->getCurrentState();
+        }
+
+        for (uint32_t i = 0; i < keyframe.vehicleCount; i++) {
+            const VehicleSnapshot& record = records[i];
+            Vehicle* vehicle = VehiclePool::acquire(record.label, record.lane,
+                                                    record.laneNumber,
+                                                    record.emergency != 0);
+            vehicle->restoreSnapshot(record);
+            addVehicle(vehicle);
+        }
+
+        replayCursor = static_cast<size_t>(keyframe.eventIndex);
+
+        DebugLogger::log("seekReplay: restored keyframe at " +
+                         std::to_string(keyframe.timeMs) + "ms (" +
+                         std::to_string(keyframe.vehicleCount) + " vehicles)");
+    }
+
+    // Replay the delta tick by tick so queue dynamics at the target are
+    // the same as a straight-through replay's
+    const uint32_t TICK_MS = 16;
+    while (running && simTimeMs < targetMs) {
+        uint32_t step = targetMs - simTimeMs;
+        update(step < TICK_MS ? step : TICK_MS);
+    }
+
+    return true;
+}
+
 void TrafficManager::update(uint32_t delta) {
     if (!running) return;
+    PROFILE_SCOPE("sim.update");
+
+    auto tickStart = std::chrono::steady_clock::now();
+    tickCounter++;
+
+    // Time compression: logical time advances timeScale times faster
+    // than the tick; at 1x this is a no-op
+    uint32_t scaledDelta = delta * timeScale;
+    simTimeMs += scaledDelta;
+
+    // Deterministic runs pace periodic work off the logical clock so
+    // wall-clock jitter can't change any decision
+    // Freeze this tick's "now" once; the light, vehicles and every
+    // periodic block below read the same instant through FrameClock
+    if (deterministicClock) {
+        FrameClock::beginFrame(simTimeMs);
+    } else {
+        FrameClock::beginFrame();
+    }
+    uint32_t currentTime = FrameClock::nowMs();
+
+    if (journalReplaying) {
+        // Replay mode: the journal is the only spawn source, so the live
+        // generator channels are ignored entirely
+        pumpReplay();
+    } else if (scheduleStreaming) {
+        // Compiled schedule mode: spawns come straight out of the
+        // mmap'd record array (see scenario_compiler)
+        pumpSchedule();
+    } else if (inProcessGenerator) {
+        // Fused generator mode: the spawn thread in this process is the
+        // only vehicle source; the file/shm channels are never touched
+        std::vector<Vehicle*> spawned = inProcessGenerator->drainSpawned();
+        addVehiclesBulk(spawned);
+    } else {
+        // Fast path: drain the shared memory channel every frame so vehicles
+        // appear within one frame of generation
+        if (fileHandler) {
+            std::vector<Vehicle*> shmVehicles = fileHandler->readVehiclesFromSharedMemory();
+            addVehiclesBulk(shmVehicles);
+        }
 
-    uint32_t currentTime = SDL_GetTicks();
+        // Lane files: the ingestion thread (inotify-driven or polling)
+        // parses them off this thread and we just drain its lock-free
+        // staging ring - zero I/O on the tick. The synchronous 200ms
+        // read only remains for the case where no thread could start.
+        if (fileHandler && fileHandler->hasFileWatcher()) {
+            std::vector<Vehicle*> stagedVehicles = fileHandler->drainStagedVehicles();
+            addVehiclesBulk(stagedVehicles);
+        } else if (currentTime - lastFileCheckTime >= 200) {
+            readVehicles();
+            lastFileCheckTime = currentTime;
+        }
+    }
 
-    // Check for new vehicles more frequently (every 200ms)
-    if (currentTime - lastFileCheckTime >= 200) {
-        readVehicles();
-        lastFileCheckTime = currentTime;
+    // Resume scenario scripts whose simulation-time waits came due, in
+    // one batch, before this tick's movement - a step that spawns at t
+    // sees its vehicles move at t
+    if (scenarioEngine) {
+        scenarioEngine->update(simTimeMs, *this);
     }
 
     // CRITICAL: Update lane priorities FIRST - this must happen before traffic light updates
     updatePriorities();
 
     // CRITICAL: Process vehicles based on traffic light state and lane type
-    processVehicles(delta);
+    processVehicles(scaledDelta);
 
     // Check for vehicles leaving the simulation
     checkVehicleBoundaries();
 
-    // Update traffic light - AFTER priorities have been updated
+    // Spacing correction: the queue-offset ladder already spaces
+    // vehicles at enqueue, so this pass only repairs the rare residual
+    // violation (turn exits, restored snapshots) and a few-tick stride
+    // is plenty. Under budget pressure the governor stretches the
+    // stride or suspends the pass outright.
+    {
+        uint32_t stride = overlapStride();
+        if (stride > 0 && tickCounter % stride == 0) {
+            preventVehicleOverlap();
+        } else if (tickCounter % OVERLAP_BASE_STRIDE == 0) {
+            shedOverlapPasses++;
+        }
+    }
+
+    // Publish immutable per-lane snapshots for the render thread; lanes
+    // that didn't change this tick skip the copy (see Lane::publishRenderSnapshot)
+    for (auto* lane : lanes) {
+        lane->publishRenderSnapshot();
+    }
+
+    // And the kinematic double buffer the renderer interpolates between
+    // (no-op unless main() enabled tick publishing for a windowed run)
+    VehicleStateStore::publishTick(FrameClock::nowMs());
+
+    // One keyframe per simulated minute while recording: seek landing
+    // points for seekReplay(), costing one state capture per minute and
+    // nothing per tick otherwise
+    if (journalRecording && simTimeMs - lastKeyframeTime >= 60000) {
+        lastKeyframeTime = simTimeMs;
+        captureKeyframe();
+    }
+
+    // Periodic wait-distribution export: one log line per active lane
+    // every minute, so threshold tuning can grep the log instead of
+    // watching the animation (see WaitHistogram)
+    if (currentTime - lastWaitExportTime >= 60000) {
+        lastWaitExportTime = currentTime;
+
+        // Under shed, only every 2^level'th deadline actually exports
+        if (shedLevel > 0 && ++exportDeadlines % shedIntervalScale() != 0) {
+            shedExports++;
+        } else {
+            for (auto* lane : lanes) {
+                const WaitHistogram& hist = lane->getWaitHistogram();
+                if (hist.totalCount() == 0) {
+                    continue;
+                }
+
+                char line[128];
+                snprintf(line, sizeof(line),
+                         "Wait %s: n=%llu p50=%llums p99=%llums p999=%llums max=%llums",
+                         lane->getName().c_str(),
+                         static_cast<unsigned long long>(hist.totalCount()),
+                         static_cast<unsigned long long>(hist.quantileMs(0.50)),
+                         static_cast<unsigned long long>(hist.quantileMs(0.99)),
+                         static_cast<unsigned long long>(hist.quantileMs(0.999)),
+                         static_cast<unsigned long long>(hist.maxMs()));
+                DebugLogger::log(line, DebugLogger::LogLevel::INFO);
+            }
+        }
+    }
+
+    // Once-a-second memory sample: pool occupancy vs. capacity is the
+    // leak detector (a vehicle that never reaches EXITED stays "live"
+    // forever and the gap over the queued total only widens), the rest
+    // tracks buffer growth and overall RSS drift on 24/7 kiosks
+    if (currentTime - lastMemorySampleTime >= 1000) {
+        lastMemorySampleTime = currentTime;
+
+        SimulationStats::MemoryRow row = {};
+        row.liveVehicles = VehiclePool::activeCount();
+        row.poolCapacity = VehiclePool::capacity();
+        for (auto* lane : lanes) {
+            row.laneQueueBytes += lane->getQueueStorageBytes();
+        }
+        row.loggerQueueDepth = DebugLogger::getQueueDepth();
+        row.rssKb = readRssKb();
+        stats.recordMemory(row);
+
+        // Same cadence feeds the per-lane depth history ring behind the
+        // overlay's sparklines
+        stats.sampleDepths();
+    }
+
+    // Periodic lane-status report for external monitors: all lanes are
+    // buffered and published in one write plus an atomic rename-swap,
+    // so readers get a consistent snapshot and the interval costs one
+    // open instead of one per lane
+    if (fileHandler &&
+        currentTime - lastStatusWriteTime >= FileHandler::statusWriteIntervalMs()) {
+        lastStatusWriteTime = currentTime;
+
+        // The governor stretches the effective interval by running only
+        // every 2^level'th deadline; external monitors see a staler but
+        // still consistent snapshot
+        if (shedLevel > 0 && ++statusDeadlines % shedIntervalScale() != 0) {
+            shedStatusWrites++;
+        } else {
+            for (auto* lane : lanes) {
+                if (lane->getVehicleCount() > 0) {
+                    fileHandler->bufferLaneStatus(
+                        lane->getLaneId(),
+                        lane->getLaneNumber(),
+                        lane->getVehicleCount(),
+                        lane->isPriorityLane() && lane->getPriority() > 0);
+                }
+            }
+            fileHandler->flushLaneStatus();
+        }
+    }
+
+    // Update traffic light - AFTER priorities have been updated.
+    // Compressed runs drive it off the logical clock so light timing
+    // scales with the simulation rather than wall time.
     if (trafficLight) {
-        trafficLight->update(lanes);
+        if (timeScale > 1 || deterministicClock) {
+            trafficLight->update(lanes, simTimeMs);
+        } else {
+            trafficLight->update(lanes);
+        }
+
+        if (journalRecording &&
+            trafficLight->getCurrentState() != lastJournaledLightState) {
+            lastJournaledLightState = trafficLight->getCurrentState();
+
+            JournalEvent event = {};
+            event.timeMs = simTimeMs;
+            event.type = JournalEvent::LIGHT_CHANGE;
+            event.lane = ' ';
+            event.lightState = static_cast<int8_t>(lastJournaledLightState);
+            journal.append(event);
+        }
     }
 
     // Debug log current state
@@ -119,15 +667,140 @@ void TrafficManager::update(uint32_t delta) {
                 case TrafficLight::State::B_GREEN: stateStr = "B_GREEN"; break;
                 case TrafficLight::State::C_GREEN: stateStr = "C_GREEN"; break;
                 case TrafficLight::State::D_GREEN: stateStr = "D_GREEN"; break;
+                case TrafficLight::State::AC_GREEN: stateStr = "AC_GREEN"; break;
+                case TrafficLight::State::BD_GREEN: stateStr = "BD_GREEN"; break;
             }
             DebugLogger::log("Current light state: " + stateStr, DebugLogger::LogLevel::INFO);
         }
 
         lastDebugTime = currentTime;
     }
+
+    // Refresh the external metrics block at ~10Hz; a no-op when the
+    // shared segment could not be created
+    if (metricsSegment.isAvailable() &&
+        currentTime - lastMetricsPublishTime >= 100) {
+        lastMetricsPublishTime = currentTime;
+        if (shedLevel > 0 && ++metricsDeadlines % shedIntervalScale() != 0) {
+            shedExports++;
+        } else {
+            publishMetrics(delta);
+        }
+    }
+
+    // Close out this tick's tape sample: depths and light state read
+    // once here, arrivals/departures accumulated above as they happened
+    if (statsTapeEnabled) {
+        tapeSample.timeMs = simTimeMs;
+        tapeSample.lightState = trafficLight
+            ? static_cast<uint8_t>(trafficLight->getCurrentState()) : 0;
+        for (auto* lane : lanes) {
+            int count = lane->getVehicleCount();
+            tapeSample.depth[tapeSlot(lane->getLaneId(), lane->getLaneNumber())] =
+                static_cast<uint16_t>(std::min(count, 65535));
+        }
+        statsTape.append(tapeSample);
+        std::memset(tapeSample.arrivals, 0, sizeof(tapeSample.arrivals));
+        std::memset(tapeSample.departures, 0, sizeof(tapeSample.departures));
+    }
+
+    // Feed the governor the measured cost of everything above. The
+    // deterministic clock opts out: wall-time feedback would make two
+    // runs of the same seed schedule their passes differently.
+    if (!deterministicClock) {
+        governTick(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - tickStart).count());
+    }
+}
+
+void TrafficManager::governTick(int64_t tickUs) {
+    if (tickUs > TICK_BUDGET_US) {
+        ticksUnderBudget = 0;
+        if (shedLevel < SHED_LEVEL_MAX) {
+            shedLevel++;
+
+            char line[160];
+            snprintf(line, sizeof(line),
+                     "Tick governor: shed level %d (tick %.1fms over %.1fms "
+                     "budget) - overlap stride %u, report intervals x%u",
+                     shedLevel, tickUs / 1000.0, TICK_BUDGET_US / 1000.0,
+                     overlapStride(), shedIntervalScale());
+            DebugLogger::log(line, DebugLogger::LogLevel::WARNING);
+        }
+        return;
+    }
+
+    if (tickUs < TICK_BUDGET_US / 2) {
+        ticksUnderBudget++;
+    } else {
+        ticksUnderBudget = 0;
+    }
+
+    // Two seconds' worth of comfortable ticks walks one level back, so
+    // a burst has to stay gone before the deferred passes resume
+    if (shedLevel > 0 && ticksUnderBudget >= 120) {
+        ticksUnderBudget = 0;
+        shedLevel--;
+
+        if (shedLevel == 0) {
+            char line[192];
+            snprintf(line, sizeof(line),
+                     "Tick governor: recovered - shed %llu overlap passes, "
+                     "%llu status writes, %llu stat refreshes",
+                     static_cast<unsigned long long>(shedOverlapPasses),
+                     static_cast<unsigned long long>(shedStatusWrites),
+                     static_cast<unsigned long long>(shedExports));
+            DebugLogger::log(line, DebugLogger::LogLevel::INFO);
+
+            shedOverlapPasses = 0;
+            shedStatusWrites = 0;
+            shedExports = 0;
+        } else {
+            DebugLogger::log("Tick governor: shed level down to " +
+                             std::to_string(shedLevel));
+        }
+    }
+}
+
+uint32_t TrafficManager::overlapStride() const {
+    switch (shedLevel) {
+        case 0:  return OVERLAP_BASE_STRIDE;
+        case 1:  return OVERLAP_BASE_STRIDE * 2;
+        case 2:  return OVERLAP_BASE_STRIDE * 4;
+        default: return 0; // Suspended until the governor recovers
+    }
+}
+
+void TrafficManager::publishMetrics(uint32_t delta) {
+    SimulationStats::Snapshot snap = stats.getSnapshot();
+
+    MetricsBlock block = {};
+    block.simTimeMs = simTimeMs;
+    block.tickMs = delta;
+    block.lightState = trafficLight
+        ? static_cast<int32_t>(trafficLight->getCurrentState()) : -1;
+    block.totalArrivals = snap.totalArrivals;
+    block.totalDepartures = snap.totalDepartures;
+    block.waitP50 = snap.waitP50;
+    block.waitP90 = snap.waitP90;
+    block.waitP99 = snap.waitP99;
+
+    for (int slot = 0; slot < MetricsBlock::LANE_SLOTS; slot++) {
+        const SimulationStats::LaneRow& row = snap.lanes[slot];
+        MetricsBlock::LaneMetrics& out = block.lanes[slot];
+        out.laneId = row.laneId;
+        out.laneNumber = static_cast<int8_t>(row.laneNumber);
+        out.priorityActive = row.priorityActive ? 1 : 0;
+        out.queueDepth = row.count;
+        out.arrivalsPerMin = row.arrivalsPerMin;
+        out.departuresPerMin = row.departuresPerMin;
+    }
+
+    metricsSegment.publish(block);
 }
 
 void TrafficManager::readVehicles() {
+    PROFILE_SCOPE("sim.readVehicles");
     if (!fileHandler) {
         DebugLogger::log("FileHandler not initialized", DebugLogger::LogLevel::ERROR);
         return;
@@ -149,28 +822,16 @@ void TrafficManager::readVehicles() {
         oss << "Read " << newVehicles.size() << " new vehicles from files";
         DebugLogger::log(oss.str());
 
-        // Add vehicles to appropriate lanes
-        for (auto* vehicle : newVehicles) {
-            addVehicle(vehicle);
-        }
+        // Grouped by lane, one lock acquisition per lane
+        addVehiclesBulk(newVehicles);
     }
 
-    // Write status to file periodically for monitoring
-    static uint32_t lastStatusTime = 0;
-    uint32_t currentTime = SDL_GetTicks();
+}
 
-    if (currentTime - lastStatusTime >= 5000) { // Every 5 seconds
-        for (auto* lane : lanes) {
-            if (fileHandler && lane->getVehicleCount() > 0) {
-                fileHandler->writeLaneStatus(
-                    lane->getLaneId(),
-                    lane->getLaneNumber(),
-                    lane->getVehicleCount(),
-                    lane->isPriorityLane() && lane->getPriority() > 0
-                );
-            }
-        }
-        lastStatusTime = currentTime;
+void TrafficManager::attachScenarioEngine(ScenarioEngine* engine) {
+    scenarioEngine = engine;
+    if (engine) {
+        DebugLogger::log("Scenario engine attached");
     }
 }
 
@@ -179,31 +840,142 @@ void TrafficManager::addVehicle(Vehicle* vehicle) {
 
     Lane* targetLane = findLane(vehicle->getLane(), vehicle->getLaneNumber());
     if (targetLane) {
-        targetLane->enqueue(vehicle);
+        // Enforce the cap at admission: a full lane refuses the vehicle
+        // before it costs a queue slot, instead of the old periodic
+        // sweep that trimmed overflow after it was already enqueued
+        if (!targetLane->tryEnqueue(vehicle, Constants::MAX_VEHICLES_PER_LANE)) {
+            rejectSpawn(vehicle, targetLane);
+            return;
+        }
 
-        // Log the action
-        std::ostringstream oss;
-        oss << "Added vehicle " << vehicle->getId() << " to lane "
-            << vehicle->getLane() << vehicle->getLaneNumber();
-        DebugLogger::log(oss.str());
+        // Wake the lane for the sparse scheduler: a parked or empty
+        // lane with a new arrival has work again
+        activeLaneMask.fetch_or(
+            static_cast<uint16_t>(1u << Constants::laneSlot(
+                vehicle->getLane(), vehicle->getLaneNumber())),
+            std::memory_order_relaxed);
+
+        recordAdmission(vehicle, targetLane);
     } else {
         // Clean up if lane not found
-        delete vehicle;
+        VehiclePool::release(vehicle);
         DebugLogger::log("Error: No matching lane found for vehicle", DebugLogger::LogLevel::ERROR);
     }
 }
 
+void TrafficManager::addVehiclesBulk(std::vector<Vehicle*>& vehicles) {
+    if (vehicles.empty()) {
+        return;
+    }
 
-void TrafficManager::updatePriorities() {
-    // CRITICAL: First retrieve the priority lane (A2)
-    Lane* priorityLane = nullptr;
-    for (auto* lane : lanes) {
-        if (lane->getLaneId() == 'A' && lane->getLaneNumber() == 2) {
-            priorityLane = lane;
-            break;
+    // Group by target lane slot so each lane's queue lock and count
+    // push are paid once per batch instead of once per vehicle - a
+    // burst of 50 spawns into lane A used to be 50 lock acquisitions
+    for (auto* vehicle : vehicles) {
+        if (!vehicle) continue;
+        if (!Constants::laneSlotValid(vehicle->getLane(),
+                                      vehicle->getLaneNumber())) {
+            VehiclePool::release(vehicle);
+            DebugLogger::log("Error: No matching lane found for vehicle",
+                             DebugLogger::LogLevel::ERROR);
+            continue;
+        }
+        admitScratch[Constants::laneSlot(vehicle->getLane(),
+                                         vehicle->getLaneNumber())]
+            .push_back(vehicle);
+    }
+    vehicles.clear();
+
+    for (int slot = 0; slot < Constants::LANE_SLOT_COUNT; slot++) {
+        std::vector<Vehicle*>& bucket = admitScratch[slot];
+        if (bucket.empty()) {
+            continue;
+        }
+
+        Lane* targetLane = lanes[slot];
+        size_t admitted =
+            targetLane->tryEnqueueBulk(bucket, Constants::MAX_VEHICLES_PER_LANE);
+
+        if (admitted > 0) {
+            activeLaneMask.fetch_or(static_cast<uint16_t>(1u << slot),
+                                    std::memory_order_relaxed);
+            for (size_t i = 0; i < admitted; i++) {
+                recordAdmission(bucket[i], targetLane);
+            }
+        }
+
+        // Whatever the cap refused goes back to the pool
+        for (size_t i = admitted; i < bucket.size(); i++) {
+            rejectSpawn(bucket[i], targetLane);
         }
+        bucket.clear();
+    }
+}
+
+void TrafficManager::rejectSpawn(Vehicle* vehicle, Lane* targetLane) {
+    stats.recordRejectedSpawn(vehicle->getLane(), vehicle->getLaneNumber());
+    DebugLogger::log("Rejected spawn " + vehicle->getLabel() +
+                     ": lane " + targetLane->getName() + " at capacity",
+                     DebugLogger::LogLevel::WARNING);
+    VehiclePool::release(vehicle);
+}
+
+void TrafficManager::recordAdmission(Vehicle* vehicle, Lane* targetLane) {
+    stats.recordArrival(vehicle->getLane(), vehicle->getLaneNumber(),
+                        targetLane->getVehicleCount(),
+                        targetLane->getPriority() > 0, simTimeMs);
+
+    if (statsTapeEnabled) {
+        uint8_t& tick = tapeSample.arrivals[tapeSlot(
+            vehicle->getLane(), vehicle->getLaneNumber())];
+        if (tick < 255) tick++;
+    }
+
+    // Close out the spawn-latency measurement for stamped vehicles
+    // (generator-spawned; in-process spawns arrive unstamped). All
+    // stamps are truncated monotonic microseconds, so the interval
+    // math is mod 2^32 - see Vehicle::setSpawnStamps.
+    uint32_t createdUs = vehicle->getSpawnCreatedUs();
+    if (createdUs != 0) {
+        uint32_t nowUs = static_cast<uint32_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        uint32_t pickedUs = vehicle->getSpawnPickedUpUs();
+        uint32_t totalUs = nowUs - createdUs;
+        // Discard nonsense readings (clock domains diverged, or a
+        // stamp older than the mod-2^32 window): ten minutes is far
+        // beyond any healthy pipeline latency
+        const uint32_t SANITY_CAP_US = 600u * 1000u * 1000u;
+        if (totalUs < SANITY_CAP_US) {
+            stats.recordSpawnLatency(totalUs, pickedUs - createdUs,
+                                     nowUs - pickedUs);
+        }
+    }
+
+    if (journalRecording) {
+        JournalEvent event = {};
+        event.timeMs = simTimeMs;
+        event.type = JournalEvent::SPAWN;
+        event.lane = vehicle->getLane();
+        event.laneNumber = static_cast<int8_t>(vehicle->getLaneNumber());
+        event.emergency = vehicle->isEmergencyVehicle() ? 1 : 0;
+        strncpy(event.label, vehicle->getLabel().c_str(), sizeof(event.label) - 1);
+        journal.append(event);
     }
 
+    // Log the action
+    std::ostringstream oss;
+    oss << "Added vehicle " << vehicle->getLabel() << " to lane "
+        << vehicle->getLane() << vehicle->getLaneNumber();
+    DebugLogger::log(oss.str());
+}
+
+
+void TrafficManager::updatePriorities() {
+    // CRITICAL: The priority lane (A2), cached at initialize() so the
+    // per-tick check is two field reads instead of a lane scan
+    Lane* priorityLane = priorityLaneA2;
+
     if (!priorityLane) {
         DebugLogger::log("ERROR: Priority lane A2 not found!", DebugLogger::LogLevel::ERROR);
         return;
@@ -214,7 +986,9 @@ void TrafficManager::updatePriorities() {
     int oldPriority = priorityLane->getPriority();
 
     // PRIORITY CONDITION: A2 lane has more than 10 vehicles
-    if (vehicleCount > Constants::PRIORITY_THRESHOLD_HIGH && oldPriority == 0) {
+    bool priorityChanged = false;
+    if (vehicleCount > TuningConfig::getPriorityThresholdHigh() && oldPriority == 0) {
+        priorityChanged = true;
         // Activate priority mode
         priorityLane->updatePriority();  // This will set priority to 100
 
@@ -229,7 +1003,8 @@ void TrafficManager::updatePriorities() {
         }
     }
     // Check if we should exit priority mode (<5 vehicles)
-    else if (vehicleCount < Constants::PRIORITY_THRESHOLD_LOW && oldPriority > 0) {
+    else if (vehicleCount < TuningConfig::getPriorityThresholdLow() && oldPriority > 0) {
+        priorityChanged = true;
         // Deactivate priority mode
         priorityLane->updatePriority();  // This will reset priority to 0
 
@@ -237,107 +1012,384 @@ void TrafficManager::updatePriorities() {
                       " vehicles (<5) ***", DebugLogger::LogLevel::INFO);
     }
 
-    // CRITICAL: Also log current lane state
-    std::ostringstream oss;
-    oss << "Lane Status: ";
-    for (auto* lane : lanes) {
-        if (lane->getVehicleCount() > 0) {
-            oss << lane->getName() << ":" << lane->getVehicleCount() << " ";
-            if (lane->getPriority() > 0) {
-                oss << "(PRIORITY) ";
+    // Rebuild the priority bitmask the render thread tests, but only on
+    // the tick a priority actually flipped (in practice only A2 ever
+    // does; the mask keeps the query general). Quiet ticks - the
+    // overwhelming majority - skip the lane scan entirely.
+    if (priorityChanged) {
+        uint16_t mask = 0;
+        for (size_t i = 0; i < lanes.size(); i++) {
+            if (lanes[i]->isPriorityLane() && lanes[i]->getPriority() > 0) {
+                mask |= static_cast<uint16_t>(1u << i);
             }
         }
+        priorityLaneMask.store(mask, std::memory_order_relaxed);
     }
-    DebugLogger::log(oss.str(), DebugLogger::LogLevel::DEBUG);
+
+    // CRITICAL: Also log current lane state (the whole sweep compiles
+    // out with the DEBUG level)
+    DebugLogger::logAt<DebugLogger::LogLevel::DEBUG>([&] {
+        std::ostringstream oss;
+        oss << "Lane Status: ";
+        for (auto* lane : lanes) {
+            if (lane->getVehicleCount() > 0) {
+                oss << lane->getName() << ":" << lane->getVehicleCount() << " ";
+                if (lane->getPriority() > 0) {
+                    oss << "(PRIORITY) ";
+                }
+            }
+        }
+        return oss.str();
+    });
 }
 
 
 void TrafficManager::processVehicles(uint32_t delta) {
-    // Determine which road has green light
-    char greenRoad = ' ';
+    PROFILE_SCOPE("sim.processVehicles");
+    // Query the light once per tick and expand it into a per-lane-slot
+    // movable bitmask (free lanes always move); each lane sweep below is
+    // then a single bit test instead of re-deriving the light rules
+    uint8_t greenRoads = 0;
     if (trafficLight) {
-        auto state = trafficLight->getCurrentState();
-        if (state == TrafficLight::State::A_GREEN) greenRoad = 'A';
-        else if (state == TrafficLight::State::B_GREEN) greenRoad = 'B';
-        else if (state == TrafficLight::State::C_GREEN) greenRoad = 'C';
-        else if (state == TrafficLight::State::D_GREEN) greenRoad = 'D';
+        // The phase's road mask covers composite phases (A+C, B+D) the
+        // same as single-road ones
+        greenRoads = TrafficLight::greenRoadMask(trafficLight->getCurrentState());
     }
 
-    // CRITICAL: Process each lane independently with special rules
-    for (auto* lane : lanes) {
-        bool isGreenLight = false;
+    uint16_t movableMask = 0;
+    for (size_t i = 0; i < lanes.size(); i++) {
+        bool roadGreen = (greenRoads >> (lanes[i]->getLaneId() - 'A')) & 1;
+        if (roadGreen || lanes[i]->getLaneNumber() == 3) {
+            movableMask |= static_cast<uint16_t>(1u << i);
+        }
+    }
+
+    // Sparse scheduling: a light transition wakes every lane (queues
+    // that were parked may roll, rolling ones must brake); between
+    // transitions only lanes whose bit is set get swept. Quiescent
+    // lanes cleared their own bit at the end of their last sweep.
+    if (movableMask != lastMovableMask) {
+        lastMovableMask = movableMask;
+        activeLaneMask.store(0x0FFF, std::memory_order_relaxed);
+    }
+    uint16_t active = activeLaneMask.load(std::memory_order_relaxed);
+    if (active == 0) {
+        return; // Nothing in the junction has work this tick
+    }
+
+    // Gather the hot straight-line moves for this tick; everything else
+    // (turning, red-light queueing, waypoint hand-offs) falls back to
+    // the scalar Vehicle::update() below
+    movementKernel.clear();
+
+    if (parallelLanes && taskPool) {
+        // Task-pool mode: lanes share nothing until the intersection
+        // box, so each one sweeps on whatever worker claims it. Each
+        // lane gathers into (and runs) its own kernel; the conflict
+        // work - preventVehicleOverlap, boundary checks - runs after
+        // update()'s sequential join as before.
+        if (laneKernels.size() != lanes.size()) {
+            laneKernels.resize(lanes.size());
+        }
+
+        taskPool->parallelFor(lanes.size(), [&](size_t i) {
+            if (!((active >> i) & 1)) {
+                return; // Quiescent lane; skip the sweep entirely
+            }
+            laneKernels[i].clear();
+            bool stillActive = processLane(lanes[i], laneKernels[i], delta,
+                                           movableMask);
+            laneKernels[i].run();
+            if (!stillActive) {
+                activeLaneMask.fetch_and(static_cast<uint16_t>(~(1u << i)),
+                                         std::memory_order_relaxed);
+            }
+        });
+        return;
+    }
 
-        // RULE 1: If this is lane's road has green light, it can move
-        if (lane->getLaneId() == greenRoad) {
-            isGreenLight = true;
+    // CRITICAL: Process each active lane independently with special rules
+    for (size_t i = 0; i < lanes.size(); i++) {
+        if (!((active >> i) & 1)) {
+            continue;
         }
-        // RULE 2: Lane 3 (free lane) can ALWAYS move regardless of traffic light
-        else if (lane->getLaneNumber() == 3) {
-            isGreenLight = true;  // FREE LANE ALWAYS HAS GREEN LIGHT
+        if (!processLane(lanes[i], movementKernel, delta, movableMask)) {
+            activeLaneMask.fetch_and(static_cast<uint16_t>(~(1u << i)),
+                                     std::memory_order_relaxed);
         }
+    }
 
-        // Get all vehicles in this lane
-        const auto& vehicles = lane->getVehicles();
-        int queuePos = 0;
+    // Advance all gathered vehicles in one vectorized pass
+    movementKernel.run();
+}
 
-        // Update each vehicle
-        for (auto* vehicle : vehicles) {
-            if (vehicle) {
-                // CRITICAL: Update vehicle with correct light status
-                vehicle->update(delta, isGreenLight, 0.0f);
-                queuePos++;
+bool TrafficManager::processLane(Lane* lane, MovementKernel& kernel,
+                                 uint32_t delta, uint16_t movableMask) {
+    // The caller folded the light rules (green road, free lane) into
+    // one bit per lane slot for this tick
+    int slot = Constants::laneSlot(lane->getLaneId(), lane->getLaneNumber());
+    bool isGreenLight = (movableMask >> slot) & 1;
+
+    // Update each vehicle, visiting the queue in place - no snapshot copy.
+    // Size the spacing ladder first: queueOffset() must stay lock-free
+    // inside the visitor.
+    lane->warmQueueLadder();
+
+    // Update LOD: under a red light the front of the queue settles into
+    // a parked segment - stopped vehicles piled behind the stop line
+    // whose update() is a guaranteed no-op until something changes. The
+    // sweep starts past the segment and extends it with whichever
+    // vehicles came to rest in order behind it this tick, so at
+    // saturation the effective update set is only the still-rolling
+    // tail. A green light (or the free lane's permanent green) wakes
+    // everything, and Lane resets the segment whenever queue positions
+    // shift (see Lane::getDormantCount).
+    size_t dormant = 0;
+    if (!isGreenLight && timeScale == 1) {
+        dormant = std::min(lane->getDormantCount(),
+                           static_cast<size_t>(lane->getVehicleCount()));
+    }
+    lane->setDormantCount(dormant);
+
+    // Stop-and-go wave propagation: one in-order pass chains each
+    // vehicle's permitted step to the vehicle ahead. A follower may
+    // close its gap down to MIN_DISTANCE plus take whatever step its
+    // leader was just granted, so when a queue head pulls away the
+    // whole column starts moving this tick instead of one rank per
+    // frame - and preventVehicleOverlap() is left with genuine
+    // crossing conflicts instead of routine queue spacing. Only the
+    // straight approach chains (animPos tracks the lane axis there);
+    // past the stop line the box reservations and the overlap pass
+    // own the geometry.
+    const float MIN_DISTANCE = 35.0f; // Matches preventVehicleOverlap()
+    float aheadAnim = 0.0f;
+    float aheadStep = 0.0f;
+    bool haveAhead = false;
+
+    int queuePos = static_cast<int>(dormant);
+    bool parkChain = true; // Still extending the parked segment in order
+    lane->forEachVehicleFrom(dormant, [&](Vehicle* vehicle) {
+        if (vehicle) {
+            float animBefore = vehicle->getAnimationPos();
+            float maxAdvance = std::numeric_limits<float>::max();
+            bool chains = timeScale == 1 && vehicle->onApproach();
+            if (chains && haveAhead) {
+                float gap = (aheadAnim - animBefore) * vehicle->approachSign();
+                maxAdvance = std::max(0.0f, gap - MIN_DISTANCE + aheadStep);
+            }
+            // CRITICAL: Update vehicle with correct light status.
+            // Bucket dispatch: the cached moveBucket tag (migrated at
+            // waypoint transitions, see Vehicle::reclassifyBucket)
+            // routes CRUISE vehicles in a movable lane into the kernel
+            // batch; everything else runs the scalar update(). The tag
+            // test replaces re-deriving state/turning/destination per
+            // vehicle per tick.
+            // Intersection box admission: a movable vehicle that hasn't
+            // claimed its box slots yet reserves them here, with its
+            // entry estimate staggered by queue position. A denied
+            // claim holds the vehicle at the stop line this tick (the
+            // slots it conflicted with expire as time advances) -
+            // compatible movements hold disjoint cells and proceed
+            // together, so only genuine crossings serialize.
+            bool movable = isGreenLight;
+            if (movable && timeScale == 1 && vehicle->needsBoxReservation()) {
+                uint64_t entryMs = simTimeMs +
+                    static_cast<uint64_t>(queuePos) *
+                        IntersectionReservations::SLOT_MS;
+                if (intersectionBox.tryReserve(vehicle->getLane(),
+                                               vehicle->getLaneNumber(),
+                                               vehicle->getDestination(),
+                                               entryMs)) {
+                    vehicle->setBoxReserved(true);
+                } else {
+                    movable = false;
+                }
             }
-        }
 
-        // For priority lane A2, log movement status
-        if (lane->getLaneId() == 'A' && lane->getLaneNumber() == 2 && !vehicles.empty()) {
-            DebugLogger::log("A2 (Priority): " + std::to_string(vehicles.size()) +
-                          " vehicles, GreenLight=" + std::to_string(isGreenLight),
-                          DebugLogger::LogLevel::DEBUG);
-        }
+            float plannedStep = 0.0f;
+            if (timeScale > 1) {
+                // Compressed runs teleport along the route polyline
+                // instead of interpolating per frame
+                vehicle->fastForward(delta, isGreenLight);
+            } else if (!movable ||
+                       vehicle->moveBucket() != MoveBucket::CRUISE ||
+                       !vehicle->queueStraightMove(kernel, delta, maxAdvance,
+                                                   plannedStep)) {
+                // The lane's precomputed spacing ladder supplies the
+                // red-light stop offset for this queue slot
+                vehicle->update(delta, movable, lane->queueOffset(queuePos),
+                                maxAdvance);
+                plannedStep =
+                    std::fabs(vehicle->getAnimationPos() - animBefore);
+            }
+
+            // The chain always carries pre-move positions, so the
+            // recurrence is the same whether the leader moved scalar
+            // (measured step) or was batched into the kernel (granted
+            // step; it lands after the sweep)
+            if (chains) {
+                aheadAnim = animBefore;
+                aheadStep = plannedStep;
+                haveAhead = true;
+            } else {
+                haveAhead = false;
+            }
 
-        // For free lanes, verify they're moving
-        if (lane->getLaneNumber() == 3 && !vehicles.empty()) {
-            DebugLogger::log(lane->getName() + " (Free lane): " +
-                          std::to_string(vehicles.size()) + " vehicles, GreenLight=true",
-                          DebugLogger::LogLevel::DEBUG);
+            if (!isGreenLight && timeScale == 1 && parkChain &&
+                vehicle->isParkedAt(lane->queueOffset(queuePos))) {
+                // Came to rest directly behind the parked segment;
+                // skip it starting next tick
+                vehicle->setQueuePos(queuePos);
+                lane->setDormantCount(static_cast<size_t>(queuePos) + 1);
+            } else {
+                parkChain = false;
+            }
+            queuePos++;
         }
+    });
+
+    // For priority lane A2, log movement status
+    int vehicleCount = lane->getVehicleCount();
+    if (lane->getLaneId() == 'A' && lane->getLaneNumber() == 2 && vehicleCount > 0) {
+        DebugLogger::logAt<DebugLogger::LogLevel::DEBUG>([&] {
+            return "A2 (Priority): " + std::to_string(vehicleCount) +
+                   " vehicles, GreenLight=" + std::to_string(isGreenLight);
+        });
     }
+
+    // For free lanes, verify they're moving
+    if (lane->getLaneNumber() == 3 && vehicleCount > 0) {
+        DebugLogger::logAt<DebugLogger::LogLevel::DEBUG>([&] {
+            return lane->getName() + " (Free lane): " +
+                   std::to_string(vehicleCount) + " vehicles, GreenLight=true";
+        });
+    }
+
+    // Quiescence verdict for the sparse scheduler: an empty lane, or a
+    // red-light queue whose parked segment now covers every vehicle,
+    // has no work until an enqueue or a light change wakes it. Time
+    // compression keeps every non-empty lane hot - fastForward needs
+    // its tick regardless of the light.
+    if (vehicleCount == 0) {
+        return false;
+    }
+    if (!isGreenLight && timeScale == 1 &&
+        lane->getDormantCount() >= static_cast<size_t>(vehicleCount)) {
+        return false;
+    }
+    return true;
 }
 
 void TrafficManager::checkVehicleBoundaries() {
-    for (auto* lane : lanes) {
-        // Check each vehicle
-        while (!lane->isEmpty()) {
-            Vehicle* vehicle = lane->peek();
-
-            if (vehicle && vehicle->hasExited()) {
-                // Remove the vehicle from the queue
-                Vehicle* removedVehicle = lane->dequeue();
+    // Batch compaction: each lane sweeps its exited vehicles out in one
+    // stable pass (see Lane::removeExited), the per-vehicle accounting
+    // runs on the collected batch, and the carcasses go back to the
+    // pool in bulk. Exit bursts at green lights used to pay a queue
+    // mutation and a pool lock per vehicle and spiked the tick time.
+    exitedScratch.clear();
+
+    // Quiescent lanes can't have exits, so the sweep honors the same
+    // mask as processVehicles(): a cleared bit means the lane is empty
+    // or every vehicle in it is parked at the stop line, and a vehicle
+    // past the boundary is neither (it keeps its lane active until this
+    // pass removes it).
+    uint16_t active = activeLaneMask.load(std::memory_order_relaxed);
+
+    for (size_t i = 0; i < lanes.size(); i++) {
+        if (!((active >> i) & 1)) {
+            continue;
+        }
+        Lane* lane = lanes[i];
+        size_t before = exitedScratch.size();
+        if (lane->removeExited(exitedScratch) == 0) {
+            continue;
+        }
 
-                // Log vehicle exit with lane info
-                std::ostringstream oss;
-                oss << "Vehicle " << removedVehicle->getId() << " exited the simulation from lane "
-                    << removedVehicle->getLane() << removedVehicle->getLaneNumber();
-                DebugLogger::log(oss.str());
+        for (size_t i = before; i < exitedScratch.size(); i++) {
+            Vehicle* removedVehicle = exitedScratch[i];
+
+            uint32_t waitSeconds = static_cast<uint32_t>(
+                std::max<time_t>(0, time(nullptr) -
+                                    removedVehicle->getArrivalTime()));
+            stats.recordDeparture(removedVehicle->getLane(),
+                                  removedVehicle->getLaneNumber(),
+                                  lane->getVehicleCount(),
+                                  lane->getPriority() > 0, simTimeMs,
+                                  waitSeconds);
+
+            if (statsTapeEnabled) {
+                uint8_t& tick = tapeSample.departures[tapeSlot(
+                    removedVehicle->getLane(),
+                    removedVehicle->getLaneNumber())];
+                if (tick < 255) tick++;
+            }
 
-                // Delete the vehicle
-                delete removedVehicle;
-            } else {
-                // If the first vehicle hasn't exited, the rest haven't either
-                break;
+            if (journalRecording) {
+                JournalEvent event = {};
+                event.timeMs = simTimeMs;
+                event.type = JournalEvent::DEQUEUE;
+                event.lane = removedVehicle->getLane();
+                event.laneNumber = static_cast<int8_t>(removedVehicle->getLaneNumber());
+                event.emergency = removedVehicle->isEmergencyVehicle() ? 1 : 0;
+                strncpy(event.label, removedVehicle->getLabel().c_str(),
+                        sizeof(event.label) - 1);
+                journal.append(event);
             }
+
+            // Log vehicle exit with lane info
+            std::ostringstream oss;
+            oss << "Vehicle " << removedVehicle->getLabel() << " exited the simulation from lane "
+                << removedVehicle->getLane() << removedVehicle->getLaneNumber();
+            DebugLogger::log(oss.str());
         }
     }
+
+    // Closed-loop mode keeps the carcasses alive: departure accounting
+    // above already ran, now each one re-enters at a spawn edge
+    if (recycleVehicles) {
+        recycleExited();
+        return;
+    }
+
+    VehiclePool::releaseAll(exitedScratch);
 }
 
-Lane* TrafficManager::findLane(char laneId, int laneNumber) const {
-    for (auto* lane : lanes) {
-        if (lane->getLaneId() == laneId && lane->getLaneNumber() == laneNumber) {
-            return lane;
+void TrafficManager::recycleExited() {
+    for (Vehicle* vehicle : exitedScratch) {
+        if (!vehicle) {
+            continue;
+        }
+
+        char laneId = recycleLaneId;
+        int laneNumber = recycleLaneNumber;
+        if (laneId == 0) {
+            // Round-robin over the eight spawnable lanes (lanes 2 and
+            // 3 of each road) so the warmed-up distribution persists
+            size_t pick = recycleCursor++ % 8;
+            laneId = static_cast<char>('A' + pick / 2);
+            laneNumber = 2 + static_cast<int>(pick % 2);
         }
+
+        // Reset to a fresh spawn in place (same pool slot, same state
+        // slot), then run the normal admission path: cap enforcement,
+        // lane wake, arrival accounting. A full inflow lane rejects the
+        // re-entry like any other spawn, so the population can only
+        // shrink toward the cap, never exceed it.
+        vehicle->resetForReentry(laneId, laneNumber);
+        addVehicle(vehicle);
+    }
+}
+
+Lane* TrafficManager::findLane(char laneId, int laneNumber) const {
+    // The lanes vector is built in slot order (A1..D3, see initialize),
+    // so lookup is index math instead of a scan - this runs on the
+    // render path every frame via isLanePrioritized()
+    if (!Constants::laneSlotValid(laneId, laneNumber)) {
+        return nullptr;
     }
-    return nullptr;
+
+    size_t slot = static_cast<size_t>(Constants::laneSlot(laneId, laneNumber));
+    return slot < lanes.size() ? lanes[slot] : nullptr;
 }
 
 const std::vector<Lane*>& TrafficManager::getLanes() const {
@@ -349,8 +1401,13 @@ TrafficLight* TrafficManager::getTrafficLight() const {
 }
 
 bool TrafficManager::isLanePrioritized(char laneId, int laneNumber) const {
-    Lane* lane = findLane(laneId, laneNumber);
-    return lane && lane->isPriorityLane() && lane->getPriority() > 0;
+    // One bit test against the mask updatePriorities() maintains
+    if (!Constants::laneSlotValid(laneId, laneNumber)) {
+        return false;
+    }
+
+    int slot = Constants::laneSlot(laneId, laneNumber);
+    return (priorityLaneMask.load(std::memory_order_relaxed) >> slot) & 1;
 }
 
 Lane* TrafficManager::getPriorityLane() const {
@@ -375,6 +1432,33 @@ std::string TrafficManager::getStatistics() const {
 
     stats << "Total Vehicles: " << totalVehicles << "\n";
 
+    // Memory occupancy (same sources the once-a-second sample feeds
+    // into SimulationStats); live pool slots above the queued total
+    // means vehicles are stranded outside any lane
+    size_t laneBytes = 0;
+    for (auto* lane : lanes) {
+        laneBytes += lane->getQueueStorageBytes();
+    }
+    stats << "Memory: " << VehiclePool::activeCount() << "/"
+          << VehiclePool::capacity() << " pool slots live, "
+          << laneBytes << "B lane rings, "
+          << DebugLogger::getQueueDepth() << " log msgs queued, RSS "
+          << readRssKb() << "KB\n";
+
+    // Intersection box admission (see IntersectionReservations); a high
+    // deny share means crossing movements are saturating the box
+    stats << "Box Reservations: " << intersectionBox.grantedCount()
+          << " granted, " << intersectionBox.deniedCount() << " denied\n";
+
+#ifdef TRAFFIC_LOCK_PROFILE
+    // Process-wide queue-lock contention (see utils/LockPolicy.h)
+    uint64_t acquisitions = LockStats::acquisitions.load(std::memory_order_relaxed);
+    uint64_t contentions = LockStats::contentions.load(std::memory_order_relaxed);
+    uint64_t waitNs = LockStats::waitNs.load(std::memory_order_relaxed);
+    stats << "Queue Locks: " << contentions << "/" << acquisitions
+          << " acquisitions blocked, " << (waitNs / 1000000) << "ms waited\n";
+#endif
+
     // Add traffic light status
     if (trafficLight) {
         stats << "Traffic Light: ";
@@ -384,6 +1468,8 @@ std::string TrafficManager::getStatistics() const {
             case TrafficLight::State::B_GREEN: stats << "B GREEN"; break;
             case TrafficLight::State::C_GREEN: stats << "C GREEN"; break;
             case TrafficLight::State::D_GREEN: stats << "D GREEN"; break;
+            case TrafficLight::State::AC_GREEN: stats << "A+C GREEN"; break;
+            case TrafficLight::State::BD_GREEN: stats << "B+D GREEN"; break;
         }
         stats << "\n";
     }
@@ -391,95 +1477,232 @@ std::string TrafficManager::getStatistics() const {
     return stats.str();
 }
 
+void TrafficManager::setParallelLaneProcessing(bool enabled) {
+    parallelLanes = enabled;
+
+    if (enabled && !taskPool) {
+        taskPool = new TaskPool(); // Sized to hardware concurrency
+        DebugLogger::log("Parallel lane processing enabled (" +
+                         std::to_string(taskPool->workerCount() + 1) +
+                         " threads)");
+    } else if (!enabled) {
+        DebugLogger::log("Parallel lane processing disabled");
+    }
+}
 
-void TrafficManager::limitVehiclesPerLane() {
-    const int MAX_VEHICLES_PER_LANE = 12; // Maximum vehicles allowed in a single lane
+void TrafficManager::setVehicleRecycling(bool enabled, char inflowLane,
+                                         int inflowLaneNumber) {
+    recycleVehicles = enabled;
+    recycleLaneId = 0;
+    recycleLaneNumber = 0;
+
+    if (enabled && inflowLane != 0) {
+        // A pinned inflow must be a spawnable lane (lane 1 is the
+        // incoming side); anything else falls back to round-robin
+        if (Constants::laneSlotValid(inflowLane, inflowLaneNumber) &&
+            inflowLaneNumber >= 2) {
+            recycleLaneId = inflowLane;
+            recycleLaneNumber = inflowLaneNumber;
+        } else {
+            DebugLogger::log("Invalid recycle inflow lane " +
+                                 std::string(1, inflowLane) +
+                                 std::to_string(inflowLaneNumber) +
+                                 " - using round-robin",
+                             DebugLogger::LogLevel::WARNING);
+        }
+    }
+
+    if (enabled) {
+        DebugLogger::log("Vehicle recycling enabled (closed-loop population)");
+    }
+}
+
+bool TrafficManager::saveSnapshot(const std::string& path) const {
+    FILE* file = fopen(path.c_str(), "wb");
+    if (!file) {
+        DebugLogger::log("Cannot open snapshot file for writing: " + path,
+                         DebugLogger::LogLevel::ERROR);
+        return false;
+    }
+
+    SnapshotHeader header = {};
+    header.magic = SNAPSHOT_MAGIC;
+    header.version = SNAPSHOT_VERSION;
+    header.simTimeMs = simTimeMs;
+    header.lightState = trafficLight
+        ? static_cast<int32_t>(trafficLight->getCurrentState()) : 0;
 
     for (auto* lane : lanes) {
-        int count = lane->getVehicleCount();
+        header.vehicleCount += static_cast<uint32_t>(lane->getVehicleCount());
+    }
 
-        // If lane has too many vehicles, remove some from the end (farthest from intersection)
-        if (count > MAX_VEHICLES_PER_LANE) {
-            int toRemove = count - MAX_VEHICLES_PER_LANE;
-
-            DebugLogger::log("Lane " + lane->getName() + " has " + std::to_string(count) +
-                           " vehicles (max " + std::to_string(MAX_VEHICLES_PER_LANE) +
-                           ") - removing " + std::to_string(toRemove),
-                           DebugLogger::LogLevel::WARNING);
-
-            // Get all vehicles
-            const auto& vehicles = lane->getVehicles();
-
-            // Remove vehicles starting from the end of the queue (furthest from intersection)
-            for (int i = 0; i < toRemove && !lane->isEmpty(); i++) {
-                // We have to dequeue all vehicles and re-enqueue except the last one
-                std::vector<Vehicle*> tempVehicles;
-                int keepCount = count - (i + 1);
-
-                // Dequeue all vehicles except the one to remove
-                for (int j = 0; j < keepCount; j++) {
-                    if (!lane->isEmpty()) {
-                        Vehicle* v = lane->dequeue();
-                        if (v) {
-                            tempVehicles.push_back(v);
-                        }
-                    }
-                }
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
 
-                // Now remove the target vehicle
-                if (!lane->isEmpty()) {
-                    Vehicle* toDelete = lane->dequeue();
-                    if (toDelete) {
-                        delete toDelete;
-                    }
-                }
+    // Lane order matters: restore replays the records in sequence, so
+    // each queue comes back in its original order
+    for (auto* lane : lanes) {
+        lane->forEachVehicle([&](Vehicle* vehicle) {
+            VehicleSnapshot record;
+            vehicle->captureSnapshot(record);
+            ok = ok && fwrite(&record, sizeof(record), 1, file) == 1;
+        });
+    }
 
-                // Re-enqueue the kept vehicles
-                for (auto* v : tempVehicles) {
-                    lane->enqueue(v);
-                }
-            }
+    fclose(file);
+
+    if (ok) {
+        DebugLogger::log("Saved snapshot of " +
+                         std::to_string(header.vehicleCount) +
+                         " vehicles to " + path);
+    } else {
+        DebugLogger::log("Snapshot write failed: " + path,
+                         DebugLogger::LogLevel::ERROR);
+    }
+    return ok;
+}
+
+bool TrafficManager::loadSnapshot(const std::string& path) {
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file) {
+        DebugLogger::log("Cannot open snapshot file: " + path,
+                         DebugLogger::LogLevel::ERROR);
+        return false;
+    }
+
+    SnapshotHeader header = {};
+    if (fread(&header, sizeof(header), 1, file) != 1 ||
+        header.magic != SNAPSHOT_MAGIC ||
+        header.version != SNAPSHOT_VERSION) {
+        DebugLogger::log("Snapshot file is not valid: " + path,
+                         DebugLogger::LogLevel::ERROR);
+        fclose(file);
+        return false;
+    }
+
+    simTimeMs = header.simTimeMs;
+    if (trafficLight) {
+        trafficLight->restoreState(
+            static_cast<TrafficLight::State>(header.lightState));
+        lastJournaledLightState = trafficLight->getCurrentState();
+    }
+
+    uint32_t restored = 0;
+    for (uint32_t i = 0; i < header.vehicleCount; i++) {
+        VehicleSnapshot record;
+        if (fread(&record, sizeof(record), 1, file) != 1) {
+            break;
         }
+
+        // The normal spawn path wires the lane, counts and stats; the
+        // record then overwrites route progress and kinematics
+        Vehicle* vehicle = VehiclePool::acquire(record.label, record.lane,
+                                                record.laneNumber,
+                                                record.emergency != 0);
+        vehicle->restoreSnapshot(record);
+        addVehicle(vehicle);
+        restored++;
     }
+    fclose(file);
+
+    if (restored != header.vehicleCount) {
+        DebugLogger::log("Snapshot truncated: restored " +
+                         std::to_string(restored) + " of " +
+                         std::to_string(header.vehicleCount) + " vehicles",
+                         DebugLogger::LogLevel::WARNING);
+    } else {
+        DebugLogger::log("Restored " + std::to_string(restored) +
+                         " vehicles from snapshot " + path);
+    }
+    return restored == header.vehicleCount;
 }
 
+SimulationStats& TrafficManager::getStats() {
+    return stats;
+}
+
+MetricsSegment& TrafficManager::getMetricsSegment() {
+    return metricsSegment;
+}
 
 
 void TrafficManager::preventVehicleOverlap() {
-    // For each lane, check for vehicles that are too close to each other
+    PROFILE_SCOPE("sim.overlap");
+    // Minimum distance between vehicles
+    const float MIN_DISTANCE = 35.0f;
+
+    // For each lane, check for vehicles that are too close to each other.
+    // Vehicles are bucketed along the lane by animPos in MIN_DISTANCE
+    // stripes, so each vehicle is only compared against the handful in
+    // its own and adjacent buckets - O(n) per lane, which keeps the pass
+    // flat at saturation queue depths.
     for (auto* lane : lanes) {
-        const auto& vehicles = lane->getVehicles();
+        // The bucket pass needs random access, so snapshot the queue
+        // into the reusable scratch buffer (free once warmed) instead
+        // of holding a reference into the live queue
+        lane->copyVehicles(overlapScratch);
+        const auto& vehicles = overlapScratch;
 
         // Skip if fewer than 2 vehicles
         if (vehicles.size() < 2) continue;
 
-        // Check each vehicle against others in the lane
-        for (size_t i = 0; i < vehicles.size() - 1; i++) {
-            Vehicle* current = vehicles[i];
-            Vehicle* next = vehicles[i+1];
-
-            if (!current || !next) continue;
-
-            // Calculate distance between vehicles
-            float dx = current->getTurnPosX() - next->getTurnPosX();
-            float dy = current->getTurnPosY() - next->getTurnPosY();
-            float distance = std::sqrt(dx*dx + dy*dy);
-
-            // Minimum distance between vehicles
-            const float MIN_DISTANCE = 35.0f;
+        size_t count = vehicles.size();
 
-            // If too close, adjust next vehicle position
-            if (distance < MIN_DISTANCE) {
-                // Normalize direction vector
-                float normalize = distance > 0 ? distance : 1.0f;
-                dx /= normalize;
-                dy /= normalize;
+        // Find the animPos range covered by this lane's vehicles
+        float minPos = vehicles[0] ? vehicles[0]->getAnimationPos() : 0.0f;
+        float maxPos = minPos;
+        for (size_t i = 1; i < count; i++) {
+            if (!vehicles[i]) continue;
+            float pos = vehicles[i]->getAnimationPos();
+            minPos = std::min(minPos, pos);
+            maxPos = std::max(maxPos, pos);
+        }
 
-                // Move next vehicle back to maintain spacing
-                float moveDistance = MIN_DISTANCE - distance;
-                next->setTurnPosX(next->getTurnPosX() - dx * moveDistance);
-                next->setTurnPosY(next->getTurnPosY() - dy * moveDistance);
+        // One bucket per MIN_DISTANCE stripe; a spacing violation can
+        // only involve vehicles in the same or an adjacent bucket
+        int bucketCount = static_cast<int>((maxPos - minPos) / MIN_DISTANCE) + 1;
+        bucketHeads.assign(bucketCount, -1);
+        bucketNext.assign(count, -1);
+
+        // Single pass: compare each vehicle against the already-inserted
+        // (earlier in queue order) vehicles in nearby buckets, then
+        // insert it. The later vehicle is the one moved back, matching
+        // the old adjacent-pair behavior.
+        for (size_t i = 0; i < count; i++) {
+            Vehicle* current = vehicles[i];
+            if (!current) continue;
+
+            int bucket = static_cast<int>((current->getAnimationPos() - minPos) / MIN_DISTANCE);
+            if (bucket < 0) bucket = 0;
+            if (bucket >= bucketCount) bucket = bucketCount - 1;
+
+            for (int b = std::max(0, bucket - 1);
+                 b <= std::min(bucketCount - 1, bucket + 1); b++) {
+                for (int j = bucketHeads[b]; j != -1; j = bucketNext[j]) {
+                    Vehicle* ahead = vehicles[j];
+                    if (!ahead) continue;
+
+                    // Calculate distance between vehicles
+                    float dx = ahead->getTurnPosX() - current->getTurnPosX();
+                    float dy = ahead->getTurnPosY() - current->getTurnPosY();
+                    float distance = std::sqrt(dx*dx + dy*dy);
+
+                    // If too close, adjust the later vehicle's position
+                    if (distance < MIN_DISTANCE) {
+                        // Normalize direction vector
+                        float normalize = distance > 0 ? distance : 1.0f;
+                        dx /= normalize;
+                        dy /= normalize;
+
+                        // Move the later vehicle back to maintain spacing
+                        float moveDistance = MIN_DISTANCE - distance;
+                        current->setTurnPosX(current->getTurnPosX() - dx * moveDistance);
+                        current->setTurnPosY(current->getTurnPosY() - dy * moveDistance);
+                    }
+                }
             }
+
+            bucketNext[i] = bucketHeads[bucket];
+            bucketHeads[bucket] = static_cast<int>(i);
         }
     }
 }
@@ -0,0 +1,382 @@
+// FILE: src/param_sweep.cpp
+// Parameter sweep runner. Launches one headless simulator instance per
+// sweep point in parallel forked children - up to one per core - runs
+// every point against the identical pre-generated arrival schedule
+// (see ArrivalSchedule.h), aggregates each child's stats-engine
+// snapshot and prints a summary ranked by p99 wait. Tuning studies
+// used to run the points sequentially overnight; an 8-core box now
+// finishes an 8-point sweep in the wall time of one run.
+//
+//   ./param_sweep --param=<name> --values=<v1,v2,...> [--policy=<p>]
+//                 [--jobs=<n>] [--vehicles=<n>] [--rate=<vehicles/sec>]
+//                 [--distribution=exponential|uniform|burst] [--seed=<n>]
+//
+// <name> is any TuningConfig key (green_ms_per_vehicle,
+// priority_threshold_high, priority_threshold_low, spawn_interval_ms,
+// vehicle_speed_base) - these are the runtime-tunable mirrors of the
+// historical Constants.h thresholds. --policy pins every point to one
+// TRAFFIC_LIGHT_POLICY value so the sweep isolates the parameter;
+// --jobs caps concurrency (default: the core count).
+//
+// Same isolation scheme as ab_compare: the parameter override rides a
+// per-point TuningConfig file and the policy rides the environment,
+// both process-wide state, so each point gets its own forked process.
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include "core/Vehicle.h"
+#include "managers/TrafficManager.h"
+#include "utils/ArrivalSchedule.h"
+#include "utils/DebugLogger.h"
+#include "utils/TuningConfig.h"
+#include "utils/VehiclePool.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// One sweep point: the parameter value token is kept verbatim so float
+// and integer parameters both round-trip through the config file
+struct PointConfig {
+    int index = 0;
+    std::string param;
+    std::string value;
+    std::string policy; // Empty = leave TRAFFIC_LIGHT_POLICY alone
+};
+
+// Fixed-width result record a child writes down its pipe (same scheme
+// as ab_compare's SideResult)
+struct PointResult {
+    uint64_t arrivals;
+    uint64_t departures;
+    uint64_t rejected;
+    float waitP50;
+    float waitP90;
+    float waitP99;
+    int maxQueueDepth;
+    uint64_t simulatedMs;
+    double wallSeconds;
+    int failed; // Nonzero when the run could not complete
+};
+
+bool isKnownParam(const std::string& name) {
+    return name == "green_ms_per_vehicle" ||
+           name == "priority_threshold_high" ||
+           name == "priority_threshold_low" ||
+           name == "spawn_interval_ms" ||
+           name == "vehicle_speed_base";
+}
+
+#ifndef _WIN32
+
+// The whole measured run, executed inside the forked child: pump the
+// shared schedule on the deterministic logical clock, drain until every
+// lane is empty (or the drain cap trips), report from the stats engine
+PointResult runPoint(const PointConfig& config,
+                     const std::vector<ScheduledArrival>& schedule) {
+    PointResult result = {};
+
+    if (!config.policy.empty()) {
+        setenv("TRAFFIC_LIGHT_POLICY", config.policy.c_str(), 1);
+    }
+
+    // The swept value rides the normal config-file path, so the run
+    // exercises exactly what a hand-tuned deployment would
+    std::string cfgPath = "param_sweep_" + std::to_string(config.index) + ".cfg";
+    std::ofstream cfg(cfgPath, std::ios::trunc);
+    cfg << config.param << " = " << config.value << "\n";
+    cfg.close();
+    TuningConfig::initialize(cfgPath);
+
+    DebugLogger::initialize("param_sweep_" + std::to_string(config.index) +
+                            ".log");
+
+    TrafficManager manager;
+    if (!manager.initialize()) {
+        result.failed = 1;
+        return result;
+    }
+    manager.setDeterministicClock(true);
+    manager.start();
+
+    const uint32_t TICK_MS = 16;
+    const uint64_t DRAIN_CAP_MS = 10 * 60 * 1000;
+    uint64_t simulatedMs = 0;
+    size_t nextArrival = 0;
+    uint64_t drainStartMs = 0;
+
+    auto wallStart = Clock::now();
+    while (true) {
+        simulatedMs += TICK_MS;
+        while (nextArrival < schedule.size() &&
+               schedule[nextArrival].arrivalMs <= simulatedMs) {
+            const ScheduledArrival& arrival = schedule[nextArrival++];
+            manager.addVehicle(VehiclePool::acquire(arrival.label,
+                                                    arrival.lane,
+                                                    arrival.laneNumber));
+        }
+
+        manager.update(TICK_MS);
+
+        // Deepest single queue across the run; also the drain check
+        int deepest = 0;
+        int queued = 0;
+        for (int road = 0; road < 4; road++) {
+            for (int laneNumber = 1; laneNumber <= 3; laneNumber++) {
+                Lane* lane = manager.findLane(static_cast<char>('A' + road),
+                                              laneNumber);
+                int count = lane ? lane->getVehicleCount() : 0;
+                deepest = std::max(deepest, count);
+                queued += count;
+            }
+        }
+        result.maxQueueDepth = std::max(result.maxQueueDepth, deepest);
+
+        if (nextArrival < schedule.size()) {
+            continue;
+        }
+        if (drainStartMs == 0) {
+            drainStartMs = simulatedMs;
+        }
+        if (queued == 0 || simulatedMs - drainStartMs >= DRAIN_CAP_MS) {
+            break;
+        }
+    }
+    result.wallSeconds = std::chrono::duration_cast<std::chrono::duration<double>>(
+        Clock::now() - wallStart).count();
+
+    SimulationStats::Snapshot snap = manager.getStats().getSnapshot();
+    result.arrivals = snap.totalArrivals;
+    result.departures = snap.totalDepartures;
+    result.rejected = snap.totalRejected;
+    result.waitP50 = snap.waitP50;
+    result.waitP90 = snap.waitP90;
+    result.waitP99 = snap.waitP99;
+    result.simulatedMs = simulatedMs;
+
+    manager.stop();
+    return result;
+}
+
+// Fork one point; the child runs the schedule and writes its result
+// record down the pipe
+pid_t launchPoint(const PointConfig& config,
+                  const std::vector<ScheduledArrival>& schedule,
+                  int pipeFd[2]) {
+    if (pipe(pipeFd) != 0) {
+        return -1;
+    }
+
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(pipeFd[0]);
+        PointResult result = runPoint(config, schedule);
+        ssize_t written = write(pipeFd[1], &result, sizeof(result));
+        close(pipeFd[1]);
+        _exit(written == static_cast<ssize_t>(sizeof(result)) &&
+                      result.failed == 0
+                  ? 0
+                  : 1);
+    }
+
+    close(pipeFd[1]);
+    return pid;
+}
+
+#endif // !_WIN32
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+#ifdef _WIN32
+    (void)argc;
+    (void)argv;
+    std::cerr << "param_sweep needs fork(); not supported on this platform\n";
+    return 1;
+#else
+    size_t vehicleCount = 5000;
+    double ratePerSecond = 60.0;
+    std::string distribution = "exponential";
+    uint32_t seed = 42;
+    std::string param;
+    std::string valueList;
+    std::string policy;
+    unsigned jobs = std::max(1u, std::thread::hardware_concurrency());
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg.rfind("--param=", 0) == 0) {
+            param = arg.substr(8);
+        } else if (arg.rfind("--values=", 0) == 0) {
+            valueList = arg.substr(9);
+        } else if (arg.rfind("--policy=", 0) == 0) {
+            policy = arg.substr(9);
+        } else if (arg.rfind("--jobs=", 0) == 0) {
+            jobs = std::max(1u, static_cast<unsigned>(std::stoul(arg.substr(7))));
+        } else if (arg.rfind("--vehicles=", 0) == 0) {
+            vehicleCount = std::stoull(arg.substr(11));
+        } else if (arg.rfind("--rate=", 0) == 0) {
+            ratePerSecond = std::stod(arg.substr(7));
+        } else if (arg.rfind("--distribution=", 0) == 0) {
+            distribution = arg.substr(15);
+        } else if (arg.rfind("--seed=", 0) == 0) {
+            seed = static_cast<uint32_t>(std::stoul(arg.substr(7)));
+        }
+    }
+
+    if (param.empty() || valueList.empty() || !isKnownParam(param)) {
+        std::cerr << "Usage: param_sweep --param=<name> --values=<v1,v2,...>\n"
+                     "       [--policy=<adaptive|fixed|lqf|compositor>] [--jobs=<n>]\n"
+                     "       [--vehicles=<n>] [--rate=<v/s>]\n"
+                     "       [--distribution=exponential|uniform|burst] [--seed=<n>]\n"
+                     "<name> is a TuningConfig key: green_ms_per_vehicle,\n"
+                     "priority_threshold_high, priority_threshold_low,\n"
+                     "spawn_interval_ms or vehicle_speed_base\n";
+        return 1;
+    }
+    if (distribution != "exponential" && distribution != "uniform" &&
+        distribution != "burst") {
+        std::cerr << "Unknown distribution: " << distribution
+                  << " (want exponential, uniform or burst)\n";
+        return 1;
+    }
+    if (!policy.empty() && policy != "adaptive" && policy != "fixed" &&
+        policy != "lqf" && policy != "compositor") {
+        std::cerr << "Unknown policy: " << policy << "\n";
+        return 1;
+    }
+
+    // Split the value list; tokens stay verbatim for the config file
+    std::vector<PointConfig> points;
+    size_t start = 0;
+    while (start <= valueList.size()) {
+        size_t comma = valueList.find(',', start);
+        std::string token = valueList.substr(
+            start, comma == std::string::npos ? std::string::npos
+                                              : comma - start);
+        if (!token.empty()) {
+            PointConfig point;
+            point.index = static_cast<int>(points.size());
+            point.param = param;
+            point.value = token;
+            point.policy = policy;
+            points.push_back(point);
+        }
+        if (comma == std::string::npos) {
+            break;
+        }
+        start = comma + 1;
+    }
+    if (points.empty()) {
+        std::cerr << "No values to sweep\n";
+        return 1;
+    }
+
+    std::cout << "Sweep: " << param << " over " << points.size()
+              << " points, " << vehicleCount << " vehicles, " << distribution
+              << " arrivals @ " << ratePerSecond << "/s (seed " << seed
+              << "), " << std::min<size_t>(jobs, points.size())
+              << " parallel\n";
+
+    // Every child inherits the identical schedule; building it before
+    // the forks also means building it once
+    std::vector<ScheduledArrival> schedule = buildArrivalSchedule(
+        vehicleCount, ratePerSecond, distribution, seed);
+
+    // Launch up to `jobs` children, refilling as points finish
+    std::vector<PointResult> results(points.size());
+    std::vector<bool> ok(points.size(), false);
+    std::map<pid_t, std::pair<int, int>> running; // pid -> (point, readFd)
+    size_t nextPoint = 0;
+    size_t finished = 0;
+
+    while (finished < points.size()) {
+        while (nextPoint < points.size() && running.size() < jobs) {
+            int pipeFd[2];
+            pid_t pid = launchPoint(points[nextPoint], schedule, pipeFd);
+            if (pid < 0) {
+                std::cerr << "Failed to launch point " << nextPoint << "\n";
+                return 1;
+            }
+            running[pid] = {static_cast<int>(nextPoint), pipeFd[0]};
+            nextPoint++;
+        }
+
+        int status = 0;
+        pid_t pid = waitpid(-1, &status, 0);
+        if (pid < 0) {
+            break;
+        }
+        auto it = running.find(pid);
+        if (it == running.end()) {
+            continue;
+        }
+        int pointIndex = it->second.first;
+        int readFd = it->second.second;
+        running.erase(it);
+
+        // The record is far below PIPE_BUF, so a single read sees
+        // either the whole struct or a dead child
+        ssize_t got = read(readFd, &results[pointIndex],
+                           sizeof(PointResult));
+        close(readFd);
+        ok[pointIndex] = got == static_cast<ssize_t>(sizeof(PointResult)) &&
+                         results[pointIndex].failed == 0 &&
+                         WIFEXITED(status) && WEXITSTATUS(status) == 0;
+        finished++;
+    }
+
+    // Rank by p99 wait (the tuning studies' objective), throughput as
+    // the tie-breaker
+    std::vector<int> order;
+    for (size_t i = 0; i < points.size(); i++) {
+        if (ok[i]) {
+            order.push_back(static_cast<int>(i));
+        } else {
+            std::cerr << "Point " << param << "=" << points[i].value
+                      << " failed\n";
+        }
+    }
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        if (results[a].waitP99 != results[b].waitP99) {
+            return results[a].waitP99 < results[b].waitP99;
+        }
+        return results[a].departures > results[b].departures;
+    });
+
+    std::printf("\n  %4s %-14s %10s %10s %8s %8s %8s %8s %9s %7s\n", "rank",
+                param.size() > 14 ? "value" : param.c_str(), "departed",
+                "veh/s", "p50 s", "p90 s", "p99 s", "maxq", "sim s",
+                "wall s");
+    for (size_t rank = 0; rank < order.size(); rank++) {
+        const PointResult& r = results[order[rank]];
+        double simSeconds = static_cast<double>(r.simulatedMs) / 1000.0;
+        std::printf("  %4zu %-14s %10llu %10.1f %8.1f %8.1f %8.1f %8d %9.1f %7.1f\n",
+                    rank + 1, points[order[rank]].value.c_str(),
+                    static_cast<unsigned long long>(r.departures),
+                    simSeconds > 0 ? r.departures / simSeconds : 0.0,
+                    r.waitP50, r.waitP90, r.waitP99, r.maxQueueDepth,
+                    simSeconds, r.wallSeconds);
+    }
+    if (!order.empty()) {
+        std::cout << "\nBest: " << param << " = " << points[order[0]].value
+                  << " (p99 wait " << results[order[0]].waitP99 << "s)\n";
+    }
+
+    return order.size() == points.size() ? 0 : 1;
+#endif
+}
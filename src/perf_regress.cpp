@@ -0,0 +1,316 @@
+// FILE: src/perf_regress.cpp
+// Performance regression harness. Runs fixed-seed headless scenarios
+// and compares tick-time, ingestion-latency and allocation-count
+// distributions against a baseline JSON, failing (exit 1) on
+// regressions - so every queue or manager change gets its effect on
+// TrafficManager::update() captured as a number, automatically.
+//
+//   ./perf_regress                       compare against perf_baseline.json
+//   ./perf_regress --update              re-record the baseline
+//   ./perf_regress --baseline=<path>     use a different baseline file
+//
+// Methodology: each scenario runs five times and the best (minimum)
+// median is kept, which strips scheduler noise from above; a metric
+// regresses when it exceeds the baseline by more than the noise margin
+// (15% for timings; 2% for allocation counts, which are deterministic
+// under fixed seeds). Baselines are machine-specific - record them on
+// the reference machine, not across hardware.
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <new>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "core/Vehicle.h"
+#include "managers/TrafficManager.h"
+#include "utils/DebugLogger.h"
+#include "utils/VehiclePool.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Global allocation counter, fed by the operator new overrides below;
+// scenario deltas of this are the allocation-count metric
+std::atomic<uint64_t> allocationCount{0};
+
+} // namespace
+
+void* operator new(size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = malloc(size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = malloc(size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
+
+namespace {
+
+constexpr int REPEATS = 5;
+constexpr double TIME_MARGIN = 1.15;  // Timings within 15% are noise
+constexpr double ALLOC_MARGIN = 1.02; // Counts are near-deterministic
+
+uint64_t median(std::vector<uint64_t>& samples) {
+    if (samples.empty()) {
+        return 0;
+    }
+    std::sort(samples.begin(), samples.end());
+    return samples[samples.size() / 2];
+}
+
+uint64_t percentile(const std::vector<uint64_t>& sorted, double pct) {
+    if (sorted.empty()) {
+        return 0;
+    }
+    return sorted[static_cast<size_t>(pct / 100.0 * (sorted.size() - 1))];
+}
+
+// One scenario run's distributions, keyed for the baseline file
+using Metrics = std::map<std::string, uint64_t>;
+
+// Fixed-seed arrival pump, the same shape the load harness uses but
+// sized for a repeatable sub-minute run
+Metrics runScenario(const std::string& distribution, size_t vehicleCount,
+                    double ratePerSecond, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::exponential_distribution<double> expGap(ratePerSecond / 1000.0);
+    std::uniform_int_distribution<int> roadDist(0, 3);
+    std::uniform_int_distribution<int> laneDist(2, 3);
+
+    struct Arrival {
+        uint64_t arrivalMs;
+        char lane;
+        int laneNumber;
+        std::string label;
+    };
+    std::vector<Arrival> schedule;
+    schedule.reserve(vehicleCount);
+
+    const size_t burstSize = static_cast<size_t>(ratePerSecond);
+    double clockMs = 0.0;
+    for (size_t i = 0; i < vehicleCount; i++) {
+        if (distribution == "burst") {
+            if (burstSize > 0 && i % burstSize == 0 && i > 0) {
+                clockMs += 1000.0;
+            }
+        } else {
+            clockMs += expGap(rng);
+        }
+
+        Arrival arrival;
+        arrival.arrivalMs = static_cast<uint64_t>(clockMs);
+        arrival.lane = static_cast<char>('A' + roadDist(rng));
+        arrival.laneNumber = laneDist(rng);
+        arrival.label = "V" + std::to_string(i) + "_L" +
+                        std::to_string(arrival.laneNumber) +
+                        (arrival.laneNumber == 3 ? "_LEFT" : "_STRAIGHT");
+        schedule.push_back(std::move(arrival));
+    }
+
+    TrafficManager manager;
+    if (!manager.initialize()) {
+        std::cerr << "Traffic manager initialization failed\n";
+        exit(1);
+    }
+    manager.setDeterministicClock(true);
+    manager.start();
+
+    const uint32_t TICK_MS = 16;
+    uint64_t simulatedMs = 0;
+    size_t nextArrival = 0;
+    std::vector<uint64_t> tickNs;
+    std::vector<uint64_t> ingestNs;
+    tickNs.reserve(schedule.back().arrivalMs / TICK_MS + 2);
+    ingestNs.reserve(vehicleCount);
+
+    uint64_t allocsBefore = allocationCount.load(std::memory_order_relaxed);
+
+    while (nextArrival < schedule.size()) {
+        simulatedMs += TICK_MS;
+        while (nextArrival < schedule.size() &&
+               schedule[nextArrival].arrivalMs <= simulatedMs) {
+            const Arrival& arrival = schedule[nextArrival++];
+            auto ingestStart = Clock::now();
+            manager.addVehicle(VehiclePool::acquire(arrival.label,
+                                                    arrival.lane,
+                                                    arrival.laneNumber));
+            ingestNs.push_back(static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    Clock::now() - ingestStart).count()));
+        }
+
+        auto tickStart = Clock::now();
+        manager.update(TICK_MS);
+        tickNs.push_back(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                Clock::now() - tickStart).count()));
+    }
+
+    uint64_t allocs =
+        allocationCount.load(std::memory_order_relaxed) - allocsBefore;
+    manager.stop();
+
+    std::sort(tickNs.begin(), tickNs.end());
+    std::sort(ingestNs.begin(), ingestNs.end());
+
+    Metrics metrics;
+    metrics["tick_p50_ns"] = percentile(tickNs, 50.0);
+    metrics["tick_p99_ns"] = percentile(tickNs, 99.0);
+    metrics["ingest_p50_ns"] = percentile(ingestNs, 50.0);
+    metrics["ingest_p99_ns"] = percentile(ingestNs, 99.0);
+    metrics["allocs"] = allocs;
+    return metrics;
+}
+
+// Best-of-N medians per metric, the number that goes into the report
+Metrics runScenarioBest(const std::string& distribution, size_t vehicleCount,
+                        double ratePerSecond, uint32_t seed) {
+    std::map<std::string, std::vector<uint64_t>> samples;
+    for (int repeat = 0; repeat < REPEATS; repeat++) {
+        Metrics metrics = runScenario(distribution, vehicleCount,
+                                      ratePerSecond, seed);
+        for (const auto& [key, value] : metrics) {
+            samples[key].push_back(value);
+        }
+    }
+
+    Metrics best;
+    for (auto& [key, values] : samples) {
+        best[key] = *std::min_element(values.begin(), values.end());
+    }
+    return best;
+}
+
+// Flat-keyed JSON: { "scenario.metric": value, ... } - valid JSON, and
+// parseable without pulling in a parser
+void writeBaseline(const std::string& path,
+                   const std::map<std::string, Metrics>& results) {
+    std::ofstream file(path, std::ios::trunc);
+    file << "{\n";
+    bool first = true;
+    for (const auto& [scenario, metrics] : results) {
+        for (const auto& [key, value] : metrics) {
+            if (!first) {
+                file << ",\n";
+            }
+            first = false;
+            file << "  \"" << scenario << "." << key << "\": " << value;
+        }
+    }
+    file << "\n}\n";
+}
+
+bool readBaseline(const std::string& path,
+                  std::map<std::string, uint64_t>& baseline) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        size_t open = line.find('"');
+        size_t close = line.find('"', open + 1);
+        size_t colon = line.find(':', close == std::string::npos ? 0 : close);
+        if (open == std::string::npos || close == std::string::npos ||
+            colon == std::string::npos) {
+            continue;
+        }
+        std::string key = line.substr(open + 1, close - open - 1);
+        baseline[key] = std::stoull(line.substr(colon + 1));
+    }
+    return !baseline.empty();
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::string baselinePath = "perf_baseline.json";
+    bool update = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--update") {
+            update = true;
+        } else if (arg.rfind("--baseline=", 0) == 0) {
+            baselinePath = arg.substr(11);
+        }
+    }
+
+    DebugLogger::initialize("perf_regress.log");
+
+    // The scenario matrix: steady arrivals, arrival bursts, and a
+    // deeper sustained load. Fixed seeds keep spawn sequences and
+    // therefore allocation counts repeatable.
+    std::map<std::string, Metrics> results;
+    std::cout << "Running scenarios (" << REPEATS << " repeats each)...\n";
+    results["steady"] = runScenarioBest("exponential", 20000, 2000.0, 1);
+    results["burst"] = runScenarioBest("burst", 20000, 2000.0, 2);
+    results["saturated"] = runScenarioBest("exponential", 40000, 8000.0, 3);
+
+    std::map<std::string, uint64_t> baseline;
+    if (update || !readBaseline(baselinePath, baseline)) {
+        writeBaseline(baselinePath, results);
+        std::cout << (update ? "Baseline updated: " : "No baseline found; recorded: ")
+                  << baselinePath << "\n";
+        return 0;
+    }
+
+    bool failed = false;
+    std::cout << std::left << std::setw(28) << "metric"
+              << std::right << std::setw(14) << "baseline"
+              << std::setw(14) << "current" << "  verdict\n";
+
+    for (const auto& [scenario, metrics] : results) {
+        for (const auto& [key, value] : metrics) {
+            std::string fullKey = scenario + "." + key;
+            auto it = baseline.find(fullKey);
+            if (it == baseline.end()) {
+                std::cout << std::left << std::setw(28) << fullKey
+                          << "  (no baseline - rerun with --update)\n";
+                continue;
+            }
+
+            double margin = (key == "allocs") ? ALLOC_MARGIN : TIME_MARGIN;
+            bool regressed = static_cast<double>(value) >
+                             static_cast<double>(it->second) * margin;
+            failed = failed || regressed;
+
+            std::cout << std::left << std::setw(28) << fullKey
+                      << std::right << std::setw(14) << it->second
+                      << std::setw(14) << value
+                      << (regressed ? "  REGRESSED" : "  ok") << "\n";
+        }
+    }
+
+    if (failed) {
+        std::cout << "\nFAIL: regression over the noise margin; investigate "
+                     "or re-baseline with --update\n";
+        return 1;
+    }
+    std::cout << "\nPASS\n";
+    return 0;
+}
@@ -0,0 +1,119 @@
+// FILE: src/stats_csv.cpp
+//
+// Post-step converter for stats tapes (see utils/StatsTape.h): reads
+// the columnar binary file the simulator records with
+// TRAFFIC_STATS_TAPE=<path> and writes row-oriented CSV to stdout for
+// tools that want one line per tick.
+//
+// Usage: stats_csv <tape.bin> > out.csv
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "utils/StatsTape.h"
+
+namespace {
+
+bool readFully(std::FILE* file, void* out, size_t bytes) {
+    return std::fread(out, 1, bytes, file) == bytes;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc != 2) {
+        std::fprintf(stderr, "Usage: stats_csv <tape.bin> > out.csv\n");
+        return 1;
+    }
+
+    std::FILE* file = std::fopen(argv[1], "rb");
+    if (!file) {
+        std::fprintf(stderr, "Cannot open tape file: %s\n", argv[1]);
+        return 1;
+    }
+
+    StatsTapeHeader header;
+    if (!readFully(file, &header, sizeof(header)) ||
+        header.magic != StatsTape::MAGIC ||
+        header.version != StatsTape::VERSION ||
+        header.laneSlots != StatsTape::LANE_SLOTS) {
+        std::fprintf(stderr, "%s is not a valid stats tape\n", argv[1]);
+        std::fclose(file);
+        return 1;
+    }
+
+    const int slots = static_cast<int>(header.laneSlots);
+
+    // Header row: time, light, then depth/arrivals/departures per lane
+    std::printf("time_ms,light_state");
+    for (int metricPass = 0; metricPass < 3; metricPass++) {
+        const char* metric = metricPass == 0 ? "depth"
+                           : metricPass == 1 ? "arrivals" : "departures";
+        for (int slot = 0; slot < slots; slot++) {
+            std::printf(",%c%d_%s", header.laneIds[slot],
+                        header.laneNumbers[slot], metric);
+        }
+    }
+    std::printf("\n");
+
+    std::vector<uint32_t> timeMs;
+    std::vector<uint8_t> lightState;
+    std::vector<uint16_t> depth;
+    std::vector<uint8_t> arrivals;
+    std::vector<uint8_t> departures;
+
+    StatsTapeBlockHeader blockHeader;
+    while (readFully(file, &blockHeader, sizeof(blockHeader))) {
+        uint32_t n = blockHeader.tickCount;
+        if (n == 0 || n > header.blockTicks) {
+            std::fprintf(stderr, "Corrupt block header (count %u)\n", n);
+            std::fclose(file);
+            return 1;
+        }
+
+        timeMs.resize(n);
+        lightState.resize(n);
+        depth.resize(static_cast<size_t>(n) * slots);
+        arrivals.resize(static_cast<size_t>(n) * slots);
+        departures.resize(static_cast<size_t>(n) * slots);
+
+        // Columns land in the same order the writer emitted them; the
+        // per-lane strips stay strip-major (slot, then tick) in memory
+        bool ok = readFully(file, timeMs.data(), n * sizeof(uint32_t)) &&
+                  readFully(file, lightState.data(), n) &&
+                  readFully(file, depth.data(),
+                            static_cast<size_t>(n) * slots * sizeof(uint16_t)) &&
+                  readFully(file, arrivals.data(),
+                            static_cast<size_t>(n) * slots) &&
+                  readFully(file, departures.data(),
+                            static_cast<size_t>(n) * slots);
+        if (!ok) {
+            std::fprintf(stderr, "Truncated block (expected %u ticks)\n", n);
+            std::fclose(file);
+            return 1;
+        }
+
+        for (uint32_t i = 0; i < n; i++) {
+            std::printf("%u,%u", timeMs[i],
+                        static_cast<unsigned>(lightState[i]));
+            for (int slot = 0; slot < slots; slot++) {
+                std::printf(",%u", static_cast<unsigned>(
+                    depth[static_cast<size_t>(slot) * n + i]));
+            }
+            for (int slot = 0; slot < slots; slot++) {
+                std::printf(",%u", static_cast<unsigned>(
+                    arrivals[static_cast<size_t>(slot) * n + i]));
+            }
+            for (int slot = 0; slot < slots; slot++) {
+                std::printf(",%u", static_cast<unsigned>(
+                    departures[static_cast<size_t>(slot) * n + i]));
+            }
+            std::printf("\n");
+        }
+    }
+
+    std::fclose(file);
+    return 0;
+}
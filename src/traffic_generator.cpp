@@ -1,4 +1,4 @@
-// F// FILE: src/traffic_generator.cpp
+// FILE: src/traffic_generator.cpp
 #include <iostream>
 #include <fstream>
 #include <string>
@@ -10,9 +10,15 @@
 #include <ctime>
 #include <mutex>
 #include <iomanip>
+#include <array>
 #include <atomic>
 #include <csignal>
-#include <map>
+#include <cstdint>
+#include <cstring>
+
+#include "utils/LaneExchange.h"
+#include "utils/MetricsSegment.h"
+#include "utils/SharedMemoryChannel.h"
 
 // Include Windows-specific headers if on Windows
 #ifdef _WIN32
@@ -27,9 +33,16 @@ const std::string DATA_DIR = "data/lanes";
 const int GENERATION_INTERVAL_MS = 2000;  // Increased from 800ms to 2000ms
 const int MAX_VEHICLES_PER_BATCH = 30;    // Reduced from 50 to 30
 const int MAX_TOTAL_VEHICLES = 60;        // New: Global limit
+const int BATCHED_VEHICLES_PER_CYCLE = 10; // Batched mode: spawns per cycle
 const int PRIORITY_THRESHOLD_HIGH = 10;
 const int PRIORITY_THRESHOLD_LOW = 5;
 
+// Per-lane backpressure cap, enforced only while the simulator's
+// occupancy feedback is live (see refresh_from_feedback): spawns aimed
+// at a lane holding this many vehicles are redirected or skipped, so a
+// saturated lane stops receiving traffic it would only discard
+const int LANE_FULL_THRESHOLD = 15;
+
 // Vehicle direction (for lane assignment)
 enum class Direction {
     LEFT,
@@ -37,9 +50,123 @@ enum class Direction {
     RIGHT
 };
 
+// Dense lane slot index, (lane - 'A') * 3 + (laneNumber - 1) - the same
+// order the simulator's Constants::laneSlot uses. Lane state lives in
+// std::array indexed by this instead of string-keyed maps.
+constexpr int LANE_SLOT_COUNT = 12;
+
+int lane_slot(char lane, int laneNumber) {
+    return (lane - 'A') * 3 + (laneNumber - 1);
+}
+
+// In-memory model of how many vehicles each lane holds, indexed by
+// lane_slot(). Spawns increment it directly; the simulator drains the
+// lane files behind our back, so reconcile_lane_counts() re-reads them
+// on the stats-display cadence (and at startup) to pull the model back
+// down. Between reconciles the model can only over-count, which at
+// worst pauses generation a little early - and the per-cycle limit and
+// priority checks no longer cost a full read of every lane file.
+std::array<int, LANE_SLOT_COUNT> laneCounts{};
+
+// Walker alias table: O(1) weighted sampling with a single uniform
+// draw. The spawn loop used to build a std::discrete_distribution (and
+// its weight vector) on every call; these are built once at startup.
+struct AliasTable {
+    std::array<double, 4> probability{};
+    std::array<int, 4> alias{};
+    int size = 0;
+
+    void init(const double* weights, int count) {
+        size = count;
+        double total = 0.0;
+        for (int i = 0; i < count; i++) {
+            total += weights[i];
+        }
+
+        std::array<double, 4> scaled{};
+        int small[4];
+        int large[4];
+        int smallCount = 0;
+        int largeCount = 0;
+        for (int i = 0; i < count; i++) {
+            scaled[i] = weights[i] * count / total;
+            probability[i] = 1.0;
+            alias[i] = i;
+        }
+        for (int i = count - 1; i >= 0; i--) {
+            if (scaled[i] < 1.0) {
+                small[smallCount++] = i;
+            } else {
+                large[largeCount++] = i;
+            }
+        }
+        while (smallCount > 0 && largeCount > 0) {
+            int s = small[--smallCount];
+            int l = large[--largeCount];
+            probability[s] = scaled[s];
+            alias[s] = l;
+            scaled[l] = (scaled[l] + scaled[s]) - 1.0;
+            if (scaled[l] < 1.0) {
+                small[smallCount++] = l;
+            } else {
+                large[largeCount++] = l;
+            }
+        }
+        while (largeCount > 0) {
+            probability[large[--largeCount]] = 1.0;
+        }
+        while (smallCount > 0) {
+            probability[small[--smallCount]] = 1.0;
+        }
+    }
+
+    int sample(std::mt19937& rng) const {
+        std::uniform_real_distribution<double> uniform(0.0, 1.0);
+        double u = uniform(rng) * size;
+        int column = static_cast<int>(u);
+        if (column >= size) {
+            column = size - 1;
+        }
+        return (u - column) < probability[column] ? column : alias[column];
+    }
+};
+
 // Global atomic flag to control continuous generation
 std::atomic<bool> keepRunning(true);
 
+// Seed override from --seed=N (-1 = nondeterministic, the default)
+long long seedOverride = -1;
+
+// Single RNG shared by every generation decision (lane, lane number,
+// direction, spawn interval jitter). With --seed=N each run produces an
+// identical vehicle sequence, so benchmark runs are comparable.
+std::mt19937& global_rng() {
+    static std::mt19937 rng(seedOverride >= 0
+        ? static_cast<std::mt19937::result_type>(seedOverride)
+        : std::random_device{}());
+    return rng;
+}
+
+// Shared memory channel to the simulator (fast spawn path).
+// When it can't be created, vehicles go through the lane files as before.
+SharedMemoryChannel shmChannel;
+
+// Memory-mapped exchange file: the preferred disk-backed transport when
+// the shm ring is unavailable or full. Pushes are cursor stores through
+// the mapping - no open/append per vehicle and no truncate race with
+// the simulator's reads. The text lane files remain the last resort.
+LaneExchange laneExchange;
+
+// Occupancy feedback from the simulator: the metrics segment it
+// publishes carries every lane's real queue depth (seqlock-sampled, so
+// reading it never blocks the simulation). While live, it replaces
+// guessing occupancy from our own output files - which only says what
+// we produced, not what the junction absorbed - so the global limit and
+// the per-lane cap throttle production at the source instead of letting
+// the simulator pay ingestion cost for overflow it discards.
+MetricsSegment metricsFeed;
+bool feedbackLive = false;
+
 // Signal handler for clean shutdown
 void signalHandler(int signum) {
     keepRunning = false;
@@ -74,14 +201,143 @@ void console_log(const std::string& message, const std::string& color = "\033[1;
     std::cout << color << "[" << timestamp << "]\033[0m " << message << std::endl;
 }
 
-// Ensure data directories exist
+// True when TRAFFIC_BINARY_FORMAT=1 - lane files then carry fixed-width
+// VehicleMessage records instead of text lines (matches FileHandler)
+bool binary_format_enabled() {
+    static const bool enabled = []() {
+        const char* env = std::getenv("TRAFFIC_BINARY_FORMAT");
+        return env && env[0] == '1';
+    }();
+    return enabled;
+}
+
+// Lane file path honoring the startup format selection
+std::string lane_file_path(char lane) {
+    return DATA_DIR + "/lane" + lane + (binary_format_enabled() ? ".bin" : ".txt");
+}
+
+// Generator-private spool the batches accumulate in before publishing
+std::string lane_spool_path(char lane) {
+    return lane_file_path(lane) + ".spool";
+}
+
+// True when TRAFFIC_APPEND_LOG=1 - the lane-file fallback then appends
+// to one append-only log per lane that the simulator consumes through a
+// read cursor (see FileHandler::appendLogEnabled). No spool, no
+// rename-publish, and nothing is ever removed while both sides run, so
+// there is no batch to lose and no per-batch rename on either side.
+// Both processes must be launched with the same setting.
+bool append_log_enabled() {
+    static const bool enabled = []() {
+        const char* env = std::getenv("TRAFFIC_APPEND_LOG");
+        return env && env[0] == '1';
+    }();
+    return enabled;
+}
+
+// Append-only log path (one per lane, shared with the simulator)
+std::string lane_log_path(char lane) {
+    return DATA_DIR + "/lane" + lane + ".log";
+}
+
+// Rename-swap publish: vehicles are appended to the private spool and
+// the spool renamed onto the published name in one atomic step. The
+// simulator claims a published file by renaming it away before parsing,
+// so neither side ever holds the other's path - the old shared-path
+// scheme needed 3-attempt/50ms retry loops on both sides. If the
+// simulator hasn't claimed the previous batch yet the spool just keeps
+// accumulating until the next publish attempt.
+void publish_lane_file(char lane) {
+    std::string spool = lane_spool_path(lane);
+    std::error_code fsError;
+    if (!fs::exists(spool, fsError)) {
+        return; // Nothing spooled
+    }
+    if (fs::exists(lane_file_path(lane), fsError)) {
+        return; // Previous batch still unclaimed; keep spooling
+    }
+    // Only this process ever creates the published name, so the
+    // exists-then-rename pair cannot clobber a fresh batch
+    fs::rename(spool, lane_file_path(lane), fsError);
+    if (fsError) {
+        console_log("ERROR: Could not publish " + lane_file_path(lane), "\033[1;31m");
+    }
+}
+
+// Ensure data directories exist. create_directories() is already a
+// no-op on an existing tree, so there's no separate exists() probe.
 void ensure_directories() {
-    if (!fs::exists(DATA_DIR)) {
-        fs::create_directories(DATA_DIR);
+    std::error_code ec;
+    if (fs::create_directories(DATA_DIR, ec)) {
         console_log("Created directory: " + DATA_DIR);
     }
 }
 
+// True when TRAFFIC_BATCHED_SPAWN=1 - a generation cycle's vehicles are
+// then accumulated in memory and flushed with one write per lane file,
+// instead of an open/append/close per vehicle
+bool batched_spawn_enabled() {
+    static const bool enabled = []() {
+        const char* env = std::getenv("TRAFFIC_BATCHED_SPAWN");
+        return env && env[0] == '1';
+    }();
+    return enabled;
+}
+
+// Build the full encoded vehicle ID the file format expects
+std::string encode_vehicle_id(const std::string& id, int laneNumber, Direction dir) {
+    std::string fullId = id + "_L" + std::to_string(laneNumber);
+    if (laneNumber == 3) {
+        // Lane 3 always turns left
+        fullId += "_LEFT";
+    } else if (laneNumber == 2) {
+        // Lane 2 can go straight or left (changed from right to left)
+        fullId += (dir == Direction::STRAIGHT) ? "_STRAIGHT" : "_LEFT";
+    }
+    return fullId;
+}
+
+// Build the fixed-width record the shared memory and binary paths carry
+// Creation stamp for spawn-latency measurement: CLOCK_MONOTONIC has one
+// base (boot) for every process on the host, so the simulator can
+// subtract this from its own reading of the same clock
+uint64_t now_micros() {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+VehicleMessage make_message(const std::string& fullId, char lane, int laneNumber, Direction dir) {
+    VehicleMessage message = {};
+    std::strncpy(message.id, fullId.c_str(), sizeof(message.id) - 1);
+    message.lane = lane;
+    message.laneNumber = static_cast<int8_t>(laneNumber);
+    message.destination = (laneNumber == 3 || dir == Direction::LEFT) ? 1
+                        : (dir == Direction::RIGHT) ? 2 : 0;
+    message.emergency = 0;
+    message.timestamp = now_micros();
+    return message;
+}
+
+// Colored "Added Vn to lane X" console line shared by both spawn paths
+void log_spawn(const std::string& id, char lane, int laneNumber, Direction dir) {
+    std::string color = "\033[1;32m"; // Default green
+    std::string dirStr = "";
+
+    if (laneNumber == 3) {
+        color = "\033[1;32m"; // Green for free lane
+        dirStr = " (LEFT turn)";
+    } else if (laneNumber == 2 && lane == 'A') {
+        color = "\033[1;33m"; // Yellow for priority lane
+        dirStr = (dir == Direction::STRAIGHT) ? " (STRAIGHT)" : " (LEFT turn)";
+    } else if (laneNumber == 2) {
+        color = "\033[1;37m"; // White for normal lane 2
+        dirStr = (dir == Direction::STRAIGHT) ? " (STRAIGHT)" : " (LEFT turn)";
+    }
+
+    console_log("Added " + id + " to lane " + lane + std::to_string(laneNumber) + dirStr, color);
+}
+
 // Write a vehicle to lane file with updated turn directions
 void write_vehicle(const std::string& id, char lane, int laneNumber, Direction dir = Direction::LEFT) {
     static std::mutex fileMutex;
@@ -92,97 +348,299 @@ void write_vehicle(const std::string& id, char lane, int laneNumber, Direction d
         return;
     }
 
-    std::string filepath = DATA_DIR + "/lane" + lane + ".txt";
-    std::ofstream file(filepath, std::ios::app);
+    std::string fullId = encode_vehicle_id(id, laneNumber, dir);
 
-    if (file.is_open()) {
-        // Format: vehicleId_L{laneNumber}:lane
-        file << id << "_L" << laneNumber;
+    // Fast path: push the vehicle through shared memory so the simulator
+    // picks it up on its next frame instead of its next file poll
+    bool delivered = false;
+    if (shmChannel.isAvailable()) {
+        delivered = shmChannel.push(make_message(fullId, lane, laneNumber, dir));
+    }
 
-        // Add direction info based on lane and specific rules
-        if (laneNumber == 3) {
-            // Lane 3 always turns left
-            file << "_LEFT";
-        } else if (laneNumber == 2) {
-            // Lane 2 can go straight or left (changed from right to left)
-            if (dir == Direction::STRAIGHT) {
-                file << "_STRAIGHT";
-            } else {
-                file << "_LEFT"; // Changed from _RIGHT to _LEFT
+    // Next best: cursor-store into the memory-mapped exchange file
+    if (!delivered && laneExchange.isAvailable()) {
+        delivered = laneExchange.push(make_message(fullId, lane, laneNumber, dir));
+    }
+
+    // Fallback: spool to disk and rename-publish (also used when the
+    // rings are full). In append-log mode the append goes straight to
+    // the lane's log and there is nothing to publish.
+    if (!delivered) {
+        std::string spoolpath = append_log_enabled() ? lane_log_path(lane)
+                                                     : lane_spool_path(lane);
+
+        if (binary_format_enabled()) {
+            // One fixed-width record per vehicle, no text formatting
+            std::ofstream file(spoolpath, std::ios::app | std::ios::binary);
+            if (!file.is_open()) {
+                console_log("ERROR: Could not open file " + spoolpath, "\033[1;31m");
+                return;
             }
-        }
 
-        file << ":" << lane << std::endl;
-        file.close();
+            VehicleMessage message = make_message(fullId, lane, laneNumber, dir);
+            file.write(reinterpret_cast<const char*>(&message), sizeof(message));
+            file.close();
+        } else {
+            std::ofstream file(spoolpath, std::ios::app);
+            if (!file.is_open()) {
+                console_log("ERROR: Could not open file " + spoolpath, "\033[1;31m");
+                return;
+            }
 
-        // Format log message with colors based on lane type
-        std::string color = "\033[1;32m"; // Default green
-        std::string dirStr = "";
+            // Format: vehicleId_L{laneNumber}[_DIRECTION]:lane@createdUs
+            // (the stamp suffix feeds the spawn-latency histograms;
+            // readers without it still parse the line)
+            file << fullId << ":" << lane << "@" << now_micros() << std::endl;
+            file.close();
+        }
 
-        if (laneNumber == 3) {
-            color = "\033[1;32m"; // Green for free lane
-            dirStr = " (LEFT turn)";
-        } else if (laneNumber == 2 && lane == 'A') {
-            color = "\033[1;33m"; // Yellow for priority lane
-            dirStr = (dir == Direction::STRAIGHT) ? " (STRAIGHT)" : " (LEFT turn)";
-        } else if (laneNumber == 2) {
-            color = "\033[1;37m"; // White for normal lane 2
-            dirStr = (dir == Direction::STRAIGHT) ? " (STRAIGHT)" : " (LEFT turn)";
+        if (!append_log_enabled()) {
+            publish_lane_file(lane);
         }
+    }
+
+    log_spawn(id, lane, laneNumber, dir);
+}
+
+// One generation cycle's worth of pending spawns, per lane, waiting for
+// a single flush_batch() write
+struct SpawnBatch {
+    std::vector<std::string> lines[4];      // Text mode, indexed by lane - 'A'
+    std::vector<VehicleMessage> records[4]; // Binary mode
+    int queued = 0;
+};
+
+// Batched-mode counterpart of write_vehicle(): queue in memory only. The
+// shared memory fast path still delivers immediately - batching applies
+// to the lane-file fallback.
+void queue_vehicle(SpawnBatch& batch, const std::string& id, char lane, int laneNumber,
+                   Direction dir = Direction::LEFT) {
+    if (laneNumber < 1 || laneNumber > 3 || laneNumber == 1) {
+        return;
+    }
 
-        console_log("Added " + id + " to lane " + lane + std::to_string(laneNumber) + dirStr, color);
+    std::string fullId = encode_vehicle_id(id, laneNumber, dir);
+    batch.queued++;
+
+    if (shmChannel.isAvailable() &&
+        shmChannel.push(make_message(fullId, lane, laneNumber, dir))) {
+        log_spawn(id, lane, laneNumber, dir);
+        return;
+    }
+
+    if (laneExchange.isAvailable() &&
+        laneExchange.push(make_message(fullId, lane, laneNumber, dir))) {
+        log_spawn(id, lane, laneNumber, dir);
+        return;
+    }
+
+    if (binary_format_enabled()) {
+        batch.records[lane - 'A'].push_back(make_message(fullId, lane, laneNumber, dir));
     } else {
-        console_log("ERROR: Could not open file " + filepath, "\033[1;31m");
+        batch.lines[lane - 'A'].push_back(fullId + ":" + lane + "@" +
+                                          std::to_string(now_micros()));
     }
+    log_spawn(id, lane, laneNumber, dir);
 }
 
-// Generate a random lane (A, B, C, D) - North, East, South, West
-char random_lane() {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    std::uniform_int_distribution<int> dist(0, 3);
-    return 'A' + dist(gen);
+// Write out everything queue_vehicle() accumulated: at most one
+// open/append/close per lane, however many vehicles the cycle produced
+void flush_batch(SpawnBatch& batch) {
+    for (char lane = 'A'; lane <= 'D'; lane++) {
+        int index = lane - 'A';
+        if (batch.lines[index].empty() && batch.records[index].empty()) {
+            // Nothing new, but a spool blocked by an unclaimed batch
+            // may be waiting for another publish attempt
+            if (!append_log_enabled()) {
+                publish_lane_file(lane);
+            }
+            continue;
+        }
+
+        std::string spoolpath = append_log_enabled() ? lane_log_path(lane)
+                                                     : lane_spool_path(lane);
+
+        if (binary_format_enabled()) {
+            std::ofstream file(spoolpath, std::ios::app | std::ios::binary);
+            if (!file.is_open()) {
+                console_log("ERROR: Could not open file " + spoolpath, "\033[1;31m");
+                continue;
+            }
+            for (const auto& record : batch.records[index]) {
+                file.write(reinterpret_cast<const char*>(&record), sizeof(record));
+            }
+        } else {
+            std::ofstream file(spoolpath, std::ios::app);
+            if (!file.is_open()) {
+                console_log("ERROR: Could not open file " + spoolpath, "\033[1;31m");
+                continue;
+            }
+            for (const auto& line : batch.lines[index]) {
+                file << line << "\n";
+            }
+        }
+
+        if (!append_log_enabled()) {
+            publish_lane_file(lane);
+        }
+
+        batch.lines[index].clear();
+        batch.records[index].clear();
+    }
 }
 
-// Generate a lane number - only Lane 2 or 3 (never Lane 1)
-int random_lane_number() {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
+char random_lane(std::mt19937& rng);
+int random_lane_number(std::mt19937& rng);
+Direction random_direction(int laneNumber, std::mt19937& rng);
+
+// Pick a spawn point with the same distribution and biases the
+// single-vehicle path has always used
+void pick_spawn(std::mt19937& gen, char& lane, int& lane_num, Direction& dir) {
+    lane = random_lane(gen);
+    lane_num = random_lane_number(gen); // Will only return 2 or 3
+    dir = random_direction(lane_num, gen);
+
+    // For testing priority condition, occasionally bias toward lane A2
+    if (gen() % 10 == 0) {
+        lane = 'A';
+        lane_num = 2;
+        dir = (gen() % 2 == 0) ? Direction::STRAIGHT : Direction::LEFT;
+    }
+
+    // Also ensure good distribution for lane 3 (free lane)
+    if (gen() % 15 == 0) {
+        lane = random_lane(gen);
+        lane_num = 3; // Force lane 3 (free lane)
+        dir = Direction::LEFT; // Lane 3 always turns left
+    }
+}
+
+// Pull the simulator's real lane occupancy into the in-memory model.
+// Returns true when the model was refreshed this cycle. The segment is
+// (re)opened lazily with a retry backoff, so the generator works
+// unchanged when the simulator isn't up yet - or goes away mid-run.
+// Vehicles we wrote that the simulator hasn't ingested yet are invisible
+// to the feed, so the model can briefly under-count; at a 2s cycle
+// against ~200ms ingestion latency that overshoots by at most a cycle's
+// batch, the same slack the file-count model always had.
+bool refresh_from_feedback() {
+    if (!metricsFeed.isAvailable()) {
+        static auto lastAttempt = std::chrono::steady_clock::time_point{};
+        auto now = std::chrono::steady_clock::now();
+        if (now - lastAttempt < std::chrono::seconds(5)) {
+            return false;
+        }
+        lastAttempt = now;
+        if (!metricsFeed.open()) {
+            return false;
+        }
+        console_log("📈 Occupancy feedback attached (throttling on simulator lane counts)", "\033[1;35m");
+    }
 
-    // Only generate Lane 2 (60%) or Lane 3 (40%) - never Lane 1
-    std::vector<double> weights = {0.0, 0.6, 0.4}; // Weights for lanes 1, 2, 3
-    std::discrete_distribution<int> dist(weights.begin(), weights.end());
+    MetricsBlock block;
+    if (!metricsFeed.sample(block)) {
+        return false;
+    }
 
-    return dist(gen) + 1; // Returns 2 or 3
+    for (const auto& laneMetrics : block.lanes) {
+        if (laneMetrics.laneId < 'A' || laneMetrics.laneId > 'D' ||
+            laneMetrics.laneNumber < 1 || laneMetrics.laneNumber > 3) {
+            continue;
+        }
+        laneCounts[lane_slot(laneMetrics.laneId, laneMetrics.laneNumber)] =
+            laneMetrics.queueDepth;
+    }
+    return true;
 }
 
-// Generate direction (LEFT or STRAIGHT) based on lane rules
-Direction random_direction(int laneNumber) {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
+// pick_spawn with the per-lane cap applied: re-roll a few times when
+// the pick lands on a saturated lane, and skip the spawn entirely when
+// every roll does (the junction is backed up everywhere - producing
+// more would only queue ingestion work the simulator throws away).
+// Without live feedback this is plain pick_spawn.
+bool pick_spawn_throttled(std::mt19937& gen, char& lane, int& lane_num,
+                          Direction& dir) {
+    for (int attempt = 0; attempt < 4; attempt++) {
+        pick_spawn(gen, lane, lane_num, dir);
+        if (!feedbackLive ||
+            laneCounts[lane_slot(lane, lane_num)] < LANE_FULL_THRESHOLD) {
+            return true;
+        }
+    }
+    return false;
+}
 
+// Generate a random lane (A, B, C, D) - North, East, South, West. The
+// RNG comes in as a parameter so shard workers can draw from their own
+// streams; the single-threaded paths pass global_rng().
+char random_lane(std::mt19937& rng) {
+    std::uniform_int_distribution<int> dist(0, 3);
+    return 'A' + dist(rng);
+}
+
+// Generate a lane number - only Lane 2 or 3 (never Lane 1)
+int random_lane_number(std::mt19937& rng) {
+    // Only generate Lane 2 (60%) or Lane 3 (40%) - never Lane 1;
+    // the alias table is built once and sampled with one draw
+    static const AliasTable table = []() {
+        AliasTable t;
+        const double weights[3] = {0.0, 0.6, 0.4}; // Weights for lanes 1, 2, 3
+        t.init(weights, 3);
+        return t;
+    }();
+    return table.sample(rng) + 1; // Returns 2 or 3
+}
+
+// Generate direction (LEFT or STRAIGHT) based on lane rules
+Direction random_direction(int laneNumber, std::mt19937& rng) {
     if (laneNumber == 3) {
         // Lane 3 always goes left
         return Direction::LEFT;
     } else if (laneNumber == 2) {
         // Lane 2 can go straight (60%) or left (40%) - changed from right to left
-        std::vector<double> weights = {0.4, 0.6, 0.0}; // [LEFT, STRAIGHT, RIGHT]
-        std::discrete_distribution<int> dist(weights.begin(), weights.end());
-        return static_cast<Direction>(dist(gen));
+        static const AliasTable table = []() {
+            AliasTable t;
+            const double weights[3] = {0.4, 0.6, 0.0}; // [LEFT, STRAIGHT, RIGHT]
+            t.init(weights, 3);
+            return t;
+        }();
+        return static_cast<Direction>(table.sample(rng));
     } else {
         // Lane 1 is incoming lane (shouldn't generate vehicles)
         return Direction::STRAIGHT;
     }
 }
 
-// Clear existing files
-void clear_files() {
+// Remove every published lane file and stale spool in one pass, with a
+// single summary log line instead of one per file. Under the
+// rename-swap protocol absence IS the cleared state. Returns false if
+// any leftover could not be removed - the caller then reconciles counts
+// from disk instead of assuming empty lanes.
+bool clear_files() {
+    bool allCleared = true;
     for (char lane = 'A'; lane <= 'D'; lane++) {
-        std::string filepath = DATA_DIR + "/lane" + lane + ".txt";
-        std::ofstream file(filepath, std::ios::trunc);
-        file.close();
-        console_log("Cleared file: " + filepath);
+        std::error_code fsError;
+        fs::remove(lane_file_path(lane), fsError);
+        if (fsError) {
+            console_log("ERROR: Could not clear " + lane_file_path(lane), "\033[1;31m");
+            allCleared = false;
+        }
+        fs::remove(lane_spool_path(lane), fsError);
+        if (fsError) {
+            console_log("ERROR: Could not clear " + lane_spool_path(lane), "\033[1;31m");
+            allCleared = false;
+        }
+        // A leftover append log would replay a whole previous session
+        fs::remove(lane_log_path(lane), fsError);
+        if (fsError) {
+            console_log("ERROR: Could not clear " + lane_log_path(lane), "\033[1;31m");
+            allCleared = false;
+        }
+    }
+    if (allCleared) {
+        console_log("Cleared lane files A-D");
     }
+    return allCleared;
 }
 
 // Display status of current generation
@@ -203,37 +661,140 @@ void display_status(int current, int total, int a2_count) {
               << " (A2: " << a2_count << ")\033[0m" << std::flush;
 }
 
-// Count current vehicles in each lane from files
-std::map<std::string, int> count_vehicles_in_lanes() {
-    std::map<std::string, int> counts;
+// Count current vehicles in each lane by reading the files, indexed by
+// lane_slot(). Slow path: only reconcile_lane_counts() uses it.
+std::array<int, LANE_SLOT_COUNT> count_vehicles_in_lanes() {
+    std::array<int, LANE_SLOT_COUNT> counts{};
 
     for (char lane = 'A'; lane <= 'D'; lane++) {
-        std::string filepath = DATA_DIR + "/lane" + lane + ".txt";
-        std::ifstream file(filepath);
-
-        if (file.is_open()) {
-            std::string line;
-            while (std::getline(file, line)) {
-                // Extract lane number
-                size_t lanePos = line.find("_L");
-                if (lanePos != std::string::npos && lanePos + 2 < line.length()) {
-                    char laneNumChar = line[lanePos + 2];
-                    if (laneNumChar >= '1' && laneNumChar <= '3') {
-                        std::string laneKey = std::string(1, lane) + laneNumChar;
-                        counts[laneKey]++;
+        // Unconsumed backlog is the published batch plus whatever is
+        // still spooling behind it (see publish_lane_file)
+        for (const std::string& filepath :
+             {lane_file_path(lane), lane_spool_path(lane)}) {
+
+            // Binary mode: the record width gives us the count directly
+            if (binary_format_enabled()) {
+                std::error_code ec;
+                auto size = fs::file_size(filepath, ec);
+                if (!ec && size > 0) {
+                    // Per-lane-number breakdown isn't known without parsing IDs,
+                    // so attribute binary records to lane 2 for the stats table
+                    counts[lane_slot(lane, 2)] += static_cast<int>(size / sizeof(VehicleMessage));
+                }
+                continue;
+            }
+
+            std::ifstream file(filepath);
+
+            if (file.is_open()) {
+                std::string line;
+                while (std::getline(file, line)) {
+                    // Extract lane number
+                    size_t lanePos = line.find("_L");
+                    if (lanePos != std::string::npos && lanePos + 2 < line.length()) {
+                        char laneNumChar = line[lanePos + 2];
+                        if (laneNumChar >= '1' && laneNumChar <= '3') {
+                            counts[lane_slot(lane, laneNumChar - '0')]++;
+                        }
                     }
                 }
+                file.close();
             }
-            file.close();
         }
     }
 
     return counts;
 }
 
-// Display current lane statistics
+// Re-base the in-memory model on what the files actually hold,
+// accounting for whatever the simulator consumed since the last call
+void reconcile_lane_counts() {
+    // An append-only log holds the session's whole history, not the
+    // unconsumed backlog, so counting it would only inflate the model;
+    // the occupancy feedback is the authority in that mode
+    if (append_log_enabled()) {
+        return;
+    }
+    laneCounts = count_vehicles_in_lanes();
+}
+
+// Crash-recovery state block: the next vehicle id, the per-lane
+// emitted model, and the batch position, published with the same
+// write-then-rename swap the lane files use so no reader (or crashed
+// writer) ever sees a half-written block. A block on disk at startup
+// means the previous run died mid-session with a simulator possibly
+// still consuming - resuming from it keeps ids unique and leaves the
+// simulator's in-flight lane files untouched instead of wiping them.
+// Clean shutdowns remove the block, so ordinary restarts keep the
+// fast-start wipe.
+struct GeneratorState {
+    uint64_t nextVehicleId = 1;
+    int batchPosition = 0;
+    std::array<int, LANE_SLOT_COUNT> laneCounts{};
+};
+
+std::string generator_state_path() {
+    return DATA_DIR + "/generator.state";
+}
+
+void save_generator_state(const GeneratorState& state) {
+    std::string temp = generator_state_path() + ".tmp";
+    std::ofstream file(temp, std::ios::trunc);
+    if (!file.is_open()) {
+        return;
+    }
+    file << "TGSTATE 1\n";
+    file << state.nextVehicleId << ' ' << state.batchPosition << '\n';
+    for (int count : state.laneCounts) {
+        file << count << ' ';
+    }
+    file << '\n';
+    file.close();
+
+    std::error_code fsError;
+    fs::rename(temp, generator_state_path(), fsError);
+    if (fsError) {
+        console_log("ERROR: Could not publish " + generator_state_path(),
+                    "\033[1;31m");
+    }
+}
+
+bool load_generator_state(GeneratorState& state) {
+    std::ifstream file(generator_state_path());
+    if (!file.is_open()) {
+        return false;
+    }
+    std::string magic;
+    int version = 0;
+    file >> magic >> version;
+    if (magic != "TGSTATE" || version != 1) {
+        return false;
+    }
+    file >> state.nextVehicleId >> state.batchPosition;
+    for (int& count : state.laneCounts) {
+        file >> count;
+    }
+    return !file.fail();
+}
+
+void remove_generator_state() {
+    std::error_code fsError;
+    fs::remove(generator_state_path(), fsError);
+    fs::remove(generator_state_path() + ".tmp", fsError);
+}
+
+// Sum the in-memory model across all lanes
+int total_lane_count() {
+    int total = 0;
+    for (int count : laneCounts) {
+        total += count;
+    }
+    return total;
+}
+
+// Display current lane statistics from the in-memory model
 void display_lane_stats() {
-    auto counts = count_vehicles_in_lanes();
+    const auto& counts = laneCounts;
 
     std::cout << "\033[1;34m";
     std::cout << "┌────────────────────────────────────┐\n";
@@ -255,8 +816,7 @@ void display_lane_stats() {
         std::cout << "│ " << laneLabel << " │";
 
         for (int i = 1; i <= 3; i++) {
-            std::string laneKey = std::string(1, lane) + std::to_string(i);
-            int count = counts[laneKey];
+            int count = counts[lane_slot(lane, i)];
             total += count;
 
             // Highlight A2 (priority lane) if over threshold
@@ -274,8 +834,211 @@ void display_lane_stats() {
     std::cout << "└────────────────────────────────────┘\033[0m\n";
 }
 
-int main() {
+// ---------------------------------------------------------------------
+// Sharded mode (--sharded): one worker thread per road A-D, for stress
+// configs whose arrival rates outrun the single generation loop. Each
+// worker owns its road's spool and published lane file outright - no
+// other thread ever touches them, so the fileMutex in write_vehicle()
+// has no counterpart here. The shm ring and the exchange map are
+// single-producer cursors and are deliberately bypassed; sharded runs
+// go through the per-road lane files, which partition cleanly.
+//
+// Vehicle labels stay globally unique through a shared atomic allocator:
+// workers draw blocks of SHARD_ID_BLOCK ids with one fetch_add and then
+// number locally, so label allocation never serializes them. Ids are
+// unique but not dense across roads - the simulator keys on the string
+// id and has never required density.
+// ---------------------------------------------------------------------
+const int SHARD_COUNT = 4;            // One worker per road A-D
+const int SHARD_CYCLE_MS = 100;       // Worker batch/flush cadence
+const uint64_t SHARD_ID_BLOCK = 64;   // Ids drawn per allocator hit
+const double SHARD_DEFAULT_RATE = 200.0; // Total vehicles/sec across roads
+
+// Next unallocated vehicle id, shared by all workers
+std::atomic<uint64_t> shardNextVehicleId{1};
+
+// Per-worker spawn tallies, read by the monitor loop and the summary
+std::array<std::atomic<uint64_t>, SHARD_COUNT> shardSpawned{};
+
+// One road's generation loop: accumulate fractional spawn credit at the
+// shard's rate, materialize the whole cycle's vehicles into a local
+// buffer, then append and publish with one write. Lane-number and
+// direction draws use the same alias tables as the single-threaded
+// path, fed from a per-worker RNG stream.
+void shard_worker(int shard, double ratePerSecond, uint64_t quota) {
+    const char road = static_cast<char>('A' + shard);
+    std::mt19937 rng(seedOverride >= 0
+        ? static_cast<std::mt19937::result_type>(seedOverride + shard)
+        : std::random_device{}());
+
+    std::vector<std::string> lines;
+    std::vector<VehicleMessage> records;
+    uint64_t idNext = 0;
+    uint64_t idLeft = 0;
+    double credits = 0.0;
+    uint64_t produced = 0;
+    auto lastCycle = std::chrono::steady_clock::now();
+
+    while (keepRunning && produced < quota) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(SHARD_CYCLE_MS));
+
+        auto now = std::chrono::steady_clock::now();
+        credits += ratePerSecond *
+            std::chrono::duration<double>(now - lastCycle).count();
+        lastCycle = now;
+
+        uint64_t due = static_cast<uint64_t>(credits);
+        credits -= static_cast<double>(due);
+        if (due > quota - produced) {
+            due = quota - produced;
+        }
+        if (due == 0) {
+            // A spool blocked by an unclaimed batch may still be waiting
+            if (!append_log_enabled()) {
+                publish_lane_file(road);
+            }
+            continue;
+        }
+
+        for (uint64_t i = 0; i < due; i++) {
+            if (idLeft == 0) {
+                idNext = shardNextVehicleId.fetch_add(SHARD_ID_BLOCK);
+                idLeft = SHARD_ID_BLOCK;
+            }
+            std::string id = "V" + std::to_string(idNext);
+            idNext++;
+            idLeft--;
+
+            int laneNumber = random_lane_number(rng); // Returns 2 or 3
+            Direction dir = random_direction(laneNumber, rng);
+            std::string fullId = encode_vehicle_id(id, laneNumber, dir);
+
+            if (binary_format_enabled()) {
+                records.push_back(make_message(fullId, road, laneNumber, dir));
+            } else {
+                lines.push_back(fullId + ":" + road + "@" +
+                                std::to_string(now_micros()));
+            }
+        }
+
+        // One append per cycle, to a spool (or log) only this worker opens
+        std::string spoolpath = append_log_enabled() ? lane_log_path(road)
+                                                     : lane_spool_path(road);
+        if (binary_format_enabled()) {
+            std::ofstream file(spoolpath, std::ios::app | std::ios::binary);
+            if (file.is_open()) {
+                for (const auto& record : records) {
+                    file.write(reinterpret_cast<const char*>(&record), sizeof(record));
+                }
+            }
+        } else {
+            std::ofstream file(spoolpath, std::ios::app);
+            if (file.is_open()) {
+                for (const auto& line : lines) {
+                    file << line << "\n";
+                }
+            }
+        }
+        lines.clear();
+        records.clear();
+        if (!append_log_enabled()) {
+            publish_lane_file(road);
+        }
+
+        produced += due;
+        shardSpawned[shard].store(produced, std::memory_order_relaxed);
+    }
+
+    // Whatever is still spooled gets one last publish attempt
+    if (!append_log_enabled()) {
+        publish_lane_file(road);
+    }
+    shardSpawned[shard].store(produced, std::memory_order_relaxed);
+}
+
+// Drive the sharded run: split the rate and quota evenly across the
+// four roads, launch the workers, and keep a low-rate progress display
+// going until they finish or SIGINT lands. No per-vehicle console
+// lines - at the rates this mode exists for, stdout would become the
+// new bottleneck.
+int run_sharded(double totalRate, uint64_t totalVehicles) {
+    console_log("🧵 Sharded mode: " + std::to_string(SHARD_COUNT) +
+                " workers, " + std::to_string(static_cast<int>(totalRate)) +
+                " vehicles/sec total", "\033[1;35m");
+    if (shmChannel.isAvailable() || laneExchange.isAvailable()) {
+        console_log("Shared rings are single-producer - sharded mode uses lane files",
+                    "\033[1;33m");
+    }
+
+    const double ratePerShard = totalRate / SHARD_COUNT;
+    const uint64_t quotaBase = totalVehicles / SHARD_COUNT;
+
+    std::vector<std::thread> workers;
+    for (int shard = 0; shard < SHARD_COUNT; shard++) {
+        // Road A absorbs the division remainder
+        uint64_t quota = quotaBase + (shard == 0 ? totalVehicles % SHARD_COUNT : 0);
+        workers.emplace_back(shard_worker, shard, ratePerShard, quota);
+    }
+
+    auto lastStatsTime = std::chrono::steady_clock::now();
+    uint64_t lastTotal = 0;
+    while (keepRunning) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+        uint64_t total = 0;
+        for (const auto& count : shardSpawned) {
+            total += count.load(std::memory_order_relaxed);
+        }
+        if (total >= totalVehicles) {
+            break;
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        double elapsed = std::chrono::duration<double>(now - lastStatsTime).count();
+        if (elapsed >= 5.0) {
+            double rate = static_cast<double>(total - lastTotal) / elapsed;
+            console_log("Spawned " + std::to_string(total) + " vehicles (" +
+                        std::to_string(static_cast<int>(rate)) + "/sec)",
+                        "\033[1;34m");
+            lastStatsTime = now;
+            lastTotal = total;
+        }
+    }
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    uint64_t total = 0;
+    for (const auto& count : shardSpawned) {
+        total += count.load(std::memory_order_relaxed);
+    }
+    console_log("✅ Sharded generation completed. Generated " +
+                std::to_string(total) + " vehicles.", "\033[1;35m");
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
     try {
+        // --seed=N pins the RNG for reproducible benchmark runs;
+        // --sharded (with optional --rate=/--vehicles=) runs one worker
+        // per road instead of the single generation loop
+        bool shardedMode = false;
+        double shardedRate = SHARD_DEFAULT_RATE;
+        uint64_t shardedVehicles = 0; // 0 = run until SIGINT
+        for (int i = 1; i < argc; i++) {
+            std::string arg = argv[i];
+            if (arg.rfind("--seed=", 0) == 0) {
+                seedOverride = std::stoll(arg.substr(7));
+            } else if (arg == "--sharded") {
+                shardedMode = true;
+            } else if (arg.rfind("--rate=", 0) == 0) {
+                shardedRate = std::stod(arg.substr(7));
+            } else if (arg.rfind("--vehicles=", 0) == 0) {
+                shardedVehicles = std::stoull(arg.substr(11));
+            }
+        }
+
         // Set up signal handler for clean termination
         std::signal(SIGINT, signalHandler);
 
@@ -283,43 +1046,97 @@ int main() {
         setupConsole();
 
         console_log("✅ Traffic generator starting", "\033[1;35m");
+        if (seedOverride >= 0) {
+            console_log("Deterministic mode: RNG seeded with " +
+                        std::to_string(seedOverride), "\033[1;35m");
+        }
 
-        // Create directories and clear files
+        // Fast start: create the data tree and truncate the lane files
+        // in one pass. A state block left by a crashed run overrides
+        // the wipe entirely - the simulator may still be consuming, so
+        // the run resumes its ids and lane model in place. A successful
+        // clear means every lane is empty, so the startup file read is
+        // skipped; only a failed clear falls back to basing the
+        // in-memory model on what's on disk.
         ensure_directories();
-        clear_files();
+        GeneratorState resumeState;
+        bool resumed = !shardedMode && load_generator_state(resumeState);
+        if (resumed) {
+            laneCounts = resumeState.laneCounts;
+            console_log("♻️  Resuming crashed session: next vehicle V" +
+                        std::to_string(resumeState.nextVehicleId), "\033[1;35m");
+            // On the file transports the lane files are the authority
+            // for the unconsumed backlog; the saved model carries the
+            // append-log mode, where the files hold history instead
+            if (!append_log_enabled()) {
+                reconcile_lane_counts();
+            }
+        } else {
+            remove_generator_state(); // A stale block must not outlive a wipe
+            if (!clear_files()) {
+                reconcile_lane_counts();
+            }
+        }
 
-        // Random generators
-        std::random_device rd;
-        std::mt19937 gen(rd());
-        std::uniform_real_distribution<> delay_dist(0.7, 1.3); // For randomized intervals
+        // Sharded stress mode replaces everything below: no shm/exchange
+        // setup (single-producer rings), no feedback throttle - the
+        // point of the mode is to outrun the simulator
+        if (shardedMode) {
+            return run_sharded(shardedRate,
+                               shardedVehicles > 0 ? shardedVehicles : UINT64_MAX);
+        }
 
-        // Global tracking variables
-        int total_vehicles = 0;
-        int a2_count = 0;
-        int current_batch = 0;
+        // Set up the shared memory fast path to the simulator
+        if (shmChannel.create()) {
+            console_log("📡 Shared memory channel created (fast spawn path)", "\033[1;35m");
+        } else {
+            console_log("Shared memory unavailable - using lane files", "\033[1;33m");
+        }
 
-        // First generate A2 priority lane vehicles
-        console_log("🚦 Generating priority lane vehicles (A2)", "\033[1;33m");
-        for (int i = 0; i < 12 && keepRunning; i++) {
-            std::string id = "V" + std::to_string(total_vehicles + 1);
+        // And the memory-mapped exchange file next to the lane files
+        if (laneExchange.create(DATA_DIR + "/exchange.map")) {
+            console_log("🗺️  Lane exchange file created (mmap spawn transport)", "\033[1;35m");
+        } else {
+            console_log("Lane exchange unavailable - lane files are the fallback", "\033[1;33m");
+        }
 
-            // Alternate between straight and left turns for lane A2
-            Direction dir = (i % 2 == 0) ? Direction::STRAIGHT : Direction::LEFT;
-            write_vehicle(id, 'A', 2, dir); // Lane A2 with direction
+        // Random generator (seeded once; see global_rng)
+        std::mt19937& gen = global_rng();
+        std::uniform_real_distribution<> delay_dist(0.7, 1.3); // For randomized intervals
 
-            total_vehicles++;
-            a2_count++;
-            current_batch++;
+        // Global tracking variables (a resumed session picks up its
+        // id sequence and batch position where the crash left them)
+        int total_vehicles =
+            resumed ? static_cast<int>(resumeState.nextVehicleId - 1) : 0;
+        int a2_count = resumed ? laneCounts[lane_slot('A', 2)] : 0;
+        int current_batch = resumed ? resumeState.batchPosition : 0;
+
+        // First generate A2 priority lane vehicles (already done by a
+        // session we are resuming)
+        if (!resumed) {
+            console_log("🚦 Generating priority lane vehicles (A2)", "\033[1;33m");
+            for (int i = 0; i < 12 && keepRunning; i++) {
+                std::string id = "V" + std::to_string(total_vehicles + 1);
 
-            // Display progress
-            display_status(current_batch, MAX_VEHICLES_PER_BATCH, a2_count);
+                // Alternate between straight and left turns for lane A2
+                Direction dir = (i % 2 == 0) ? Direction::STRAIGHT : Direction::LEFT;
+                write_vehicle(id, 'A', 2, dir); // Lane A2 with direction
 
-            // Wait between vehicles with slight randomization
-            std::this_thread::sleep_for(
-                std::chrono::milliseconds(
-                    static_cast<int>(GENERATION_INTERVAL_MS * delay_dist(gen))
-                )
-            );
+                laneCounts[lane_slot('A', 2)]++;
+                total_vehicles++;
+                a2_count++;
+                current_batch++;
+
+                // Display progress
+                display_status(current_batch, MAX_VEHICLES_PER_BATCH, a2_count);
+
+                // Wait between vehicles with slight randomization
+                std::this_thread::sleep_for(
+                    std::chrono::milliseconds(
+                        static_cast<int>(GENERATION_INTERVAL_MS * delay_dist(gen))
+                    )
+                );
+            }
         }
 
         std::cout << std::endl;
@@ -328,57 +1145,71 @@ int main() {
         // Display starting lane stats
         display_lane_stats();
 
-        // Stats display timer
+        // Stats display and state-checkpoint timers
         auto lastStatsTime = std::chrono::steady_clock::now();
+        auto lastStateSaveTime = lastStatsTime;
         bool in_priority_mode = false;
 
         // Continuous generation until terminated
         while (keepRunning) {
-            // NEW: Check total vehicle count before generating more
-            auto counts = count_vehicles_in_lanes();
-            int totalVehiclesInSystem = 0;
-
-            for (char lane = 'A'; lane <= 'D'; lane++) {
-                for (int i = 1; i <= 3; i++) {
-                    std::string laneKey = std::string(1, lane) + std::to_string(i);
-                    totalVehiclesInSystem += counts[laneKey];
-                }
-            }
+            // Sync the model with the simulator's actual occupancy when
+            // the feedback segment is up (one seqlock read per cycle)
+            feedbackLive = refresh_from_feedback();
+
+            // Check total vehicle count before generating more - from
+            // the in-memory model, so the limit check costs no I/O
+            int totalVehiclesInSystem = total_lane_count();
+
+            // Batched mode: the limit is enforced against in-memory
+            // counts while the cycle's vehicles accumulate, then each
+            // touched lane file is written exactly once
+            if (batched_spawn_enabled() && totalVehiclesInSystem < MAX_TOTAL_VEHICLES) {
+                SpawnBatch batch;
+                while (totalVehiclesInSystem + batch.queued < MAX_TOTAL_VEHICLES &&
+                       batch.queued < BATCHED_VEHICLES_PER_CYCLE) {
+                    char lane;
+                    int lane_num;
+                    Direction dir;
+                    if (!pick_spawn_throttled(gen, lane, lane_num, dir)) {
+                        break; // Every candidate lane is saturated
+                    }
 
-            // Only generate new vehicles if below the maximum limit
-            if (totalVehiclesInSystem < MAX_TOTAL_VEHICLES) {
-                char lane = random_lane();
-                int lane_num = random_lane_number(); // Will only return 2 or 3
-                Direction dir = random_direction(lane_num);
-
-                // For testing priority condition, occasionally bias toward lane A2
-                if (gen() % 10 == 0) {
-                    lane = 'A';
-                    lane_num = 2;
-                    dir = (gen() % 2 == 0) ? Direction::STRAIGHT : Direction::LEFT;
-                }
+                    std::string id = "V" + std::to_string(total_vehicles + 1);
+                    queue_vehicle(batch, id, lane, lane_num, dir);
 
-                // Also ensure good distribution for lane 3 (free lane)
-                if (gen() % 15 == 0) {
-                    lane = random_lane();
-                    lane_num = 3; // Force lane 3 (free lane)
-                    dir = Direction::LEFT; // Lane 3 always turns left
+                    laneCounts[lane_slot(lane, lane_num)]++;
+                    total_vehicles++;
+                    current_batch++;
+                    if (lane == 'A' && lane_num == 2) {
+                        a2_count++;
+                    }
                 }
+                flush_batch(batch);
 
-                std::string id = "V" + std::to_string(total_vehicles + 1);
-
-                // Write vehicle to file with appropriate direction
-                write_vehicle(id, lane, lane_num, dir);
+                display_status(current_batch, MAX_VEHICLES_PER_BATCH, a2_count);
+            }
+            // Only generate new vehicles if below the maximum limit
+            else if (totalVehiclesInSystem < MAX_TOTAL_VEHICLES) {
+                char lane;
+                int lane_num;
+                Direction dir;
+                if (pick_spawn_throttled(gen, lane, lane_num, dir)) {
+                    std::string id = "V" + std::to_string(total_vehicles + 1);
+
+                    // Write vehicle to file with appropriate direction
+                    write_vehicle(id, lane, lane_num, dir);
+
+                    // Update counters
+                    laneCounts[lane_slot(lane, lane_num)]++;
+                    total_vehicles++;
+                    current_batch++;
+                    if (lane == 'A' && lane_num == 2) {
+                        a2_count++;
+                    }
 
-                // Update counters
-                total_vehicles++;
-                current_batch++;
-                if (lane == 'A' && lane_num == 2) {
-                    a2_count++;
+                    // Display progress
+                    display_status(current_batch, MAX_VEHICLES_PER_BATCH, a2_count);
                 }
-
-                // Display progress
-                display_status(current_batch, MAX_VEHICLES_PER_BATCH, a2_count);
             } else {
                 // Skip generation this cycle and wait for vehicles to clear
                 console_log("Vehicle limit reached (" + std::to_string(totalVehiclesInSystem) +
@@ -388,14 +1219,35 @@ int main() {
                 std::this_thread::sleep_for(std::chrono::milliseconds(1000));
             }
 
-            // Periodically display lane stats (every 5 seconds)
+            // Periodically display lane stats (every 5 seconds). This
+            // is the one place the files are re-read: it both refreshes
+            // the table and credits the model with whatever the
+            // simulator consumed since the last reconcile. With live
+            // feedback the model is already the simulator's own counts,
+            // so the file scan is skipped outright.
             auto currentTime = std::chrono::steady_clock::now();
             if (std::chrono::duration_cast<std::chrono::seconds>(currentTime - lastStatsTime).count() >= 5) {
                 std::cout << std::endl;
+                if (!feedbackLive) {
+                    reconcile_lane_counts();
+                }
                 display_lane_stats();
                 lastStatsTime = currentTime;
             }
 
+            // Checkpoint the state block about once a second: a crash
+            // loses at most a second of id/model progress and the next
+            // launch resumes from here instead of wiping the lanes
+            if (std::chrono::duration_cast<std::chrono::milliseconds>(
+                    currentTime - lastStateSaveTime).count() >= 1000) {
+                GeneratorState state;
+                state.nextVehicleId = static_cast<uint64_t>(total_vehicles) + 1;
+                state.batchPosition = current_batch;
+                state.laneCounts = laneCounts;
+                save_generator_state(state);
+                lastStateSaveTime = currentTime;
+            }
+
             // Reset batch counter when it reaches max
             if (current_batch >= MAX_VEHICLES_PER_BATCH) {
                 current_batch = 0;
@@ -404,9 +1256,10 @@ int main() {
                 display_lane_stats();
             }
 
-            // Check priority lane count and log state changes
-            auto currentCounts = count_vehicles_in_lanes();
-            int a2_count_current = currentCounts["A2"];
+            // Check priority lane count and log state changes (from the
+            // in-memory model - this used to be a second full file scan
+            // per cycle)
+            int a2_count_current = laneCounts[lane_slot('A', 2)];
 
             if (!in_priority_mode && a2_count_current > PRIORITY_THRESHOLD_HIGH) {
                 in_priority_mode = true;
@@ -426,6 +1279,10 @@ int main() {
             );
         }
 
+        // Clean shutdown closes the session: drop the state block so
+        // the next launch starts fresh (only crashes leave it behind)
+        remove_generator_state();
+
         std::cout << std::endl;
         console_log("✅ Traffic generator completed. Generated " +
                    std::to_string(total_vehicles) + " vehicles.", "\033[1;35m");
@@ -0,0 +1,133 @@
+// FILE: src/utils/CompiledSchedule.cpp
+#include "utils/CompiledSchedule.h"
+#include "utils/DebugLogger.h"
+
+#include <cstdio>
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+CompiledSchedule::CompiledSchedule()
+    : fd(-1),
+      mapping(nullptr),
+      mappedBytes(0),
+      records(nullptr),
+      recordCount(0) {}
+
+CompiledSchedule::~CompiledSchedule() {
+    close();
+}
+
+bool CompiledSchedule::openForRead(const std::string& path) {
+#ifndef _WIN32
+    close();
+
+    fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        DebugLogger::log("CompiledSchedule: failed to open " + path,
+                       DebugLogger::LogLevel::ERROR);
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 ||
+        static_cast<size_t>(st.st_size) < sizeof(Header)) {
+        ::close(fd);
+        fd = -1;
+        return false;
+    }
+
+    mappedBytes = static_cast<size_t>(st.st_size);
+    mapping = mmap(nullptr, mappedBytes, PROT_READ, MAP_SHARED, fd, 0);
+    if (mapping == MAP_FAILED) {
+        mapping = nullptr;
+        mappedBytes = 0;
+        ::close(fd);
+        fd = -1;
+        return false;
+    }
+
+    const Header* header = static_cast<const Header*>(mapping);
+    size_t capacity = (mappedBytes - sizeof(Header)) / sizeof(CompiledArrival);
+
+    // Reject schedules from an incompatible compiler build, or files
+    // whose claimed count overruns the bytes actually present
+    if (header->magic != MAGIC || header->version != VERSION ||
+        header->count > capacity) {
+        DebugLogger::log("CompiledSchedule: " + path +
+                         " is not a valid compiled schedule",
+                       DebugLogger::LogLevel::ERROR);
+        close();
+        return false;
+    }
+
+    records = reinterpret_cast<const CompiledArrival*>(
+        static_cast<const char*>(mapping) + sizeof(Header));
+    recordCount = header->count;
+
+    DebugLogger::log("CompiledSchedule opened " + path + " with " +
+                     std::to_string(recordCount) + " arrivals");
+    return true;
+#else
+    (void)path;
+    return false; // No mmap schedule on Windows
+#endif
+}
+
+size_t CompiledSchedule::count() const {
+    return static_cast<size_t>(recordCount);
+}
+
+const CompiledArrival& CompiledSchedule::arrival(size_t index) const {
+    return records[index];
+}
+
+bool CompiledSchedule::isOpen() const {
+    return records != nullptr;
+}
+
+void CompiledSchedule::close() {
+#ifndef _WIN32
+    if (mapping) {
+        munmap(mapping, mappedBytes);
+    }
+    if (fd >= 0) {
+        ::close(fd);
+    }
+#endif
+    fd = -1;
+    mapping = nullptr;
+    mappedBytes = 0;
+    records = nullptr;
+    recordCount = 0;
+}
+
+bool CompiledSchedule::writeFile(const std::string& path,
+                                 const std::vector<CompiledArrival>& records) {
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        return false;
+    }
+
+    Header header;
+    std::memset(&header, 0, sizeof(header));
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.count = records.size();
+
+    bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+    if (ok && !records.empty()) {
+        ok = std::fwrite(records.data(), sizeof(CompiledArrival),
+                         records.size(), file) == records.size();
+    }
+
+    if (std::fclose(file) != 0) {
+        ok = false;
+    }
+    return ok;
+}
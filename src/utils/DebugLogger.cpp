@@ -1,4 +1,9 @@
 #include "utils/DebugLogger.h"
+#include "utils/StreamCodec.h"
+#include "utils/ThreadScheduling.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
 #include <iostream>
 #include <fstream>
 #include <chrono>
@@ -8,31 +13,181 @@
 
 // Static class members initialization
 std::string DebugLogger::logFilePath = "traffic_simulator.log";
-std::vector<std::string> DebugLogger::recentLogs;
+std::string DebugLogger::recentRing[DebugLogger::RECENT_CAPACITY];
+uint64_t DebugLogger::recentHead = 0;
+std::atomic<uint64_t> DebugLogger::recentGeneration{0};
 std::mutex DebugLogger::logMutex;
 bool DebugLogger::initialized = false;
 
+DebugLogger::Cell DebugLogger::ring[DebugLogger::RING_SIZE];
+std::atomic<size_t> DebugLogger::enqueuePos{0};
+std::atomic<size_t> DebugLogger::dequeuePos{0};
+std::atomic<uint64_t> DebugLogger::droppedCount{0};
+
+std::thread DebugLogger::flushThread;
+std::atomic<bool> DebugLogger::flushRunning{false};
+
+bool DebugLogger::compressSink = false;
+std::string DebugLogger::compressBuffer;
+
 void DebugLogger::initialize(const std::string& path) {
-    std::lock_guard<std::mutex> lock(logMutex);
-    logFilePath = path;
+    {
+        std::lock_guard<std::mutex> lock(logMutex);
 
-    // Create/clear the log file
-    std::ofstream file(logFilePath, std::ios::trunc);
-    if (file.is_open()) {
-        file << "=== Traffic Simulator Log ===\n";
-        file.close();
+        if (initialized) {
+            return;
+        }
+
+        logFilePath = path;
+
+        // Opt-in compressed sink for long soaks (see sealCompressedBlock)
+        const char* compressEnv = std::getenv("TRAFFIC_COMPRESS_LOGS");
+        compressSink = compressEnv && compressEnv[0] == '1';
+
+        // Create/clear the log file
+        if (compressSink) {
+            std::ofstream file(logFilePath + ".z",
+                               std::ios::trunc | std::ios::binary);
+        } else {
+            std::ofstream file(logFilePath, std::ios::trunc);
+            if (file.is_open()) {
+                file << "=== Traffic Simulator Log ===\n";
+                file.close();
+            }
+        }
+
+        // Stamp each ring cell with its slot index (Vyukov scheme)
+        for (size_t i = 0; i < RING_SIZE; i++) {
+            ring[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        enqueuePos.store(0, std::memory_order_relaxed);
+        dequeuePos.store(0, std::memory_order_relaxed);
+
+        initialized = true;
     }
 
-    initialized = true;
+    // Start the background flush thread
+    flushRunning = true;
+    flushThread = std::thread(flushLoop);
+
+    // Make sure the flush thread is drained and joined even if the
+    // application never calls shutdown() explicitly
+    std::atexit([]() { DebugLogger::shutdown(); });
 }
 
 void DebugLogger::log(const std::string& message, LogLevel level) {
+    // The compile-time floor also governs plain log() calls - the
+    // message was already built here, but it never reaches the ring
+    if (!levelEnabled(level)) {
+        return;
+    }
+
     if (!initialized) {
         initialize(); // Initialize with default path if not done already
     }
 
-    std::string levelStr;
-    switch (level) {
+    // The timestamp and level prefix are rendered on the flush thread
+    // (see formatEntry); the producer only hands over the body. Drop
+    // (and count) on overload rather than ever blocking the caller.
+    std::string body = message;
+    if (!tryPush(std::move(body), nullptr, nullptr, 0, level)) {
+        droppedCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void DebugLogger::logStructured(const char* format, const long long* args,
+                                int argCount, LogLevel level) {
+    if (!initialized) {
+        initialize();
+    }
+
+    // No string is built here at all: the cell carries the format
+    // pointer and the raw argument words, and the flush thread does
+    // the rest
+    if (!tryPush(std::string(), format, args, argCount, level)) {
+        droppedCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+bool DebugLogger::tryPush(std::string&& message, const char* format,
+                          const long long* args, int argCount,
+                          LogLevel level) {
+    // One cheap clock read on the producer; all rendering is deferred
+    uint64_t stampMs = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+
+    size_t pos = enqueuePos.load(std::memory_order_relaxed);
+
+    for (;;) {
+        Cell& cell = ring[pos & (RING_SIZE - 1)];
+        size_t seq = cell.sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+        if (diff == 0) {
+            // Slot is free; claim it
+            if (enqueuePos.compare_exchange_weak(pos, pos + 1,
+                                                 std::memory_order_relaxed)) {
+                cell.entry.message = std::move(message);
+                cell.entry.format = format;
+                for (int i = 0; i < argCount; i++) {
+                    cell.entry.args[i] = args[i];
+                }
+                cell.entry.argCount = argCount;
+                cell.entry.level = level;
+                cell.entry.stampMs = stampMs;
+                cell.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+            // CAS failed: pos was reloaded, retry
+        } else if (diff < 0) {
+            return false; // Ring is full
+        } else {
+            pos = enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool DebugLogger::tryPop(Entry& entry) {
+    size_t pos = dequeuePos.load(std::memory_order_relaxed);
+    Cell& cell = ring[pos & (RING_SIZE - 1)];
+    size_t seq = cell.sequence.load(std::memory_order_acquire);
+
+    if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1) < 0) {
+        return false; // Ring is empty
+    }
+
+    // Single consumer: no CAS needed
+    dequeuePos.store(pos + 1, std::memory_order_relaxed);
+    entry.message = std::move(cell.entry.message);
+    entry.format = cell.entry.format;
+    for (int i = 0; i < cell.entry.argCount; i++) {
+        entry.args[i] = cell.entry.args[i];
+    }
+    entry.argCount = cell.entry.argCount;
+    entry.level = cell.entry.level;
+    entry.stampMs = cell.entry.stampMs;
+    cell.sequence.store(pos + RING_SIZE, std::memory_order_release);
+    return true;
+}
+
+std::string DebugLogger::formatEntry(Entry& entry) {
+    // Per-second strftime cache: all stamps are rendered here on the
+    // flush thread, and consecutive messages almost always fall within
+    // the same second, so localtime/strftime run only when the epoch
+    // second actually changes. Milliseconds are appended per message.
+    static time_t cachedSecond = -1;
+    static char cachedBase[24] = {0}; // "YYYY-mm-dd HH:MM:SS"
+
+    time_t second = static_cast<time_t>(entry.stampMs / 1000);
+    if (second != cachedSecond) {
+        std::strftime(cachedBase, sizeof(cachedBase), "%Y-%m-%d %H:%M:%S",
+                      std::localtime(&second));
+        cachedSecond = second;
+    }
+
+    const char* levelStr;
+    switch (entry.level) {
         case LogLevel::INFO:    levelStr = "INFO"; break;
         case LogLevel::WARNING: levelStr = "WARNING"; break;
         case LogLevel::ERROR:   levelStr = "ERROR"; break;
@@ -40,64 +195,177 @@ void DebugLogger::log(const std::string& message, LogLevel level) {
         default:                levelStr = "INFO"; break;
     }
 
-    std::string timestamp = getTimestamp();
-    std::string formattedMessage = "[" + timestamp + "] [" + levelStr + "] " + message;
+    char prefix[48];
+    std::snprintf(prefix, sizeof(prefix), "[%s.%03d] [%s] ",
+                  cachedBase, static_cast<int>(entry.stampMs % 1000),
+                  levelStr);
 
-    // Store in recent logs (limited to last 100)
-    {
-        std::lock_guard<std::mutex> lock(logMutex);
-        recentLogs.push_back(formattedMessage);
-        if (recentLogs.size() > 100) {
-            recentLogs.erase(recentLogs.begin());
-        }
+    std::string line(prefix);
+    if (entry.format) {
+        // Structured record: expand the deferred format here. Unused
+        // trailing arguments are simply ignored by snprintf.
+        char body[256];
+        std::snprintf(body, sizeof(body), entry.format,
+                      entry.argCount > 0 ? entry.args[0] : 0LL,
+                      entry.argCount > 1 ? entry.args[1] : 0LL,
+                      entry.argCount > 2 ? entry.args[2] : 0LL,
+                      entry.argCount > 3 ? entry.args[3] : 0LL);
+        line += body;
+    } else {
+        line += entry.message;
     }
+    return line;
+}
+
+void DebugLogger::flushLoop() {
+    // Log flushing is deferrable by definition; run it at background
+    // priority so it stays off the cores the hot threads are using
+    ThreadScheduling::setCurrentThreadBackground();
+
+    Entry entry;
+    uint64_t lastReportedDrops = 0;
+
+    while (flushRunning.load(std::memory_order_relaxed) ||
+           dequeuePos.load(std::memory_order_relaxed) !=
+           enqueuePos.load(std::memory_order_relaxed)) {
+
+        bool drained = false;
+        while (tryPop(entry)) {
+            drained = true;
+
+            std::string message = formatEntry(entry);
 
-    // Write to file
-    writeToFile(formattedMessage);
+            // Store in the recent-log ring; the slot assignment reuses
+            // the evicted string's capacity instead of allocating
+            {
+                std::lock_guard<std::mutex> lock(logMutex);
+                recentRing[recentHead % RECENT_CAPACITY] = message;
+                recentHead++;
+            }
+            recentGeneration.fetch_add(1, std::memory_order_release);
 
-    // Also output to console
-    std::cout << formattedMessage << std::endl;
+            writeToFile(message);
+            std::cout << message << std::endl;
+        }
+
+        // Surface drops periodically so overload isn't silent
+        uint64_t drops = droppedCount.load(std::memory_order_relaxed);
+        if (drops != lastReportedDrops) {
+            std::string notice = "[" + getTimestamp() + "] [WARNING] Logger dropped " +
+                                 std::to_string(drops - lastReportedDrops) +
+                                 " messages under load";
+            writeToFile(notice);
+            std::cout << notice << std::endl;
+            lastReportedDrops = drops;
+        }
+
+        if (!drained) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    }
 }
 
 std::vector<std::string> DebugLogger::getRecentLogs(int count) {
     std::lock_guard<std::mutex> lock(logMutex);
 
-    if (count <= 0 || recentLogs.empty()) {
+    uint64_t stored = std::min<uint64_t>(recentHead, RECENT_CAPACITY);
+    if (count <= 0 || stored == 0) {
         return {};
     }
+    if (static_cast<uint64_t>(count) > stored) {
+        count = static_cast<int>(stored);
+    }
 
-    if (count >= static_cast<int>(recentLogs.size())) {
-        return recentLogs;
+    // Walk the last 'count' slots of the ring in arrival order
+    std::vector<std::string> result;
+    result.reserve(count);
+    for (uint64_t i = recentHead - count; i != recentHead; i++) {
+        result.push_back(recentRing[i % RECENT_CAPACITY]);
     }
 
-    // Return last 'count' logs
-    return std::vector<std::string>(
-        recentLogs.end() - count,
-        recentLogs.end()
-    );
+    return result;
 }
 
-void DebugLogger::clearLogs() {
+ArenaVector<ArenaString> DebugLogger::getRecentLogs(int count, FrameArena& arena) {
+    ArenaVector<ArenaString> result{ArenaAllocator<ArenaString>(arena)};
+
     std::lock_guard<std::mutex> lock(logMutex);
-    recentLogs.clear();
 
-    // Clear the log file
-    std::ofstream file(logFilePath, std::ios::trunc);
-    if (file.is_open()) {
-        file << "=== Traffic Simulator Log (Cleared) ===\n";
-        file.close();
+    uint64_t stored = std::min<uint64_t>(recentHead, RECENT_CAPACITY);
+    if (count <= 0 || stored == 0) {
+        return result;
+    }
+    if (static_cast<uint64_t>(count) > stored) {
+        count = static_cast<int>(stored);
+    }
+
+    result.reserve(count);
+    for (uint64_t i = recentHead - count; i != recentHead; i++) {
+        const std::string& entry = recentRing[i % RECENT_CAPACITY];
+        result.emplace_back(entry.c_str(), entry.size(),
+                            ArenaAllocator<char>(arena));
     }
+
+    return result;
+}
+
+uint64_t DebugLogger::getRecentGeneration() {
+    return recentGeneration.load(std::memory_order_acquire);
+}
+
+void DebugLogger::clearLogs() {
+    {
+        std::lock_guard<std::mutex> lock(logMutex);
+
+        // Slots keep their capacity for reuse; only the window resets
+        recentHead = 0;
+
+        // Clear the log file
+        if (compressSink) {
+            std::ofstream file(logFilePath + ".z",
+                               std::ios::trunc | std::ios::binary);
+        } else {
+            std::ofstream file(logFilePath, std::ios::trunc);
+            if (file.is_open()) {
+                file << "=== Traffic Simulator Log (Cleared) ===\n";
+                file.close();
+            }
+        }
+    }
+    recentGeneration.fetch_add(1, std::memory_order_release);
 }
 
 void DebugLogger::shutdown() {
-    std::lock_guard<std::mutex> lock(logMutex);
+    {
+        std::lock_guard<std::mutex> lock(logMutex);
+        if (!initialized) {
+            return;
+        }
+        initialized = false;
+    }
 
-    if (!initialized) {
-        return;
+    // Let the flush thread drain whatever is still queued, then join it
+    flushRunning = false;
+    if (flushThread.joinable()) {
+        flushThread.join();
     }
 
     writeToFile("[" + getTimestamp() + "] [INFO] Logger shutdown");
-    initialized = false;
+
+    // Land whatever the final partial block holds
+    if (compressSink) {
+        sealCompressedBlock();
+    }
+}
+
+uint64_t DebugLogger::getDroppedCount() {
+    return droppedCount.load(std::memory_order_relaxed);
+}
+
+size_t DebugLogger::getQueueDepth() {
+    size_t enqueue = enqueuePos.load(std::memory_order_relaxed);
+    size_t dequeue = dequeuePos.load(std::memory_order_relaxed);
+    return enqueue > dequeue ? enqueue - dequeue : 0;
 }
 
 std::string DebugLogger::getTimestamp() {
@@ -114,9 +382,41 @@ std::string DebugLogger::getTimestamp() {
 }
 
 void DebugLogger::writeToFile(const std::string& message) {
+    if (compressSink) {
+        // Accumulate into the current block; the frame is written (and
+        // the compression paid) only once per COMPRESS_BLOCK_BYTES of
+        // log text, all on this thread
+        compressBuffer.append(message);
+        compressBuffer.push_back('\n');
+        if (compressBuffer.size() >= COMPRESS_BLOCK_BYTES) {
+            sealCompressedBlock();
+        }
+        return;
+    }
+
     std::ofstream file(logFilePath, std::ios::app);
     if (file.is_open()) {
         file << message << std::endl;
         file.close();
     }
 }
+
+void DebugLogger::sealCompressedBlock() {
+    if (compressBuffer.empty()) {
+        return;
+    }
+
+    std::vector<char> frame;
+    StreamCodec::appendFrame(compressBuffer.data(), compressBuffer.size(),
+                             frame);
+
+    std::ofstream file(logFilePath + ".z",
+                       std::ios::app | std::ios::binary);
+    if (file.is_open()) {
+        file.write(frame.data(), static_cast<std::streamsize>(frame.size()));
+        file.close();
+    }
+
+    // Keep the capacity; the next block reuses it
+    compressBuffer.clear();
+}
@@ -0,0 +1,686 @@
+// FILE: src/utils/EventJournal.cpp
+#include "utils/EventJournal.h"
+#include "utils/DebugLogger.h"
+#include "utils/StreamCodec.h"
+#include <cstdlib>
+#include <cstring>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    constexpr size_t fileSize(size_t eventCapacity) {
+        return sizeof(uint32_t) * 2 + sizeof(uint64_t) +
+               sizeof(JournalEvent) * eventCapacity;
+    }
+
+    constexpr size_t NO_BLOCK = static_cast<size_t>(-1);
+
+#ifndef _WIN32
+    // pread the full range or fail (short reads only happen at EOF,
+    // which the offset validation should already have ruled out)
+    bool preadFully(int fd, void* dst, size_t len, uint64_t offset) {
+        char* out = static_cast<char*>(dst);
+        while (len > 0) {
+            ssize_t got = pread(fd, out, len, static_cast<off_t>(offset));
+            if (got <= 0) {
+                return false;
+            }
+            out += got;
+            offset += static_cast<uint64_t>(got);
+            len -= static_cast<size_t>(got);
+        }
+        return true;
+    }
+#endif
+}
+
+EventJournal::EventJournal()
+    : header(nullptr),
+      events(nullptr),
+      capacity(0),
+      mappedBytes(0),
+      writable(false),
+      keyframes(nullptr),
+      keyframeTotal(0),
+      compressed(false),
+      ownHeader{0, 0, 0},
+      writeOffset(0),
+      cachedBlock(NO_BLOCK)
+#ifndef _WIN32
+    , fd(-1)
+#endif
+{
+}
+
+EventJournal::~EventJournal() {
+    close();
+}
+
+bool EventJournal::openForWrite(const std::string& path) {
+#ifndef _WIN32
+    close();
+
+    fd = ::open(path.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0666);
+    if (fd < 0) {
+        DebugLogger::log("EventJournal: failed to create " + path,
+                       DebugLogger::LogLevel::ERROR);
+        return false;
+    }
+
+    // Opt-in compressed recording: sequential StreamCodec frames
+    // instead of the mmap array (see the class comment). Checked per
+    // open so a process can record both flavors across runs.
+    const char* compressEnv = std::getenv("TRAFFIC_JOURNAL_COMPRESS");
+    if (compressEnv && compressEnv[0] == '1') {
+        ownHeader.magic = COMPRESSED_MAGIC;
+        ownHeader.version = VERSION;
+        ownHeader.count = 0;
+        header = &ownHeader;
+        writeOffset = sizeof(Header); // Header itself lands at close()
+        compressed = true;
+        writable = true;
+        blockBuffer.reserve(BLOCK_EVENTS);
+
+        DebugLogger::log("EventJournal recording compressed to " + path);
+        return true;
+    }
+
+    if (!remap(GROW_EVENTS)) {
+        ::close(fd);
+        fd = -1;
+        return false;
+    }
+
+    header->magic = MAGIC;
+    header->version = VERSION;
+    header->count = 0;
+    writable = true;
+
+    DebugLogger::log("EventJournal recording to " + path);
+    return true;
+#else
+    (void)path;
+    return false; // No mmap journal on Windows
+#endif
+}
+
+bool EventJournal::openForRead(const std::string& path) {
+#ifndef _WIN32
+    close();
+
+    fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        DebugLogger::log("EventJournal: failed to open " + path,
+                       DebugLogger::LogLevel::ERROR);
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < fileSize(0)) {
+        ::close(fd);
+        fd = -1;
+        return false;
+    }
+
+    // Sniff the flavor before mapping anything
+    Header probe;
+    if (!preadFully(fd, &probe, sizeof(probe), 0)) {
+        ::close(fd);
+        fd = -1;
+        return false;
+    }
+
+    if (probe.magic == COMPRESSED_MAGIC) {
+        uint64_t totalBytes = static_cast<uint64_t>(st.st_size);
+        CompressedFooter footer;
+        bool ok = probe.version == VERSION &&
+                  totalBytes >= sizeof(Header) + sizeof(footer) &&
+                  preadFully(fd, &footer, sizeof(footer),
+                             totalBytes - sizeof(footer)) &&
+                  footer.magic == COMPRESSED_FOOTER_MAGIC &&
+                  footer.blockIndexOffset >= sizeof(Header) &&
+                  footer.blockIndexOffset +
+                      footer.blockCount * sizeof(BlockIndexEntry) <=
+                      totalBytes - sizeof(footer) &&
+                  footer.keyframeIndexOffset >= sizeof(Header) &&
+                  footer.keyframeIndexOffset +
+                      footer.keyframeCount * sizeof(KeyframeIndexEntry) <=
+                      totalBytes - sizeof(footer);
+
+        if (ok && footer.blockCount > 0) {
+            blockTable.resize(static_cast<size_t>(footer.blockCount));
+            ok = preadFully(fd, blockTable.data(),
+                            blockTable.size() * sizeof(BlockIndexEntry),
+                            footer.blockIndexOffset);
+        }
+        if (ok && footer.keyframeCount > 0) {
+            keyframeTable.resize(static_cast<size_t>(footer.keyframeCount));
+            ok = preadFully(fd, keyframeTable.data(),
+                            keyframeTable.size() * sizeof(KeyframeIndexEntry),
+                            footer.keyframeIndexOffset);
+        }
+
+        if (!ok) {
+            blockTable.clear();
+            keyframeTable.clear();
+            ::close(fd);
+            fd = -1;
+            return false;
+        }
+
+        ownHeader = probe;
+        header = &ownHeader;
+        compressed = true;
+        writable = false;
+        keyframeTotal = keyframeTable.size();
+        cachedBlock = NO_BLOCK;
+
+        DebugLogger::log("EventJournal opened " + path + " with " +
+                         std::to_string(header->count) + " events and " +
+                         std::to_string(keyframeTotal) +
+                         " keyframes (compressed)");
+        return true;
+    }
+
+    void* mapping = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ,
+                         MAP_SHARED, fd, 0);
+    if (mapping == MAP_FAILED) {
+        ::close(fd);
+        fd = -1;
+        return false;
+    }
+
+    header = static_cast<Header*>(mapping);
+    events = reinterpret_cast<JournalEvent*>(
+        reinterpret_cast<char*>(mapping) + sizeof(Header));
+    capacity = (static_cast<size_t>(st.st_size) - sizeof(Header)) /
+               sizeof(JournalEvent);
+
+    // Reject journals written by an incompatible build
+    if (header->magic != MAGIC || header->version != VERSION ||
+        header->count > capacity) {
+        munmap(mapping, static_cast<size_t>(st.st_size));
+        header = nullptr;
+        events = nullptr;
+        capacity = 0;
+        ::close(fd);
+        fd = -1;
+        return false;
+    }
+
+    writable = false;
+    mappedBytes = static_cast<size_t>(st.st_size);
+
+    // Keyframe section (optional): a valid footer at the end of the
+    // file points at the index; anything else is a plain journal
+    size_t eventsEnd = fileSize(header->count);
+    if (mappedBytes >= eventsEnd + sizeof(KeyframeFooter)) {
+        const char* base = reinterpret_cast<const char*>(header);
+        KeyframeFooter footer;
+        std::memcpy(&footer, base + mappedBytes - sizeof(KeyframeFooter),
+                    sizeof(footer));
+        if (footer.magic == KEYFRAME_MAGIC &&
+            footer.indexOffset >= eventsEnd &&
+            footer.indexOffset +
+                footer.keyframeCount * sizeof(KeyframeIndexEntry) <=
+                mappedBytes - sizeof(KeyframeFooter)) {
+            keyframes = reinterpret_cast<const KeyframeIndexEntry*>(
+                base + footer.indexOffset);
+            keyframeTotal = static_cast<size_t>(footer.keyframeCount);
+        }
+    }
+
+    DebugLogger::log("EventJournal opened " + path + " with " +
+                     std::to_string(header->count) + " events and " +
+                     std::to_string(keyframeTotal) + " keyframes");
+    return true;
+#else
+    (void)path;
+    return false; // No mmap journal on Windows
+#endif
+}
+
+void EventJournal::append(const JournalEvent& event) {
+    if (!writable || !header) {
+        return;
+    }
+
+    if (compressed) {
+        blockBuffer.push_back(event);
+        header->count++;
+        if (blockBuffer.size() >= BLOCK_EVENTS) {
+            sealEventBlock();
+        }
+        return;
+    }
+
+    // Grow in chunks; the header (including count) lives in the file, so
+    // it survives the remap
+    if (header->count >= capacity) {
+        if (!remap(capacity + GROW_EVENTS)) {
+            DebugLogger::log("EventJournal: grow failed, dropping event",
+                           DebugLogger::LogLevel::ERROR);
+            return;
+        }
+    }
+
+    events[header->count] = event;
+    header->count++;
+}
+
+void EventJournal::appendKeyframe(uint64_t timeMs, int32_t lightState,
+                                  const VehicleSnapshot* records,
+                                  uint32_t vehicleCount) {
+    if (!writable || !header) {
+        return;
+    }
+
+    if (compressed) {
+        // Seal the pending block first so the keyframe's eventIndex
+        // lands on a block boundary - a seek that restores this
+        // keyframe resumes decoding at the start of a frame
+        sealEventBlock();
+
+        KeyframeHeader keyframe;
+        keyframe.timeMs = timeMs;
+        keyframe.eventIndex = header->count;
+        keyframe.lightState = lightState;
+        keyframe.vehicleCount = vehicleCount;
+
+        std::vector<char> raw(sizeof(keyframe) +
+                              sizeof(VehicleSnapshot) * vehicleCount);
+        std::memcpy(raw.data(), &keyframe, sizeof(keyframe));
+        if (vehicleCount > 0) {
+            std::memcpy(raw.data() + sizeof(keyframe), records,
+                        sizeof(VehicleSnapshot) * vehicleCount);
+        }
+
+        KeyframeIndexEntry entry;
+        entry.timeMs = timeMs;
+        entry.fileOffset = writeOffset;
+
+        size_t frameBytes = 0;
+        if (!writeFrameAt(raw.data(), raw.size(), writeOffset, frameBytes)) {
+            DebugLogger::log("EventJournal: keyframe frame write failed",
+                           DebugLogger::LogLevel::WARNING);
+            return;
+        }
+        keyframeIndex.push_back(entry);
+        writeOffset += frameBytes;
+        return;
+    }
+
+    // Stage in memory: the keyframe section can only be placed once the
+    // event array has stopped growing, which isn't known until close()
+    KeyframeIndexEntry entry;
+    entry.timeMs = timeMs;
+    entry.fileOffset = keyframeBuffer.size(); // Relative until close()
+    keyframeIndex.push_back(entry);
+
+    KeyframeHeader keyframe;
+    keyframe.timeMs = timeMs;
+    keyframe.eventIndex = header->count;
+    keyframe.lightState = lightState;
+    keyframe.vehicleCount = vehicleCount;
+
+    size_t offset = keyframeBuffer.size();
+    keyframeBuffer.resize(offset + sizeof(keyframe) +
+                          sizeof(VehicleSnapshot) * vehicleCount);
+    std::memcpy(&keyframeBuffer[offset], &keyframe, sizeof(keyframe));
+    if (vehicleCount > 0) {
+        std::memcpy(&keyframeBuffer[offset + sizeof(keyframe)], records,
+                    sizeof(VehicleSnapshot) * vehicleCount);
+    }
+}
+
+size_t EventJournal::keyframeCount() const {
+    return keyframeTotal;
+}
+
+bool EventJournal::findKeyframe(uint64_t timeMs, KeyframeHeader& outHeader,
+                                const VehicleSnapshot*& outRecords) const {
+    if (!header || keyframeTotal == 0) {
+        return false;
+    }
+
+    if (compressed) {
+        // Same last-at-or-before search, over the loaded table
+        size_t lo = 0;
+        size_t hi = keyframeTable.size();
+        while (lo < hi) {
+            size_t mid = (lo + hi) / 2;
+            if (keyframeTable[mid].timeMs <= timeMs) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        if (lo == 0) {
+            return false;
+        }
+
+        if (!readFrameAt(keyframeTable[lo - 1].fileOffset, keyframeScratch) ||
+            keyframeScratch.size() < sizeof(KeyframeHeader)) {
+            return false;
+        }
+        std::memcpy(&outHeader, keyframeScratch.data(), sizeof(outHeader));
+        if (keyframeScratch.size() <
+            sizeof(KeyframeHeader) +
+                sizeof(VehicleSnapshot) * outHeader.vehicleCount) {
+            return false;
+        }
+        outRecords = reinterpret_cast<const VehicleSnapshot*>(
+            keyframeScratch.data() + sizeof(KeyframeHeader));
+        return true;
+    }
+
+    // Index rows are in capture order, so times ascend: binary search
+    // for the last row at or before the target
+    size_t lo = 0;
+    size_t hi = keyframeTotal;
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (keyframes[mid].timeMs <= timeMs) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo == 0) {
+        return false; // Every keyframe is later than the target
+    }
+
+    const KeyframeIndexEntry& entry = keyframes[lo - 1];
+    const char* base = reinterpret_cast<const char*>(header);
+    if (entry.fileOffset + sizeof(KeyframeHeader) > mappedBytes) {
+        return false;
+    }
+
+    std::memcpy(&outHeader, base + entry.fileOffset, sizeof(outHeader));
+    if (entry.fileOffset + sizeof(KeyframeHeader) +
+            sizeof(VehicleSnapshot) * outHeader.vehicleCount > mappedBytes) {
+        return false;
+    }
+
+    outRecords = reinterpret_cast<const VehicleSnapshot*>(
+        base + entry.fileOffset + sizeof(KeyframeHeader));
+    return true;
+}
+
+size_t EventJournal::eventCount() const {
+    return header ? static_cast<size_t>(header->count) : 0;
+}
+
+const JournalEvent& EventJournal::event(size_t index) const {
+    if (!compressed) {
+        return events[index];
+    }
+
+    // Decode-on-demand with a single resident block; replay's
+    // sequential walk re-decodes each block exactly once
+    static const JournalEvent corrupt{};
+    size_t lo = 0;
+    size_t hi = blockTable.size();
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (blockTable[mid].firstEvent <= index) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo == 0) {
+        return corrupt; // Index precedes the first block
+    }
+
+    size_t block = lo - 1;
+    if (block != cachedBlock) {
+        if (!readFrameAt(blockTable[block].fileOffset, cachedEvents)) {
+            DebugLogger::log("EventJournal: corrupt event block " +
+                             std::to_string(block),
+                           DebugLogger::LogLevel::ERROR);
+            cachedBlock = NO_BLOCK;
+            return corrupt;
+        }
+        cachedBlock = block;
+    }
+
+    size_t relative = index - static_cast<size_t>(blockTable[block].firstEvent);
+    if ((relative + 1) * sizeof(JournalEvent) > cachedEvents.size()) {
+        return corrupt;
+    }
+    return reinterpret_cast<const JournalEvent*>(cachedEvents.data())[relative];
+}
+
+bool EventJournal::isOpen() const {
+    return header != nullptr;
+}
+
+void EventJournal::sealEventBlock() {
+#ifndef _WIN32
+    if (blockBuffer.empty()) {
+        return;
+    }
+
+    BlockIndexEntry entry;
+    entry.firstEvent = header->count - blockBuffer.size();
+    entry.fileOffset = writeOffset;
+
+    size_t frameBytes = 0;
+    if (!writeFrameAt(reinterpret_cast<const char*>(blockBuffer.data()),
+                      blockBuffer.size() * sizeof(JournalEvent),
+                      writeOffset, frameBytes)) {
+        DebugLogger::log("EventJournal: block write failed, dropping " +
+                         std::to_string(blockBuffer.size()) + " events",
+                       DebugLogger::LogLevel::ERROR);
+        header->count -= blockBuffer.size();
+        blockBuffer.clear();
+        return;
+    }
+
+    blockTable.push_back(entry);
+    writeOffset += frameBytes;
+    blockBuffer.clear();
+#endif
+}
+
+bool EventJournal::writeFrameAt(const char* raw, size_t rawLen,
+                                uint64_t offset, size_t& frameBytes) {
+#ifndef _WIN32
+    std::vector<char> frame;
+    StreamCodec::appendFrame(raw, rawLen, frame);
+    if (pwrite(fd, frame.data(), frame.size(), static_cast<off_t>(offset)) !=
+        static_cast<ssize_t>(frame.size())) {
+        return false;
+    }
+    frameBytes = frame.size();
+    return true;
+#else
+    (void)raw; (void)rawLen; (void)offset; (void)frameBytes;
+    return false;
+#endif
+}
+
+bool EventJournal::readFrameAt(uint64_t offset, std::vector<char>& out) const {
+#ifndef _WIN32
+    uint32_t sizes[2]; // rawBytes, compBytes
+    if (!preadFully(fd, sizes, sizeof(sizes), offset)) {
+        return false;
+    }
+    if (sizes[1] > sizes[0]) {
+        return false;
+    }
+
+    std::vector<char> payload(sizes[1]);
+    if (!preadFully(fd, payload.data(), payload.size(),
+                    offset + sizeof(sizes))) {
+        return false;
+    }
+
+    out.resize(sizes[0]);
+    if (sizes[1] == sizes[0]) {
+        std::memcpy(out.data(), payload.data(), payload.size());
+        return true;
+    }
+    return StreamCodec::decompressBlock(payload.data(), payload.size(),
+                                        out.data(), out.size());
+#else
+    (void)offset; (void)out;
+    return false;
+#endif
+}
+
+bool EventJournal::remap(size_t newCapacity) {
+#ifndef _WIN32
+    if (header) {
+        munmap(header, mappedBytes);
+        header = nullptr;
+        events = nullptr;
+    }
+
+    if (ftruncate(fd, static_cast<off_t>(fileSize(newCapacity))) != 0) {
+        capacity = 0;
+        return false;
+    }
+
+    void* mapping = mmap(nullptr, fileSize(newCapacity),
+                         PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (mapping == MAP_FAILED) {
+        capacity = 0;
+        return false;
+    }
+
+    header = static_cast<Header*>(mapping);
+    events = reinterpret_cast<JournalEvent*>(
+        reinterpret_cast<char*>(mapping) + sizeof(Header));
+    capacity = newCapacity;
+    mappedBytes = fileSize(newCapacity);
+    return true;
+#else
+    (void)newCapacity;
+    return false;
+#endif
+}
+
+void EventJournal::close() {
+#ifndef _WIN32
+    if (compressed) {
+        if (writable && fd >= 0) {
+            // Land the pending block, both indexes, the footer and -
+            // last, so a crash mid-close leaves an unopenable file
+            // rather than a lying one - the real header
+            sealEventBlock();
+
+            CompressedFooter footer;
+            footer.blockIndexOffset = writeOffset;
+            footer.blockCount = blockTable.size();
+            footer.keyframeIndexOffset =
+                writeOffset + blockTable.size() * sizeof(BlockIndexEntry);
+            footer.keyframeCount = keyframeIndex.size();
+            footer.magic = COMPRESSED_FOOTER_MAGIC;
+            footer.pad = 0;
+
+            bool ok = blockTable.empty() ||
+                      pwrite(fd, blockTable.data(),
+                             blockTable.size() * sizeof(BlockIndexEntry),
+                             static_cast<off_t>(footer.blockIndexOffset)) ==
+                          static_cast<ssize_t>(blockTable.size() *
+                                               sizeof(BlockIndexEntry));
+            ok = ok && (keyframeIndex.empty() ||
+                        pwrite(fd, keyframeIndex.data(),
+                               keyframeIndex.size() * sizeof(KeyframeIndexEntry),
+                               static_cast<off_t>(footer.keyframeIndexOffset)) ==
+                            static_cast<ssize_t>(keyframeIndex.size() *
+                                                 sizeof(KeyframeIndexEntry)));
+            ok = ok && pwrite(fd, &footer, sizeof(footer),
+                              static_cast<off_t>(footer.keyframeIndexOffset +
+                                                 footer.keyframeCount *
+                                                     sizeof(KeyframeIndexEntry))) ==
+                           static_cast<ssize_t>(sizeof(footer));
+            ok = ok && pwrite(fd, header, sizeof(Header), 0) ==
+                           static_cast<ssize_t>(sizeof(Header));
+            if (!ok) {
+                DebugLogger::log("EventJournal: compressed index write failed",
+                               DebugLogger::LogLevel::WARNING);
+            }
+        }
+    } else if (header) {
+        // Trim the preallocated tail so the file holds exactly what was
+        // recorded
+        uint64_t recorded = header->count;
+        bool wasWritable = writable;
+
+        munmap(header, mappedBytes);
+        header = nullptr;
+        events = nullptr;
+
+        if (wasWritable && fd >= 0) {
+            if (ftruncate(fd, static_cast<off_t>(fileSize(recorded))) != 0) {
+                DebugLogger::log("EventJournal: failed to trim journal file",
+                               DebugLogger::LogLevel::WARNING);
+            }
+
+            // Land the staged keyframe section right after the trimmed
+            // event array: keyframes, then the index, then the footer
+            if (!keyframeBuffer.empty()) {
+                uint64_t sectionStart = fileSize(recorded);
+                for (auto& entry : keyframeIndex) {
+                    entry.fileOffset += sectionStart; // Was section-relative
+                }
+
+                KeyframeFooter footer;
+                footer.indexOffset = sectionStart + keyframeBuffer.size();
+                footer.keyframeCount = keyframeIndex.size();
+                footer.magic = KEYFRAME_MAGIC;
+                footer.pad = 0;
+
+                bool ok = pwrite(fd, keyframeBuffer.data(), keyframeBuffer.size(),
+                                 static_cast<off_t>(sectionStart)) ==
+                              static_cast<ssize_t>(keyframeBuffer.size());
+                ok = ok && pwrite(fd, keyframeIndex.data(),
+                                  keyframeIndex.size() * sizeof(KeyframeIndexEntry),
+                                  static_cast<off_t>(footer.indexOffset)) ==
+                              static_cast<ssize_t>(keyframeIndex.size() *
+                                                   sizeof(KeyframeIndexEntry));
+                ok = ok && pwrite(fd, &footer, sizeof(footer),
+                                  static_cast<off_t>(footer.indexOffset +
+                                                     footer.keyframeCount *
+                                                         sizeof(KeyframeIndexEntry))) ==
+                              static_cast<ssize_t>(sizeof(footer));
+                if (!ok) {
+                    DebugLogger::log("EventJournal: keyframe section write failed",
+                                   DebugLogger::LogLevel::WARNING);
+                }
+            }
+        }
+    }
+
+    if (fd >= 0) {
+        ::close(fd);
+        fd = -1;
+    }
+#endif
+
+    header = nullptr;
+    events = nullptr;
+    capacity = 0;
+    mappedBytes = 0;
+    writable = false;
+    keyframeBuffer.clear();
+    keyframeIndex.clear();
+    keyframes = nullptr;
+    keyframeTotal = 0;
+    compressed = false;
+    writeOffset = 0;
+    blockBuffer.clear();
+    blockTable.clear();
+    keyframeTable.clear();
+    cachedBlock = NO_BLOCK;
+    cachedEvents.clear();
+    keyframeScratch.clear();
+}
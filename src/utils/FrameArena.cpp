@@ -0,0 +1,46 @@
+// FILE: src/utils/FrameArena.cpp
+#include "utils/FrameArena.h"
+#include "utils/DebugLogger.h"
+
+FrameArena::FrameArena(size_t capacityBytes)
+    : buffer(new unsigned char[capacityBytes]),
+      capacity(capacityBytes),
+      offset(0),
+      warnedOverflow(false) {
+}
+
+FrameArena::~FrameArena() {
+    reset();
+}
+
+void* FrameArena::allocate(size_t bytes, size_t alignment) {
+    // Bump the pointer to the next aligned position
+    size_t aligned = (offset + alignment - 1) & ~(alignment - 1);
+
+    if (aligned + bytes <= capacity) {
+        offset = aligned + bytes;
+        return buffer.get() + aligned;
+    }
+
+    // Buffer exhausted - fall back to the heap so callers keep working;
+    // warn once because it means the arena should be sized up
+    if (!warnedOverflow) {
+        warnedOverflow = true;
+        DebugLogger::log("FrameArena: " + std::to_string(capacity) +
+                         " byte buffer exhausted, falling back to heap",
+                         DebugLogger::LogLevel::WARNING);
+    }
+
+    void* block = ::operator new(bytes);
+    overflowBlocks.push_back(block);
+    return block;
+}
+
+void FrameArena::reset() {
+    offset = 0;
+
+    for (void* block : overflowBlocks) {
+        ::operator delete(block);
+    }
+    overflowBlocks.clear();
+}
@@ -0,0 +1,335 @@
+// FILE: src/utils/FrameCapture.cpp
+#include "utils/FrameCapture.h"
+#include "utils/DebugLogger.h"
+#include "utils/FrameClock.h"
+#include "utils/ThreadScheduling.h"
+#include <chrono>
+#include <unordered_map>
+
+namespace {
+
+// Little-endian 16-bit field, the GIF integer encoding
+void writeU16(FILE* file, uint16_t value) {
+    fputc(value & 0xFF, file);
+    fputc(value >> 8, file);
+}
+
+// Accumulates LZW codes LSB-first and flushes the resulting bytes
+// through the 255-byte data sub-blocks the GIF stream requires
+struct BlockBitWriter {
+    FILE* file;
+    uint32_t bitBuffer = 0;
+    int bitCount = 0;
+    uint8_t block[255];
+    int blockLength = 0;
+
+    explicit BlockBitWriter(FILE* f) : file(f) {}
+
+    void putByte(uint8_t byte) {
+        block[blockLength++] = byte;
+        if (blockLength == 255) {
+            flushBlock();
+        }
+    }
+
+    void flushBlock() {
+        if (blockLength == 0) {
+            return;
+        }
+        fputc(blockLength, file);
+        fwrite(block, 1, blockLength, file);
+        blockLength = 0;
+    }
+
+    void putCode(uint32_t code, int width) {
+        bitBuffer |= code << bitCount;
+        bitCount += width;
+        while (bitCount >= 8) {
+            putByte(static_cast<uint8_t>(bitBuffer & 0xFF));
+            bitBuffer >>= 8;
+            bitCount -= 8;
+        }
+    }
+
+    void finish() {
+        if (bitCount > 0) {
+            putByte(static_cast<uint8_t>(bitBuffer & 0xFF));
+        }
+        flushBlock();
+        fputc(0x00, file); // Sub-block terminator
+    }
+};
+
+} // namespace
+
+FrameCapture::FrameCapture()
+    : writeIndex(0),
+      readIndex(0),
+      frameWidth(0),
+      frameHeight(0),
+      captureIntervalMs(0),
+      nextCaptureTime(0),
+      frameDelayCentis(2),
+      output(nullptr),
+      running(false),
+      droppedFrames(0) {}
+
+FrameCapture::~FrameCapture() {
+    stop();
+}
+
+bool FrameCapture::start(const std::string& outputPath, int width, int height,
+                         int fps) {
+    if (running.load(std::memory_order_relaxed)) {
+        return false;
+    }
+    if (fps < 1) {
+        fps = 1;
+    }
+    if (fps > 50) {
+        fps = 50; // GIF delays are 10ms steps; 50fps is the format ceiling
+    }
+
+    output = fopen(outputPath.c_str(), "wb");
+    if (!output) {
+        DebugLogger::log("Could not open capture file: " + outputPath,
+                         DebugLogger::LogLevel::ERROR);
+        return false;
+    }
+
+    frameWidth = width;
+    frameHeight = height;
+    captureIntervalMs = 1000u / static_cast<uint32_t>(fps);
+    nextCaptureTime = 0;
+    frameDelayCentis = 100 / fps;
+    if (frameDelayCentis < 2) {
+        frameDelayCentis = 2;
+    }
+    writeIndex = 0;
+    readIndex = 0;
+    droppedFrames.store(0, std::memory_order_relaxed);
+
+    // GIF89a header and logical screen descriptor with a global
+    // 256-entry palette (a 6x7x6 color cube; quantization is then pure
+    // arithmetic per pixel, no nearest-neighbor search)
+    fwrite("GIF89a", 1, 6, output);
+    writeU16(output, static_cast<uint16_t>(width));
+    writeU16(output, static_cast<uint16_t>(height));
+    fputc(0xF7, output); // Global table, 8 bits/pixel, 256 entries
+    fputc(0x00, output); // Background color index
+    fputc(0x00, output); // No pixel aspect ratio
+
+    for (int r = 0; r < 6; r++) {
+        for (int g = 0; g < 7; g++) {
+            for (int b = 0; b < 6; b++) {
+                fputc(r * 255 / 5, output);
+                fputc(g * 255 / 6, output);
+                fputc(b * 255 / 5, output);
+            }
+        }
+    }
+    for (int i = 252; i < 256; i++) { // Pad the cube out to 256 entries
+        fputc(0x00, output);
+        fputc(0x00, output);
+        fputc(0x00, output);
+    }
+
+    // NETSCAPE application extension: loop forever
+    static const uint8_t loopExtension[] = {
+        0x21, 0xFF, 0x0B, 'N', 'E', 'T', 'S', 'C', 'A', 'P', 'E',
+        '2', '.', '0', 0x03, 0x01, 0x00, 0x00, 0x00
+    };
+    fwrite(loopExtension, 1, sizeof(loopExtension), output);
+
+    running.store(true, std::memory_order_release);
+    encoderThread = std::thread(&FrameCapture::encodeLoop, this);
+
+    DebugLogger::log("Frame capture started: " + outputPath + " at " +
+                     std::to_string(fps) + "fps");
+    return true;
+}
+
+void FrameCapture::captureFrame(SDL_Renderer* renderer) {
+    if (!running.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    // Capture cadence: frames between ticks are skipped outright
+    uint32_t now = FrameClock::nowMs();
+    if (now < nextCaptureTime) {
+        return;
+    }
+    nextCaptureTime = now + captureIntervalMs;
+
+    // Ring full means the encoder is behind; drop rather than block
+    Slot& slot = slots[writeIndex];
+    if (slot.filled.load(std::memory_order_acquire)) {
+        droppedFrames.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    SDL_Surface* surface = SDL_RenderReadPixels(renderer, nullptr);
+    if (!surface) {
+        return;
+    }
+
+    slot.surface = surface;
+    slot.filled.store(true, std::memory_order_release);
+    writeIndex = (writeIndex + 1) % STAGING_SLOTS;
+}
+
+void FrameCapture::encodeLoop() {
+    // Encoding can always wait for spare cycles; dropping frames under
+    // pressure is preferable to contending with the render thread
+    ThreadScheduling::setCurrentThreadBackground();
+
+    std::vector<uint8_t> indexScratch;
+
+    for (;;) {
+        Slot& slot = slots[readIndex];
+        if (slot.filled.load(std::memory_order_acquire)) {
+            encodeFrame(slot.surface, indexScratch);
+            SDL_DestroySurface(slot.surface);
+            slot.surface = nullptr;
+            slot.filled.store(false, std::memory_order_release);
+            readIndex = (readIndex + 1) % STAGING_SLOTS;
+        } else if (!running.load(std::memory_order_relaxed)) {
+            break; // Producer stopped and the ring is drained
+        } else {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    }
+}
+
+void FrameCapture::encodeFrame(SDL_Surface* surface,
+                               std::vector<uint8_t>& indexScratch) {
+    // Normalize to a known byte order before quantizing
+    SDL_Surface* rgba = surface;
+    bool converted = false;
+    if (surface->format != SDL_PIXELFORMAT_RGBA32) {
+        rgba = SDL_ConvertSurface(surface, SDL_PIXELFORMAT_RGBA32);
+        if (!rgba) {
+            return;
+        }
+        converted = true;
+    }
+
+    if (rgba->w != frameWidth || rgba->h != frameHeight) {
+        // Window was resized mid-capture; skip rather than corrupt the
+        // fixed-dimension stream
+        if (converted) {
+            SDL_DestroySurface(rgba);
+        }
+        return;
+    }
+
+    // Map every pixel onto the 6x7x6 cube with plain arithmetic
+    indexScratch.resize(static_cast<size_t>(frameWidth) * frameHeight);
+    const uint8_t* pixels = static_cast<const uint8_t*>(rgba->pixels);
+    for (int y = 0; y < frameHeight; y++) {
+        const uint8_t* row = pixels + static_cast<size_t>(y) * rgba->pitch;
+        uint8_t* out = indexScratch.data() + static_cast<size_t>(y) * frameWidth;
+        for (int x = 0; x < frameWidth; x++) {
+            uint8_t r = row[x * 4];
+            uint8_t g = row[x * 4 + 1];
+            uint8_t b = row[x * 4 + 2];
+            out[x] = static_cast<uint8_t>(
+                (r * 6 >> 8) * 42 + (g * 7 >> 8) * 6 + (b * 6 >> 8));
+        }
+    }
+
+    if (converted) {
+        SDL_DestroySurface(rgba);
+    }
+
+    // Graphic control extension: frame delay, no transparency
+    fputc(0x21, output);
+    fputc(0xF9, output);
+    fputc(0x04, output);
+    fputc(0x04, output); // Disposal: leave the frame in place
+    writeU16(output, static_cast<uint16_t>(frameDelayCentis));
+    fputc(0x00, output);
+    fputc(0x00, output);
+
+    // Image descriptor: full frame, global palette
+    fputc(0x2C, output);
+    writeU16(output, 0);
+    writeU16(output, 0);
+    writeU16(output, static_cast<uint16_t>(frameWidth));
+    writeU16(output, static_cast<uint16_t>(frameHeight));
+    fputc(0x00, output);
+
+    // GIF-variant LZW: 8-bit symbols, codes grow 9..12 bits, dictionary
+    // reset via clear codes when it fills
+    const int MIN_CODE_SIZE = 8;
+    const uint32_t CLEAR_CODE = 256;
+    const uint32_t END_CODE = 257;
+    fputc(MIN_CODE_SIZE, output);
+
+    BlockBitWriter bits(output);
+    std::unordered_map<uint32_t, uint16_t> table;
+    table.reserve(4096);
+    int codeWidth = 9;
+    uint32_t nextCode = 258;
+
+    bits.putCode(CLEAR_CODE, codeWidth);
+    uint32_t prefix = indexScratch[0];
+    for (size_t i = 1; i < indexScratch.size(); i++) {
+        uint32_t c = indexScratch[i];
+        uint32_t key = (prefix << 8) | c;
+        auto it = table.find(key);
+        if (it != table.end()) {
+            prefix = it->second;
+            continue;
+        }
+
+        bits.putCode(prefix, codeWidth);
+        table[key] = static_cast<uint16_t>(nextCode);
+        if (nextCode >= (1u << codeWidth) && codeWidth < 12) {
+            codeWidth++;
+        }
+        nextCode++;
+        if (nextCode == 4096) {
+            bits.putCode(CLEAR_CODE, codeWidth);
+            table.clear();
+            codeWidth = 9;
+            nextCode = 258;
+        }
+        prefix = c;
+    }
+    bits.putCode(prefix, codeWidth);
+    bits.putCode(END_CODE, codeWidth);
+    bits.finish();
+}
+
+void FrameCapture::stop() {
+    if (!running.exchange(false, std::memory_order_acq_rel)) {
+        return;
+    }
+    if (encoderThread.joinable()) {
+        encoderThread.join();
+    }
+
+    // The encoder drains in order before exiting, but be thorough
+    for (Slot& slot : slots) {
+        if (slot.surface) {
+            SDL_DestroySurface(slot.surface);
+            slot.surface = nullptr;
+        }
+        slot.filled.store(false, std::memory_order_relaxed);
+    }
+
+    if (output) {
+        fputc(0x3B, output); // GIF trailer
+        fclose(output);
+        output = nullptr;
+    }
+
+    uint64_t dropped = droppedFrames.load(std::memory_order_relaxed);
+    if (dropped > 0) {
+        DebugLogger::log("Frame capture dropped " + std::to_string(dropped) +
+                         " frames (encoder behind)",
+                         DebugLogger::LogLevel::WARNING);
+    }
+    DebugLogger::log("Frame capture finished");
+}
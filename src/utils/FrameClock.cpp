@@ -0,0 +1,28 @@
+// FILE: src/utils/FrameClock.cpp
+#include "utils/FrameClock.h"
+
+#include <SDL3/SDL.h>
+
+thread_local uint32_t FrameClock::frozenMs = 0;
+thread_local bool FrameClock::frozen = false;
+thread_local uint64_t FrameClock::frames = 0;
+
+void FrameClock::beginFrame() {
+    frozenMs = static_cast<uint32_t>(SDL_GetTicks());
+    frozen = true;
+    frames++;
+}
+
+void FrameClock::beginFrame(uint32_t logicalMs) {
+    frozenMs = logicalMs;
+    frozen = true;
+    frames++;
+}
+
+uint32_t FrameClock::nowMs() {
+    return frozen ? frozenMs : static_cast<uint32_t>(SDL_GetTicks());
+}
+
+uint64_t FrameClock::frameIndex() {
+    return frames;
+}
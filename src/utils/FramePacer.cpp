@@ -0,0 +1,70 @@
+// FILE: src/utils/FramePacer.cpp
+#include "utils/FramePacer.h"
+#include <SDL3/SDL.h>
+
+namespace {
+    // Hand the last stretch before the deadline to a spin loop: kernel
+    // sleeps round up to a scheduler quantum, and that rounding is what
+    // made the old limiter oscillate around the target rate
+    constexpr uint64_t SPIN_MARGIN_NS = 1500000; // 1.5ms
+}
+
+FramePacer::FramePacer(int targetFps, int idleFps)
+    : targetFps(targetFps),
+      idleFps(idleFps),
+      vsyncActive(false),
+      wasIdle(false),
+      nextDeadlineNs(0) {}
+
+void FramePacer::setTargetFps(int fps) {
+    targetFps = fps;
+}
+
+void FramePacer::setVsyncActive(bool active) {
+    vsyncActive = active;
+}
+
+bool FramePacer::isVsyncActive() const {
+    return vsyncActive;
+}
+
+void FramePacer::pace(bool sceneActive) {
+    int fps = sceneActive ? targetFps : idleFps;
+    if (fps <= 0) {
+        return;
+    }
+
+    uint64_t periodNs = 1000000000ull / static_cast<uint64_t>(fps);
+    uint64_t now = SDL_GetTicksNS();
+
+    if (sceneActive && vsyncActive) {
+        // The display already paced this frame through the present
+        // call; just keep the deadline fresh for a later idle stretch
+        nextDeadlineNs = now + periodNs;
+        wasIdle = false;
+        return;
+    }
+
+    // Rebase instead of chasing the old deadline when starting out,
+    // waking from idle, or running more than a full period late -
+    // catching up would burst frames, which reads worse than one
+    // stretched frame
+    if (nextDeadlineNs == 0 || (sceneActive && wasIdle) ||
+        now >= nextDeadlineNs + periodNs) {
+        nextDeadlineNs = now + periodNs;
+        wasIdle = !sceneActive;
+        return;
+    }
+
+    // Coarse sleep to just short of the deadline, then spin-finish so
+    // the frame releases on the nanosecond clock, not on a timer tick
+    if (nextDeadlineNs > now + SPIN_MARGIN_NS) {
+        SDL_DelayNS(nextDeadlineNs - now - SPIN_MARGIN_NS);
+    }
+    while (SDL_GetTicksNS() < nextDeadlineNs) {
+        // Bounded by SPIN_MARGIN_NS plus whatever the sleep overshot
+    }
+
+    nextDeadlineNs += periodNs;
+    wasIdle = !sceneActive;
+}
@@ -0,0 +1,95 @@
+// FILE: src/utils/FrameStats.cpp
+#include "utils/FrameStats.h"
+
+#include <algorithm>
+#include <cstdio>
+
+#include "utils/DebugLogger.h"
+
+namespace {
+
+// Sorted percentile over the scratch copy (nanoseconds)
+uint64_t percentileNs(const uint64_t* sorted, size_t count, double pct) {
+    if (count == 0) {
+        return 0;
+    }
+    size_t index = static_cast<size_t>(pct / 100.0 * (count - 1));
+    return sorted[index];
+}
+
+float toMs(uint64_t ns) {
+    return static_cast<float>(ns) / 1e6f;
+}
+
+} // namespace
+
+FrameStats::FrameStats()
+    : ring{},
+      ringCount(0),
+      ringHead(0),
+      totalFrames(0),
+      stutterCount(0) {
+}
+
+void FrameStats::record(uint64_t frameNs) {
+    // Judge the stutter against the median of the frames before it, so
+    // one hitch can't raise the bar it is measured by
+    if (ringCount >= RING_SIZE / 2) {
+        uint64_t median = ringMedianNs();
+        if (median > 0 && frameNs > 2 * median) {
+            stutterCount++;
+        }
+    }
+
+    ring[ringHead] = frameNs;
+    ringHead = (ringHead + 1) % RING_SIZE;
+    if (ringCount < RING_SIZE) {
+        ringCount++;
+    }
+    totalFrames++;
+}
+
+uint64_t FrameStats::ringMedianNs() const {
+    if (ringCount == 0) {
+        return 0;
+    }
+    uint64_t scratch[RING_SIZE];
+    std::copy(ring, ring + ringCount, scratch);
+    size_t mid = ringCount / 2;
+    std::nth_element(scratch, scratch + mid, scratch + ringCount);
+    return scratch[mid];
+}
+
+FrameStats::Summary FrameStats::summarize() const {
+    Summary summary = {};
+    summary.frames = totalFrames;
+    summary.stutters = stutterCount;
+    if (ringCount == 0) {
+        return summary;
+    }
+
+    uint64_t scratch[RING_SIZE];
+    std::copy(ring, ring + ringCount, scratch);
+    std::sort(scratch, scratch + ringCount);
+
+    summary.p50Ms = toMs(percentileNs(scratch, ringCount, 50.0));
+    summary.p95Ms = toMs(percentileNs(scratch, ringCount, 95.0));
+    summary.p99Ms = toMs(percentileNs(scratch, ringCount, 99.0));
+    summary.maxMs = toMs(scratch[ringCount - 1]);
+    return summary;
+}
+
+void FrameStats::logSummary() const {
+    if (totalFrames == 0) {
+        return;
+    }
+    Summary summary = summarize();
+    char line[160];
+    snprintf(line, sizeof(line),
+             "Frame stats: %llu frames, p50 %.1fms p95 %.1fms p99 %.1fms "
+             "max %.1fms, %llu stutters (>2x median)",
+             static_cast<unsigned long long>(summary.frames), summary.p50Ms,
+             summary.p95Ms, summary.p99Ms, summary.maxMs,
+             static_cast<unsigned long long>(summary.stutters));
+    DebugLogger::log(line);
+}
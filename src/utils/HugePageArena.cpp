@@ -0,0 +1,122 @@
+// FILE: src/utils/HugePageArena.cpp
+#include "utils/HugePageArena.h"
+#include "utils/DebugLogger.h"
+
+#include <new>
+#include <sstream>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace {
+
+const size_t HUGE_PAGE_BYTES = 2u * 1024 * 1024;
+
+// Registry of live arenas for snapshotAll(); function-local statics so
+// arenas constructed lazily before main() still find it initialized
+std::vector<HugePageArena*>& registry() {
+    static std::vector<HugePageArena*> arenas;
+    return arenas;
+}
+
+std::mutex& registryMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+} // namespace
+
+HugePageArena::HugePageArena(const char* name, size_t reserveBytes)
+    : arenaName(name),
+      base(nullptr),
+      reserved(0),
+      used(0),
+      allocCount(0),
+      overflow(0),
+      hugeBacked(false) {
+    // Round the reservation up to whole 2MB pages
+    reserveBytes =
+        (reserveBytes + HUGE_PAGE_BYTES - 1) / HUGE_PAGE_BYTES * HUGE_PAGE_BYTES;
+
+#ifdef __linux__
+    void* map = mmap(nullptr, reserveBytes, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (map != MAP_FAILED) {
+        hugeBacked = true;
+    } else {
+        // No reserved huge pages on this box (vm.nr_hugepages); take a
+        // normal mapping and ask the kernel for transparent huge pages
+        map = mmap(nullptr, reserveBytes, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (map != MAP_FAILED) {
+            madvise(map, reserveBytes, MADV_HUGEPAGE);
+        }
+    }
+    if (map != MAP_FAILED) {
+        base = static_cast<unsigned char*>(map);
+        reserved = reserveBytes;
+    }
+#else
+    // No page-size control off Linux; one plain reservation keeps the
+    // bump-allocation and occupancy accounting identical
+    base = static_cast<unsigned char*>(::operator new(reserveBytes, std::nothrow));
+    if (base) {
+        reserved = reserveBytes;
+    }
+#endif
+
+    {
+        std::lock_guard<std::mutex> lock(registryMutex());
+        registry().push_back(this);
+    }
+
+    std::ostringstream oss;
+    oss << "Arena '" << arenaName << "' reserved " << reserved / 1024 << " KB ("
+        << (hugeBacked ? "2MB pages" : "transparent huge pages") << ")";
+    DebugLogger::log(oss.str());
+}
+
+void* HugePageArena::allocate(size_t bytes, size_t alignment) {
+    std::lock_guard<std::mutex> lock(arenaMutex);
+
+    size_t offset = (used + alignment - 1) & ~(alignment - 1);
+    if (base && offset + bytes <= reserved) {
+        void* out = base + offset;
+        used = offset + bytes;
+        allocCount++;
+        return out;
+    }
+
+    // Region exhausted (or the mapping failed): fall back to the heap
+    // so the stores keep working, and let the stats show the spill
+    overflow += bytes;
+    allocCount++;
+    return ::operator new(bytes, std::align_val_t(alignment));
+}
+
+HugePageArena::Stats HugePageArena::stats() const {
+    std::lock_guard<std::mutex> lock(arenaMutex);
+    return {arenaName, reserved, used, allocCount, overflow, hugeBacked};
+}
+
+std::vector<HugePageArena::Stats> HugePageArena::snapshotAll() {
+    std::lock_guard<std::mutex> lock(registryMutex());
+
+    std::vector<Stats> out;
+    out.reserve(registry().size());
+    for (const HugePageArena* arena : registry()) {
+        out.push_back(arena->stats());
+    }
+    return out;
+}
+
+HugePageArena& HugePageArena::vehicles() {
+    static HugePageArena arena("vehicle_slabs", 8u * 1024 * 1024);
+    return arena;
+}
+
+HugePageArena& HugePageArena::stateArrays() {
+    static HugePageArena arena("state_arrays", 8u * 1024 * 1024);
+    return arena;
+}
@@ -0,0 +1,203 @@
+// FILE: src/utils/LaneExchange.cpp
+#include "utils/LaneExchange.h"
+#include <cstring>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    constexpr size_t exchangeSize() {
+        return sizeof(uint32_t) * 2 + (sizeof(uint64_t) * 2 + 48) * 4 +
+               sizeof(VehicleMessage) * LaneExchange::SLOTS_PER_LANE * 4 + 64;
+    }
+}
+
+LaneExchange::LaneExchange()
+    : header(nullptr),
+      slots(nullptr),
+      owner(false),
+      available(false)
+#ifndef _WIN32
+    , fileFd(-1)
+#endif
+{
+}
+
+LaneExchange::~LaneExchange() {
+    close();
+}
+
+bool LaneExchange::create(const std::string& path) {
+#ifndef _WIN32
+    filePath = path;
+
+    // Replace any stale exchange from a previous run so the consumer
+    // never resumes against dead cursors
+    ::unlink(path.c_str());
+
+    fileFd = ::open(path.c_str(), O_CREAT | O_RDWR | O_EXCL, 0666);
+    if (fileFd < 0) {
+        return false;
+    }
+
+    // Preallocate the whole file up front; after this the only
+    // metadata the kernel ever touches again is dirty-page writeback
+    if (ftruncate(fileFd, static_cast<off_t>(exchangeSize())) != 0) {
+        ::close(fileFd);
+        ::unlink(path.c_str());
+        fileFd = -1;
+        return false;
+    }
+
+    void* mapping = mmap(nullptr, exchangeSize(), PROT_READ | PROT_WRITE,
+                         MAP_SHARED, fileFd, 0);
+    if (mapping == MAP_FAILED) {
+        ::close(fileFd);
+        ::unlink(path.c_str());
+        fileFd = -1;
+        return false;
+    }
+
+    header = static_cast<ExchangeHeader*>(mapping);
+    slots = reinterpret_cast<VehicleMessage*>(
+        reinterpret_cast<char*>(mapping) + sizeof(ExchangeHeader));
+
+    // Initialize the control block; the magic goes in last so a
+    // consumer mapping a half-built file rejects it
+    for (int i = 0; i < 4; i++) {
+        header->lanes[i].head.store(0, std::memory_order_relaxed);
+        header->lanes[i].tail.store(0, std::memory_order_relaxed);
+    }
+    header->slotsPerLane = SLOTS_PER_LANE;
+    header->magic = MAGIC;
+
+    owner = true;
+    available = true;
+    return true;
+#else
+    (void)path;
+    return false; // Fall back to lane files on Windows
+#endif
+}
+
+bool LaneExchange::open(const std::string& path) {
+#ifndef _WIN32
+    filePath = path;
+
+    fileFd = ::open(path.c_str(), O_RDWR);
+    if (fileFd < 0) {
+        return false;
+    }
+
+    // A short file is one the producer is still building (or a
+    // leftover); don't map past its end
+    struct stat fileInfo;
+    if (fstat(fileFd, &fileInfo) != 0 ||
+        fileInfo.st_size < static_cast<off_t>(exchangeSize())) {
+        ::close(fileFd);
+        fileFd = -1;
+        return false;
+    }
+
+    void* mapping = mmap(nullptr, exchangeSize(), PROT_READ | PROT_WRITE,
+                         MAP_SHARED, fileFd, 0);
+    if (mapping == MAP_FAILED) {
+        ::close(fileFd);
+        fileFd = -1;
+        return false;
+    }
+
+    header = static_cast<ExchangeHeader*>(mapping);
+    slots = reinterpret_cast<VehicleMessage*>(
+        reinterpret_cast<char*>(mapping) + sizeof(ExchangeHeader));
+
+    // Reject files written by an incompatible build
+    if (header->magic != MAGIC || header->slotsPerLane != SLOTS_PER_LANE) {
+        munmap(mapping, exchangeSize());
+        ::close(fileFd);
+        header = nullptr;
+        slots = nullptr;
+        fileFd = -1;
+        return false;
+    }
+
+    owner = false;
+    available = true;
+    return true;
+#else
+    (void)path;
+    return false; // Fall back to lane files on Windows
+#endif
+}
+
+bool LaneExchange::push(const VehicleMessage& message) {
+    if (!available || message.lane < 'A' || message.lane > 'D') {
+        return false;
+    }
+
+    int laneIndex = message.lane - 'A';
+    LaneCursors& cursors = header->lanes[laneIndex];
+    VehicleMessage* ring = slots + static_cast<size_t>(laneIndex) * SLOTS_PER_LANE;
+
+    uint64_t tail = cursors.tail.load(std::memory_order_relaxed);
+    uint64_t head = cursors.head.load(std::memory_order_acquire);
+
+    if (tail - head >= SLOTS_PER_LANE) {
+        return false; // Ring is full; caller falls back to the lane file
+    }
+
+    ring[tail % SLOTS_PER_LANE] = message;
+
+    // Publish the slot only after the memcpy completed
+    cursors.tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+bool LaneExchange::pop(char laneId, VehicleMessage& message) {
+    if (!available || laneId < 'A' || laneId > 'D') {
+        return false;
+    }
+
+    int laneIndex = laneId - 'A';
+    LaneCursors& cursors = header->lanes[laneIndex];
+    VehicleMessage* ring = slots + static_cast<size_t>(laneIndex) * SLOTS_PER_LANE;
+
+    uint64_t head = cursors.head.load(std::memory_order_relaxed);
+    uint64_t tail = cursors.tail.load(std::memory_order_acquire);
+
+    if (head == tail) {
+        return false; // Ring is empty
+    }
+
+    message = ring[head % SLOTS_PER_LANE];
+
+    cursors.head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+bool LaneExchange::isAvailable() const {
+    return available;
+}
+
+void LaneExchange::close() {
+#ifndef _WIN32
+    if (header) {
+        munmap(header, exchangeSize());
+        header = nullptr;
+        slots = nullptr;
+    }
+    if (fileFd >= 0) {
+        ::close(fileFd);
+        fileFd = -1;
+    }
+    if (owner && !filePath.empty()) {
+        ::unlink(filePath.c_str());
+        owner = false;
+    }
+    available = false;
+#endif
+}
@@ -0,0 +1,238 @@
+// FILE: src/utils/MetricsHttpServer.cpp
+#include "utils/MetricsHttpServer.h"
+#include "utils/MetricsSegment.h"
+#include "utils/DebugLogger.h"
+#include "utils/HugePageArena.h"
+
+#include <cstdio>
+#include <cstring>
+
+#ifndef _WIN32
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+MetricsHttpServer::MetricsHttpServer()
+    : segment(nullptr),
+      listenFd(-1),
+      running(false) {
+}
+
+MetricsHttpServer::~MetricsHttpServer() {
+    stop();
+}
+
+bool MetricsHttpServer::start(uint16_t port, MetricsSegment* metricsSegment) {
+#ifndef _WIN32
+    if (running.load()) {
+        return true;
+    }
+
+    segment = metricsSegment;
+
+    listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    if (listenFd < 0) {
+        DebugLogger::log("Metrics endpoint: socket() failed",
+                         DebugLogger::LogLevel::ERROR);
+        return false;
+    }
+
+    int reuse = 1;
+    setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(port);
+
+    if (bind(listenFd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 ||
+        listen(listenFd, 4) < 0) {
+        DebugLogger::log("Metrics endpoint: cannot bind port " +
+                         std::to_string(port), DebugLogger::LogLevel::ERROR);
+        ::close(listenFd);
+        listenFd = -1;
+        return false;
+    }
+
+    running.store(true);
+    serverThread = std::thread(&MetricsHttpServer::serveLoop, this);
+
+    DebugLogger::log("Metrics endpoint listening on port " +
+                     std::to_string(port));
+    return true;
+#else
+    (void)port;
+    (void)metricsSegment;
+    return false; // No metrics endpoint on Windows
+#endif
+}
+
+void MetricsHttpServer::stop() {
+#ifndef _WIN32
+    if (!running.exchange(false)) {
+        return;
+    }
+
+    if (serverThread.joinable()) {
+        serverThread.join();
+    }
+
+    if (listenFd >= 0) {
+        ::close(listenFd);
+        listenFd = -1;
+    }
+#endif
+}
+
+bool MetricsHttpServer::isRunning() const {
+    return running.load();
+}
+
+#ifndef _WIN32
+void MetricsHttpServer::serveLoop() {
+    while (running.load()) {
+        // Poll with a timeout so stop() can join without a connection
+        pollfd pfd = {listenFd, POLLIN, 0};
+        int ready = poll(&pfd, 1, 200);
+        if (ready <= 0) {
+            continue;
+        }
+
+        int clientFd = accept(listenFd, nullptr, nullptr);
+        if (clientFd < 0) {
+            continue;
+        }
+
+        // Drain the request line/headers; the path doesn't matter, every
+        // GET gets the exposition (Prometheus only asks for /metrics)
+        char requestBuf[1024];
+        ssize_t received = recv(clientFd, requestBuf, sizeof(requestBuf) - 1, 0);
+        (void)received;
+
+        MetricsBlock block = {};
+        std::string body;
+        if (segment && segment->sample(block)) {
+            body = buildExposition(block);
+        }
+
+        char header[128];
+        int headerLen = snprintf(header, sizeof(header),
+                                 "HTTP/1.0 200 OK\r\n"
+                                 "Content-Type: text/plain; version=0.0.4\r\n"
+                                 "Content-Length: %zu\r\n\r\n",
+                                 body.size());
+        send(clientFd, header, headerLen, 0);
+        if (!body.empty()) {
+            send(clientFd, body.c_str(), body.size(), 0);
+        }
+
+        ::close(clientFd);
+    }
+}
+#else
+void MetricsHttpServer::serveLoop() {}
+#endif
+
+std::string MetricsHttpServer::buildExposition(const MetricsBlock& block) {
+    std::string out;
+    out.reserve(2048);
+    char line[128];
+
+    out += "# HELP traffic_lane_queue_depth Vehicles currently queued in the lane\n"
+           "# TYPE traffic_lane_queue_depth gauge\n";
+    for (const auto& lane : block.lanes) {
+        snprintf(line, sizeof(line),
+                 "traffic_lane_queue_depth{lane=\"%c%d\"} %d\n",
+                 lane.laneId, lane.laneNumber, lane.queueDepth);
+        out += line;
+    }
+
+    out += "# HELP traffic_lane_arrivals_per_minute Arrival rate over the last completed minute\n"
+           "# TYPE traffic_lane_arrivals_per_minute gauge\n";
+    for (const auto& lane : block.lanes) {
+        snprintf(line, sizeof(line),
+                 "traffic_lane_arrivals_per_minute{lane=\"%c%d\"} %.1f\n",
+                 lane.laneId, lane.laneNumber, lane.arrivalsPerMin);
+        out += line;
+    }
+
+    out += "# HELP traffic_lane_departures_per_minute Departure rate over the last completed minute\n"
+           "# TYPE traffic_lane_departures_per_minute gauge\n";
+    for (const auto& lane : block.lanes) {
+        snprintf(line, sizeof(line),
+                 "traffic_lane_departures_per_minute{lane=\"%c%d\"} %.1f\n",
+                 lane.laneId, lane.laneNumber, lane.departuresPerMin);
+        out += line;
+    }
+
+    out += "# HELP traffic_lane_priority_active 1 while the lane is in priority mode\n"
+           "# TYPE traffic_lane_priority_active gauge\n";
+    for (const auto& lane : block.lanes) {
+        snprintf(line, sizeof(line),
+                 "traffic_lane_priority_active{lane=\"%c%d\"} %d\n",
+                 lane.laneId, lane.laneNumber, lane.priorityActive);
+        out += line;
+    }
+
+    out += "# HELP traffic_light_state Current TrafficLight::State (0=ALL_RED)\n"
+           "# TYPE traffic_light_state gauge\n";
+    snprintf(line, sizeof(line), "traffic_light_state %d\n", block.lightState);
+    out += line;
+
+    out += "# HELP traffic_vehicles_spawned_total Vehicles spawned since start\n"
+           "# TYPE traffic_vehicles_spawned_total counter\n";
+    snprintf(line, sizeof(line), "traffic_vehicles_spawned_total %llu\n",
+             static_cast<unsigned long long>(block.totalArrivals));
+    out += line;
+
+    out += "# HELP traffic_vehicles_exited_total Vehicles that left the simulation\n"
+           "# TYPE traffic_vehicles_exited_total counter\n";
+    snprintf(line, sizeof(line), "traffic_vehicles_exited_total %llu\n",
+             static_cast<unsigned long long>(block.totalDepartures));
+    out += line;
+
+    out += "# HELP traffic_wait_seconds Queue wait percentiles in seconds\n"
+           "# TYPE traffic_wait_seconds gauge\n";
+    snprintf(line, sizeof(line),
+             "traffic_wait_seconds{quantile=\"0.5\"} %.0f\n"
+             "traffic_wait_seconds{quantile=\"0.9\"} %.0f\n"
+             "traffic_wait_seconds{quantile=\"0.99\"} %.0f\n",
+             block.waitP50, block.waitP90, block.waitP99);
+    out += line;
+
+    out += "# HELP traffic_tick_duration_ms Duration covered by the last update tick\n"
+           "# TYPE traffic_tick_duration_ms gauge\n";
+    snprintf(line, sizeof(line), "traffic_tick_duration_ms %u\n", block.tickMs);
+    out += line;
+
+    out += "# HELP traffic_sim_time_ms Logical simulation clock\n"
+           "# TYPE traffic_sim_time_ms counter\n";
+    snprintf(line, sizeof(line), "traffic_sim_time_ms %llu\n",
+             static_cast<unsigned long long>(block.simTimeMs));
+    out += line;
+
+    // Arena occupancy comes straight from the in-process registry
+    // rather than the published block - the arenas live in this
+    // process, so there is nothing to ship through the segment
+    out += "# HELP traffic_arena_bytes Long-lived arena occupancy in bytes\n"
+           "# TYPE traffic_arena_bytes gauge\n";
+    for (const auto& arena : HugePageArena::snapshotAll()) {
+        snprintf(line, sizeof(line),
+                 "traffic_arena_bytes{arena=\"%s\",kind=\"used\"} %zu\n",
+                 arena.name, arena.usedBytes);
+        out += line;
+        snprintf(line, sizeof(line),
+                 "traffic_arena_bytes{arena=\"%s\",kind=\"reserved\"} %zu\n",
+                 arena.name, arena.reservedBytes);
+        out += line;
+        snprintf(line, sizeof(line),
+                 "traffic_arena_bytes{arena=\"%s\",kind=\"overflow\"} %zu\n",
+                 arena.name, arena.overflowBytes);
+        out += line;
+    }
+
+    return out;
+}
@@ -0,0 +1,164 @@
+// FILE: src/utils/MetricsSegment.cpp
+#include "utils/MetricsSegment.h"
+#include <cstring>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+MetricsSegment::MetricsSegment()
+    : header(nullptr),
+      owner(false),
+      available(false)
+#ifndef _WIN32
+    , shmFd(-1)
+#endif
+{
+}
+
+MetricsSegment::~MetricsSegment() {
+    close();
+}
+
+bool MetricsSegment::create(const std::string& name) {
+#ifndef _WIN32
+    shmName = name;
+
+    // Remove any stale segment from a previous run
+    shm_unlink(name.c_str());
+
+    shmFd = shm_open(name.c_str(), O_CREAT | O_RDWR | O_EXCL, 0666);
+    if (shmFd < 0) {
+        return false;
+    }
+
+    if (ftruncate(shmFd, static_cast<off_t>(sizeof(SharedHeader))) != 0) {
+        ::close(shmFd);
+        shm_unlink(name.c_str());
+        shmFd = -1;
+        return false;
+    }
+
+    void* mapping = mmap(nullptr, sizeof(SharedHeader),
+                         PROT_READ | PROT_WRITE, MAP_SHARED, shmFd, 0);
+    if (mapping == MAP_FAILED) {
+        ::close(shmFd);
+        shm_unlink(name.c_str());
+        shmFd = -1;
+        return false;
+    }
+
+    header = static_cast<SharedHeader*>(mapping);
+    header->sequence.store(0, std::memory_order_relaxed);
+    memset(&header->block, 0, sizeof(header->block));
+    header->magic = MAGIC;
+
+    owner = true;
+    available = true;
+    return true;
+#else
+    (void)name;
+    return false; // No metrics export on Windows
+#endif
+}
+
+bool MetricsSegment::open(const std::string& name) {
+#ifndef _WIN32
+    shmName = name;
+
+    shmFd = shm_open(name.c_str(), O_RDWR, 0666);
+    if (shmFd < 0) {
+        return false;
+    }
+
+    void* mapping = mmap(nullptr, sizeof(SharedHeader),
+                         PROT_READ | PROT_WRITE, MAP_SHARED, shmFd, 0);
+    if (mapping == MAP_FAILED) {
+        ::close(shmFd);
+        shmFd = -1;
+        return false;
+    }
+
+    header = static_cast<SharedHeader*>(mapping);
+    if (header->magic != MAGIC) {
+        munmap(header, sizeof(SharedHeader));
+        header = nullptr;
+        ::close(shmFd);
+        shmFd = -1;
+        return false;
+    }
+
+    owner = false;
+    available = true;
+    return true;
+#else
+    (void)name;
+    return false;
+#endif
+}
+
+void MetricsSegment::publish(const MetricsBlock& block) {
+    if (!available) {
+        return;
+    }
+
+    // Seqlock write: odd sequence marks the block as in flight. The
+    // release on the second store orders the payload copy before the
+    // sequence a reader checks.
+    uint32_t seq = header->sequence.load(std::memory_order_relaxed);
+    header->sequence.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    header->block = block;
+
+    header->sequence.store(seq + 2, std::memory_order_release);
+}
+
+bool MetricsSegment::sample(MetricsBlock& out) const {
+    if (!available) {
+        return false;
+    }
+
+    // A handful of retries is plenty: the writer publishes once per
+    // tick and the copy is a few hundred bytes
+    for (int attempt = 0; attempt < 8; attempt++) {
+        uint32_t before = header->sequence.load(std::memory_order_acquire);
+        if (before & 1) {
+            continue; // Write in flight
+        }
+
+        out = header->block;
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint32_t after = header->sequence.load(std::memory_order_relaxed);
+        if (before == after) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool MetricsSegment::isAvailable() const {
+    return available;
+}
+
+void MetricsSegment::close() {
+#ifndef _WIN32
+    if (header) {
+        munmap(header, sizeof(SharedHeader));
+        header = nullptr;
+    }
+    if (shmFd >= 0) {
+        ::close(shmFd);
+        shmFd = -1;
+    }
+    if (owner && !shmName.empty()) {
+        shm_unlink(shmName.c_str());
+    }
+#endif
+    owner = false;
+    available = false;
+}
@@ -0,0 +1,251 @@
+// FILE: src/utils/Profiler.cpp
+#include "utils/Profiler.h"
+#include "utils/DebugLogger.h"
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+
+namespace {
+    uint64_t nowNs() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+}
+
+// Registry of all per-thread rings; threads register once, the overlay
+// scans. Rings are never removed - the handful of threads here (sim,
+// render, watcher, flush) live for the whole run.
+std::vector<Profiler::ThreadRing*>& Profiler::registry() {
+    static std::vector<ThreadRing*> rings;
+    return rings;
+}
+
+std::mutex& Profiler::registryMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+Profiler::ThreadRing* Profiler::ringForThisThread() {
+    thread_local ThreadRing* ring = nullptr;
+    if (!ring) {
+        ring = new ThreadRing();
+        ring->head.store(0, std::memory_order_relaxed);
+        for (auto& entry : ring->entries) {
+            entry.name = nullptr;
+            entry.durationNs = 0;
+        }
+
+        std::lock_guard<std::mutex> lock(registryMutex());
+        registry().push_back(ring);
+    }
+    return ring;
+}
+
+void Profiler::record(const char* name, uint64_t durationNs) {
+    ThreadRing* ring = ringForThisThread();
+
+    uint32_t slot = ring->head.load(std::memory_order_relaxed);
+    ring->entries[slot & (RING_SIZE - 1)] = {name, durationNs};
+    ring->head.store(slot + 1, std::memory_order_release);
+}
+
+Profiler::Scope::Scope(const char* phaseName)
+    : name(phaseName),
+      startNs(nowNs()) {
+}
+
+Profiler::Scope::~Scope() {
+    uint64_t endNs = nowNs();
+    record(name, endNs - startNs);
+
+    if (traceActive.load(std::memory_order_relaxed)) {
+        tracePush(name, startNs, endNs - startNs);
+    }
+}
+
+// Static trace-capture members
+std::atomic<bool> Profiler::traceActive{false};
+Profiler::TraceCell Profiler::traceRing[Profiler::TRACE_RING_SIZE];
+std::atomic<size_t> Profiler::traceEnqueuePos{0};
+std::atomic<size_t> Profiler::traceDequeuePos{0};
+std::atomic<uint64_t> Profiler::traceDropped{0};
+std::thread Profiler::traceThread;
+std::atomic<bool> Profiler::traceRunning{false};
+FILE* Profiler::traceFile = nullptr;
+
+uint32_t Profiler::threadId() {
+    static std::atomic<uint32_t> nextTid{1};
+    thread_local uint32_t tid = nextTid.fetch_add(1, std::memory_order_relaxed);
+    return tid;
+}
+
+bool Profiler::startTrace(const std::string& path) {
+    if (traceActive.load(std::memory_order_relaxed)) {
+        DebugLogger::log("Trace capture already active",
+                         DebugLogger::LogLevel::ERROR);
+        return false;
+    }
+
+    traceFile = fopen(path.c_str(), "w");
+    if (!traceFile) {
+        DebugLogger::log("Failed to open trace file: " + path,
+                         DebugLogger::LogLevel::ERROR);
+        return false;
+    }
+    fputs("[\n", traceFile);
+
+    // Stamp each ring cell with its slot index (Vyukov scheme, same as
+    // the async logger)
+    for (size_t i = 0; i < TRACE_RING_SIZE; i++) {
+        traceRing[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    traceEnqueuePos.store(0, std::memory_order_relaxed);
+    traceDequeuePos.store(0, std::memory_order_relaxed);
+    traceDropped.store(0, std::memory_order_relaxed);
+
+    traceRunning.store(true, std::memory_order_relaxed);
+    traceThread = std::thread(traceLoop);
+    traceActive.store(true, std::memory_order_release);
+
+    DebugLogger::log("Trace capture started: " + path,
+                     DebugLogger::LogLevel::INFO);
+    return true;
+}
+
+void Profiler::stopTrace() {
+    if (!traceActive.exchange(false, std::memory_order_acq_rel)) {
+        return;
+    }
+
+    // Let the writer drain whatever is still queued, then join it
+    traceRunning.store(false, std::memory_order_relaxed);
+    if (traceThread.joinable()) {
+        traceThread.join();
+    }
+
+    fputs("]\n", traceFile);
+    fclose(traceFile);
+    traceFile = nullptr;
+
+    uint64_t dropped = traceDropped.load(std::memory_order_relaxed);
+    if (dropped > 0) {
+        DebugLogger::log("Trace capture dropped " + std::to_string(dropped) +
+                         " events under load", DebugLogger::LogLevel::WARNING);
+    }
+    DebugLogger::log("Trace capture stopped", DebugLogger::LogLevel::INFO);
+}
+
+void Profiler::tracePush(const char* name, uint64_t startNs,
+                         uint64_t durationNs) {
+    size_t pos = traceEnqueuePos.load(std::memory_order_relaxed);
+
+    for (;;) {
+        TraceCell& cell = traceRing[pos & (TRACE_RING_SIZE - 1)];
+        size_t seq = cell.sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+        if (diff == 0) {
+            // Slot is free; claim it
+            if (traceEnqueuePos.compare_exchange_weak(pos, pos + 1,
+                                                      std::memory_order_relaxed)) {
+                cell.name = name;
+                cell.startNs = startNs;
+                cell.durationNs = durationNs;
+                cell.tid = threadId();
+                cell.sequence.store(pos + 1, std::memory_order_release);
+                return;
+            }
+            // CAS failed: pos was reloaded, retry
+        } else if (diff < 0) {
+            // Ring is full: drop rather than ever blocking the timed path
+            traceDropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            pos = traceEnqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void Profiler::traceLoop() {
+    while (traceRunning.load(std::memory_order_relaxed) ||
+           traceDequeuePos.load(std::memory_order_relaxed) !=
+           traceEnqueuePos.load(std::memory_order_relaxed)) {
+
+        bool drained = false;
+
+        for (;;) {
+            size_t pos = traceDequeuePos.load(std::memory_order_relaxed);
+            TraceCell& cell = traceRing[pos & (TRACE_RING_SIZE - 1)];
+            size_t seq = cell.sequence.load(std::memory_order_acquire);
+
+            if (static_cast<intptr_t>(seq) -
+                static_cast<intptr_t>(pos + 1) < 0) {
+                break; // Ring is empty
+            }
+
+            // Single consumer: no CAS needed
+            const char* name = cell.name;
+            uint64_t startNs = cell.startNs;
+            uint64_t durationNs = cell.durationNs;
+            uint32_t tid = cell.tid;
+            traceDequeuePos.store(pos + 1, std::memory_order_relaxed);
+            cell.sequence.store(pos + TRACE_RING_SIZE,
+                                std::memory_order_release);
+
+            // Complete ("X") event; ts/dur are microseconds. Phase names
+            // are literals and contain nothing that needs JSON escaping.
+            fprintf(traceFile,
+                    "{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,"
+                    "\"dur\":%.3f,\"pid\":1,\"tid\":%u},\n",
+                    name, startNs / 1000.0, durationNs / 1000.0, tid);
+            drained = true;
+        }
+
+        if (!drained) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    }
+
+    // The trailing comma before "]" is accepted by both chrome://tracing
+    // and Perfetto, so no fixup pass is needed
+    fflush(traceFile);
+}
+
+std::vector<Profiler::PhaseStats> Profiler::snapshot() {
+    std::vector<PhaseStats> stats;
+
+    std::lock_guard<std::mutex> lock(registryMutex());
+    for (ThreadRing* ring : registry()) {
+        for (const Entry& entry : ring->entries) {
+            if (!entry.name) {
+                continue; // Slot never written
+            }
+
+            // Phase names are literals, so pointer identity is the key
+            auto it = std::find_if(stats.begin(), stats.end(),
+                                   [&](const PhaseStats& s) {
+                                       return s.name == entry.name;
+                                   });
+            float ms = entry.durationNs / 1.0e6f;
+            if (it == stats.end()) {
+                stats.push_back({entry.name, ms, ms, 1});
+            } else {
+                it->averageMs += ms; // Sum for now; divided below
+                it->maxMs = std::max(it->maxMs, ms);
+                it->samples++;
+            }
+        }
+    }
+
+    for (auto& s : stats) {
+        s.averageMs /= s.samples;
+    }
+
+    std::sort(stats.begin(), stats.end(),
+              [](const PhaseStats& a, const PhaseStats& b) {
+                  return a.averageMs > b.averageMs;
+              });
+
+    return stats;
+}
@@ -0,0 +1,182 @@
+// FILE: src/utils/SharedMemoryChannel.cpp
+#include "utils/SharedMemoryChannel.h"
+#include <cstring>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    constexpr size_t segmentSize() {
+        return sizeof(uint64_t) * 2 + sizeof(uint32_t) * 2 +
+               sizeof(VehicleMessage) * SharedMemoryChannel::CAPACITY + 64;
+    }
+}
+
+SharedMemoryChannel::SharedMemoryChannel()
+    : header(nullptr),
+      slots(nullptr),
+      owner(false),
+      available(false)
+#ifndef _WIN32
+    , shmFd(-1)
+#endif
+{
+}
+
+SharedMemoryChannel::~SharedMemoryChannel() {
+    close();
+}
+
+bool SharedMemoryChannel::create(const std::string& name) {
+#ifndef _WIN32
+    shmName = name;
+
+    // Remove any stale segment from a previous run
+    shm_unlink(name.c_str());
+
+    shmFd = shm_open(name.c_str(), O_CREAT | O_RDWR | O_EXCL, 0666);
+    if (shmFd < 0) {
+        return false;
+    }
+
+    if (ftruncate(shmFd, static_cast<off_t>(segmentSize())) != 0) {
+        ::close(shmFd);
+        shm_unlink(name.c_str());
+        shmFd = -1;
+        return false;
+    }
+
+    void* mapping = mmap(nullptr, segmentSize(), PROT_READ | PROT_WRITE,
+                         MAP_SHARED, shmFd, 0);
+    if (mapping == MAP_FAILED) {
+        ::close(shmFd);
+        shm_unlink(name.c_str());
+        shmFd = -1;
+        return false;
+    }
+
+    header = static_cast<SharedHeader*>(mapping);
+    slots = reinterpret_cast<VehicleMessage*>(
+        reinterpret_cast<char*>(mapping) + sizeof(SharedHeader));
+
+    // Initialize the control block
+    header->head.store(0, std::memory_order_relaxed);
+    header->tail.store(0, std::memory_order_relaxed);
+    header->capacity = CAPACITY;
+    header->magic = MAGIC;
+
+    owner = true;
+    available = true;
+    return true;
+#else
+    (void)name;
+    return false; // Fall back to lane files on Windows
+#endif
+}
+
+bool SharedMemoryChannel::open(const std::string& name) {
+#ifndef _WIN32
+    shmName = name;
+
+    shmFd = shm_open(name.c_str(), O_RDWR, 0666);
+    if (shmFd < 0) {
+        return false;
+    }
+
+    void* mapping = mmap(nullptr, segmentSize(), PROT_READ | PROT_WRITE,
+                         MAP_SHARED, shmFd, 0);
+    if (mapping == MAP_FAILED) {
+        ::close(shmFd);
+        shmFd = -1;
+        return false;
+    }
+
+    header = static_cast<SharedHeader*>(mapping);
+    slots = reinterpret_cast<VehicleMessage*>(
+        reinterpret_cast<char*>(mapping) + sizeof(SharedHeader));
+
+    // Reject segments written by an incompatible build
+    if (header->magic != MAGIC || header->capacity != CAPACITY) {
+        munmap(mapping, segmentSize());
+        ::close(shmFd);
+        header = nullptr;
+        slots = nullptr;
+        shmFd = -1;
+        return false;
+    }
+
+    owner = false;
+    available = true;
+    return true;
+#else
+    (void)name;
+    return false; // Fall back to lane files on Windows
+#endif
+}
+
+bool SharedMemoryChannel::push(const VehicleMessage& message) {
+    if (!available) {
+        return false;
+    }
+
+    uint64_t tail = header->tail.load(std::memory_order_relaxed);
+    uint64_t head = header->head.load(std::memory_order_acquire);
+
+    if (tail - head >= CAPACITY) {
+        return false; // Ring is full; caller falls back to the lane file
+    }
+
+    slots[tail % CAPACITY] = message;
+
+    // Publish the slot only after the memcpy completed
+    header->tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+bool SharedMemoryChannel::pop(VehicleMessage& message) {
+    if (!available) {
+        return false;
+    }
+
+    uint64_t head = header->head.load(std::memory_order_relaxed);
+    uint64_t tail = header->tail.load(std::memory_order_acquire);
+
+    if (head == tail) {
+        return false; // Ring is empty
+    }
+
+    message = slots[head % CAPACITY];
+
+    header->head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+bool SharedMemoryChannel::isAvailable() const {
+    return available;
+}
+
+void SharedMemoryChannel::close() {
+#ifndef _WIN32
+    if (header) {
+        munmap(header, segmentSize());
+        header = nullptr;
+        slots = nullptr;
+    }
+
+    if (shmFd >= 0) {
+        ::close(shmFd);
+        shmFd = -1;
+    }
+
+    if (owner && !shmName.empty()) {
+        shm_unlink(shmName.c_str());
+        owner = false;
+    }
+#endif
+
+    available = false;
+}
@@ -0,0 +1,201 @@
+// FILE: src/utils/StatsTape.cpp
+#include "utils/StatsTape.h"
+#include "utils/DebugLogger.h"
+#include "utils/ThreadScheduling.h"
+
+#include <cstring>
+
+StatsTape::StatsTape()
+    : file(nullptr),
+      frontCount(0),
+      backCount(0),
+      backPending(false),
+      running(false),
+      dropped(0) {}
+
+StatsTape::~StatsTape() {
+    close();
+}
+
+bool StatsTape::open(const std::string& path) {
+    close();
+
+    file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        DebugLogger::log("StatsTape: failed to open " + path,
+                       DebugLogger::LogLevel::ERROR);
+        return false;
+    }
+
+    StatsTapeHeader header;
+    std::memset(&header, 0, sizeof(header));
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.laneSlots = LANE_SLOTS;
+    header.blockTicks = BLOCK_TICKS;
+    for (int slot = 0; slot < LANE_SLOTS; slot++) {
+        header.laneIds[slot] = static_cast<char>('A' + slot / 3);
+        header.laneNumbers[slot] = static_cast<int8_t>(slot % 3 + 1);
+    }
+
+    if (std::fwrite(&header, sizeof(header), 1, file) != 1) {
+        std::fclose(file);
+        file = nullptr;
+        return false;
+    }
+
+    frontBuffer.resize(BLOCK_TICKS);
+    backBuffer.resize(BLOCK_TICKS);
+    frontCount = 0;
+    backCount = 0;
+    backPending = false;
+    dropped = 0;
+
+    running = true;
+    writerThread = std::thread(&StatsTape::writerLoop, this);
+
+    DebugLogger::log("StatsTape recording to " + path);
+    return true;
+}
+
+void StatsTape::append(const TickSample& sample) {
+    if (!file) {
+        return;
+    }
+
+    // Only this thread touches the front buffer, so the copy itself is
+    // lock-free; the lock is taken on block boundaries only
+    frontBuffer[frontCount++] = sample;
+    if (frontCount < BLOCK_TICKS) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(swapMutex);
+        if (backPending) {
+            // Writer still busy (disk stall): drop the block rather
+            // than stalling the tick; surfaced at close()
+            dropped++;
+        } else {
+            frontBuffer.swap(backBuffer);
+            backCount = frontCount;
+            backPending = true;
+        }
+    }
+    frontCount = 0;
+    wake.notify_one();
+}
+
+void StatsTape::writerLoop() {
+    // Tape writing is deferrable by definition; run it at background
+    // priority so it stays off the cores the hot threads are using
+    ThreadScheduling::setCurrentThreadBackground();
+
+    std::unique_lock<std::mutex> lock(swapMutex);
+    while (running || backPending) {
+        if (!backPending) {
+            wake.wait(lock, [this] { return backPending || !running; });
+            continue;
+        }
+
+        // The producer never touches the back buffer while backPending
+        // is set, so the write runs unlocked
+        uint32_t tickCount = backCount;
+        lock.unlock();
+        writeBlock(backBuffer.data(), tickCount);
+        lock.lock();
+        backPending = false;
+    }
+}
+
+void StatsTape::writeBlock(const TickSample* samples, uint32_t tickCount) {
+    // Transpose the row-wise block into one contiguous column image:
+    // timeMs, lightState, then depth/arrivals/departures as one strip
+    // per lane slot - a metric over time is then a single sequential
+    // read for the analysis side
+    size_t bytes = sizeof(StatsTapeBlockHeader) +
+                   tickCount * (sizeof(uint32_t) + sizeof(uint8_t) +
+                                LANE_SLOTS * (sizeof(uint16_t) +
+                                              2 * sizeof(uint8_t)));
+    columnScratch.resize(bytes);
+    uint8_t* out = columnScratch.data();
+
+    StatsTapeBlockHeader blockHeader;
+    blockHeader.tickCount = tickCount;
+    std::memcpy(out, &blockHeader, sizeof(blockHeader));
+    out += sizeof(blockHeader);
+
+    for (uint32_t i = 0; i < tickCount; i++) {
+        std::memcpy(out + i * sizeof(uint32_t), &samples[i].timeMs,
+                    sizeof(uint32_t));
+    }
+    out += tickCount * sizeof(uint32_t);
+
+    for (uint32_t i = 0; i < tickCount; i++) {
+        out[i] = samples[i].lightState;
+    }
+    out += tickCount;
+
+    for (int slot = 0; slot < LANE_SLOTS; slot++) {
+        for (uint32_t i = 0; i < tickCount; i++) {
+            std::memcpy(out + i * sizeof(uint16_t), &samples[i].depth[slot],
+                        sizeof(uint16_t));
+        }
+        out += tickCount * sizeof(uint16_t);
+    }
+
+    for (int slot = 0; slot < LANE_SLOTS; slot++) {
+        for (uint32_t i = 0; i < tickCount; i++) {
+            out[i] = samples[i].arrivals[slot];
+        }
+        out += tickCount;
+    }
+
+    for (int slot = 0; slot < LANE_SLOTS; slot++) {
+        for (uint32_t i = 0; i < tickCount; i++) {
+            out[i] = samples[i].departures[slot];
+        }
+        out += tickCount;
+    }
+
+    std::fwrite(columnScratch.data(), 1, columnScratch.size(), file);
+}
+
+void StatsTape::close() {
+    if (!file) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(swapMutex);
+        running = false;
+    }
+    wake.notify_one();
+    if (writerThread.joinable()) {
+        writerThread.join();
+    }
+
+    // The writer drained the pending block before exiting; only the
+    // partial tail remains
+    if (frontCount > 0) {
+        writeBlock(frontBuffer.data(), frontCount);
+        frontCount = 0;
+    }
+
+    std::fclose(file);
+    file = nullptr;
+
+    if (dropped > 0) {
+        DebugLogger::log("StatsTape dropped " + std::to_string(dropped) +
+                         " blocks under load",
+                       DebugLogger::LogLevel::WARNING);
+    }
+}
+
+bool StatsTape::isOpen() const {
+    return file != nullptr;
+}
+
+uint64_t StatsTape::droppedBlocks() const {
+    return dropped;
+}
@@ -0,0 +1,256 @@
+// FILE: src/utils/StreamCodec.cpp
+#include "utils/StreamCodec.h"
+#include <cstring>
+
+namespace {
+    // 4-byte-sequence hash table: positions of recent occurrences,
+    // stored +1 so 0 means empty. 13 bits keeps the table at 32 KB -
+    // it lives on the compressing thread's stack-adjacent heap and is
+    // rebuilt per block, so blocks stay independent.
+    constexpr size_t HASH_BITS = 13;
+    constexpr size_t HASH_SIZE = size_t(1) << HASH_BITS;
+    constexpr size_t MAX_OFFSET = 65535; // 2-byte backwards offset
+    constexpr size_t MIN_MATCH = 4;
+
+    // The last sequence must be literals and matches may not start in
+    // the final 12 bytes; both keep the decoder's copy loops simple
+    constexpr size_t TAIL_LITERALS = 12;
+
+    inline uint32_t load32(const char* p) {
+        uint32_t v;
+        std::memcpy(&v, p, sizeof(v));
+        return v;
+    }
+
+    inline uint32_t hash4(uint32_t sequence) {
+        return (sequence * 2654435761u) >> (32 - HASH_BITS);
+    }
+
+    // Emit a length in the token-nibble + 255-continuation scheme
+    inline bool putLength(size_t length, char*& op, const char* opEnd) {
+        while (length >= 255) {
+            if (op >= opEnd) return false;
+            *op++ = static_cast<char>(0xFF);
+            length -= 255;
+        }
+        if (op >= opEnd) return false;
+        *op++ = static_cast<char>(length);
+        return true;
+    }
+
+    inline bool getLength(size_t& length, const char*& ip, const char* ipEnd) {
+        size_t total = 0;
+        uint8_t byte;
+        do {
+            if (ip >= ipEnd) return false;
+            byte = static_cast<uint8_t>(*ip++);
+            total += byte;
+        } while (byte == 255);
+        length += total;
+        return true;
+    }
+
+    inline void put32(uint32_t v, std::vector<char>& out) {
+        char bytes[4];
+        std::memcpy(bytes, &v, sizeof(v));
+        out.insert(out.end(), bytes, bytes + 4);
+    }
+}
+
+namespace StreamCodec {
+
+size_t maxCompressedSize(size_t rawBytes) {
+    // Literal-only worst case: one token + length extension per 255
+    // literals, plus slack for the closing sequence
+    return rawBytes + rawBytes / 255 + 16;
+}
+
+size_t compressBlock(const char* src, size_t srcLen,
+                     char* dst, size_t dstCap) {
+    if (srcLen < MIN_MATCH + TAIL_LITERALS) {
+        return 0; // Too short to ever win; store it
+    }
+
+    std::vector<uint32_t> table(HASH_SIZE, 0);
+
+    const char* ip = src;
+    const char* anchor = src;
+    const char* const srcEnd = src + srcLen;
+    const char* const matchLimit = srcEnd - TAIL_LITERALS;
+    char* op = dst;
+    char* const opEnd = dst + dstCap;
+
+    while (ip < matchLimit) {
+        uint32_t sequence = load32(ip);
+        uint32_t h = hash4(sequence);
+        uint32_t candidate = table[h];
+        table[h] = static_cast<uint32_t>(ip - src) + 1;
+
+        const char* match = candidate ? src + candidate - 1 : nullptr;
+        if (!match || static_cast<size_t>(ip - match) > MAX_OFFSET ||
+            load32(match) != sequence) {
+            ip++;
+            continue;
+        }
+
+        // Extend the match forward as far as it runs
+        size_t matchLen = MIN_MATCH;
+        while (ip + matchLen < matchLimit &&
+               match[matchLen] == ip[matchLen]) {
+            matchLen++;
+        }
+
+        // Token + literals + offset + extensions
+        size_t literalLen = static_cast<size_t>(ip - anchor);
+        if (op >= opEnd) return 0;
+        char* token = op++;
+        uint8_t litNibble;
+        if (literalLen >= 15) {
+            litNibble = 15;
+            if (!putLength(literalLen - 15, op, opEnd)) return 0;
+        } else {
+            litNibble = static_cast<uint8_t>(literalLen);
+        }
+        if (op + literalLen + 2 > opEnd) return 0;
+        std::memcpy(op, anchor, literalLen);
+        op += literalLen;
+
+        size_t offset = static_cast<size_t>(ip - match);
+        *op++ = static_cast<char>(offset & 0xFF);
+        *op++ = static_cast<char>((offset >> 8) & 0xFF);
+
+        size_t matchCode = matchLen - MIN_MATCH;
+        uint8_t matchNibble;
+        if (matchCode >= 15) {
+            matchNibble = 15;
+            if (!putLength(matchCode - 15, op, opEnd)) return 0;
+        } else {
+            matchNibble = static_cast<uint8_t>(matchCode);
+        }
+        *token = static_cast<char>((litNibble << 4) | matchNibble);
+
+        ip += matchLen;
+        anchor = ip;
+    }
+
+    // Closing literal-only sequence covers everything left
+    size_t literalLen = static_cast<size_t>(srcEnd - anchor);
+    if (op >= opEnd) return 0;
+    char* token = op++;
+    if (literalLen >= 15) {
+        *token = static_cast<char>(15 << 4);
+        if (!putLength(literalLen - 15, op, opEnd)) return 0;
+    } else {
+        *token = static_cast<char>(literalLen << 4);
+    }
+    if (op + literalLen > opEnd) return 0;
+    std::memcpy(op, anchor, literalLen);
+    op += literalLen;
+
+    size_t compressed = static_cast<size_t>(op - dst);
+    return compressed < srcLen ? compressed : 0;
+}
+
+bool decompressBlock(const char* src, size_t srcLen,
+                     char* dst, size_t rawLen) {
+    const char* ip = src;
+    const char* const ipEnd = src + srcLen;
+    char* op = dst;
+    char* const opEnd = dst + rawLen;
+
+    while (ip < ipEnd) {
+        uint8_t token = static_cast<uint8_t>(*ip++);
+
+        // Literals
+        size_t literalLen = token >> 4;
+        if (literalLen == 15 && !getLength(literalLen, ip, ipEnd)) {
+            return false;
+        }
+        if (ip + literalLen > ipEnd || op + literalLen > opEnd) {
+            return false;
+        }
+        std::memcpy(op, ip, literalLen);
+        ip += literalLen;
+        op += literalLen;
+
+        if (ip >= ipEnd) {
+            break; // Closing sequence has no match part
+        }
+
+        // Match: 2-byte backwards offset, then the length
+        if (ip + 2 > ipEnd) return false;
+        size_t offset = static_cast<uint8_t>(ip[0]) |
+                        (static_cast<size_t>(static_cast<uint8_t>(ip[1])) << 8);
+        ip += 2;
+        if (offset == 0 || offset > static_cast<size_t>(op - dst)) {
+            return false;
+        }
+
+        size_t matchLen = (token & 0x0F) + MIN_MATCH;
+        if ((token & 0x0F) == 15) {
+            size_t extension = 0;
+            if (!getLength(extension, ip, ipEnd)) return false;
+            matchLen += extension;
+        }
+        if (op + matchLen > opEnd) return false;
+
+        // Byte-wise copy: overlapping matches (offset < matchLen) are
+        // how the format encodes runs, so memcpy/memmove won't do
+        const char* from = op - offset;
+        while (matchLen-- > 0) {
+            *op++ = *from++;
+        }
+    }
+
+    return op == opEnd;
+}
+
+void appendFrame(const char* src, size_t srcLen, std::vector<char>& out) {
+    size_t headerAt = out.size();
+    put32(static_cast<uint32_t>(srcLen), out);
+    put32(static_cast<uint32_t>(srcLen), out); // Patched below if it shrank
+
+    size_t payloadAt = out.size();
+    out.resize(payloadAt + maxCompressedSize(srcLen));
+    size_t compressed = compressBlock(src, srcLen, out.data() + payloadAt,
+                                      out.size() - payloadAt);
+    if (compressed > 0) {
+        out.resize(payloadAt + compressed);
+        uint32_t compBytes = static_cast<uint32_t>(compressed);
+        std::memcpy(out.data() + headerAt + sizeof(uint32_t), &compBytes,
+                    sizeof(compBytes));
+    } else {
+        // Stored frame: compBytes == rawBytes, payload verbatim
+        out.resize(payloadAt + srcLen);
+        std::memcpy(out.data() + payloadAt, src, srcLen);
+    }
+}
+
+bool readFrame(const char* src, size_t srcLen, std::vector<char>& out,
+               size_t& frameBytes) {
+    if (srcLen < FRAME_HEADER_BYTES) {
+        return false;
+    }
+
+    uint32_t rawBytes;
+    uint32_t compBytes;
+    std::memcpy(&rawBytes, src, sizeof(rawBytes));
+    std::memcpy(&compBytes, src + sizeof(rawBytes), sizeof(compBytes));
+    if (compBytes > rawBytes ||
+        FRAME_HEADER_BYTES + compBytes > srcLen) {
+        return false;
+    }
+
+    const char* payload = src + FRAME_HEADER_BYTES;
+    out.resize(rawBytes);
+    if (compBytes == rawBytes) {
+        std::memcpy(out.data(), payload, rawBytes);
+    } else if (!decompressBlock(payload, compBytes, out.data(), rawBytes)) {
+        return false;
+    }
+
+    frameBytes = FRAME_HEADER_BYTES + compBytes;
+    return true;
+}
+
+} // namespace StreamCodec
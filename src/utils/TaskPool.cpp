@@ -0,0 +1,128 @@
+// FILE: src/utils/TaskPool.cpp
+#include "utils/TaskPool.h"
+
+TaskPool::TaskPool(unsigned threadCount)
+    : currentTask(nullptr),
+      taskCount(0),
+      nextIndex(0),
+      remaining(0),
+      generation(0),
+      activeDrainers(0),
+      shuttingDown(false) {
+    if (threadCount == 0) {
+        unsigned hw = std::thread::hardware_concurrency();
+        threadCount = hw > 1 ? hw - 1 : 0;
+    }
+
+    workers.reserve(threadCount);
+    for (unsigned i = 0; i < threadCount; i++) {
+        workers.emplace_back(&TaskPool::workerLoop, this);
+    }
+}
+
+TaskPool::~TaskPool() {
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        shuttingDown = true;
+    }
+    workAvailable.notify_all();
+    for (auto& worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+unsigned TaskPool::workerCount() const {
+    return static_cast<unsigned>(workers.size());
+}
+
+void TaskPool::drainCurrentDispatch(const std::function<void(size_t)>& task,
+                                    size_t count) {
+    for (;;) {
+        size_t index = nextIndex.fetch_add(1, std::memory_order_relaxed);
+        if (index >= count) {
+            return;
+        }
+
+        task(index);
+
+        if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            // Last index done; release the caller
+            std::lock_guard<std::mutex> lock(poolMutex);
+            workDone.notify_all();
+        }
+    }
+}
+
+void TaskPool::workerLoop() {
+    uint64_t seenGeneration = 0;
+
+    for (;;) {
+        const std::function<void(size_t)>* task;
+        size_t count;
+        {
+            std::unique_lock<std::mutex> lock(poolMutex);
+            workAvailable.wait(lock, [&] {
+                return shuttingDown || generation != seenGeneration;
+            });
+            if (shuttingDown) {
+                return;
+            }
+            seenGeneration = generation;
+
+            // Snapshot the dispatch under the lock so the claim loop
+            // never reads state the next parallelFor() is resetting
+            task = currentTask;
+            count = taskCount;
+            activeDrainers++;
+        }
+
+        drainCurrentDispatch(*task, count);
+
+        {
+            std::lock_guard<std::mutex> lock(poolMutex);
+            activeDrainers--;
+        }
+        workDone.notify_all();
+    }
+}
+
+void TaskPool::parallelFor(size_t count,
+                           const std::function<void(size_t)>& task) {
+    if (count == 0) {
+        return;
+    }
+
+    // No workers (single core): just run inline
+    if (workers.empty()) {
+        for (size_t i = 0; i < count; i++) {
+            task(i);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        currentTask = &task;
+        taskCount = count;
+        nextIndex.store(0, std::memory_order_relaxed);
+        remaining.store(count, std::memory_order_relaxed);
+        generation++;
+    }
+    workAvailable.notify_all();
+
+    // The calling thread works too instead of idling
+    drainCurrentDispatch(task, count);
+
+    // Wait for every index AND for the workers to leave the claim
+    // loop - a straggler between claims must not still be inside
+    // drainCurrentDispatch() when the next dispatch resets the
+    // counters, or it could claim an index of a dispatch it never saw
+    std::unique_lock<std::mutex> lock(poolMutex);
+    workDone.wait(lock, [&] {
+        return remaining.load(std::memory_order_acquire) == 0 &&
+               activeDrainers == 0;
+    });
+    currentTask = nullptr;
+}
@@ -0,0 +1,60 @@
+// FILE: src/utils/ThreadScheduling.cpp
+#include "utils/ThreadScheduling.h"
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#elif defined(_WIN32)
+#include <windows.h>
+#endif
+
+namespace ThreadScheduling {
+
+bool pinCurrentThreadToCore(int core) {
+    if (core < 0) {
+        return false;
+    }
+#ifdef __linux__
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(core, &cpuSet);
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) == 0;
+#elif defined(_WIN32)
+    return SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << core) != 0;
+#else
+    // macOS has no thread-to-core pinning API; affinity tags are only
+    // hints and not worth pretending with
+    return false;
+#endif
+}
+
+bool setCurrentThreadRealtime() {
+#ifdef __linux__
+    sched_param param{};
+    param.sched_priority = sched_get_priority_min(SCHED_RR);
+    return pthread_setschedparam(pthread_self(), SCHED_RR, &param) == 0;
+#elif defined(_WIN32)
+    return SetThreadPriority(GetCurrentThread(),
+                             THREAD_PRIORITY_TIME_CRITICAL) != 0;
+#else
+    return false;
+#endif
+}
+
+bool setCurrentThreadBackground() {
+#ifdef __linux__
+    // SCHED_IDLE only runs when nothing else wants the CPU; under
+    // energy-aware scheduling that lands these threads on the
+    // efficiency cores without naming them
+    sched_param param{};
+    param.sched_priority = 0;
+    return pthread_setschedparam(pthread_self(), SCHED_IDLE, &param) == 0;
+#elif defined(_WIN32)
+    return SetThreadPriority(GetCurrentThread(),
+                             THREAD_MODE_BACKGROUND_BEGIN) != 0;
+#else
+    return false;
+#endif
+}
+
+}
@@ -0,0 +1,165 @@
+// FILE: src/utils/TuningConfig.cpp
+#include "utils/TuningConfig.h"
+#include "utils/DebugLogger.h"
+#include "utils/ThreadScheduling.h"
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+// Defaults are the historical compile-time constants
+std::atomic<float> TuningConfig::vehicleSpeedBase{0.018f};
+std::atomic<int> TuningConfig::greenMsPerVehicle{2000};
+std::atomic<int> TuningConfig::priorityThresholdHigh{10};
+std::atomic<int> TuningConfig::priorityThresholdLow{5};
+std::atomic<int> TuningConfig::spawnIntervalMs{2000};
+std::atomic<uint64_t> TuningConfig::version{0};
+
+std::string TuningConfig::configPath = "traffic_tuning.cfg";
+std::thread TuningConfig::watcherThread;
+std::atomic<bool> TuningConfig::watcherRunning{false};
+
+namespace {
+
+// Strip leading/trailing whitespace in place
+std::string trimmed(const std::string& s) {
+    size_t begin = s.find_first_not_of(" \t\r");
+    if (begin == std::string::npos) {
+        return "";
+    }
+    size_t end = s.find_last_not_of(" \t\r");
+    return s.substr(begin, end - begin + 1);
+}
+
+} // namespace
+
+void TuningConfig::initialize(const std::string& path) {
+    if (watcherRunning.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    configPath = path;
+    if (loadFile()) {
+        DebugLogger::log("Tuning config loaded from " + configPath);
+    }
+
+    watcherRunning.store(true, std::memory_order_release);
+    watcherThread = std::thread(watchLoop);
+
+    // Join the watcher even if the application never calls shutdown()
+    std::atexit([]() { TuningConfig::shutdown(); });
+}
+
+void TuningConfig::shutdown() {
+    if (!watcherRunning.exchange(false, std::memory_order_acq_rel)) {
+        return;
+    }
+    if (watcherThread.joinable()) {
+        watcherThread.join();
+    }
+}
+
+TuningConfig::Snapshot TuningConfig::snapshot() {
+    Snapshot snap;
+    snap.vehicleSpeedBase = vehicleSpeedBase.load(std::memory_order_relaxed);
+    snap.greenMsPerVehicle = greenMsPerVehicle.load(std::memory_order_relaxed);
+    snap.priorityThresholdHigh =
+        priorityThresholdHigh.load(std::memory_order_relaxed);
+    snap.priorityThresholdLow =
+        priorityThresholdLow.load(std::memory_order_relaxed);
+    snap.spawnIntervalMs = spawnIntervalMs.load(std::memory_order_relaxed);
+    snap.version = version.load(std::memory_order_relaxed);
+    return snap;
+}
+
+bool TuningConfig::loadFile() {
+    std::ifstream file(configPath);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        // Strip comments, then split on the first '='
+        size_t hash = line.find('#');
+        if (hash != std::string::npos) {
+            line.resize(hash);
+        }
+        size_t equals = line.find('=');
+        if (equals == std::string::npos) {
+            continue;
+        }
+
+        std::string key = trimmed(line.substr(0, equals));
+        std::string value = trimmed(line.substr(equals + 1));
+        if (key.empty() || value.empty()) {
+            continue;
+        }
+
+        try {
+            if (key == "vehicle_speed_base") {
+                vehicleSpeedBase.store(std::stof(value),
+                                       std::memory_order_relaxed);
+            } else if (key == "green_ms_per_vehicle") {
+                greenMsPerVehicle.store(std::stoi(value),
+                                        std::memory_order_relaxed);
+            } else if (key == "priority_threshold_high") {
+                priorityThresholdHigh.store(std::stoi(value),
+                                            std::memory_order_relaxed);
+            } else if (key == "priority_threshold_low") {
+                priorityThresholdLow.store(std::stoi(value),
+                                           std::memory_order_relaxed);
+            } else if (key == "spawn_interval_ms") {
+                spawnIntervalMs.store(std::stoi(value),
+                                      std::memory_order_relaxed);
+            } else {
+                DebugLogger::log("Tuning config: unknown key '" + key + "'",
+                                 DebugLogger::LogLevel::WARNING);
+            }
+        } catch (const std::exception&) {
+            DebugLogger::log("Tuning config: bad value for '" + key + "': " +
+                             value, DebugLogger::LogLevel::WARNING);
+        }
+    }
+
+    version.fetch_add(1, std::memory_order_release);
+    return true;
+}
+
+void TuningConfig::watchLoop() {
+    // A twice-a-second mtime poll never needs a performance core
+    ThreadScheduling::setCurrentThreadBackground();
+
+    std::error_code ec;
+    fs::file_time_type lastWrite = fs::last_write_time(configPath, ec);
+    bool existed = !ec;
+
+    while (watcherRunning.load(std::memory_order_relaxed)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+        fs::file_time_type current = fs::last_write_time(configPath, ec);
+        if (ec) {
+            existed = false;
+            continue;
+        }
+
+        if (!existed || current != lastWrite) {
+            existed = true;
+            lastWrite = current;
+            if (loadFile()) {
+                Snapshot snap = snapshot();
+                std::ostringstream oss;
+                oss << "Tuning config reloaded (v" << snap.version
+                    << "): speed=" << snap.vehicleSpeedBase
+                    << " green/veh=" << snap.greenMsPerVehicle << "ms"
+                    << " priority=" << snap.priorityThresholdHigh << "/"
+                    << snap.priorityThresholdLow
+                    << " spawn=" << snap.spawnIntervalMs << "ms";
+                DebugLogger::log(oss.str());
+            }
+        }
+    }
+}
@@ -0,0 +1,33 @@
+// FILE: src/utils/VehicleIdRegistry.cpp
+#include "utils/VehicleIdRegistry.h"
+
+#include <deque>
+#include <mutex>
+
+namespace {
+    // A deque keeps earlier labels stable while the table grows, so
+    // label() can hand out references without copying
+    std::deque<std::string> labels;
+    std::mutex registryMutex;
+
+    const std::string UNKNOWN_LABEL = "<unknown>";
+}
+
+uint32_t VehicleIdRegistry::intern(const std::string& label) {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    labels.push_back(label);
+    return static_cast<uint32_t>(labels.size() - 1);
+}
+
+const std::string& VehicleIdRegistry::label(uint32_t id) {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    if (id >= labels.size()) {
+        return UNKNOWN_LABEL;
+    }
+    return labels[id];
+}
+
+size_t VehicleIdRegistry::size() {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    return labels.size();
+}
@@ -0,0 +1,110 @@
+// FILE: src/utils/VehiclePool.cpp
+#include "utils/VehiclePool.h"
+#include "utils/DebugLogger.h"
+#include "utils/HugePageArena.h"
+#include "utils/VehicleIdRegistry.h"
+#include <new>
+#include <sstream>
+
+// Static class members initialization
+std::vector<VehiclePool::Slot*> VehiclePool::slabs;
+std::vector<VehiclePool::Slot*> VehiclePool::freeSlots;
+size_t VehiclePool::active = 0;
+std::mutex VehiclePool::poolMutex;
+
+Vehicle* VehiclePool::acquire(const std::string& id, char lane, int laneNumber,
+                              bool isEmergency) {
+    Slot* slot = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+
+        if (freeSlots.empty()) {
+            addSlab();
+        }
+
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+        active++;
+    }
+
+    // Construct in place; if the constructor throws, return the slot.
+    // The textual label is interned here so the Vehicle only carries the
+    // integer id.
+    try {
+        return new (slot->storage) Vehicle(VehicleIdRegistry::intern(id),
+                                           lane, laneNumber, isEmergency);
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        freeSlots.push_back(slot);
+        active--;
+        throw;
+    }
+}
+
+void VehiclePool::release(Vehicle* vehicle) {
+    if (!vehicle) {
+        return;
+    }
+
+    // Run the destructor, then recycle the raw storage
+    vehicle->~Vehicle();
+
+    std::lock_guard<std::mutex> lock(poolMutex);
+    freeSlots.push_back(reinterpret_cast<Slot*>(vehicle));
+    if (active > 0) {
+        active--;
+    }
+}
+
+void VehiclePool::releaseAll(const std::vector<Vehicle*>& vehicles) {
+    if (vehicles.empty()) {
+        return;
+    }
+
+    // Destructors run outside the lock; only the free-list pushes are
+    // serialized, once for the whole batch
+    for (Vehicle* vehicle : vehicles) {
+        if (vehicle) {
+            vehicle->~Vehicle();
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(poolMutex);
+    for (Vehicle* vehicle : vehicles) {
+        if (!vehicle) {
+            continue;
+        }
+        freeSlots.push_back(reinterpret_cast<Slot*>(vehicle));
+        if (active > 0) {
+            active--;
+        }
+    }
+}
+
+size_t VehiclePool::activeCount() {
+    std::lock_guard<std::mutex> lock(poolMutex);
+    return active;
+}
+
+size_t VehiclePool::capacity() {
+    std::lock_guard<std::mutex> lock(poolMutex);
+    return slabs.size() * SLAB_SIZE;
+}
+
+void VehiclePool::addSlab() {
+    // One allocation covers SLAB_SIZE vehicles. Slot is raw aligned
+    // storage, so the arena's bytes serve directly - no construction
+    // needed before placement new claims a slot.
+    Slot* slab = static_cast<Slot*>(HugePageArena::vehicles().allocate(
+        SLAB_SIZE * sizeof(Slot), alignof(Slot)));
+    slabs.push_back(slab);
+
+    for (size_t i = 0; i < SLAB_SIZE; i++) {
+        freeSlots.push_back(&slab[i]);
+    }
+
+    std::ostringstream oss;
+    oss << "VehiclePool grew to " << slabs.size() * SLAB_SIZE << " slots";
+    DebugLogger::log(oss.str());
+}
@@ -0,0 +1,78 @@
+// FILE: src/utils/WaitHistogram.cpp
+#include "utils/WaitHistogram.h"
+
+#include <cstring>
+
+WaitHistogram::WaitHistogram()
+    : total(0),
+      maxSeen(0) {
+    memset(buckets, 0, sizeof(buckets));
+}
+
+int WaitHistogram::bucketFor(uint64_t ms) {
+    if (ms < SUB) {
+        return static_cast<int>(ms); // Exact buckets below the first group
+    }
+
+    int msb = 63;
+    while (!(ms >> msb)) {
+        msb--;
+    }
+
+    // Group = position above the sub-bucket range; sub = the SUB_BITS
+    // bits right after the leading one
+    int group = msb - SUB_BITS + 1;
+    int sub = static_cast<int>((ms >> (msb - SUB_BITS)) & (SUB - 1));
+    int bucket = group * SUB + sub;
+
+    return bucket < BUCKET_COUNT ? bucket : BUCKET_COUNT - 1;
+}
+
+uint64_t WaitHistogram::bucketMidpoint(int bucket) {
+    if (bucket < SUB) {
+        return static_cast<uint64_t>(bucket);
+    }
+
+    int group = bucket / SUB;
+    int sub = bucket % SUB;
+    int shift = group - 1;
+    uint64_t lower = static_cast<uint64_t>(SUB + sub) << shift;
+    uint64_t width = static_cast<uint64_t>(1) << shift;
+    return lower + width / 2;
+}
+
+void WaitHistogram::record(uint64_t waitMs) {
+    buckets[bucketFor(waitMs)]++;
+    total++;
+    if (waitMs > maxSeen) {
+        maxSeen = waitMs;
+    }
+}
+
+uint64_t WaitHistogram::totalCount() const {
+    return total;
+}
+
+uint64_t WaitHistogram::maxMs() const {
+    return maxSeen;
+}
+
+uint64_t WaitHistogram::quantileMs(double fraction) const {
+    if (total == 0) {
+        return 0;
+    }
+
+    uint64_t target = static_cast<uint64_t>(fraction * total);
+    if (target >= total) {
+        target = total - 1;
+    }
+
+    uint64_t seen = 0;
+    for (int bucket = 0; bucket < BUCKET_COUNT; bucket++) {
+        seen += buckets[bucket];
+        if (seen > target) {
+            return bucketMidpoint(bucket);
+        }
+    }
+    return bucketMidpoint(BUCKET_COUNT - 1);
+}
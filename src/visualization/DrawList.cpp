@@ -0,0 +1,117 @@
+// FILE: src/visualization/DrawList.cpp
+#include "visualization/DrawList.h"
+
+DrawList::DrawList()
+    : currentColor{255, 255, 255, 255},
+      activeRuns(0) {
+    runs.reserve(4);
+}
+
+void DrawList::begin() {
+    shapes.begin();
+    for (size_t i = 0; i < activeRuns; i++) {
+        runs[i].vertices.clear();
+        runs[i].indices.clear();
+    }
+    activeRuns = 0;
+    currentColor = {255, 255, 255, 255};
+}
+
+void DrawList::setColor(Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
+    currentColor = {r, g, b, a};
+}
+
+void DrawList::fillRect(const SDL_FRect& rect) {
+    shapes.pushQuad(rect, currentColor);
+}
+
+void DrawList::rectOutline(const SDL_FRect& rect) {
+    shapes.pushRectOutline(rect, currentColor);
+}
+
+void DrawList::line(float x1, float y1, float x2, float y2) {
+    shapes.pushLine(x1, y1, x2, y2, currentColor);
+}
+
+void DrawList::triangle(float x1, float y1, float x2, float y2,
+                        float x3, float y3) {
+    shapes.pushTriangle(x1, y1, x2, y2, x3, y3, currentColor);
+}
+
+DrawList::TextureRun& DrawList::runFor(SDL_Texture* texture) {
+    for (size_t i = 0; i < activeRuns; i++) {
+        if (runs[i].texture == texture) {
+            return runs[i];
+        }
+    }
+    if (activeRuns == runs.size()) {
+        runs.emplace_back();
+    }
+    TextureRun& run = runs[activeRuns++];
+    run.texture = texture;
+    return run;
+}
+
+void DrawList::texturedQuad(SDL_Texture* texture, const SDL_FRect& src,
+                            const SDL_FRect& dst) {
+    float texW = 0.0f;
+    float texH = 0.0f;
+    SDL_GetTextureSize(texture, &texW, &texH);
+    if (texW <= 0.0f || texH <= 0.0f) {
+        return;
+    }
+
+    const float u0 = src.x / texW;
+    const float v0 = src.y / texH;
+    const float u1 = (src.x + src.w) / texW;
+    const float v1 = (src.y + src.h) / texH;
+
+    TextureRun& run = runFor(texture);
+    int base = static_cast<int>(run.vertices.size());
+
+    const SDL_FPoint positions[4] = {
+        {dst.x, dst.y},
+        {dst.x + dst.w, dst.y},
+        {dst.x + dst.w, dst.y + dst.h},
+        {dst.x, dst.y + dst.h}
+    };
+    const SDL_FPoint uv[4] = {
+        {u0, v0}, {u1, v0}, {u1, v1}, {u0, v1}
+    };
+
+    for (int i = 0; i < 4; i++) {
+        SDL_Vertex v;
+        v.position = positions[i];
+        v.color = {1.0f, 1.0f, 1.0f, 1.0f};
+        v.tex_coord = uv[i];
+        run.vertices.push_back(v);
+    }
+
+    run.indices.push_back(base);
+    run.indices.push_back(base + 1);
+    run.indices.push_back(base + 2);
+    run.indices.push_back(base);
+    run.indices.push_back(base + 2);
+    run.indices.push_back(base + 3);
+}
+
+void DrawList::flush(SDL_Renderer* renderer) {
+    // Per-vertex alpha only blends if the renderer's blend mode allows
+    // it; restore NONE afterwards to match the direct-draw call sites
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+
+    shapes.flush(renderer);
+
+    for (size_t i = 0; i < activeRuns; i++) {
+        TextureRun& run = runs[i];
+        if (!run.indices.empty()) {
+            SDL_RenderGeometry(renderer, run.texture,
+                               run.vertices.data(),
+                               static_cast<int>(run.vertices.size()),
+                               run.indices.data(),
+                               static_cast<int>(run.indices.size()));
+        }
+    }
+
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+}
@@ -0,0 +1,115 @@
+// FILE: src/visualization/GeometryBatch.cpp
+#include "visualization/GeometryBatch.h"
+
+#include <cmath>
+
+namespace {
+    SDL_FColor toFColor(SDL_Color color) {
+        return {color.r / 255.0f, color.g / 255.0f,
+                color.b / 255.0f, color.a / 255.0f};
+    }
+}
+
+GeometryBatch::GeometryBatch() {
+    vertices.reserve(1024);
+    indices.reserve(1536);
+}
+
+void GeometryBatch::begin() {
+    vertices.clear();
+    indices.clear();
+}
+
+void GeometryBatch::pushCorners(const SDL_FPoint corners[4], const SDL_FColor& color) {
+    int base = static_cast<int>(vertices.size());
+
+    for (int i = 0; i < 4; i++) {
+        SDL_Vertex v;
+        v.position = corners[i];
+        v.color = color;
+        v.tex_coord = {0.0f, 0.0f};
+        vertices.push_back(v);
+    }
+
+    // Two triangles: 0-1-2 and 0-2-3
+    indices.push_back(base);
+    indices.push_back(base + 1);
+    indices.push_back(base + 2);
+    indices.push_back(base);
+    indices.push_back(base + 2);
+    indices.push_back(base + 3);
+}
+
+void GeometryBatch::pushQuad(const SDL_FRect& rect, SDL_Color color) {
+    SDL_FPoint corners[4] = {
+        {rect.x, rect.y},
+        {rect.x + rect.w, rect.y},
+        {rect.x + rect.w, rect.y + rect.h},
+        {rect.x, rect.y + rect.h}
+    };
+    pushCorners(corners, toFColor(color));
+}
+
+void GeometryBatch::pushRectOutline(const SDL_FRect& rect, SDL_Color color) {
+    SDL_FRect top = {rect.x, rect.y, rect.w, 1.0f};
+    SDL_FRect bottom = {rect.x, rect.y + rect.h - 1.0f, rect.w, 1.0f};
+    SDL_FRect left = {rect.x, rect.y, 1.0f, rect.h};
+    SDL_FRect right = {rect.x + rect.w - 1.0f, rect.y, 1.0f, rect.h};
+
+    pushQuad(top, color);
+    pushQuad(bottom, color);
+    pushQuad(left, color);
+    pushQuad(right, color);
+}
+
+void GeometryBatch::pushTriangle(float x1, float y1, float x2, float y2,
+                                 float x3, float y3, SDL_Color color) {
+    SDL_FColor fcolor = toFColor(color);
+    int base = static_cast<int>(vertices.size());
+
+    SDL_Vertex v;
+    v.color = fcolor;
+    v.tex_coord = {0.0f, 0.0f};
+
+    v.position = {x1, y1};
+    vertices.push_back(v);
+    v.position = {x2, y2};
+    vertices.push_back(v);
+    v.position = {x3, y3};
+    vertices.push_back(v);
+
+    indices.push_back(base);
+    indices.push_back(base + 1);
+    indices.push_back(base + 2);
+}
+
+void GeometryBatch::pushLine(float x1, float y1, float x2, float y2, SDL_Color color) {
+    // Expand the segment into a 1px-thick quad along its perpendicular
+    float dx = x2 - x1;
+    float dy = y2 - y1;
+    float length = std::sqrt(dx * dx + dy * dy);
+    if (length < 0.0001f) {
+        return;
+    }
+
+    float nx = -dy / length * 0.5f;
+    float ny = dx / length * 0.5f;
+
+    SDL_FPoint corners[4] = {
+        {x1 + nx, y1 + ny},
+        {x2 + nx, y2 + ny},
+        {x2 - nx, y2 - ny},
+        {x1 - nx, y1 - ny}
+    };
+    pushCorners(corners, toFColor(color));
+}
+
+void GeometryBatch::flush(SDL_Renderer* renderer) {
+    if (indices.empty()) {
+        return;
+    }
+
+    SDL_RenderGeometry(renderer, nullptr,
+                       vertices.data(), static_cast<int>(vertices.size()),
+                       indices.data(), static_cast<int>(indices.size()));
+}
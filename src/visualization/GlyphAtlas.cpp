@@ -0,0 +1,546 @@
+// FILE: src/visualization/GlyphAtlas.cpp
+#include "visualization/GlyphAtlas.h"
+#include "visualization/TextureCache.h"
+#include "utils/DebugLogger.h"
+
+#include <cstring>
+
+GlyphAtlas& GlyphAtlas::get() {
+    static GlyphAtlas instance;
+    return instance;
+}
+
+GlyphAtlas::GlyphAtlas()
+    : atlas(nullptr),
+      atlasFailed(false),
+      textureCache(nullptr) {
+}
+
+void GlyphAtlas::setTextureCache(TextureCache* cache) {
+    textureCache = cache;
+}
+
+bool GlyphAtlas::ensureAtlas(SDL_Renderer* renderer) {
+    if (atlas) {
+        return true;
+    }
+    if (atlasFailed) {
+        return false;
+    }
+
+    const int numGlyphs = LAST_CHAR - FIRST_CHAR + 1;
+
+    // A cached rasterization from a previous launch skips the
+    // per-glyph line drawing entirely
+    if (textureCache) {
+        atlas = textureCache->load(renderer, "glyph_atlas",
+                                   numGlyphs * GLYPH_ADVANCE, GLYPH_HEIGHT);
+        if (atlas) {
+            SDL_SetTextureBlendMode(atlas, SDL_BLENDMODE_BLEND);
+            DebugLogger::log("GlyphAtlas: restored atlas from cache");
+            return true;
+        }
+    }
+
+    atlas = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
+                              SDL_TEXTUREACCESS_TARGET,
+                              numGlyphs * GLYPH_ADVANCE, GLYPH_HEIGHT);
+    if (!atlas) {
+        atlasFailed = true;
+        DebugLogger::log("GlyphAtlas: target texture unavailable, using line fallback",
+                       DebugLogger::LogLevel::WARNING);
+        return false;
+    }
+
+    // Rasterize every printable character once, white on transparent;
+    // per-call tinting happens through the texture color mod
+    SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+    SDL_SetRenderTarget(renderer, atlas);
+
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+
+    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
+    for (int c = FIRST_CHAR; c <= LAST_CHAR; c++) {
+        drawGlyphLines(renderer, static_cast<char>(c),
+                       (c - FIRST_CHAR) * GLYPH_ADVANCE, 1);
+    }
+
+    SDL_SetRenderTarget(renderer, previousTarget);
+
+    if (textureCache) {
+        textureCache->store(renderer, atlas, "glyph_atlas");
+    }
+
+    SDL_SetTextureBlendMode(atlas, SDL_BLENDMODE_BLEND);
+
+    DebugLogger::log("GlyphAtlas: built " + std::to_string(numGlyphs) + " glyph atlas");
+    return true;
+}
+
+void GlyphAtlas::drawText(SDL_Renderer* renderer, const char* text, size_t length,
+                          int x, int y, SDL_Color color) {
+    if (!ensureAtlas(renderer)) {
+        // Pre-atlas path: rasterize from line primitives every call
+        SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
+        for (size_t i = 0; i < length; i++) {
+            drawGlyphLines(renderer, text[i], x + static_cast<int>(i) * GLYPH_ADVANCE, y);
+        }
+        return;
+    }
+
+    // One source texture for the whole string - SDL batches these quads
+    SDL_SetTextureColorMod(atlas, color.r, color.g, color.b);
+    SDL_SetTextureAlphaMod(atlas, color.a);
+
+    for (size_t i = 0; i < length; i++) {
+        unsigned char c = static_cast<unsigned char>(text[i]);
+        if (c < FIRST_CHAR || c > LAST_CHAR) {
+            c = '?';
+        }
+
+        SDL_FRect src = {static_cast<float>((c - FIRST_CHAR) * GLYPH_ADVANCE), 0,
+                         static_cast<float>(GLYPH_ADVANCE),
+                         static_cast<float>(GLYPH_HEIGHT)};
+        SDL_FRect dst = {static_cast<float>(x + static_cast<int>(i) * GLYPH_ADVANCE),
+                         static_cast<float>(y),
+                         static_cast<float>(GLYPH_ADVANCE),
+                         static_cast<float>(GLYPH_HEIGHT)};
+        SDL_RenderTexture(renderer, atlas, &src, &dst);
+    }
+}
+
+void GlyphAtlas::drawCachedString(SDL_Renderer* renderer, const std::string& text,
+                                  int x, int y, SDL_Color color) {
+    if (text.empty()) {
+        return;
+    }
+
+    SDL_Texture* cached = nullptr;
+    auto it = stringCache.find(text);
+    if (it != stringCache.end()) {
+        cached = it->second;
+    } else if (ensureAtlas(renderer)) {
+        // Bake the whole string once; afterwards it's a single quad
+        if (stringCache.size() >= MAX_CACHED_STRINGS) {
+            DebugLogger::log("GlyphAtlas: string cache full, clearing",
+                           DebugLogger::LogLevel::WARNING);
+            for (auto& entry : stringCache) {
+                SDL_DestroyTexture(entry.second);
+            }
+            stringCache.clear();
+        }
+
+        cached = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
+                                   SDL_TEXTUREACCESS_TARGET,
+                                   static_cast<int>(text.length()) * GLYPH_ADVANCE,
+                                   GLYPH_HEIGHT);
+        if (cached) {
+            SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+            SDL_SetRenderTarget(renderer, cached);
+
+            SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+            SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+            SDL_RenderClear(renderer);
+
+            SDL_SetTextureColorMod(atlas, 255, 255, 255);
+            SDL_SetTextureAlphaMod(atlas, 255);
+            drawText(renderer, text.c_str(), text.length(), 0, 0,
+                     {255, 255, 255, 255});
+
+            SDL_SetRenderTarget(renderer, previousTarget);
+            SDL_SetTextureBlendMode(cached, SDL_BLENDMODE_BLEND);
+            stringCache[text] = cached;
+        }
+    }
+
+    if (!cached) {
+        // No cache available - draw through the atlas (or line fallback)
+        drawText(renderer, text.c_str(), text.length(), x, y, color);
+        return;
+    }
+
+    SDL_SetTextureColorMod(cached, color.r, color.g, color.b);
+    SDL_SetTextureAlphaMod(cached, color.a);
+
+    SDL_FRect dst = {static_cast<float>(x), static_cast<float>(y),
+                     static_cast<float>(text.length() * GLYPH_ADVANCE),
+                     static_cast<float>(GLYPH_HEIGHT)};
+    SDL_RenderTexture(renderer, cached, nullptr, &dst);
+}
+
+void GlyphAtlas::shutdown() {
+    for (auto& entry : stringCache) {
+        SDL_DestroyTexture(entry.second);
+    }
+    stringCache.clear();
+
+    if (atlas) {
+        SDL_DestroyTexture(atlas);
+        atlas = nullptr;
+    }
+    atlasFailed = false;
+}
+
+void GlyphAtlas::drawGlyphLines(SDL_Renderer* renderer, char c, int x, int y) {
+    // Simplified monospaced character drawing
+    switch (c) {
+        case 'A':
+            SDL_RenderLine(renderer, x+3, y, x, y+9);      // Left diagonal
+            SDL_RenderLine(renderer, x+3, y, x+6, y+9);    // Right diagonal
+            SDL_RenderLine(renderer, x+1, y+6, x+5, y+6);  // Middle
+            break;
+        case 'B':
+            SDL_RenderLine(renderer, x, y, x, y+9);        // Left vertical
+            SDL_RenderLine(renderer, x, y, x+4, y);        // Top
+            SDL_RenderLine(renderer, x+4, y, x+5, y+2);    // Top curve
+            SDL_RenderLine(renderer, x+5, y+2, x+4, y+4);  // Middle top
+            SDL_RenderLine(renderer, x, y+4, x+4, y+4);    // Middle
+            SDL_RenderLine(renderer, x+4, y+4, x+5, y+7);  // Middle bottom
+            SDL_RenderLine(renderer, x+5, y+7, x+4, y+9);  // Bottom curve
+            SDL_RenderLine(renderer, x+4, y+9, x, y+9);    // Bottom
+            break;
+        case 'C':
+            SDL_RenderLine(renderer, x+5, y+2, x+2, y);    // Top right
+            SDL_RenderLine(renderer, x+2, y, x, y+2);      // Top left
+            SDL_RenderLine(renderer, x, y+2, x, y+7);      // Left
+            SDL_RenderLine(renderer, x, y+7, x+2, y+9);    // Bottom left
+            SDL_RenderLine(renderer, x+2, y+9, x+5, y+7);  // Bottom right
+            break;
+        case 'D':
+            SDL_RenderLine(renderer, x, y, x, y+9);        // Left vertical
+            SDL_RenderLine(renderer, x, y, x+3, y);        // Top
+            SDL_RenderLine(renderer, x+3, y, x+5, y+2);    // Top right
+            SDL_RenderLine(renderer, x+5, y+2, x+5, y+7);  // Right
+            SDL_RenderLine(renderer, x+5, y+7, x+3, y+9);  // Bottom right
+            SDL_RenderLine(renderer, x+3, y+9, x, y+9);    // Bottom
+            break;
+        case 'E':
+            SDL_RenderLine(renderer, x, y, x, y+9);        // Vertical
+            SDL_RenderLine(renderer, x, y, x+5, y);        // Top
+            SDL_RenderLine(renderer, x, y+4, x+4, y+4);    // Middle
+            SDL_RenderLine(renderer, x, y+9, x+5, y+9);    // Bottom
+            break;
+        case 'F':
+            SDL_RenderLine(renderer, x, y, x, y+9);        // Vertical
+            SDL_RenderLine(renderer, x, y, x+5, y);        // Top
+            SDL_RenderLine(renderer, x, y+4, x+4, y+4);    // Middle
+            break;
+        case 'G':
+            SDL_RenderLine(renderer, x+5, y+2, x+2, y);    // Top right
+            SDL_RenderLine(renderer, x+2, y, x, y+2);      // Top left
+            SDL_RenderLine(renderer, x, y+2, x, y+7);      // Left
+            SDL_RenderLine(renderer, x, y+7, x+2, y+9);    // Bottom left
+            SDL_RenderLine(renderer, x+2, y+9, x+5, y+7);  // Bottom right
+            SDL_RenderLine(renderer, x+5, y+7, x+5, y+5);  // Right
+            SDL_RenderLine(renderer, x+5, y+5, x+3, y+5);  // G hook
+            break;
+        case 'H':
+            SDL_RenderLine(renderer, x, y, x, y+9);        // Left vertical
+            SDL_RenderLine(renderer, x+5, y, x+5, y+9);    // Right vertical
+            SDL_RenderLine(renderer, x, y+4, x+5, y+4);    // Middle
+            break;
+        case 'I':
+            SDL_RenderLine(renderer, x+2, y, x+2, y+9);    // Vertical
+            break;
+        case 'L':
+            SDL_RenderLine(renderer, x, y, x, y+9);        // Vertical
+            SDL_RenderLine(renderer, x, y+9, x+5, y+9);    // Bottom
+            break;
+        case 'M':
+            SDL_RenderLine(renderer, x, y, x, y+9);        // Left vertical
+            SDL_RenderLine(renderer, x+5, y, x+5, y+9);    // Right vertical
+            SDL_RenderLine(renderer, x, y, x+2, y+5);      // Left diagonal
+            SDL_RenderLine(renderer, x+5, y, x+3, y+5);    // Right diagonal
+            break;
+        case 'N':
+            SDL_RenderLine(renderer, x, y, x, y+9);        // Left vertical
+            SDL_RenderLine(renderer, x+5, y, x+5, y+9);    // Right vertical
+            SDL_RenderLine(renderer, x, y, x+5, y+9);      // Diagonal
+            break;
+        case 'O':
+            SDL_RenderLine(renderer, x+2, y, x+3, y);      // Top
+            SDL_RenderLine(renderer, x, y+2, x, y+7);      // Left
+            SDL_RenderLine(renderer, x+2, y+9, x+3, y+9);  // Bottom
+            SDL_RenderLine(renderer, x+5, y+2, x+5, y+7);  // Right
+            SDL_RenderLine(renderer, x+2, y, x, y+2);      // Top left
+            SDL_RenderLine(renderer, x+3, y, x+5, y+2);    // Top right
+            SDL_RenderLine(renderer, x, y+7, x+2, y+9);    // Bottom left
+            SDL_RenderLine(renderer, x+5, y+7, x+3, y+9);  // Bottom right
+            break;
+        case 'P':
+            SDL_RenderLine(renderer, x, y, x, y+9);        // Vertical
+            SDL_RenderLine(renderer, x, y, x+3, y);        // Top
+            SDL_RenderLine(renderer, x+3, y, x+5, y+2);    // Top curve
+            SDL_RenderLine(renderer, x+5, y+2, x+3, y+5);  // Bottom curve
+            SDL_RenderLine(renderer, x+3, y+5, x, y+5);    // Bottom
+            break;
+        case 'R':
+            SDL_RenderLine(renderer, x, y, x, y+9);        // Vertical
+            SDL_RenderLine(renderer, x, y, x+3, y);        // Top
+            SDL_RenderLine(renderer, x+3, y, x+5, y+2);    // Top curve
+            SDL_RenderLine(renderer, x+5, y+2, x+3, y+5);  // Bottom curve
+            SDL_RenderLine(renderer, x+3, y+5, x, y+5);    // Middle
+            SDL_RenderLine(renderer, x+2, y+5, x+5, y+9);  // Diagonal
+            break;
+        case 'S':
+            SDL_RenderLine(renderer, x+5, y+2, x+2, y);    // Top right
+            SDL_RenderLine(renderer, x+2, y, x, y+2);      // Top left
+            SDL_RenderLine(renderer, x, y+2, x+2, y+4);    // Middle left
+            SDL_RenderLine(renderer, x+2, y+4, x+3, y+4);  // Middle
+            SDL_RenderLine(renderer, x+3, y+4, x+5, y+6);  // Middle right
+            SDL_RenderLine(renderer, x+5, y+6, x+3, y+9);  // Bottom right
+            SDL_RenderLine(renderer, x+3, y+9, x, y+7);    // Bottom left
+            break;
+        case 'T':
+            SDL_RenderLine(renderer, x, y, x+5, y);        // Top
+            SDL_RenderLine(renderer, x+2, y, x+2, y+9);    // Vertical
+            break;
+        case 'Y':
+            SDL_RenderLine(renderer, x, y, x+2, y+4);      // Left diagonal
+            SDL_RenderLine(renderer, x+5, y, x+3, y+4);    // Right diagonal
+            SDL_RenderLine(renderer, x+2, y+4, x+2, y+9);  // Bottom vertical
+            break;
+        case '0':
+            SDL_RenderLine(renderer, x+2, y, x+3, y);      // Top
+            SDL_RenderLine(renderer, x, y+2, x, y+7);      // Left
+            SDL_RenderLine(renderer, x+2, y+9, x+3, y+9);  // Bottom
+            SDL_RenderLine(renderer, x+5, y+2, x+5, y+7);  // Right
+            SDL_RenderLine(renderer, x+2, y, x, y+2);      // Top left
+            SDL_RenderLine(renderer, x+3, y, x+5, y+2);    // Top right
+            SDL_RenderLine(renderer, x, y+7, x+2, y+9);    // Bottom left
+            SDL_RenderLine(renderer, x+5, y+7, x+3, y+9);  // Bottom right
+            break;
+        case '1':
+            SDL_RenderLine(renderer, x+2, y, x+2, y+9);    // Vertical
+            SDL_RenderLine(renderer, x+1, y+2, x+2, y);    // Diagonal
+            break;
+        case '2':
+            SDL_RenderLine(renderer, x+1, y+1, x+2, y);    // Top left curve
+            SDL_RenderLine(renderer, x+2, y, x+4, y);      // Top
+            SDL_RenderLine(renderer, x+4, y, x+5, y+2);    // Top right curve
+            SDL_RenderLine(renderer, x+5, y+2, x+3, y+5);  // Middle curve
+            SDL_RenderLine(renderer, x+3, y+5, x, y+9);    // Bottom left diagonal
+            SDL_RenderLine(renderer, x, y+9, x+5, y+9);    // Bottom
+            break;
+        case '3':
+            SDL_RenderLine(renderer, x+1, y+1, x+3, y);    // Top left curve
+            SDL_RenderLine(renderer, x+3, y, x+4, y+1);    // Top right curve
+            SDL_RenderLine(renderer, x+4, y+1, x+3, y+4);  // Middle top curve
+            SDL_RenderLine(renderer, x+3, y+4, x+4, y+5);  // Middle bottom curve
+            SDL_RenderLine(renderer, x+4, y+5, x+3, y+8);  // Bottom right curve
+            SDL_RenderLine(renderer, x+3, y+8, x+1, y+9);  // Bottom left curve
+            SDL_RenderLine(renderer, x+2, y+4, x+3, y+4);  // Middle connect
+            break;
+        case '4':
+            SDL_RenderLine(renderer, x+4, y, x+4, y+9);    // Right vertical
+            SDL_RenderLine(renderer, x+4, y, x, y+6);      // Diagonal
+            SDL_RenderLine(renderer, x, y+6, x+5, y+6);    // Horizontal
+            break;
+        case '5':
+            SDL_RenderLine(renderer, x+5, y, x, y);        // Top
+            SDL_RenderLine(renderer, x, y, x, y+4);        // Left vertical
+            SDL_RenderLine(renderer, x, y+4, x+4, y+4);    // Middle
+            SDL_RenderLine(renderer, x+4, y+4, x+5, y+6);  // Middle right curve
+            SDL_RenderLine(renderer, x+5, y+6, x+4, y+9);  // Bottom right curve
+            SDL_RenderLine(renderer, x+4, y+9, x, y+9);    // Bottom
+            break;
+        case '6':
+            SDL_RenderLine(renderer, x+5, y+1, x+3, y);    // Top right curve
+            SDL_RenderLine(renderer, x+3, y, x+1, y+1);    // Top left curve
+            SDL_RenderLine(renderer, x+1, y+1, x, y+3);    // Upper left curve
+            SDL_RenderLine(renderer, x, y+3, x, y+7);      // Left vertical
+            SDL_RenderLine(renderer, x, y+7, x+2, y+9);    // Bottom left curve
+            SDL_RenderLine(renderer, x+2, y+9, x+4, y+8);  // Bottom curve
+            SDL_RenderLine(renderer, x+4, y+8, x+5, y+6);  // Bottom right curve
+            SDL_RenderLine(renderer, x+5, y+6, x+4, y+4);  // Middle right curve
+            SDL_RenderLine(renderer, x+4, y+4, x, y+4);    // Middle
+            break;
+        case '7':
+            SDL_RenderLine(renderer, x, y, x+5, y);        // Top
+            SDL_RenderLine(renderer, x+5, y, x+2, y+9);    // Diagonal
+            break;
+        case '8':
+            SDL_RenderLine(renderer, x+1, y+1, x+2, y);    // Top left curve
+            SDL_RenderLine(renderer, x+2, y, x+3, y);      // Top
+            SDL_RenderLine(renderer, x+3, y, x+4, y+1);    // Top right curve
+            SDL_RenderLine(renderer, x+4, y+1, x+4, y+3);  // Upper right vertical
+            SDL_RenderLine(renderer, x+4, y+3, x+3, y+4);  // Middle top right
+            SDL_RenderLine(renderer, x+3, y+4, x+2, y+4);  // Middle
+            SDL_RenderLine(renderer, x+2, y+4, x+1, y+3);  // Middle top left
+            SDL_RenderLine(renderer, x+1, y+3, x+1, y+1);  // Upper left vertical
+            SDL_RenderLine(renderer, x+1, y+5, x+2, y+4);  // Middle bottom left
+            SDL_RenderLine(renderer, x+2, y+4, x+3, y+4);  // Middle
+            SDL_RenderLine(renderer, x+3, y+4, x+4, y+5);  // Middle bottom right
+            SDL_RenderLine(renderer, x+4, y+5, x+4, y+7);  // Lower right vertical
+            SDL_RenderLine(renderer, x+4, y+7, x+3, y+9);  // Bottom right curve
+            SDL_RenderLine(renderer, x+3, y+9, x+2, y+9);  // Bottom
+            SDL_RenderLine(renderer, x+2, y+9, x+1, y+7);  // Bottom left curve
+            SDL_RenderLine(renderer, x+1, y+7, x+1, y+5);  // Lower left vertical
+            break;
+        case '9':
+            SDL_RenderLine(renderer, x+1, y+1, x+2, y);    // Top left curve
+            SDL_RenderLine(renderer, x+2, y, x+3, y);      // Top
+            SDL_RenderLine(renderer, x+3, y, x+4, y+1);    // Top right curve
+            SDL_RenderLine(renderer, x+4, y+1, x+5, y+3);  // Upper right curve
+            SDL_RenderLine(renderer, x+5, y+3, x+5, y+7);  // Right vertical
+            SDL_RenderLine(renderer, x+5, y+7, x+3, y+9);  // Bottom right curve
+            SDL_RenderLine(renderer, x+3, y+9, x+1, y+8);  // Bottom curve
+            SDL_RenderLine(renderer, x+1, y+1, x, y+3);    // Upper left curve
+            SDL_RenderLine(renderer, x, y+3, x+1, y+5);    // Middle left curve
+            SDL_RenderLine(renderer, x+1, y+5, x+5, y+5);  // Middle
+            break;
+        case ':':
+            SDL_RenderPoint(renderer, x+2, y+2);           // Top dot
+            SDL_RenderPoint(renderer, x+2, y+7);           // Bottom dot
+            break;
+        case ' ':
+            // Space - do nothing
+            break;
+        case '-':
+            SDL_RenderLine(renderer, x, y+4, x+4, y+4);    // Middle
+            break;
+        case '_':
+            SDL_RenderLine(renderer, x, y+9, x+5, y+9);    // Bottom
+            break;
+        case '.':
+            SDL_RenderPoint(renderer, x+2, y+9);           // Dot
+            break;
+        case ',':
+            SDL_RenderLine(renderer, x+2, y+7, x+1, y+9);  // Comma
+            break;
+        case '!':
+            SDL_RenderLine(renderer, x+2, y, x+2, y+6);    // Vertical
+            SDL_RenderPoint(renderer, x+2, y+9);           // Bottom dot
+            break;
+        case '/':
+            SDL_RenderLine(renderer, x+5, y, x, y+9);      // Diagonal
+            break;
+        case '\\':
+            SDL_RenderLine(renderer, x, y, x+5, y+9);      // Diagonal
+            break;
+        case '(':
+            SDL_RenderLine(renderer, x+3, y, x+1, y+4);    // Top curve
+            SDL_RenderLine(renderer, x+1, y+4, x+3, y+9);  // Bottom curve
+            break;
+        case ')':
+            SDL_RenderLine(renderer, x+1, y, x+3, y+4);    // Top curve
+            SDL_RenderLine(renderer, x+3, y+4, x+1, y+9);  // Bottom curve
+            break;
+        case '+':
+            SDL_RenderLine(renderer, x, y+4, x+4, y+4);    // Horizontal
+            SDL_RenderLine(renderer, x+2, y+2, x+2, y+7);  // Vertical
+            break;
+        case '=':
+            SDL_RenderLine(renderer, x, y+3, x+4, y+3);    // Top
+            SDL_RenderLine(renderer, x, y+6, x+4, y+6);    // Bottom
+            break;
+        case '[':
+            SDL_RenderLine(renderer, x+3, y, x+1, y);      // Top
+            SDL_RenderLine(renderer, x+1, y, x+1, y+9);    // Vertical
+            SDL_RenderLine(renderer, x+1, y+9, x+3, y+9);  // Bottom
+            break;
+        case ']':
+            SDL_RenderLine(renderer, x+1, y, x+3, y);      // Top
+            SDL_RenderLine(renderer, x+3, y, x+3, y+9);    // Vertical
+            SDL_RenderLine(renderer, x+3, y+9, x+1, y+9);  // Bottom
+            break;
+        case '{':
+            SDL_RenderLine(renderer, x+3, y, x+2, y+1);    // Top curve
+            SDL_RenderLine(renderer, x+2, y+1, x+2, y+3);  // Upper vertical
+            SDL_RenderLine(renderer, x+2, y+3, x+1, y+4);  // Middle top curve
+            SDL_RenderLine(renderer, x+1, y+4, x+2, y+5);  // Middle bottom curve
+            SDL_RenderLine(renderer, x+2, y+5, x+2, y+8);  // Lower vertical
+            SDL_RenderLine(renderer, x+2, y+8, x+3, y+9);  // Bottom curve
+            break;
+        case '}':
+            SDL_RenderLine(renderer, x+1, y, x+2, y+1);    // Top curve
+            SDL_RenderLine(renderer, x+2, y+1, x+2, y+3);  // Upper vertical
+            SDL_RenderLine(renderer, x+2, y+3, x+3, y+4);  // Middle top curve
+            SDL_RenderLine(renderer, x+3, y+4, x+2, y+5);  // Middle bottom curve
+            SDL_RenderLine(renderer, x+2, y+5, x+2, y+8);  // Lower vertical
+            SDL_RenderLine(renderer, x+2, y+8, x+1, y+9);  // Bottom curve
+            break;
+        case '>':
+            SDL_RenderLine(renderer, x, y+2, x+3, y+4);    // Top
+            SDL_RenderLine(renderer, x+3, y+4, x, y+7);    // Bottom
+            break;
+        case '<':
+            SDL_RenderLine(renderer, x+3, y+2, x, y+4);    // Top
+            SDL_RenderLine(renderer, x, y+4, x+3, y+7);    // Bottom
+            break;
+        case '\'':
+            SDL_RenderLine(renderer, x+2, y, x+2, y+2);    // Quote
+            break;
+        case '"':
+            SDL_RenderLine(renderer, x+1, y, x+1, y+2);    // Left quote
+            SDL_RenderLine(renderer, x+3, y, x+3, y+2);    // Right quote
+            break;
+        case '`':
+            SDL_RenderLine(renderer, x+1, y, x+2, y+2);    // Backtick
+            break;
+        case '~':
+            SDL_RenderLine(renderer, x, y+4, x+2, y+3);    // Left curve
+            SDL_RenderLine(renderer, x+2, y+3, x+4, y+5);  // Right curve
+            break;
+        case '@':
+            SDL_RenderLine(renderer, x+3, y, x+1, y+2);    // Top left curve
+            SDL_RenderLine(renderer, x+1, y+2, x+1, y+7);  // Left vertical
+            SDL_RenderLine(renderer, x+1, y+7, x+3, y+9);  // Bottom left curve
+            SDL_RenderLine(renderer, x+3, y+9, x+5, y+7);  // Bottom right curve
+            SDL_RenderLine(renderer, x+5, y+7, x+5, y+2);  // Right vertical
+            SDL_RenderLine(renderer, x+5, y+2, x+3, y);    // Top right curve
+            SDL_RenderLine(renderer, x+3, y+5, x+3, y+7);  // Inner vertical
+            SDL_RenderLine(renderer, x+3, y+7, x+4, y+7);  // Inner horizontal
+            SDL_RenderLine(renderer, x+4, y+7, x+5, y+5);  // Inner curve
+            break;
+        case '#':
+            SDL_RenderLine(renderer, x+1, y+1, x+1, y+8);  // Left vertical
+            SDL_RenderLine(renderer, x+4, y+1, x+4, y+8);  // Right vertical
+            SDL_RenderLine(renderer, x, y+3, x+5, y+3);    // Top horizontal
+            SDL_RenderLine(renderer, x, y+6, x+5, y+6);    // Bottom horizontal
+            break;
+        case '$':
+            SDL_RenderLine(renderer, x+2, y, x+2, y+9);    // Middle vertical
+            SDL_RenderLine(renderer, x+4, y+1, x+2, y+1);  // Top right
+            SDL_RenderLine(renderer, x+2, y+1, x, y+3);    // Top left curve
+            SDL_RenderLine(renderer, x, y+3, x+2, y+5);    // Middle left curve
+            SDL_RenderLine(renderer, x+2, y+5, x+4, y+5);  // Middle
+            SDL_RenderLine(renderer, x+4, y+5, x+5, y+7);  // Bottom right curve
+            SDL_RenderLine(renderer, x+5, y+7, x+3, y+9);  // Bottom curve
+            break;
+        case '%':
+            SDL_RenderLine(renderer, x+5, y, x, y+9);      // Main diagonal
+            SDL_RenderPoint(renderer, x+1, y+2);           // Top circle
+            SDL_RenderPoint(renderer, x+4, y+7);           // Bottom circle
+            break;
+        case '^':
+            SDL_RenderLine(renderer, x+1, y+3, x+2, y);    // Left diagonal
+            SDL_RenderLine(renderer, x+2, y, x+3, y+3);    // Right diagonal
+            break;
+        case '&':
+            SDL_RenderLine(renderer, x+4, y+1, x+2, y);    // Top right
+            SDL_RenderLine(renderer, x+2, y, x, y+2);      // Top left curve
+            SDL_RenderLine(renderer, x, y+2, x+2, y+4);    // Middle left curve
+            SDL_RenderLine(renderer, x+2, y+4, x, y+7);    // Middle right curve
+            SDL_RenderLine(renderer, x, y+7, x+2, y+9);    // Bottom left curve
+            SDL_RenderLine(renderer, x+2, y+9, x+4, y+7);  // Bottom right curve
+            SDL_RenderLine(renderer, x+4, y+7, x+5, y+9);  // Bottom right diagonal
+            break;
+        case '*':
+            SDL_RenderLine(renderer, x+2, y+2, x+2, y+7);  // Vertical
+            SDL_RenderLine(renderer, x, y+4, x+4, y+4);    // Horizontal
+            SDL_RenderLine(renderer, x+1, y+2, x+3, y+7);  // Diagonal 1
+            SDL_RenderLine(renderer, x+3, y+2, x+1, y+7);  // Diagonal 2
+            break;
+        default:
+            // For unknown characters, draw a rectangle
+            SDL_FRect charBox = {
+                static_cast<float>(x), static_cast<float>(y),
+                5.0f, 9.0f
+            };
+            SDL_RenderRect(renderer, &charBox);
+            break;
+    }
+}
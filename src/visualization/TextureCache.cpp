@@ -0,0 +1,225 @@
+// FILE: src/visualization/TextureCache.cpp
+#include "visualization/TextureCache.h"
+#include "utils/DebugLogger.h"
+#include "utils/StreamCodec.h"
+
+#include <cstring>
+#include <fstream>
+
+namespace {
+    // File layout: header, then per entry a small descriptor followed
+    // by one StreamCodec frame of pixel data
+    struct FileHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t entryCount;
+        uint32_t pad;
+    };
+
+    struct EntryHeader {
+        uint32_t keyLength;
+        int32_t width;
+        int32_t height;
+        uint32_t pad;
+    };
+}
+
+TextureCache::TextureCache()
+    : dirty(false) {
+}
+
+TextureCache::~TextureCache() {
+    save();
+}
+
+void TextureCache::open(const std::string& path) {
+    filePath = path;
+    entries.clear();
+    dirty = false;
+
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return; // First launch (or cleared cache); everything bakes
+    }
+
+    std::vector<char> data(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(data.data(), static_cast<std::streamsize>(data.size()));
+    file.close();
+
+    FileHeader header;
+    if (data.size() < sizeof(header)) {
+        return;
+    }
+    std::memcpy(&header, data.data(), sizeof(header));
+    if (header.magic != MAGIC || header.version != VERSION) {
+        DebugLogger::log("TextureCache: discarding incompatible cache " + path);
+        return;
+    }
+
+    size_t offset = sizeof(header);
+    for (uint32_t i = 0; i < header.entryCount; i++) {
+        EntryHeader entryHeader;
+        if (offset + sizeof(entryHeader) > data.size()) {
+            break;
+        }
+        std::memcpy(&entryHeader, data.data() + offset, sizeof(entryHeader));
+        offset += sizeof(entryHeader);
+
+        if (offset + entryHeader.keyLength > data.size() ||
+            entryHeader.width <= 0 || entryHeader.height <= 0) {
+            break;
+        }
+
+        Entry entry;
+        entry.key.assign(data.data() + offset, entryHeader.keyLength);
+        entry.width = entryHeader.width;
+        entry.height = entryHeader.height;
+        offset += entryHeader.keyLength;
+
+        size_t frameBytes = 0;
+        if (!StreamCodec::readFrame(data.data() + offset,
+                                    data.size() - offset,
+                                    entry.pixels, frameBytes) ||
+            entry.pixels.size() !=
+                static_cast<size_t>(entry.width) * entry.height * 4) {
+            break; // Truncated/corrupt tail; keep what parsed cleanly
+        }
+        offset += frameBytes;
+
+        entries.push_back(std::move(entry));
+    }
+
+    DebugLogger::log("TextureCache: loaded " + std::to_string(entries.size()) +
+                     " cached textures from " + path);
+}
+
+SDL_Texture* TextureCache::load(SDL_Renderer* renderer, const std::string& key,
+                                int width, int height) {
+    Entry* entry = find(key);
+    if (!entry || entry->width != width || entry->height != height) {
+        return nullptr;
+    }
+
+    SDL_Texture* texture = SDL_CreateTexture(renderer,
+                                             SDL_PIXELFORMAT_RGBA8888,
+                                             SDL_TEXTUREACCESS_STATIC,
+                                             width, height);
+    if (!texture) {
+        return nullptr;
+    }
+
+    if (!SDL_UpdateTexture(texture, NULL, entry->pixels.data(), width * 4)) {
+        SDL_DestroyTexture(texture);
+        return nullptr;
+    }
+
+    return texture;
+}
+
+bool TextureCache::store(SDL_Renderer* renderer, SDL_Texture* texture,
+                         const std::string& key) {
+    if (!texture) {
+        return false;
+    }
+
+    // Read the baked pixels back through the render target (the only
+    // path SDL offers for a TARGET texture); one-time cost at bake
+    SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+    SDL_SetRenderTarget(renderer, texture);
+    SDL_Surface* readback = SDL_RenderReadPixels(renderer, NULL);
+    SDL_SetRenderTarget(renderer, previousTarget);
+    if (!readback) {
+        DebugLogger::log("TextureCache: readback failed for '" + key + "': " +
+                         std::string(SDL_GetError()),
+                       DebugLogger::LogLevel::WARNING);
+        return false;
+    }
+
+    SDL_Surface* rgba = readback;
+    if (readback->format != SDL_PIXELFORMAT_RGBA8888) {
+        rgba = SDL_ConvertSurface(readback, SDL_PIXELFORMAT_RGBA8888);
+        if (!rgba) {
+            SDL_DestroySurface(readback);
+            return false;
+        }
+    }
+
+    Entry* entry = find(key);
+    if (!entry) {
+        entries.emplace_back();
+        entry = &entries.back();
+        entry->key = key;
+    }
+    entry->width = rgba->w;
+    entry->height = rgba->h;
+    entry->pixels.resize(static_cast<size_t>(rgba->w) * rgba->h * 4);
+
+    // Row-wise copy: the surface pitch may exceed width*4
+    const char* src = static_cast<const char*>(rgba->pixels);
+    for (int row = 0; row < rgba->h; row++) {
+        std::memcpy(entry->pixels.data() +
+                        static_cast<size_t>(row) * rgba->w * 4,
+                    src + static_cast<size_t>(row) * rgba->pitch,
+                    static_cast<size_t>(rgba->w) * 4);
+    }
+
+    if (rgba != readback) {
+        SDL_DestroySurface(rgba);
+    }
+    SDL_DestroySurface(readback);
+
+    dirty = true;
+    return true;
+}
+
+void TextureCache::save() {
+    if (!dirty || filePath.empty()) {
+        return;
+    }
+
+    std::vector<char> out;
+    FileHeader header;
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.entryCount = static_cast<uint32_t>(entries.size());
+    header.pad = 0;
+    out.insert(out.end(), reinterpret_cast<const char*>(&header),
+               reinterpret_cast<const char*>(&header) + sizeof(header));
+
+    for (const Entry& entry : entries) {
+        EntryHeader entryHeader;
+        entryHeader.keyLength = static_cast<uint32_t>(entry.key.size());
+        entryHeader.width = entry.width;
+        entryHeader.height = entry.height;
+        entryHeader.pad = 0;
+        out.insert(out.end(), reinterpret_cast<const char*>(&entryHeader),
+                   reinterpret_cast<const char*>(&entryHeader) +
+                       sizeof(entryHeader));
+        out.insert(out.end(), entry.key.begin(), entry.key.end());
+        StreamCodec::appendFrame(entry.pixels.data(), entry.pixels.size(), out);
+    }
+
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        DebugLogger::log("TextureCache: failed to write " + filePath,
+                       DebugLogger::LogLevel::WARNING);
+        return;
+    }
+    file.write(out.data(), static_cast<std::streamsize>(out.size()));
+    file.close();
+    dirty = false;
+
+    DebugLogger::log("TextureCache: saved " + std::to_string(entries.size()) +
+                     " textures (" + std::to_string(out.size() / 1024) +
+                     " KB) to " + filePath);
+}
+
+TextureCache::Entry* TextureCache::find(const std::string& key) {
+    for (Entry& entry : entries) {
+        if (entry.key == key) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
@@ -0,0 +1,265 @@
+// FILE: src/visualization/VehicleSpriteAtlas.cpp
+#include "visualization/VehicleSpriteAtlas.h"
+#include "visualization/TextureCache.h"
+#include "utils/DebugLogger.h"
+
+#include <cmath>
+
+namespace {
+
+// The same body palette Vehicle::render() uses for the primitive path;
+// rows 0..11 are lane slots A1..D3, then default and the two emergency
+// flash phases
+const SDL_Color BODY_COLORS[VehicleSpriteAtlas::VARIANT_COUNT] = {
+    {30, 144, 255, 255},  // A1 Dodger Blue
+    {255, 140, 0, 255},   // A2 Orange (priority)
+    {50, 205, 50, 255},   // A3 Lime Green (free)
+    {75, 0, 130, 255},    // B1 Indigo
+    {218, 165, 32, 255},  // B2 Goldenrod
+    {34, 139, 34, 255},   // B3 Forest Green (free)
+    {70, 130, 180, 255},  // C1 Steel Blue
+    {210, 105, 30, 255},  // C2 Chocolate
+    {60, 179, 113, 255},  // C3 Medium Sea Green (free)
+    {138, 43, 226, 255},  // D1 Blue Violet
+    {205, 133, 63, 255},  // D2 Peru
+    {46, 139, 87, 255},   // D3 Sea Green (free)
+    {150, 150, 150, 255}, // Default grey
+    {255, 0, 0, 255},     // Emergency, flash on
+    {180, 0, 0, 255},     // Emergency, flash off
+};
+
+void setColor(SDL_Renderer* renderer, SDL_Color c) {
+    SDL_SetRenderDrawColor(renderer, c.r, c.g, c.b, c.a);
+}
+
+} // namespace
+
+VehicleSpriteAtlas::VehicleSpriteAtlas()
+    : atlas(nullptr),
+      atlasW(0.0f),
+      atlasH(0.0f),
+      spriteCount(0) {
+    vertices.reserve(1024);
+    indices.reserve(1536);
+}
+
+VehicleSpriteAtlas::~VehicleSpriteAtlas() {
+    shutdown();
+}
+
+int VehicleSpriteAtlas::bodyVariant(char lane, int laneNumber, bool emergency,
+                                    bool flashPhase) {
+    if (emergency) {
+        return flashPhase ? VARIANT_EMERGENCY_BRIGHT : VARIANT_EMERGENCY_DARK;
+    }
+    int road = lane - 'A';
+    int num = laneNumber - 1;
+    if (road < 0 || road > 3 || num < 0 || num > 2) {
+        return VARIANT_DEFAULT;
+    }
+    return road * 3 + num;
+}
+
+bool VehicleSpriteAtlas::build(SDL_Renderer* renderer, TextureCache* cache) {
+    if (atlas) {
+        return true;
+    }
+
+    const int width = CELL_W * 3;             // One column per destination
+    const int height = CELL_H * VARIANT_COUNT;
+
+    // A cached bake from a previous launch skips the primitive drawing
+    if (cache) {
+        atlas = cache->load(renderer, "vehicle_atlas", width, height);
+        if (atlas) {
+            atlasW = static_cast<float>(width);
+            atlasH = static_cast<float>(height);
+            SDL_SetTextureBlendMode(atlas, SDL_BLENDMODE_BLEND);
+            SDL_SetTextureScaleMode(atlas, SDL_SCALEMODE_LINEAR);
+            DebugLogger::log("Vehicle sprite atlas restored from cache");
+            return true;
+        }
+    }
+
+    atlas = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
+                              SDL_TEXTUREACCESS_TARGET, width, height);
+    if (!atlas) {
+        DebugLogger::log("Vehicle sprite atlas unavailable; keeping the "
+                         "primitive path", DebugLogger::LogLevel::WARNING);
+        return false;
+    }
+    atlasW = static_cast<float>(width);
+    atlasH = static_cast<float>(height);
+
+    SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+    SDL_SetRenderTarget(renderer, atlas);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+
+    for (int variant = 0; variant < VARIANT_COUNT; variant++) {
+        for (int column = 0; column < 3; column++) {
+            bakeCell(renderer, variant, column);
+        }
+    }
+
+    SDL_SetRenderTarget(renderer, previousTarget);
+
+    if (cache) {
+        cache->store(renderer, atlas, "vehicle_atlas");
+    }
+
+    SDL_SetTextureBlendMode(atlas, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureScaleMode(atlas, SDL_SCALEMODE_LINEAR);
+
+    DebugLogger::log("Vehicle sprite atlas baked: " +
+                     std::to_string(VARIANT_COUNT * 3) + " variants");
+    return true;
+}
+
+void VehicleSpriteAtlas::bakeCell(SDL_Renderer* renderer, int variant,
+                                  int destinationColumn) {
+    // Cell origin plus the gutter; everything below is the primitive
+    // recipe from Vehicle::render() at 2x, facing DOWN
+    const float x = static_cast<float>(destinationColumn * CELL_W + 2);
+    const float y = static_cast<float>(variant * CELL_H + 2);
+    const float w = SPRITE_W * SCALE;
+    const float h = SPRITE_H * SCALE;
+
+    SDL_Color color = BODY_COLORS[variant];
+
+    // Body
+    setColor(renderer, color);
+    SDL_FRect body = {x, y, w, h};
+    SDL_RenderFillRect(renderer, &body);
+
+    // Shadow edge (right 40%) and highlight edge (left 30%)
+    SDL_Color shadow = {static_cast<Uint8>(color.r * 0.7f),
+                        static_cast<Uint8>(color.g * 0.7f),
+                        static_cast<Uint8>(color.b * 0.7f), color.a};
+    setColor(renderer, shadow);
+    SDL_FRect shadowEdge = {x + w * 0.6f, y, w * 0.4f, h};
+    SDL_RenderFillRect(renderer, &shadowEdge);
+
+    SDL_Color highlight = {static_cast<Uint8>(SDL_min(255, color.r + 40)),
+                           static_cast<Uint8>(SDL_min(255, color.g + 40)),
+                           static_cast<Uint8>(SDL_min(255, color.b + 40)),
+                           color.a};
+    setColor(renderer, highlight);
+    SDL_FRect highlightEdge = {x, y, w * 0.3f, h};
+    SDL_RenderFillRect(renderer, &highlightEdge);
+
+    // Border
+    setColor(renderer, {0, 0, 0, 255});
+    SDL_RenderRect(renderer, &body);
+
+    // Destination indicator (column 0 = STRAIGHT, 1 = LEFT, 2 = RIGHT)
+    setColor(renderer, {255, 255, 0, 255});
+    if (destinationColumn == 1) {
+        // Left arrow on the left flank plus the "L" symbol
+        const float arrowSize = 8.0f * SCALE;
+        SDL_Vertex arrow[3] = {};
+        arrow[0].position = {x, y + h / 3};
+        arrow[1].position = {x + arrowSize, y + h / 3 - arrowSize / 2};
+        arrow[2].position = {x + arrowSize, y + h / 3 + arrowSize / 2};
+        for (auto& v : arrow) {
+            v.color = {1.0f, 1.0f, 0.0f, 1.0f};
+        }
+        SDL_RenderGeometry(renderer, nullptr, arrow, 3, nullptr, 0);
+
+        const float symbolSize = 6.0f * SCALE;
+        const float cx = x + w / 2;
+        const float cy = y + h / 2;
+        SDL_RenderLine(renderer, cx - symbolSize / 2, cy - symbolSize / 2,
+                       cx - symbolSize / 2, cy + symbolSize / 2);
+        SDL_RenderLine(renderer, cx - symbolSize / 2, cy + symbolSize / 2,
+                       cx + symbolSize / 2, cy + symbolSize / 2);
+    } else if (destinationColumn == 0) {
+        // Straight: double parallel lines down the middle
+        const float lineWidth = 2.5f * SCALE;
+        SDL_FRect line1 = {x + w / 2 - lineWidth * 1.5f, y + h / 4,
+                           lineWidth, h / 2};
+        SDL_FRect line2 = {x + w / 2 + lineWidth * 0.5f, y + h / 4,
+                           lineWidth, h / 2};
+        SDL_RenderFillRect(renderer, &line1);
+        SDL_RenderFillRect(renderer, &line2);
+    }
+    // Column 2 (RIGHT) carries no indicator, as in the primitive path
+}
+
+void VehicleSpriteAtlas::begin() {
+    // Persistent-buffer scheme: the vertex and index arrays are never
+    // cleared. Quads all share one index pattern, so the index ladder
+    // is extended once at the high-water mark and reused verbatim every
+    // frame after; vertices are overwritten in place per sprite. A
+    // frame's per-vehicle cost is exactly the four-vertex instance
+    // update - no destruction, no reallocation, no index rebuild.
+    spriteCount = 0;
+}
+
+void VehicleSpriteAtlas::pushSprite(int variant, int destinationColumn,
+                                    float cx, float cy, float w, float h,
+                                    float angleDegrees) {
+    // Cell UVs, inset past the gutter
+    const float u0 = (destinationColumn * CELL_W + 2) / atlasW;
+    const float v0 = (variant * CELL_H + 2) / atlasH;
+    const float u1 = u0 + (SPRITE_W * SCALE) / atlasW;
+    const float v1 = v0 + (SPRITE_H * SCALE) / atlasH;
+
+    const float radians = angleDegrees * (static_cast<float>(M_PI) / 180.0f);
+    const float cosA = std::cos(radians);
+    const float sinA = std::sin(radians);
+    const float hw = w / 2.0f;
+    const float hh = h / 2.0f;
+
+    // Corner order: top-left, top-right, bottom-right, bottom-left in
+    // sprite space, rotated about the center
+    const SDL_FPoint local[4] = {
+        {-hw, -hh}, {hw, -hh}, {hw, hh}, {-hw, hh}
+    };
+    const SDL_FPoint uv[4] = {
+        {u0, v0}, {u1, v0}, {u1, v1}, {u0, v1}
+    };
+
+    // Grow the persistent buffers only past the high-water mark; the
+    // index ladder laid down then is correct forever
+    const size_t base = spriteCount * 4;
+    if (vertices.size() < base + 4) {
+        vertices.resize(base + 4);
+        const int b = static_cast<int>(base);
+        indices.push_back(b);
+        indices.push_back(b + 1);
+        indices.push_back(b + 2);
+        indices.push_back(b);
+        indices.push_back(b + 2);
+        indices.push_back(b + 3);
+    }
+
+    for (int i = 0; i < 4; i++) {
+        SDL_Vertex& v = vertices[base + i];
+        v.position = {cx + local[i].x * cosA - local[i].y * sinA,
+                      cy + local[i].x * sinA + local[i].y * cosA};
+        v.color = {1.0f, 1.0f, 1.0f, 1.0f};
+        v.tex_coord = uv[i];
+    }
+
+    spriteCount++;
+}
+
+void VehicleSpriteAtlas::flush(SDL_Renderer* renderer) {
+    if (spriteCount == 0) {
+        return;
+    }
+
+    // Only this frame's live range is submitted; stale tail entries
+    // past spriteCount are never read
+    SDL_RenderGeometry(renderer, atlas, vertices.data(),
+                       static_cast<int>(spriteCount * 4), indices.data(),
+                       static_cast<int>(spriteCount * 6));
+}
+
+void VehicleSpriteAtlas::shutdown() {
+    if (atlas) {
+        SDL_DestroyTexture(atlas);
+        atlas = nullptr;
+    }
+}